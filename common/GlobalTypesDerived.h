@@ -75,7 +75,9 @@ using MatrixFloat64_3d = Eigen::Matrix<float64, 3, 3>; ///< Alias for 3x3 square
 using MatrixFloat64_4d = Eigen::Matrix<float64, 4, 4>; ///< Alias for 4x4 square matrices of 64-bit floating point values.
 
 // matrices
-using MatrixFloat64_3x4 = Eigen::Matrix<float64, 3, 4>; ///< Alias for 3x4 matrices of 64 bit floating point values.
+using MatrixFloat32_2xX = Eigen::Matrix<float32, 2, Eigen::Dynamic>; ///< Alias for 2xX matrices of 32 bit floating point values.
+using MatrixFloat64_2xX = Eigen::Matrix<float64, 2, Eigen::Dynamic>; ///< Alias for 2xX matrices of 64 bit floating point values.
+using MatrixFloat64_3x4 = Eigen::Matrix<float64, 3, 4>;              ///< Alias for 3x4 matrices of 64 bit floating point values.
 
 // lists of general matrices
 using ListMatrixFloat64 = std::vector<MatrixFloat64, Eigen::aligned_allocator<MatrixFloat64>>; ///< Alias for lists containing general matrices of 64-bit floating point values.
@@ -84,6 +86,8 @@ using ListMatrixUInt64  = std::vector<MatrixUInt64, Eigen::aligned_allocator<Mat
 using ListMatrixBoolean = std::vector<MatrixBoolean, Eigen::aligned_allocator<MatrixBoolean>>; ///< Alias for lists containing general matrices of boolean values.
 
 // lists of matrices
-using ListMatrixFloat64_4d = std::vector<MatrixFloat64_4d, Eigen::aligned_allocator<MatrixFloat64_4d>>; ///< Alias for lists containing 4x4 square matrices of 64-bit floating point values.
+using ListMatrixFloat32_2xX = std::vector<MatrixFloat32_2xX, Eigen::aligned_allocator<MatrixFloat32_2xX>>; ///< Alias for lists containing 2xX matrices of 32-bit floating point values.
+using ListMatrixFloat64_2xX = std::vector<MatrixFloat64_2xX, Eigen::aligned_allocator<MatrixFloat64_2xX>>; ///< Alias for lists containing 2xX matrices of 64-bit floating point values.
+using ListMatrixFloat64_4d  = std::vector<MatrixFloat64_4d, Eigen::aligned_allocator<MatrixFloat64_4d>>;   ///< Alias for lists containing 4x4 square matrices of 64-bit floating point values.
 
 #endif // GLOBALTYPESDERIVED_H
@@ -0,0 +1,299 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file BatchRunner.cpp
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "BatchRunner.h"
+
+BatchRunner::BatchRunner(const std::function<std::unique_ptr<DatasetReaderBase>(const std::string&)>& ReaderFactory,
+                         const uint64                                                                 NumberOfWorkers,
+                         const boolean                                                                PinWorkers) :
+    m_ReaderFactory{ReaderFactory},
+    m_NumberOfWorkers{NumberOfWorkers},
+    m_PinWorkers{PinWorkers},
+    m_NextShardIndex{0U},
+    m_ElapsedTime{0.0}
+{
+    if(!m_ReaderFactory)
+    {
+        throw std::invalid_argument("The reader factory must not be empty.");
+    }
+
+    // use one worker per hardware thread by default
+    if(m_NumberOfWorkers == 0U)
+    {
+        m_NumberOfWorkers = std::max(static_cast<uint64>(std::thread::hardware_concurrency()), static_cast<uint64>(1U));
+    }
+}
+
+BatchRunner::~BatchRunner()
+{
+}
+
+uint64 BatchRunner::AddSequence(const std::string& SequenceName,
+                                const uint64       NumberOfShards)
+{
+    // the range of frames of each part is determined on the worker
+    const uint64 NumberOfShardsUsed{std::max(NumberOfShards, static_cast<uint64>(1U))};
+
+    for(uint64 i_Shard{0U}; i_Shard < NumberOfShardsUsed; i_Shard++)
+    {
+        const uint64 ShardIndex{AddShard(SequenceName)};
+
+        m_Shards[ShardIndex].PartIndex     = i_Shard;
+        m_Shards[ShardIndex].NumberOfParts = NumberOfShardsUsed;
+    }
+
+    return NumberOfShardsUsed;
+}
+
+uint64 BatchRunner::AddShard(const std::string& SequenceName,
+                             const uint64       FirstFrameIndex,
+                             const uint64       NumberOfFrames)
+{
+    BatchShard Shard;
+
+    Shard.ShardIndex      = m_Shards.size();
+    Shard.SequenceName    = SequenceName;
+    Shard.FirstFrameIndex = FirstFrameIndex;
+    Shard.NumberOfFrames  = NumberOfFrames;
+
+    m_Shards.push_back(Shard);
+
+    return Shard.ShardIndex;
+}
+
+float64 BatchRunner::GetElapsedTime() const
+{
+    return m_ElapsedTime;
+}
+
+uint64 BatchRunner::GetNumberOfFailedShards() const
+{
+    return static_cast<uint64>(std::count_if(m_ShardResults.begin(), m_ShardResults.end(), [](const ShardResult& Result) { return !Result.IsSuccessful; }));
+}
+
+uint64 BatchRunner::GetNumberOfFramesProcessed() const
+{
+    uint64 NumberOfFramesProcessed{0U};
+
+    for(const ShardResult& Result : m_ShardResults)
+    {
+        NumberOfFramesProcessed += Result.NumberOfFramesProcessed;
+    }
+
+    return NumberOfFramesProcessed;
+}
+
+uint64 BatchRunner::GetNumberOfShards() const
+{
+    return m_Shards.size();
+}
+
+uint64 BatchRunner::GetNumberOfWorkers() const
+{
+    return m_NumberOfWorkers;
+}
+
+const std::vector<ShardResult>& BatchRunner::GetShardResults() const
+{
+    return m_ShardResults;
+}
+
+float64 BatchRunner::GetTotalProcessingTime() const
+{
+    float64 TotalProcessingTime{0.0};
+
+    for(const ShardResult& Result : m_ShardResults)
+    {
+        TotalProcessingTime += Result.ReaderSetupTime + Result.ProcessingTime;
+    }
+
+    return TotalProcessingTime;
+}
+
+void BatchRunner::Run(const std::function<uint64(DatasetReaderBase&, const BatchShard&)>& Processor)
+{
+    const std::chrono::steady_clock::time_point RunStartTime{std::chrono::steady_clock::now()};
+
+    // each worker writes to the results of its shards only
+    m_ShardResults.assign(m_Shards.size(), ShardResult());
+    m_NextShardIndex = 0U;
+
+    // no more workers than shards are started
+    const uint64 NumberOfWorkersUsed{std::min(m_NumberOfWorkers, static_cast<uint64>(m_Shards.size()))};
+
+    std::vector<std::thread> WorkerThreads;
+
+    WorkerThreads.reserve(NumberOfWorkersUsed);
+
+    for(uint64 i_Worker{0U}; i_Worker < NumberOfWorkersUsed; i_Worker++)
+    {
+        WorkerThreads.emplace_back(&BatchRunner::RunWorker, this, std::cref(Processor), i_Worker);
+    }
+
+    for(std::thread& WorkerThread : WorkerThreads)
+    {
+        WorkerThread.join();
+    }
+
+    m_ElapsedTime = std::chrono::duration<float64, std::milli>(std::chrono::steady_clock::now() - RunStartTime).count();
+}
+
+void BatchRunner::DetermineFrameRange(const uint64 NumberOfFramesSequence,
+                                      BatchShard&  Shard)
+{
+    // split the frames of the sequence evenly (the first parts get one frame more)
+    if(Shard.NumberOfParts > 1U)
+    {
+        const uint64 NumberOfFramesPerPart{NumberOfFramesSequence / Shard.NumberOfParts};
+        const uint64 NumberOfRemainingFrames{NumberOfFramesSequence % Shard.NumberOfParts};
+
+        Shard.FirstFrameIndex = (Shard.PartIndex * NumberOfFramesPerPart) + std::min(Shard.PartIndex, NumberOfRemainingFrames);
+        Shard.NumberOfFrames  = NumberOfFramesPerPart + ((Shard.PartIndex < NumberOfRemainingFrames) ? 1U : 0U);
+    }
+
+    // clamp the range of frames to the end of the sequence
+    Shard.FirstFrameIndex = std::min(Shard.FirstFrameIndex, NumberOfFramesSequence);
+    Shard.NumberOfFrames  = std::min(Shard.NumberOfFrames, NumberOfFramesSequence - Shard.FirstFrameIndex);
+}
+
+boolean BatchRunner::PinThreadToCPU(const uint64 CPUIndex)
+{
+    // get the CPUs the process is allowed to run on
+    cpu_set_t AllowedCPUs;
+
+    CPU_ZERO(&AllowedCPUs);
+
+    if(sched_getaffinity(0, sizeof(cpu_set_t), &AllowedCPUs) != 0)
+    {
+        return false;
+    }
+
+    const uint64 NumberOfAllowedCPUs{static_cast<uint64>(CPU_COUNT(&AllowedCPUs))};
+
+    if(NumberOfAllowedCPUs == 0U)
+    {
+        return false;
+    }
+
+    // find the allowed CPU with the provided index (round-robin)
+    uint64 AllowedCPUIndex{CPUIndex % NumberOfAllowedCPUs};
+
+    for(sint32 i_CPU{0}; i_CPU < CPU_SETSIZE; i_CPU++)
+    {
+        if(!CPU_ISSET(i_CPU, &AllowedCPUs))
+        {
+            continue;
+        }
+
+        if(AllowedCPUIndex > 0U)
+        {
+            AllowedCPUIndex--;
+            continue;
+        }
+
+        cpu_set_t CPUSet;
+
+        CPU_ZERO(&CPUSet);
+        CPU_SET(i_CPU, &CPUSet);
+
+        return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &CPUSet) == 0;
+    }
+
+    return false;
+}
+
+void BatchRunner::ProcessShard(const std::function<uint64(DatasetReaderBase&, const BatchShard&)>& Processor,
+                               const uint64                                                        ShardIndex,
+                               const uint64                                                        WorkerIndex)
+{
+    ShardResult& Result{m_ShardResults[ShardIndex]};
+
+    Result.Shard       = m_Shards[ShardIndex];
+    Result.WorkerIndex = WorkerIndex;
+
+    try
+    {
+        // create an independent dataset reader for the shard
+        const std::chrono::steady_clock::time_point SetupStartTime{std::chrono::steady_clock::now()};
+
+        const std::unique_ptr<DatasetReaderBase> Reader{m_ReaderFactory(Result.Shard.SequenceName)};
+
+        Result.ReaderSetupTime = std::chrono::duration<float64, std::milli>(std::chrono::steady_clock::now() - SetupStartTime).count();
+
+        if(Reader == nullptr)
+        {
+            throw std::runtime_error("No dataset reader was created for the sequence " + Result.Shard.SequenceName + ".");
+        }
+
+        DetermineFrameRange(Reader->GetNumberOfFrames(), Result.Shard);
+
+        // process the shard
+        const std::chrono::steady_clock::time_point ProcessingStartTime{std::chrono::steady_clock::now()};
+
+        Result.NumberOfFramesProcessed = Processor(*Reader, Result.Shard);
+        Result.ProcessingTime          = std::chrono::duration<float64, std::milli>(std::chrono::steady_clock::now() - ProcessingStartTime).count();
+        Result.IsSuccessful            = true;
+    }
+    catch(const std::exception& Exception)
+    {
+        Result.ErrorMessage = Exception.what();
+    }
+    catch(...)
+    {
+        Result.ErrorMessage = "Unknown exception.";
+    }
+}
+
+void BatchRunner::RunWorker(const std::function<uint64(DatasetReaderBase&, const BatchShard&)>& Processor,
+                            const uint64                                                        WorkerIndex)
+{
+    // pin the worker to a CPU (the worker keeps running unpinned if this fails)
+    if(m_PinWorkers)
+    {
+        PinThreadToCPU(WorkerIndex);
+    }
+
+    // take shards until all of them are processed
+    while(true)
+    {
+        const uint64 ShardIndex{m_NextShardIndex.fetch_add(1U)};
+
+        if(ShardIndex >= m_Shards.size())
+        {
+            break;
+        }
+
+        ProcessShard(Processor, ShardIndex, WorkerIndex);
+    }
+}
@@ -0,0 +1,245 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file BatchRunner.h
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#ifndef BATCHRUNNER_H
+#define BATCHRUNNER_H
+
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "DatasetReaderBase.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// \struct BatchShard
+///
+/// \brief  Contiguous range of frames of a sequence processed as a unit.
+///////////////////////////////////////////////////////////////////////////////
+struct BatchShard
+{
+    uint64      ShardIndex{0U};                                      ///< Index of the shard (in the order the shards were added).
+    std::string SequenceName;                                        ///< Name of the sequence.
+    uint64      FirstFrameIndex{0U};                                 ///< Index of the first frame.
+    uint64      NumberOfFrames{std::numeric_limits<uint64>::max()}; ///< Number of frames (clamped to the end of the sequence).
+    uint64      PartIndex{0U};                                       ///< Index of the part of the sequence covered by the shard.
+    uint64      NumberOfParts{1U};                                   ///< Number of parts the sequence is split into (one for a range of frames).
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \struct ShardResult
+///
+/// \brief  Result of processing a shard.
+///////////////////////////////////////////////////////////////////////////////
+struct ShardResult
+{
+    BatchShard  Shard;                       ///< Processed shard (with the range of frames within the sequence, clamped to its end).
+    boolean     IsSuccessful{false};         ///< Flag whether the shard was processed successfully or not.
+    std::string ErrorMessage;                ///< Message of the exception thrown while processing the shard (if any).
+    uint64      WorkerIndex{0U};             ///< Index of the worker which processed the shard.
+    uint64      NumberOfFramesProcessed{0U}; ///< Number of frames reported by the processor.
+    float64     ReaderSetupTime{0.0};        ///< Time needed to create the dataset reader (in milliseconds).
+    float64     ProcessingTime{0.0};         ///< Time needed to process the shard (in milliseconds).
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class BatchRunner
+///
+/// \brief Class for processing several sequences (or ranges of frames within
+///        them) in parallel.
+///
+/// The shards are distributed dynamically to a pool of worker threads, i.e. a
+/// worker takes the next shard as soon as it finished its previous one. Long
+/// shards should be added first. Each shard gets an independent dataset
+/// reader created by the reader factory on the worker, i.e. no reader is
+/// created before the run. Workers can be pinned to CPUs to avoid migrations
+/// between cores.
+///
+/// Results which are specific to the processing (e.g. trajectories) should be
+/// written to storage indexed by the shard index, which needs no locking.
+///////////////////////////////////////////////////////////////////////////////
+class BatchRunner
+{
+protected:
+    std::function<std::unique_ptr<DatasetReaderBase>(const std::string&)> m_ReaderFactory;   ///< Function creating a dataset reader for a sequence.
+    uint64                                                                 m_NumberOfWorkers; ///< Number of worker threads.
+    boolean                                                                m_PinWorkers;      ///< Flag whether the workers are pinned to CPUs or not.
+    std::vector<BatchShard>                                                m_Shards;          ///< Shards to be processed.
+    std::vector<ShardResult>                                               m_ShardResults;    ///< Results of the last run (ordered by the shard index).
+    std::atomic<uint64>                                                    m_NextShardIndex;  ///< Index of the next shard to be processed.
+    float64                                                                m_ElapsedTime;     ///< Wall-clock time of the last run (in milliseconds).
+
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Constructor.
+    ///
+    /// \param[in] ReaderFactory   Function creating a dataset reader for a sequence (called concurrently, may return a null pointer for an unknown sequence).
+    /// \param[in] NumberOfWorkers Number of worker threads (zero for one per hardware thread).
+    /// \param[in] PinWorkers      Flag whether the workers shall be pinned to CPUs or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    BatchRunner(const std::function<std::unique_ptr<DatasetReaderBase>(const std::string&)>& ReaderFactory,
+                const uint64                                                                 NumberOfWorkers = 0U,
+                const boolean                                                                PinWorkers      = true);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor.
+    ///////////////////////////////////////////////////////////////////////////////
+    ~BatchRunner();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Adds a sequence split into shards of contiguous frames.
+    ///
+    /// The frames are split evenly once the number of frames is known, i.e.
+    /// when the reader of a shard is created on its worker (the first shards
+    /// get one frame more). Shards beyond the number of frames are empty.
+    ///
+    /// \param[in] SequenceName   Name of the sequence.
+    /// \param[in] NumberOfShards Number of shards the sequence is split into.
+    ///
+    /// \return    Number of shards added.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 AddSequence(const std::string& SequenceName,
+                       const uint64       NumberOfShards = 1U);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Adds a shard.
+    ///
+    /// \param[in] SequenceName    Name of the sequence.
+    /// \param[in] FirstFrameIndex Index of the first frame.
+    /// \param[in] NumberOfFrames  Number of frames (clamped to the end of the sequence).
+    ///
+    /// \return    Index of the shard.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 AddShard(const std::string& SequenceName,
+                    const uint64       FirstFrameIndex = 0U,
+                    const uint64       NumberOfFrames  = std::numeric_limits<uint64>::max());
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the wall-clock time of the last run.
+    ///
+    /// \return Wall-clock time of the last run (in milliseconds).
+    ///////////////////////////////////////////////////////////////////////////////
+    float64 GetElapsedTime() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the number of shards which failed in the last run.
+    ///
+    /// \return Number of shards which failed.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 GetNumberOfFailedShards() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the number of frames processed in the last run.
+    ///
+    /// \return Number of frames processed (summed over all shards).
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 GetNumberOfFramesProcessed() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the number of shards.
+    ///
+    /// \return Number of shards.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 GetNumberOfShards() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the number of worker threads.
+    ///
+    /// \return Number of worker threads.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 GetNumberOfWorkers() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the results of the last run.
+    ///
+    /// \return Results of the shards (ordered by the shard index).
+    ///////////////////////////////////////////////////////////////////////////////
+    const std::vector<ShardResult>& GetShardResults() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the processing time summed over all shards.
+    ///
+    /// \return Processing time summed over all shards, including the creation of the dataset readers (in milliseconds).
+    ///////////////////////////////////////////////////////////////////////////////
+    float64 GetTotalProcessingTime() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Processes all shards.
+    ///
+    /// The call blocks until all shards are processed. Exceptions thrown while
+    /// creating the reader or processing a shard are recorded in its result,
+    /// the remaining shards are processed anyway. A shard whose reader is not
+    /// created (null pointer) fails as well.
+    ///
+    /// \param[in] Processor Function processing the frames of a shard (called concurrently), returns the number of frames processed.
+    ///////////////////////////////////////////////////////////////////////////////
+    void Run(const std::function<uint64(DatasetReaderBase&, const BatchShard&)>& Processor);
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Determines the range of frames of a shard within a sequence.
+    ///
+    /// \param[in]  NumberOfFramesSequence Number of frames of the sequence.
+    /// \param[out] Shard                  Shard whose range of frames is determined.
+    ///////////////////////////////////////////////////////////////////////////////
+    static void DetermineFrameRange(const uint64 NumberOfFramesSequence,
+                                    BatchShard&  Shard);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Pins the calling thread to a CPU.
+    ///
+    /// Only the CPUs the process is allowed to run on are considered, they are
+    /// assigned round-robin.
+    ///
+    /// \param[in] CPUIndex Index of the CPU (w.r.t. the CPUs the process is allowed to run on).
+    ///
+    /// \return    Flag whether the thread was pinned or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    static boolean PinThreadToCPU(const uint64 CPUIndex);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Processes a single shard.
+    ///
+    /// \param[in] Processor   Function processing the frames of the shard.
+    /// \param[in] ShardIndex  Index of the shard.
+    /// \param[in] WorkerIndex Index of the worker processing the shard.
+    ///////////////////////////////////////////////////////////////////////////////
+    void ProcessShard(const std::function<uint64(DatasetReaderBase&, const BatchShard&)>& Processor,
+                      const uint64                                                        ShardIndex,
+                      const uint64                                                        WorkerIndex);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Runs a worker.
+    ///
+    /// \param[in] Processor   Function processing the frames of a shard.
+    /// \param[in] WorkerIndex Index of the worker.
+    ///////////////////////////////////////////////////////////////////////////////
+    void RunWorker(const std::function<uint64(DatasetReaderBase&, const BatchShard&)>& Processor,
+                   const uint64                                                        WorkerIndex);
+};
+
+#endif // BATCHRUNNER_H
@@ -0,0 +1,274 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file DatasetPrefetcher.cpp
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "DatasetPrefetcher.h"
+
+DatasetPrefetcher::DatasetPrefetcher(const DatasetReaderBase& Reader,
+                                     const uint64             NumberOfWorkers,
+                                     const uint64             NumberOfSlots) :
+    m_DatasetReader{Reader},
+    m_NumberOfFrames{Reader.GetNumberOfFrames()},
+    m_FirstFrameIndex{0U},
+    m_Generation{0U},
+    m_StopRequested{false}
+{
+    // initialize the ring buffer with the first frames
+    m_Slots.resize(std::max(NumberOfSlots, static_cast<uint64>(1U)));
+
+    RestartWindow(0U);
+
+    // start the workers
+    m_WorkerThreads.reserve(NumberOfWorkers);
+
+    for(uint64 i_Worker{0U}; i_Worker < NumberOfWorkers; i_Worker++)
+    {
+        m_WorkerThreads.emplace_back(&DatasetPrefetcher::RunWorker, this);
+    }
+}
+
+DatasetPrefetcher::~DatasetPrefetcher()
+{
+    // request the workers to stop
+    {
+        const std::lock_guard<std::mutex> Lock(m_Mutex);
+
+        m_StopRequested = true;
+    }
+
+    m_WorkerCondition.notify_all();
+
+    for(std::thread& WorkerThread : m_WorkerThreads)
+    {
+        WorkerThread.join();
+    }
+}
+
+void DatasetPrefetcher::GetFrame(const uint64      FrameIndex,
+                                 ImageInformation& ImageInformationStereoLeft,
+                                 ImageInformation& ImageInformationStereoRight)
+{
+    if(FrameIndex >= m_NumberOfFrames)
+    {
+        throw std::out_of_range("Index " + std::to_string(FrameIndex) + " is out of range.");
+    }
+
+    // decode both images synchronously (if there are no workers)
+    if(m_WorkerThreads.empty())
+    {
+        m_DatasetReader.GetImageInformationStereoLeft(FrameIndex, ImageInformationStereoLeft);
+        m_DatasetReader.GetImageInformationStereoRight(FrameIndex, ImageInformationStereoRight);
+
+        return;
+    }
+
+    std::unique_lock<std::mutex> Lock(m_Mutex);
+
+    const uint64 NumberOfSlots{m_Slots.size()};
+
+    // decode frames outside of the window synchronously and restart the prefetching behind the frame
+    if((FrameIndex < m_FirstFrameIndex) || (FrameIndex >= (m_FirstFrameIndex + NumberOfSlots)))
+    {
+        RestartWindow(FrameIndex + 1U);
+
+        Lock.unlock();
+        m_WorkerCondition.notify_all();
+
+        m_DatasetReader.GetImageInformationStereoLeft(FrameIndex, ImageInformationStereoLeft);
+        m_DatasetReader.GetImageInformationStereoRight(FrameIndex, ImageInformationStereoRight);
+
+        return;
+    }
+
+    // drop skipped frames (their slots are assigned to the next frames)
+    while(m_FirstFrameIndex < FrameIndex)
+    {
+        AssignSlot(m_FirstFrameIndex + NumberOfSlots);
+        m_FirstFrameIndex++;
+    }
+
+    // wait for both images of the frame
+    Slot& CurrentSlot{m_Slots[FrameIndex % NumberOfSlots]};
+
+    m_ConsumerCondition.wait(Lock, [&CurrentSlot]() { return CurrentSlot.IsStereoLeftReady && CurrentSlot.IsStereoRightReady; });
+
+    const std::exception_ptr Exception{CurrentSlot.Exception};
+
+    ImageInformationStereoLeft  = std::move(CurrentSlot.StereoLeft);
+    ImageInformationStereoRight = std::move(CurrentSlot.StereoRight);
+
+    // move the window by one frame
+    AssignSlot(m_FirstFrameIndex + NumberOfSlots);
+    m_FirstFrameIndex++;
+
+    Lock.unlock();
+    m_WorkerCondition.notify_all();
+
+    // rethrow the exception of the worker (the window has moved on, i.e. the next frames are not affected)
+    if(Exception)
+    {
+        std::rethrow_exception(Exception);
+    }
+}
+
+uint64 DatasetPrefetcher::GetNumberOfFrames() const
+{
+    return m_NumberOfFrames;
+}
+
+void DatasetPrefetcher::AssignSlot(const uint64 FrameIndex)
+{
+    Slot& CurrentSlot{m_Slots[FrameIndex % m_Slots.size()]};
+
+    CurrentSlot.FrameIndex           = FrameIndex;
+    CurrentSlot.IsStereoLeftClaimed  = false;
+    CurrentSlot.IsStereoRightClaimed = false;
+    CurrentSlot.IsStereoLeftReady    = false;
+    CurrentSlot.IsStereoRightReady   = false;
+    CurrentSlot.StereoLeft           = ImageInformation();
+    CurrentSlot.StereoRight          = ImageInformation();
+    CurrentSlot.Exception            = nullptr;
+}
+
+boolean DatasetPrefetcher::ClaimTask(uint64&  FrameIndex,
+                                     boolean& IsStereoLeft)
+{
+    const uint64 LastFrameIndex{std::min(m_FirstFrameIndex + m_Slots.size(), m_NumberOfFrames)};
+
+    for(uint64 i_Frame{m_FirstFrameIndex}; i_Frame < LastFrameIndex; i_Frame++)
+    {
+        Slot& CurrentSlot{m_Slots[i_Frame % m_Slots.size()]};
+
+        if(!CurrentSlot.IsStereoLeftClaimed)
+        {
+            CurrentSlot.IsStereoLeftClaimed = true;
+
+            FrameIndex   = i_Frame;
+            IsStereoLeft = true;
+
+            return true;
+        }
+
+        if(!CurrentSlot.IsStereoRightClaimed)
+        {
+            CurrentSlot.IsStereoRightClaimed = true;
+
+            FrameIndex   = i_Frame;
+            IsStereoLeft = false;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void DatasetPrefetcher::RestartWindow(const uint64 FirstFrameIndex)
+{
+    m_Generation++;
+    m_FirstFrameIndex = FirstFrameIndex;
+
+    for(uint64 i_Slot{0U}; i_Slot < m_Slots.size(); i_Slot++)
+    {
+        AssignSlot(FirstFrameIndex + i_Slot);
+    }
+}
+
+void DatasetPrefetcher::RunWorker()
+{
+    while(true)
+    {
+        uint64  FrameIndex{0U};
+        boolean IsStereoLeft{false};
+        uint64  Generation{0U};
+
+        // wait for the next task
+        {
+            std::unique_lock<std::mutex> Lock(m_Mutex);
+
+            m_WorkerCondition.wait(Lock, [this, &FrameIndex, &IsStereoLeft]() { return m_StopRequested || ClaimTask(FrameIndex, IsStereoLeft); });
+
+            if(m_StopRequested)
+            {
+                break;
+            }
+
+            Generation = m_Generation;
+        }
+
+        // decode the image (outside of the lock, exceptions are passed to the consumer)
+        ImageInformation   DecodedImageInformation;
+        std::exception_ptr Exception;
+
+        try
+        {
+            if(IsStereoLeft)
+            {
+                m_DatasetReader.GetImageInformationStereoLeft(FrameIndex, DecodedImageInformation);
+            }
+            else
+            {
+                m_DatasetReader.GetImageInformationStereoRight(FrameIndex, DecodedImageInformation);
+            }
+        }
+        catch(...)
+        {
+            Exception = std::current_exception();
+        }
+
+        // store the image (unless the frame was dropped in the meantime)
+        {
+            const std::lock_guard<std::mutex> Lock(m_Mutex);
+
+            Slot& CurrentSlot{m_Slots[FrameIndex % m_Slots.size()]};
+
+            if((Generation != m_Generation) || (CurrentSlot.FrameIndex != FrameIndex))
+            {
+                continue;
+            }
+
+            if(Exception && !CurrentSlot.Exception)
+            {
+                CurrentSlot.Exception = Exception;
+            }
+
+            if(IsStereoLeft)
+            {
+                CurrentSlot.StereoLeft        = std::move(DecodedImageInformation);
+                CurrentSlot.IsStereoLeftReady = true;
+            }
+            else
+            {
+                CurrentSlot.StereoRight        = std::move(DecodedImageInformation);
+                CurrentSlot.IsStereoRightReady = true;
+            }
+        }
+
+        m_ConsumerCondition.notify_all();
+    }
+}
@@ -0,0 +1,170 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file DatasetPrefetcher.h
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#ifndef DATASETPREFETCHER_H
+#define DATASETPREFETCHER_H
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "DatasetReaderBase.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class DatasetPrefetcher
+///
+/// \brief Class for loading the stereo camera images of a dataset ahead of
+///        the consumer.
+///
+/// Worker threads decode the images of the upcoming frames into a ring buffer
+/// with a fixed number of slots. The left and the right image of a frame are
+/// separate tasks, i.e. they are decoded concurrently if there are at least
+/// two workers. Reading the frames in ascending order (skipping frames is
+/// allowed) is served from the ring buffer. A frame outside of the prefetched
+/// window (random access) is decoded on the thread of the caller and the
+/// prefetching restarts behind it.
+///
+/// An exception thrown while a worker decodes an image is stored in the slot
+/// of the frame and rethrown to the consumer requesting the frame.
+///
+/// Without workers, all images are decoded on the thread of the caller. The
+/// prefetcher must not be used by several consumers concurrently.
+///////////////////////////////////////////////////////////////////////////////
+class DatasetPrefetcher
+{
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \struct Slot
+    ///
+    /// \brief  Slot of the ring buffer holding the images of a single frame.
+    ///////////////////////////////////////////////////////////////////////////////
+    struct Slot
+    {
+        uint64             FrameIndex{0U};              ///< Index of the frame assigned to the slot.
+        boolean            IsStereoLeftClaimed{false};  ///< Flag whether a worker decodes the left stereo camera image or not.
+        boolean            IsStereoRightClaimed{false}; ///< Flag whether a worker decodes the right stereo camera image or not.
+        boolean            IsStereoLeftReady{false};    ///< Flag whether the left stereo camera image is decoded (or failed) or not.
+        boolean            IsStereoRightReady{false};   ///< Flag whether the right stereo camera image is decoded (or failed) or not.
+        ImageInformation   StereoLeft;                  ///< Image information of the left stereo camera image.
+        ImageInformation   StereoRight;                 ///< Image information of the right stereo camera image.
+        std::exception_ptr Exception;                   ///< Exception thrown while decoding one of the images (null if both images are decoded).
+    };
+
+    const DatasetReaderBase& m_DatasetReader;     ///< Dataset reader used to decode the images.
+    const uint64             m_NumberOfFrames;    ///< Number of frames in the dataset.
+    std::vector<Slot>        m_Slots;             ///< Ring buffer (the slot of a frame is its index modulo the number of slots).
+    uint64                   m_FirstFrameIndex;   ///< Index of the first frame of the prefetched window.
+    uint64                   m_Generation;        ///< Generation of the prefetched window (incremented whenever the window is restarted).
+    std::mutex               m_Mutex;             ///< Mutex protecting the ring buffer and the flags.
+    std::condition_variable  m_WorkerCondition;   ///< Condition variable signaling new tasks to the workers.
+    std::condition_variable  m_ConsumerCondition; ///< Condition variable signaling decoded images to the consumer.
+    boolean                  m_StopRequested;     ///< Flag defining whether the workers shall be stopped or not.
+    std::vector<std::thread> m_WorkerThreads;     ///< Threads running the workers.
+
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Constructor.
+    ///
+    /// \param[in] Reader          Dataset reader used to decode the images (must outlive the prefetcher).
+    /// \param[in] NumberOfWorkers Number of worker threads (zero to decode all images synchronously).
+    /// \param[in] NumberOfSlots   Number of frames which are prefetched.
+    ///////////////////////////////////////////////////////////////////////////////
+    DatasetPrefetcher(const DatasetReaderBase& Reader,
+                      const uint64             NumberOfWorkers = 2U,
+                      const uint64             NumberOfSlots   = 8U);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor.
+    ///
+    /// Images which are currently decoded are finished before the workers are
+    /// stopped.
+    ///////////////////////////////////////////////////////////////////////////////
+    ~DatasetPrefetcher();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Getter for the information of both stereo camera images of a
+    ///             frame.
+    ///
+    /// The call blocks until both images of the frame are decoded. An exception
+    /// thrown while decoding one of the images is rethrown.
+    ///
+    /// \param[in]  FrameIndex                  Index of the frame.
+    /// \param[out] ImageInformationStereoLeft  Image information of the left stereo camera image.
+    /// \param[out] ImageInformationStereoRight Image information of the right stereo camera image.
+    ///////////////////////////////////////////////////////////////////////////////
+    void GetFrame(const uint64      FrameIndex,
+                  ImageInformation& ImageInformationStereoLeft,
+                  ImageInformation& ImageInformationStereoRight);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the number of frames in the dataset.
+    ///
+    /// \return Number of frames in the dataset.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 GetNumberOfFrames() const;
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Assigns a frame to its slot (the images of the previous frame of
+    ///            the slot are dropped).
+    ///
+    /// Must be called with the mutex being locked.
+    ///
+    /// \param[in] FrameIndex Index of the frame.
+    ///////////////////////////////////////////////////////////////////////////////
+    void AssignSlot(const uint64 FrameIndex);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Claims the next image which shall be decoded.
+    ///
+    /// The frames of the window are visited in ascending order. Must be called
+    /// with the mutex being locked.
+    ///
+    /// \param[out] FrameIndex   Index of the frame of the claimed image.
+    /// \param[out] IsStereoLeft Flag whether the claimed image is the left stereo camera image or not.
+    ///
+    /// \return     Flag whether an image was claimed or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    boolean ClaimTask(uint64&  FrameIndex,
+                      boolean& IsStereoLeft);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Restarts the prefetched window at a frame.
+    ///
+    /// Images which are currently decoded for the previous window are dropped.
+    /// Must be called with the mutex being locked.
+    ///
+    /// \param[in] FirstFrameIndex Index of the first frame of the window.
+    ///////////////////////////////////////////////////////////////////////////////
+    void RestartWindow(const uint64 FirstFrameIndex);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Runs a worker.
+    ///////////////////////////////////////////////////////////////////////////////
+    void RunWorker();
+};
+
+#endif // DATASETPREFETCHER_H
@@ -23,11 +23,10 @@ You should have received a copy of the GNU General Public License along with
 the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
 */
 
-#include <fstream>
-
 #include "../CSVReader.h"
 #include "../FileInterface.h"
 #include "DatasetReader4Seasons.h"
+#include "TimestampParser.h"
 
 DatasetReader4Seasons::DatasetReader4Seasons(const std::string& BaseDirectory,
                                              const std::string& SequenceName) :
@@ -43,6 +42,7 @@ DatasetReader4Seasons::DatasetReader4Seasons(const std::string& BaseDirectory,
     const std::filesystem::path FilenameIntrinsicCalibrationLeft("undistorted_calib_0.txt");
     const std::filesystem::path FilenameIntrinsicCalibrationRight("undistorted_calib_1.txt");
     const std::filesystem::path FilenameExtrinsicCalibration("undistorted_calib_stereo.txt");
+    const std::filesystem::path FilenameIndexCache("dataset_index.bin");
 
     // create absolute paths to stereo camera information
     const std::filesystem::path AbsolutePathImagesStereoLeft{m_BaseDirectory / m_SequenceName / RelativePathImagesStereoLeft};
@@ -52,6 +52,15 @@ DatasetReader4Seasons::DatasetReader4Seasons(const std::string& BaseDirectory,
     const std::filesystem::path AbsolutePathIntrinsicCalibrationStereoLeft{m_BaseDirectory / RelativePathCalibration / FilenameIntrinsicCalibrationLeft};
     const std::filesystem::path AbsolutePathIntrinsicCalibrationStereoRight{m_BaseDirectory / RelativePathCalibration / FilenameIntrinsicCalibrationRight};
     const std::filesystem::path AbsolutePathExtrinsicCalibrationStereo{m_BaseDirectory / RelativePathCalibration / FilenameExtrinsicCalibration};
+    const std::filesystem::path AbsolutePathIndexCache{m_BaseDirectory / m_SequenceName / FilenameIndexCache};
+
+    // load the index of the sequence from the cache (if it is up to date)
+    const std::vector<std::filesystem::path> SourcePaths{AbsolutePathImagesStereoLeft, AbsolutePathImagesStereoRight, AbsolutePathTimestampsImagesStereoLeft, AbsolutePathTimestampsImagesStereoRight, AbsolutePathIntrinsicCalibrationStereoLeft, AbsolutePathIntrinsicCalibrationStereoRight, AbsolutePathExtrinsicCalibrationStereo};
+
+    if(LoadIndexCache(AbsolutePathIndexCache, SourcePaths))
+    {
+        return;
+    }
 
     // extract filenames of the stereo camera images
     const FileInterface FileInterfaceImagesStereoLeft(AbsolutePathImagesStereoLeft, FileBasenameImagesStereo, FileExtensionImagesStereo);
@@ -72,6 +81,9 @@ DatasetReader4Seasons::DatasetReader4Seasons(const std::string& BaseDirectory,
 
     // extract projection matrices of the stereo cameras
     ExtractProjectionMatrices(AbsolutePathIntrinsicCalibrationStereoLeft, AbsolutePathIntrinsicCalibrationStereoRight, AbsolutePathExtrinsicCalibrationStereo, m_ProjectionMatrixStereoLeft, m_ProjectionMatrixStereoRight);
+
+    // write the index of the sequence to the cache
+    SaveIndexCache(AbsolutePathIndexCache, SourcePaths);
 }
 
 DatasetReader4Seasons::~DatasetReader4Seasons()
@@ -129,35 +141,6 @@ void DatasetReader4Seasons::ExtractProjectionMatrices(const std::string& Filenam
 uint64 DatasetReader4Seasons::ExtractTimestamps(const std::filesystem::path& FileTimestampsWithPath,
                                                 ListUInt64&                  ListTimestamps)
 {
-    // initialize number of timestamps found
-    uint64 NumberOfTimestampsFound = 0;
-
-    // open file containing the timestamps
-    std::ifstream infile(FileTimestampsWithPath);
-
-    // extract data
-    std::string line;
-
-    while(std::getline(infile, line))
-    {
-        uint64  FrameID              = 0U;
-        float64 TimestampSeconds     = 0.0;
-        uint64  TimestampNanoseconds = 0U;
-        float64 ExposureTime         = 0.0;
-        char    Delimiter            = ' ';
-
-        std::istringstream iss(line);
-
-        if(!(iss >> FrameID >> Delimiter >> TimestampSeconds >> Delimiter >> ExposureTime))
-        {
-            break;
-        }
-
-        TimestampNanoseconds = static_cast<uint64>(TimestampSeconds * 1.0e9); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
-
-        ListTimestamps.push_back(TimestampNanoseconds);
-        NumberOfTimestampsFound++;
-    }
-
-    return NumberOfTimestampsFound;
+    // extract the timestamps (in seconds) from the second column (the first column contains the frame ID)
+    return TimestampParser::ExtractTimestamps(FileTimestampsWithPath, 1U, FormatSeconds, ListTimestamps);
 }
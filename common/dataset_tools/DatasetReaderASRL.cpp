@@ -23,11 +23,10 @@ You should have received a copy of the GNU General Public License along with
 the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
 */
 
-#include <fstream>
-
 #include "../CSVReader.h"
 #include "../FileInterface.h"
 #include "DatasetReaderASRL.h"
+#include "TimestampParser.h"
 
 DatasetReaderASRL::DatasetReaderASRL(const std::string& BaseDirectory,
                                      const std::string& SequenceName) :
@@ -40,6 +39,7 @@ DatasetReaderASRL::DatasetReaderASRL(const std::string& BaseDirectory,
     const std::filesystem::path FileExtensionImagesStereo(".png");
     const std::filesystem::path FilenameTimestampsImagesStereo("timestamps_images.txt");
     const std::filesystem::path FilenameCalibrationStereo("camera_parameters.txt");
+    const std::filesystem::path FilenameIndexCache("dataset_index.bin");
 
     // create absolute paths to stereo camera information
     const std::filesystem::path AbsolutePathImagesStereoLeft{m_BaseDirectory / m_SequenceName / RelativePathImagesStereoLeft};
@@ -47,6 +47,15 @@ DatasetReaderASRL::DatasetReaderASRL(const std::string& BaseDirectory,
     const std::filesystem::path AbsolutePathTimestampsImagesStereoLeft{m_BaseDirectory / m_SequenceName / FilenameTimestampsImagesStereo};
     const std::filesystem::path AbsolutePathTimestampsImagesStereoRight{m_BaseDirectory / m_SequenceName / FilenameTimestampsImagesStereo};
     const std::filesystem::path AbsolutePathCalibrationStereo{m_BaseDirectory / FilenameCalibrationStereo};
+    const std::filesystem::path AbsolutePathIndexCache{m_BaseDirectory / m_SequenceName / FilenameIndexCache};
+
+    // load the index of the sequence from the cache (if it is up to date)
+    const std::vector<std::filesystem::path> SourcePaths{AbsolutePathImagesStereoLeft, AbsolutePathImagesStereoRight, AbsolutePathTimestampsImagesStereoLeft, AbsolutePathTimestampsImagesStereoRight, AbsolutePathCalibrationStereo};
+
+    if(LoadIndexCache(AbsolutePathIndexCache, SourcePaths))
+    {
+        return;
+    }
 
     // extract filenames of the stereo camera images
     const FileInterface FileInterfaceImagesStereoLeft(AbsolutePathImagesStereoLeft, FileBasenameImagesStereo, FileExtensionImagesStereo);
@@ -67,6 +76,9 @@ DatasetReaderASRL::DatasetReaderASRL(const std::string& BaseDirectory,
 
     // extract projection matrices of the stereo cameras
     ExtractProjectionMatrices(AbsolutePathCalibrationStereo, m_ProjectionMatrixStereoLeft, m_ProjectionMatrixStereoRight);
+
+    // write the index of the sequence to the cache
+    SaveIndexCache(AbsolutePathIndexCache, SourcePaths);
 }
 
 DatasetReaderASRL::~DatasetReaderASRL()
@@ -116,31 +128,6 @@ void DatasetReaderASRL::ExtractProjectionMatrices(const std::string& FilenameCal
 uint64 DatasetReaderASRL::ExtractTimestamps(const std::filesystem::path& FileTimestampsWithPath,
                                             ListUInt64&                  ListTimestamps)
 {
-    // initialize number of timestamps found
-    uint64 NumberOfTimestampsFound = 0;
-
-    // open file containing the timestamps
-    std::ifstream infile(FileTimestampsWithPath);
-
-    // extract data
-    std::string line;
-
-    while(std::getline(infile, line))
-    {
-        uint64 Vertex               = 0U;
-        uint64 TimestampNanoseconds = 0U;
-        char   Delimiter            = ' ';
-
-        std::istringstream iss(line);
-
-        if(!(iss >> Vertex >> Delimiter >> TimestampNanoseconds) && !(Delimiter == ','))
-        {
-            break;
-        }
-
-        ListTimestamps.push_back(TimestampNanoseconds);
-        NumberOfTimestampsFound++;
-    }
-
-    return NumberOfTimestampsFound;
+    // extract the timestamps (in nanoseconds) from the second column (the first column contains the vertex)
+    return TimestampParser::ExtractTimestamps(FileTimestampsWithPath, 1U, FormatNanoseconds, ListTimestamps);
 }
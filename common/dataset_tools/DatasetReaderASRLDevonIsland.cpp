@@ -23,11 +23,11 @@ You should have received a copy of the GNU General Public License along with
 the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
 */
 
-#include <regex>
+#include <stdexcept>
 
-#include "../CSVReader.h"
 #include "../FileInterface.h"
 #include "DatasetReaderASRLDevonIsland.h"
+#include "TimestampParser.h"
 
 DatasetReaderASRLDevonIsland::DatasetReaderASRLDevonIsland(const std::string&  BaseDirectory,
                                                            const std::string&  SequenceName,
@@ -67,6 +67,15 @@ DatasetReaderASRLDevonIsland::DatasetReaderASRLDevonIsland(const std::string&  B
     // create absolute paths to stereo camera information
     const std::filesystem::path AbsolutePathImagesStereoLeft{m_BaseDirectory / DirectoryIdentifier / SequenceDirectory};
     const std::filesystem::path AbsolutePathImagesStereoRight{m_BaseDirectory / DirectoryIdentifier / SequenceDirectory};
+    const std::filesystem::path AbsolutePathIndexCache{m_BaseDirectory / DirectoryIdentifier / (SequenceDirectory.string() + "-index.bin")};
+
+    // load the index of the sequence from the cache (if it is up to date)
+    const std::vector<std::filesystem::path> SourcePaths{AbsolutePathImagesStereoLeft, AbsolutePathImagesStereoRight, AbsolutePathTimestampsImagesStereoLeft, AbsolutePathTimestampsImagesStereoRight};
+
+    if(LoadIndexCache(AbsolutePathIndexCache, SourcePaths))
+    {
+        return;
+    }
 
     // extract filenames of the stereo camera images
     const FileInterface FileInterfaceImagesStereoLeft(AbsolutePathImagesStereoLeft, FileBasenameImagesStereoLeft, FileExtensionImagesStereo);
@@ -87,35 +96,13 @@ DatasetReaderASRLDevonIsland::DatasetReaderASRLDevonIsland(const std::string&  B
 
     // set projection matrices of the stereo cameras
     SetProjectionMatrices(m_ProjectionMatrixStereoLeft, m_ProjectionMatrixStereoRight);
-}
 
-DatasetReaderASRLDevonIsland::~DatasetReaderASRLDevonIsland()
-{
+    // write the index of the sequence to the cache
+    SaveIndexCache(AbsolutePathIndexCache, SourcePaths);
 }
 
-uint64 DatasetReaderASRLDevonIsland::ConvertTimestampIntoNanoSeconds(const std::vector<std::string>& TimestampParts)
+DatasetReaderASRLDevonIsland::~DatasetReaderASRLDevonIsland()
 {
-    // ignore the date as all images of the dataset have been captured at the same day
-    const sint32 Hours{std::stoi(TimestampParts[3])};
-    const sint32 Minutes{std::stoi(TimestampParts[4])};
-    const sint32 Seconds{std::stoi(TimestampParts[5])};
-    const sint32 Milliseconds{std::stoi(TimestampParts[6])};
-
-    const std::chrono::hours        HoursChrono{std::chrono::hours(Hours)};
-    const std::chrono::minutes      MinutesChrono{std::chrono::minutes(Minutes)};
-    const std::chrono::seconds      SecondsChrono{std::chrono::seconds(Seconds)};
-    const std::chrono::milliseconds MillisecondsChrono{std::chrono::milliseconds(Milliseconds)};
-
-    const std::chrono::nanoseconds HoursInNanoseconds{std::chrono::duration_cast<std::chrono::nanoseconds>(HoursChrono)};
-    const std::chrono::nanoseconds MinutesInNanoseconds{std::chrono::duration_cast<std::chrono::nanoseconds>(MinutesChrono)};
-    const std::chrono::nanoseconds SecondsInNanoseconds{std::chrono::duration_cast<std::chrono::nanoseconds>(SecondsChrono)};
-    const std::chrono::nanoseconds MillisecondsInNanoseconds{std::chrono::duration_cast<std::chrono::nanoseconds>(MillisecondsChrono)};
-
-    const std::chrono::nanoseconds TimestampNanosecondsChrono{HoursInNanoseconds + MinutesInNanoseconds + SecondsInNanoseconds + MillisecondsInNanoseconds};
-
-    const sint64 TimestampNanoseconds{TimestampNanosecondsChrono.count()};
-
-    return TimestampNanoseconds;
 }
 
 uint64 DatasetReaderASRLDevonIsland::ExtractTimestamps(const std::filesystem::path& FileTimestampsWithPath,
@@ -124,32 +111,10 @@ uint64 DatasetReaderASRLDevonIsland::ExtractTimestamps(const std::filesystem::pa
     // initialize number of timestamps found
     uint64 NumberOfTimestampsFound{0U};
 
-    // read file
-    const CSVReader Reader(FileTimestampsWithPath, " ");
-
-    // extract all timestamps
+    // extract all timestamps (the date is ignored as all images of the dataset have been captured at the same day)
     ListUInt64 ListTimestampsAll;
 
-    for(uint64 i_FrameCounter{0}; i_FrameCounter < Reader.GetNumberOfRows(); i_FrameCounter++)
-    {
-        const std::regex regular_expression_timestamp("[-:T.]{1}");
-
-        std::string Timestamp{Reader.GetValue(i_FrameCounter, 1U)};
-
-        std::sregex_token_iterator       iter(Timestamp.begin(), Timestamp.end(), regular_expression_timestamp, -1);
-        const std::sregex_token_iterator end;
-
-        std::vector<std::string> TimestampParts;
-
-        for(; iter != end; ++iter)
-        {
-            TimestampParts.push_back(*iter);
-        }
-
-        const uint64 TimestampNanoseconds{ConvertTimestampIntoNanoSeconds(TimestampParts)};
-
-        ListTimestampsAll.push_back(TimestampNanoseconds);
-    }
+    TimestampParser::ExtractTimestamps(FileTimestampsWithPath, 1U, FormatISO8601TimeOfDay, ListTimestampsAll);
 
     // filter timestamps to get the relevant timestamps only
     NumberOfTimestampsFound = FilterTimestamps(ListTimestampsAll, ListTimestamps);
@@ -179,6 +144,12 @@ uint64 DatasetReaderASRLDevonIsland::FilterTimestamps(const ListUInt64& ListTime
     const uint64 FramenumberFirst{static_cast<uint64>(std::stoi(FramenumberFirstTemp))};
     const uint64 FramenumberLast{static_cast<uint64>(std::stoi(FramenumberLastTemp))};
 
+    // the timestamp file must contain a timestamp for each image (parsing stops at the first invalid line)
+    if((FramenumberFirst == 0U) || (ListTimestampsAll.size() < FramenumberLast))
+    {
+        throw std::runtime_error("The timestamp file contains " + std::to_string(ListTimestampsAll.size()) + " valid timestamps, but " + std::to_string(FramenumberLast) + " timestamps are required.");
+    }
+
     for(uint64 i_Frame{FramenumberFirst}; i_Frame <= FramenumberLast; i_Frame++)
     {
         ListTimestamps.push_back(ListTimestampsAll[i_Frame - 1]); // -1 as Framenumbers start with 1
@@ -70,15 +70,6 @@ public:
 protected:
     ASRLImageType m_ImageType; ///< Image type to be used (either color or grey).
 
-    ///////////////////////////////////////////////////////////////////////////////
-    /// \brief     Extracts the timestamps from the provided file.
-    ///
-    /// \param[in] TimestampParts Parts of the timestamp (years, months, days, hours, minutes, seconds, milliseconds).
-    ///
-    /// \return    Timestamp in nanoseconds.
-    ///////////////////////////////////////////////////////////////////////////////
-    static uint64 ConvertTimestampIntoNanoSeconds(const std::vector<std::string>& TimestampParts);
-
     ///////////////////////////////////////////////////////////////////////////////
     /// \brief      Extracts the timestamps from the provided file.
     ///
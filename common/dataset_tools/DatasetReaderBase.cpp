@@ -23,9 +23,26 @@ You should have received a copy of the GNU General Public License along with
 the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
 */
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <opencv2/highgui/highgui.hpp>
 
 #include "DatasetReaderBase.h"
+#include "TimestampSearch.h"
 
 DatasetReaderBase::DatasetReaderBase(const std::string& BaseDirectory,
                                      const std::string& SequenceName) :
@@ -36,7 +53,9 @@ DatasetReaderBase::DatasetReaderBase(const std::string& BaseDirectory,
     m_NumberOfTimestampsStereoLeft{0U},
     m_NumberOfTimestampsStereoRight{0U},
     m_HeightImagesStereo{0U},
-    m_WidthImagesStereo{0U}
+    m_WidthImagesStereo{0U},
+    m_HasDecodingOptions{false},
+    m_DecodingScale{DecodingScaleFull}
 {
 }
 
@@ -44,8 +63,80 @@ DatasetReaderBase::~DatasetReaderBase()
 {
 }
 
+void DatasetReaderBase::DecodeImageStereoLeft(uint64            Index,
+                                              ImageBuffer&      Buffer,
+                                              ImageInformation& ImageInformation) const
+{
+    // collect image information (without copying the filename)
+    const boolean IsDecoded{DecodeImage(m_FilenamesWithPathImagesStereoLeft[Index], GetReadMode(), Buffer)};
+
+    ImageInformation.Index     = Index;
+    ImageInformation.Timestamp = m_TimestampsImagesStereoLeftNanoseconds[Index];
+    ImageInformation.FilenameWithAbsolutePath.clear();
+    ImageInformation.ImageGrayscale = Buffer.ImageGrayscale;
+    ImageInformation.IsValid        = IsDecoded && ApplyRegionOfInterest(ImageInformation.ImageGrayscale);
+}
+
+void DatasetReaderBase::DecodeImageStereoRight(uint64            Index,
+                                               ImageBuffer&      Buffer,
+                                               ImageInformation& ImageInformation) const
+{
+    // collect image information (without copying the filename)
+    const boolean IsDecoded{DecodeImage(m_FilenamesWithPathImagesStereoRight[Index], GetReadMode(), Buffer)};
+
+    ImageInformation.Index     = Index;
+    ImageInformation.Timestamp = m_TimestampsImagesStereoRightNanoseconds[Index];
+    ImageInformation.FilenameWithAbsolutePath.clear();
+    ImageInformation.ImageGrayscale = Buffer.ImageGrayscale;
+    ImageInformation.IsValid        = IsDecoded && ApplyRegionOfInterest(ImageInformation.ImageGrayscale);
+}
+
+void DatasetReaderBase::FindFramesInInterval(const uint64 TimestampStartNanoseconds,
+                                             const uint64 TimestampEndNanoseconds,
+                                             uint64&      FirstFrameIndex,
+                                             uint64&      NumberOfFrames) const
+{
+    TimestampSearch::FindInterval(m_TimestampsImagesStereoLeftNanoseconds, TimestampStartNanoseconds, TimestampEndNanoseconds, FirstFrameIndex, NumberOfFrames);
+
+    // ignore timestamps without an image
+    const uint64 NumberOfFramesDataset{GetNumberOfFrames()};
+
+    FirstFrameIndex = std::min(FirstFrameIndex, NumberOfFramesDataset);
+    NumberOfFrames  = std::min(NumberOfFrames, NumberOfFramesDataset - FirstFrameIndex);
+}
+
+uint64 DatasetReaderBase::FindNearestFrame(const uint64 TimestampNanoseconds) const
+{
+    const uint64 NumberOfFrames{GetNumberOfFrames()};
+
+    if(NumberOfFrames == 0U)
+    {
+        throw std::out_of_range("The dataset does not contain any frames.");
+    }
+
+    // ignore timestamps without an image
+    const uint64 FrameIndex{TimestampSearch::FindNearest(m_TimestampsImagesStereoLeftNanoseconds, TimestampNanoseconds)};
+
+    return std::min(FrameIndex, NumberOfFrames - 1U);
+}
+
+const std::string& DatasetReaderBase::GetFilenameImageStereoLeft(uint64 Index) const
+{
+    return m_FilenamesWithPathImagesStereoLeft[Index];
+}
+
+const std::string& DatasetReaderBase::GetFilenameImageStereoRight(uint64 Index) const
+{
+    return m_FilenamesWithPathImagesStereoRight[Index];
+}
+
 uint32 DatasetReaderBase::GetImageHeightStereoImages() const
 {
+    if(m_HasDecodingOptions)
+    {
+        return static_cast<uint32>(m_RegionOfInterestDecoded.height);
+    }
+
     return m_HeightImagesStereo;
 }
 
@@ -53,24 +144,31 @@ void DatasetReaderBase::GetImageInformationStereoLeft(uint64            Index,
                                                       ImageInformation& ImageInformation) const
 {
     // collect image information
-    ImageInformation.IsValid                  = true;
+    ImageInformation.Index                    = Index;
     ImageInformation.Timestamp                = m_TimestampsImagesStereoLeftNanoseconds[Index];
     ImageInformation.FilenameWithAbsolutePath = m_FilenamesWithPathImagesStereoLeft[Index];
-    ImageInformation.ImageGrayscale           = cv::imread(ImageInformation.FilenameWithAbsolutePath, cv::IMREAD_GRAYSCALE);
+    ImageInformation.ImageGrayscale           = cv::imread(ImageInformation.FilenameWithAbsolutePath, GetReadMode());
+    ImageInformation.IsValid                  = ApplyRegionOfInterest(ImageInformation.ImageGrayscale);
 }
 
 void DatasetReaderBase::GetImageInformationStereoRight(uint64            Index,
                                                        ImageInformation& ImageInformation) const
 {
     // collect image information
-    ImageInformation.IsValid                  = true;
+    ImageInformation.Index                    = Index;
     ImageInformation.Timestamp                = m_TimestampsImagesStereoRightNanoseconds[Index];
     ImageInformation.FilenameWithAbsolutePath = m_FilenamesWithPathImagesStereoRight[Index];
-    ImageInformation.ImageGrayscale           = cv::imread(ImageInformation.FilenameWithAbsolutePath, cv::IMREAD_GRAYSCALE);
+    ImageInformation.ImageGrayscale           = cv::imread(ImageInformation.FilenameWithAbsolutePath, GetReadMode());
+    ImageInformation.IsValid                  = ApplyRegionOfInterest(ImageInformation.ImageGrayscale);
 }
 
 uint32 DatasetReaderBase::GetImageWidthStereoImages() const
 {
+    if(m_HasDecodingOptions)
+    {
+        return static_cast<uint32>(m_RegionOfInterestDecoded.width);
+    }
+
     return m_WidthImagesStereo;
 }
 
@@ -84,22 +182,724 @@ uint64 DatasetReaderBase::GetNumberOfFrames() const
 
 const MatrixFloat64_3x4& DatasetReaderBase::GetProjectionMatrixStereoLeft() const
 {
+    if(m_HasDecodingOptions)
+    {
+        return m_ProjectionMatrixStereoLeftDecoded;
+    }
+
     return m_ProjectionMatrixStereoLeft;
 }
 
 const MatrixFloat64_3x4& DatasetReaderBase::GetProjectionMatrixStereoRight() const
 {
+    if(m_HasDecodingOptions)
+    {
+        return m_ProjectionMatrixStereoRightDecoded;
+    }
+
     return m_ProjectionMatrixStereoRight;
 }
 
+void DatasetReaderBase::SetDecodingOptions(const DecodingScale Scale,
+                                           const cv::Rect&     RegionOfInterest)
+{
+    // dimensions of the images decoded at the reduced resolution (rounded down like cv::imread)
+    const sint32 ReductionFactor{static_cast<sint32>(Scale)};
+    const sint32 HeightImagesReduced{static_cast<sint32>(m_HeightImagesStereo) / ReductionFactor};
+    const sint32 WidthImagesReduced{static_cast<sint32>(m_WidthImagesStereo) / ReductionFactor};
+
+    // convert the region of interest to the reduced resolution (the whole image if it is empty)
+    sint32 RegionStartHorizontal{0};
+    sint32 RegionStartVertical{0};
+    sint32 RegionEndHorizontal{WidthImagesReduced};
+    sint32 RegionEndVertical{HeightImagesReduced};
+
+    if((RegionOfInterest.width > 0) && (RegionOfInterest.height > 0))
+    {
+        RegionStartHorizontal = std::max(RegionOfInterest.x, 0) / ReductionFactor;
+        RegionStartVertical   = std::max(RegionOfInterest.y, 0) / ReductionFactor;
+        RegionEndHorizontal   = std::min((RegionOfInterest.x + RegionOfInterest.width) / ReductionFactor, WidthImagesReduced);
+        RegionEndVertical     = std::min((RegionOfInterest.y + RegionOfInterest.height) / ReductionFactor, HeightImagesReduced);
+    }
+
+    if((RegionEndHorizontal <= RegionStartHorizontal) || (RegionEndVertical <= RegionStartVertical))
+    {
+        throw std::invalid_argument("The region of interest does not overlap with the images.");
+    }
+
+    // scale the pixel grid (the centers of the reduced pixels are the centers of the merged pixels) and shift it to the region of interest
+    // (the scale factors are the actual ratios per axis, they differ from the reduction factor if the dimensions are not divisible by it)
+    const float64 ScaleFactorHorizontal{static_cast<float64>(WidthImagesReduced) / static_cast<float64>(m_WidthImagesStereo)};
+    const float64 ScaleFactorVertical{static_cast<float64>(HeightImagesReduced) / static_cast<float64>(m_HeightImagesStereo)};
+
+    MatrixFloat64_3d Transformation{MatrixFloat64_3d::Identity()};
+
+    Transformation(0, 0) = ScaleFactorHorizontal;
+    Transformation(1, 1) = ScaleFactorVertical;
+    Transformation(0, 2) = (0.5 * ScaleFactorHorizontal) - 0.5 - static_cast<float64>(RegionStartHorizontal); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    Transformation(1, 2) = (0.5 * ScaleFactorVertical) - 0.5 - static_cast<float64>(RegionStartVertical);     // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    m_HasDecodingOptions                 = true;
+    m_DecodingScale                      = Scale;
+    m_RegionOfInterestDecoded            = cv::Rect(RegionStartHorizontal, RegionStartVertical, RegionEndHorizontal - RegionStartHorizontal, RegionEndVertical - RegionStartVertical);
+    m_ProjectionMatrixStereoLeftDecoded  = Transformation * m_ProjectionMatrixStereoLeft;
+    m_ProjectionMatrixStereoRightDecoded = Transformation * m_ProjectionMatrixStereoRight;
+}
+
+boolean DatasetReaderBase::ValidateImagesDimensions(const uint64 NumberOfThreads) const
+{
+    // get number of images of both stereo cameras
+    const uint64 NumberOfImagesStereoLeft{m_FilenamesWithPathImagesStereoLeft.size()};
+    const uint64 NumberOfImages{NumberOfImagesStereoLeft + m_FilenamesWithPathImagesStereoRight.size()};
+    const uint64 NumberOfThreadsUsed{std::max(std::min(NumberOfThreads, NumberOfImages), static_cast<uint64>(1U))};
+
+    // compare the dimensions of all images (each thread checks every n-th image)
+    std::atomic<boolean> AreDimensionsMatching{true};
+
+    const std::function<void(const uint64)> CheckImages{[&](const uint64 FirstImage)
+    {
+        for(uint64 i_Image{FirstImage}; (i_Image < NumberOfImages) && AreDimensionsMatching; i_Image += NumberOfThreadsUsed)
+        {
+            const std::string& FilenameImage{(i_Image < NumberOfImagesStereoLeft) ? m_FilenamesWithPathImagesStereoLeft[i_Image] : m_FilenamesWithPathImagesStereoRight[i_Image - NumberOfImagesStereoLeft]};
+
+            uint32 ImageHeight{0U};
+            uint32 ImageWidth{0U};
+
+            // only the header is read (images whose header cannot be parsed are treated as mismatching)
+            const boolean IsHeaderParsed{ReadImageDimensions(FilenameImage, ImageHeight, ImageWidth)};
+
+            if(!IsHeaderParsed || (ImageHeight != m_HeightImagesStereo) || (ImageWidth != m_WidthImagesStereo))
+            {
+                AreDimensionsMatching = false;
+            }
+        }
+    }};
+
+    std::vector<std::thread> Threads;
+
+    Threads.reserve(NumberOfThreadsUsed - 1U);
+
+    for(uint64 i_Thread{1U}; i_Thread < NumberOfThreadsUsed; i_Thread++)
+    {
+        Threads.emplace_back(CheckImages, i_Thread);
+    }
+
+    CheckImages(0U);
+
+    for(std::thread& Thread : Threads)
+    {
+        Thread.join();
+    }
+
+    return AreDimensionsMatching;
+}
+
+boolean DatasetReaderBase::ApplyRegionOfInterest(cv::Mat& Image) const
+{
+    if(!m_HasDecodingOptions)
+    {
+        return true;
+    }
+
+    // codecs decoding the reduced resolution themselves round up the image dimensions
+    if((Image.rows < (m_RegionOfInterestDecoded.y + m_RegionOfInterestDecoded.height)) || (Image.cols < (m_RegionOfInterestDecoded.x + m_RegionOfInterestDecoded.width)))
+    {
+        return false;
+    }
+
+    if((Image.rows != m_RegionOfInterestDecoded.height) || (Image.cols != m_RegionOfInterestDecoded.width))
+    {
+        Image = Image(m_RegionOfInterestDecoded);
+    }
+
+    return true;
+}
+
+boolean DatasetReaderBase::ComputeSourceFingerprint(const std::filesystem::path& SourcePath,
+                                                    sint64&                      ModificationTime,
+                                                    uint64&                      Size)
+{
+    std::error_code ErrorCode;
+
+    const std::filesystem::file_time_type LastWriteTime{std::filesystem::last_write_time(SourcePath, ErrorCode)};
+
+    if(ErrorCode)
+    {
+        return false;
+    }
+
+    ModificationTime = static_cast<sint64>(LastWriteTime.time_since_epoch().count());
+    Size             = 0U;
+
+    // the modification time of a directory changes whenever files are added or removed
+    if(std::filesystem::is_regular_file(SourcePath, ErrorCode))
+    {
+        Size = static_cast<uint64>(std::filesystem::file_size(SourcePath, ErrorCode));
+    }
+
+    return !ErrorCode;
+}
+
+std::filesystem::path DatasetReaderBase::CreateTemporaryFilename(const std::filesystem::path& Filename)
+{
+    // the process id separates processes, the hash of the thread id separates the threads of a process
+    const uint64 ThreadHash{static_cast<uint64>(std::hash<std::thread::id>{}(std::this_thread::get_id()))};
+
+    return std::filesystem::path(Filename.string() + ".tmp" + std::to_string(getpid()) + "_" + std::to_string(ThreadHash));
+}
+
+boolean DatasetReaderBase::DecodeImage(const std::string& FilenameImage,
+                                       const sint32       ReadMode,
+                                       ImageBuffer&       Buffer)
+{
+    // read the file into the encoded image buffer (its capacity is reused)
+    const sint32 FileDescriptor{open(FilenameImage.c_str(), O_RDONLY)};
+
+    if(FileDescriptor < 0)
+    {
+        return false;
+    }
+
+    struct stat FileStatus{};
+
+    if((fstat(FileDescriptor, &FileStatus) != 0) || (FileStatus.st_size <= 0))
+    {
+        close(FileDescriptor);
+        return false;
+    }
+
+    Buffer.EncodedImage.resize(static_cast<uint64>(FileStatus.st_size));
+
+    uint64 NumberOfBytesRead{0U};
+
+    while(NumberOfBytesRead < Buffer.EncodedImage.size())
+    {
+        const ssize_t Result{read(FileDescriptor, Buffer.EncodedImage.data() + NumberOfBytesRead, Buffer.EncodedImage.size() - NumberOfBytesRead)};
+
+        if(Result <= 0)
+        {
+            break;
+        }
+
+        NumberOfBytesRead += static_cast<uint64>(Result);
+    }
+
+    close(FileDescriptor);
+
+    if(NumberOfBytesRead != Buffer.EncodedImage.size())
+    {
+        return false;
+    }
+
+    // decode into the grayscale image buffer (reallocated only if the dimensions differ)
+    const cv::Mat EncodedImage(1, static_cast<sint32>(Buffer.EncodedImage.size()), CV_8UC1, Buffer.EncodedImage.data());
+
+    const cv::Mat DecodedImage{cv::imdecode(EncodedImage, ReadMode, &Buffer.ImageGrayscale)};
+
+    return !DecodedImage.empty();
+}
+
 void DatasetReaderBase::ExtractImagesDimensions(const std::string& FilenameImage,
                                                 uint32&            ImageHeight,
                                                 uint32&            ImageWidth)
 {
-    // read first stereo camera image (left camera)
-    const cv::Mat Image{cv::imread(FilenameImage, cv::IMREAD_COLOR)};
+    // read the dimensions from the header of the image
+    if(ReadImageDimensions(FilenameImage, ImageHeight, ImageWidth))
+    {
+        return;
+    }
+
+    // decode the image (format not supported by the header parsers)
+    const cv::Mat Image{cv::imread(FilenameImage, cv::IMREAD_UNCHANGED)};
 
     // get image dimensions
     ImageHeight = Image.rows;
     ImageWidth  = Image.cols;
 }
+
+sint32 DatasetReaderBase::GetReadMode() const
+{
+    switch(m_DecodingScale)
+    {
+        case DecodingScaleHalf:
+            return cv::IMREAD_REDUCED_GRAYSCALE_2;
+        case DecodingScaleQuarter:
+            return cv::IMREAD_REDUCED_GRAYSCALE_4;
+        case DecodingScaleEighth:
+            return cv::IMREAD_REDUCED_GRAYSCALE_8;
+        default:
+            return cv::IMREAD_GRAYSCALE;
+    }
+}
+
+boolean DatasetReaderBase::LoadIndexCache(const std::filesystem::path&              FilenameIndexCache,
+                                          const std::vector<std::filesystem::path>& SourcePaths)
+{
+    // map the cache into memory
+    const sint32 FileDescriptor{open(FilenameIndexCache.c_str(), O_RDONLY)};
+
+    if(FileDescriptor < 0)
+    {
+        return false;
+    }
+
+    struct stat FileStatus{};
+
+    if((fstat(FileDescriptor, &FileStatus) != 0) || (FileStatus.st_size <= 0))
+    {
+        close(FileDescriptor);
+        return false;
+    }
+
+    const uint64 FileSize{static_cast<uint64>(FileStatus.st_size)};
+
+    void* Mapping{mmap(nullptr, FileSize, PROT_READ, MAP_PRIVATE, FileDescriptor, 0)};
+
+    close(FileDescriptor);
+
+    if(Mapping == MAP_FAILED)
+    {
+        return false;
+    }
+
+    // parse the index
+    const boolean IsLoaded{ParseIndexCache(static_cast<const uint8*>(Mapping), FileSize, SourcePaths)};
+
+    munmap(Mapping, FileSize);
+
+    // discard a partially parsed index
+    if(!IsLoaded)
+    {
+        m_FilenamesWithPathImagesStereoLeft.clear();
+        m_FilenamesWithPathImagesStereoRight.clear();
+        m_TimestampsImagesStereoLeftNanoseconds.clear();
+        m_TimestampsImagesStereoRightNanoseconds.clear();
+
+        m_NumberOfImagesStereoLeft      = 0U;
+        m_NumberOfImagesStereoRight     = 0U;
+        m_NumberOfTimestampsStereoLeft  = 0U;
+        m_NumberOfTimestampsStereoRight = 0U;
+        m_HeightImagesStereo            = 0U;
+        m_WidthImagesStereo             = 0U;
+    }
+
+    return IsLoaded;
+}
+
+boolean DatasetReaderBase::ParseHeaderJPEG(std::istream& ImageStream,
+                                           uint32&       ImageHeight,
+                                           uint32&       ImageWidth)
+{
+    const sint32 MarkerPrefix{0xFF};
+    const sint32 MarkerStartOfImage{0xD8};
+    const sint32 MarkerEndOfImage{0xD9};
+    const sint32 MarkerStartOfScan{0xDA};
+
+    // check start of image marker
+    if((ImageStream.get() != MarkerPrefix) || (ImageStream.get() != MarkerStartOfImage))
+    {
+        return false;
+    }
+
+    // walk through the segments up to the first start of frame segment
+    while(ImageStream.get() == MarkerPrefix)
+    {
+        // skip fill bytes
+        sint32 Marker{ImageStream.get()};
+
+        while(Marker == MarkerPrefix)
+        {
+            Marker = ImageStream.get();
+        }
+
+        // skip markers without segment (restart markers and TEM)
+        const boolean IsRestartMarker{(Marker >= 0xD0) && (Marker <= 0xD7)};
+
+        if(IsRestartMarker || (Marker == 0x01))
+        {
+            continue;
+        }
+
+        // stop at the image data (no start of frame segment found)
+        if((Marker == MarkerEndOfImage) || (Marker == MarkerStartOfScan) || (Marker == std::char_traits<char>::eof()))
+        {
+            return false;
+        }
+
+        std::array<uint8, 7U> SegmentHeader{};
+
+        ImageStream.read(reinterpret_cast<char*>(SegmentHeader.data()), 2);
+
+        const uint32 SegmentLength{(static_cast<uint32>(SegmentHeader[0]) << 8U) | static_cast<uint32>(SegmentHeader[1])};
+
+        if(!ImageStream || (SegmentLength < 2U))
+        {
+            return false;
+        }
+
+        // start of frame segments (SOF0 to SOF15 except DHT, JPG and DAC) contain the precision, the height and the width
+        const boolean IsStartOfFrame{(Marker >= 0xC0) && (Marker <= 0xCF) && (Marker != 0xC4) && (Marker != 0xC8) && (Marker != 0xCC)};
+
+        if(IsStartOfFrame)
+        {
+            ImageStream.read(reinterpret_cast<char*>(SegmentHeader.data() + 2), 5);
+
+            if(!ImageStream)
+            {
+                return false;
+            }
+
+            ImageHeight = (static_cast<uint32>(SegmentHeader[3]) << 8U) | static_cast<uint32>(SegmentHeader[4]);
+            ImageWidth  = (static_cast<uint32>(SegmentHeader[5]) << 8U) | static_cast<uint32>(SegmentHeader[6]);
+
+            return true;
+        }
+
+        ImageStream.ignore(static_cast<std::streamsize>(SegmentLength - 2U));
+    }
+
+    return false;
+}
+
+boolean DatasetReaderBase::ParseHeaderPNG(std::istream& ImageStream,
+                                          uint32&       ImageHeight,
+                                          uint32&       ImageWidth)
+{
+    // signature (8 bytes), length (4 bytes) and type (4 bytes) of the first chunk, width and height (4 bytes each)
+    const std::array<uint8, 8U> Signature{0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    std::array<uint8, 24U>      Header{};
+
+    ImageStream.read(reinterpret_cast<char*>(Header.data()), static_cast<std::streamsize>(Header.size()));
+
+    if(!ImageStream || !std::equal(Signature.begin(), Signature.end(), Header.begin()))
+    {
+        return false;
+    }
+
+    // the first chunk has to be the image header
+    if((Header[12] != 'I') || (Header[13] != 'H') || (Header[14] != 'D') || (Header[15] != 'R'))
+    {
+        return false;
+    }
+
+    // both values are stored in big-endian byte order
+    ImageWidth  = (static_cast<uint32>(Header[16]) << 24U) | (static_cast<uint32>(Header[17]) << 16U) | (static_cast<uint32>(Header[18]) << 8U) | static_cast<uint32>(Header[19]);
+    ImageHeight = (static_cast<uint32>(Header[20]) << 24U) | (static_cast<uint32>(Header[21]) << 16U) | (static_cast<uint32>(Header[22]) << 8U) | static_cast<uint32>(Header[23]);
+
+    return true;
+}
+
+boolean DatasetReaderBase::ParseHeaderPNM(std::istream& ImageStream,
+                                          uint32&       ImageHeight,
+                                          uint32&       ImageWidth)
+{
+    // check magic number (P1 to P6)
+    const sint32 MagicFirst{ImageStream.get()};
+    const sint32 MagicSecond{ImageStream.get()};
+
+    if((MagicFirst != 'P') || (MagicSecond < '1') || (MagicSecond > '6'))
+    {
+        return false;
+    }
+
+    // read width and height (ASCII values separated by whitespaces and comments)
+    std::array<uint32, 2U> Dimensions{};
+
+    for(uint32& Dimension : Dimensions)
+    {
+        sint32 Character{ImageStream.get()};
+
+        while((Character == '#') || ((Character != std::char_traits<char>::eof()) && std::isspace(Character)))
+        {
+            if(Character == '#')
+            {
+                ImageStream.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            }
+
+            Character = ImageStream.get();
+        }
+
+        if((Character == std::char_traits<char>::eof()) || !std::isdigit(Character))
+        {
+            return false;
+        }
+
+        uint64 Value{0U};
+
+        while((Character != std::char_traits<char>::eof()) && std::isdigit(Character))
+        {
+            Value = 10U * Value + static_cast<uint64>(Character - '0');
+
+            if(Value > std::numeric_limits<uint32>::max())
+            {
+                return false;
+            }
+
+            Character = ImageStream.get();
+        }
+
+        Dimension = static_cast<uint32>(Value);
+    }
+
+    ImageWidth  = Dimensions[0];
+    ImageHeight = Dimensions[1];
+
+    return true;
+}
+
+boolean DatasetReaderBase::ParseIndexCache(const uint8*                              Content,
+                                           const uint64                              ContentSize,
+                                           const std::vector<std::filesystem::path>& SourcePaths)
+{
+    const uint32 IndexCacheMagic{0x58444952U}; // "RIDX"
+    const uint32 IndexCacheVersion{2U};
+
+    const uint8* Cursor{Content};
+    const uint8* ContentEnd{Content + ContentSize};
+
+    // check magic number and version
+    uint32 Magic{0U};
+    uint32 Version{0U};
+
+    if(!ReadFromIndexCache(Cursor, ContentEnd, &Magic, sizeof(Magic)) || !ReadFromIndexCache(Cursor, ContentEnd, &Version, sizeof(Version)) || (Magic != IndexCacheMagic) || (Version != IndexCacheVersion))
+    {
+        return false;
+    }
+
+    // check whether the sources changed since the cache was written
+    uint64 NumberOfSources{0U};
+
+    if(!ReadFromIndexCache(Cursor, ContentEnd, &NumberOfSources, sizeof(NumberOfSources)) || (NumberOfSources != SourcePaths.size()))
+    {
+        return false;
+    }
+
+    for(const std::filesystem::path& SourcePath : SourcePaths)
+    {
+        std::string SourcePathCached;
+        sint64      ModificationTimeCached{0};
+        uint64      SizeCached{0U};
+        sint64      ModificationTime{0};
+        uint64      Size{0U};
+
+        if(!ReadStringFromIndexCache(Cursor, ContentEnd, SourcePathCached) || !ReadFromIndexCache(Cursor, ContentEnd, &ModificationTimeCached, sizeof(ModificationTimeCached)) || !ReadFromIndexCache(Cursor, ContentEnd, &SizeCached, sizeof(SizeCached)))
+        {
+            return false;
+        }
+
+        if(!ComputeSourceFingerprint(SourcePath, ModificationTime, Size) || (SourcePathCached != SourcePath.string()) || (ModificationTimeCached != ModificationTime) || (SizeCached != Size))
+        {
+            return false;
+        }
+    }
+
+    // read counters, image dimensions and projection matrices
+    if(!ReadFromIndexCache(Cursor, ContentEnd, &m_NumberOfImagesStereoLeft, sizeof(m_NumberOfImagesStereoLeft)) ||
+       !ReadFromIndexCache(Cursor, ContentEnd, &m_NumberOfImagesStereoRight, sizeof(m_NumberOfImagesStereoRight)) ||
+       !ReadFromIndexCache(Cursor, ContentEnd, &m_NumberOfTimestampsStereoLeft, sizeof(m_NumberOfTimestampsStereoLeft)) ||
+       !ReadFromIndexCache(Cursor, ContentEnd, &m_NumberOfTimestampsStereoRight, sizeof(m_NumberOfTimestampsStereoRight)) ||
+       !ReadFromIndexCache(Cursor, ContentEnd, &m_HeightImagesStereo, sizeof(m_HeightImagesStereo)) ||
+       !ReadFromIndexCache(Cursor, ContentEnd, &m_WidthImagesStereo, sizeof(m_WidthImagesStereo)) ||
+       !ReadFromIndexCache(Cursor, ContentEnd, m_ProjectionMatrixStereoLeft.data(), sizeof(float64) * m_ProjectionMatrixStereoLeft.size()) ||
+       !ReadFromIndexCache(Cursor, ContentEnd, m_ProjectionMatrixStereoRight.data(), sizeof(float64) * m_ProjectionMatrixStereoRight.size()))
+    {
+        return false;
+    }
+
+    // read filenames and timestamps of both stereo cameras
+    for(std::vector<std::string>* Filenames : {&m_FilenamesWithPathImagesStereoLeft, &m_FilenamesWithPathImagesStereoRight})
+    {
+        uint64 NumberOfFilenames{0U};
+
+        if(!ReadFromIndexCache(Cursor, ContentEnd, &NumberOfFilenames, sizeof(NumberOfFilenames)) || (NumberOfFilenames > ContentSize))
+        {
+            return false;
+        }
+
+        Filenames->resize(NumberOfFilenames);
+
+        for(std::string& Filename : *Filenames)
+        {
+            if(!ReadStringFromIndexCache(Cursor, ContentEnd, Filename))
+            {
+                return false;
+            }
+        }
+    }
+
+    for(ListUInt64* Timestamps : {&m_TimestampsImagesStereoLeftNanoseconds, &m_TimestampsImagesStereoRightNanoseconds})
+    {
+        uint64 NumberOfTimestamps{0U};
+
+        if(!ReadFromIndexCache(Cursor, ContentEnd, &NumberOfTimestamps, sizeof(NumberOfTimestamps)) || (NumberOfTimestamps > ContentSize))
+        {
+            return false;
+        }
+
+        Timestamps->resize(NumberOfTimestamps);
+
+        if(!ReadFromIndexCache(Cursor, ContentEnd, Timestamps->data(), sizeof(uint64) * NumberOfTimestamps))
+        {
+            return false;
+        }
+    }
+
+    // the cache must not contain any further data
+    return Cursor == ContentEnd;
+}
+
+boolean DatasetReaderBase::ReadFromIndexCache(const uint8*& Cursor,
+                                              const uint8*  ContentEnd,
+                                              void*         Value,
+                                              const uint64  ValueSize)
+{
+    if(static_cast<uint64>(ContentEnd - Cursor) < ValueSize)
+    {
+        return false;
+    }
+
+    std::memcpy(Value, Cursor, ValueSize);
+    Cursor += ValueSize;
+
+    return true;
+}
+
+boolean DatasetReaderBase::ReadImageDimensions(const std::string& FilenameImage,
+                                               uint32&            ImageHeight,
+                                               uint32&            ImageWidth)
+{
+    std::ifstream ImageStream(FilenameImage, std::ios::binary);
+
+    // detect format by the first byte of the file
+    const sint32 FirstByte{ImageStream.peek()};
+
+    switch(FirstByte)
+    {
+        case 0x89:
+            return ParseHeaderPNG(ImageStream, ImageHeight, ImageWidth);
+        case 0xFF:
+            return ParseHeaderJPEG(ImageStream, ImageHeight, ImageWidth);
+        case 'P':
+            return ParseHeaderPNM(ImageStream, ImageHeight, ImageWidth);
+        default:
+            return false;
+    }
+}
+
+boolean DatasetReaderBase::ReadStringFromIndexCache(const uint8*& Cursor,
+                                                    const uint8*  ContentEnd,
+                                                    std::string&  Value)
+{
+    uint64 Length{0U};
+
+    if(!ReadFromIndexCache(Cursor, ContentEnd, &Length, sizeof(Length)) || (static_cast<uint64>(ContentEnd - Cursor) < Length))
+    {
+        return false;
+    }
+
+    Value.assign(reinterpret_cast<const char*>(Cursor), Length);
+    Cursor += Length;
+
+    return true;
+}
+
+void DatasetReaderBase::SaveIndexCache(const std::filesystem::path&              FilenameIndexCache,
+                                       const std::vector<std::filesystem::path>& SourcePaths) const
+{
+    const uint32 IndexCacheMagic{0x58444952U}; // "RIDX"
+    const uint32 IndexCacheVersion{2U};
+
+    const std::filesystem::path FilenameTemporary{CreateTemporaryFilename(FilenameIndexCache)};
+
+    {
+        std::ofstream IndexCache(FilenameTemporary, std::ios::binary | std::ios::trunc);
+
+        if(!IndexCache)
+        {
+            return;
+        }
+
+        // write magic number, version and fingerprints of the sources
+        const uint64 NumberOfSources{SourcePaths.size()};
+
+        IndexCache.write(reinterpret_cast<const char*>(&IndexCacheMagic), sizeof(IndexCacheMagic));
+        IndexCache.write(reinterpret_cast<const char*>(&IndexCacheVersion), sizeof(IndexCacheVersion));
+        IndexCache.write(reinterpret_cast<const char*>(&NumberOfSources), sizeof(NumberOfSources));
+
+        for(const std::filesystem::path& SourcePath : SourcePaths)
+        {
+            sint64 ModificationTime{0};
+            uint64 Size{0U};
+
+            if(!ComputeSourceFingerprint(SourcePath, ModificationTime, Size))
+            {
+                IndexCache.setstate(std::ios::failbit);
+                break;
+            }
+
+            WriteStringToIndexCache(IndexCache, SourcePath.string());
+            IndexCache.write(reinterpret_cast<const char*>(&ModificationTime), sizeof(ModificationTime));
+            IndexCache.write(reinterpret_cast<const char*>(&Size), sizeof(Size));
+        }
+
+        // write counters, image dimensions and projection matrices
+        IndexCache.write(reinterpret_cast<const char*>(&m_NumberOfImagesStereoLeft), sizeof(m_NumberOfImagesStereoLeft));
+        IndexCache.write(reinterpret_cast<const char*>(&m_NumberOfImagesStereoRight), sizeof(m_NumberOfImagesStereoRight));
+        IndexCache.write(reinterpret_cast<const char*>(&m_NumberOfTimestampsStereoLeft), sizeof(m_NumberOfTimestampsStereoLeft));
+        IndexCache.write(reinterpret_cast<const char*>(&m_NumberOfTimestampsStereoRight), sizeof(m_NumberOfTimestampsStereoRight));
+        IndexCache.write(reinterpret_cast<const char*>(&m_HeightImagesStereo), sizeof(m_HeightImagesStereo));
+        IndexCache.write(reinterpret_cast<const char*>(&m_WidthImagesStereo), sizeof(m_WidthImagesStereo));
+        IndexCache.write(reinterpret_cast<const char*>(m_ProjectionMatrixStereoLeft.data()), static_cast<std::streamsize>(sizeof(float64) * m_ProjectionMatrixStereoLeft.size()));
+        IndexCache.write(reinterpret_cast<const char*>(m_ProjectionMatrixStereoRight.data()), static_cast<std::streamsize>(sizeof(float64) * m_ProjectionMatrixStereoRight.size()));
+
+        // write filenames and timestamps of both stereo cameras
+        for(const std::vector<std::string>* Filenames : {&m_FilenamesWithPathImagesStereoLeft, &m_FilenamesWithPathImagesStereoRight})
+        {
+            const uint64 NumberOfFilenames{Filenames->size()};
+
+            IndexCache.write(reinterpret_cast<const char*>(&NumberOfFilenames), sizeof(NumberOfFilenames));
+
+            for(const std::string& Filename : *Filenames)
+            {
+                WriteStringToIndexCache(IndexCache, Filename);
+            }
+        }
+
+        for(const ListUInt64* Timestamps : {&m_TimestampsImagesStereoLeftNanoseconds, &m_TimestampsImagesStereoRightNanoseconds})
+        {
+            const uint64 NumberOfTimestamps{Timestamps->size()};
+
+            IndexCache.write(reinterpret_cast<const char*>(&NumberOfTimestamps), sizeof(NumberOfTimestamps));
+            IndexCache.write(reinterpret_cast<const char*>(Timestamps->data()), static_cast<std::streamsize>(sizeof(uint64) * NumberOfTimestamps));
+        }
+
+        if(!IndexCache.flush())
+        {
+            std::error_code ErrorCode;
+
+            IndexCache.close();
+            std::filesystem::remove(FilenameTemporary, ErrorCode);
+
+            return;
+        }
+    }
+
+    // replace the cache atomically
+    std::error_code ErrorCode;
+
+    std::filesystem::rename(FilenameTemporary, FilenameIndexCache, ErrorCode);
+
+    if(ErrorCode)
+    {
+        std::filesystem::remove(FilenameTemporary, ErrorCode);
+    }
+}
+
+void DatasetReaderBase::WriteStringToIndexCache(std::ostream&      IndexCache,
+                                                const std::string& Value)
+{
+    const uint64 Length{Value.size()};
+
+    IndexCache.write(reinterpret_cast<const char*>(&Length), sizeof(Length));
+    IndexCache.write(Value.data(), static_cast<std::streamsize>(Length));
+}
@@ -27,6 +27,8 @@ the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
 #define DATASETREADERBASE_H
 
 #include <filesystem>
+#include <istream>
+#include <ostream>
 
 #include <opencv2/core/core.hpp>
 
@@ -40,15 +42,50 @@ the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
 struct ImageInformation
 {
     boolean     IsValid;                  ///< Flag whether the information is valid or not.
+    uint64      Index;                    ///< Index of the image.
     uint64      Timestamp;                ///< Timestamp of the image in nanoseconds.
-    std::string FilenameWithAbsolutePath; ///< Filename of the image including its absolute path.
+    std::string FilenameWithAbsolutePath; ///< Filename of the image including its absolute path (empty if the image was decoded into a buffer).
     cv::Mat     ImageGrayscale;           ///< Grayscale image.
 };
 
+///////////////////////////////////////////////////////////////////////////////
+/// \struct ImageBuffer
+///
+/// \brief  Caller-owned buffers an image is decoded into.
+///
+/// Both buffers are reused as long as they are large enough, i.e. decoding
+/// images of the same size into the same buffer does not allocate memory
+/// (apart from the internal state of the image codec).
+///////////////////////////////////////////////////////////////////////////////
+struct ImageBuffer
+{
+    std::vector<uint8> EncodedImage;   ///< Content of the image file.
+    cv::Mat            ImageGrayscale; ///< Decoded grayscale image.
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \enum  DecodingScale
+///
+/// \brief Defines the resolution the images are decoded at (the value is the
+///        reduction factor).
+///////////////////////////////////////////////////////////////////////////////
+enum DecodingScale
+{
+    DecodingScaleFull    = 1, ///< Full resolution.
+    DecodingScaleHalf    = 2, ///< Half resolution.
+    DecodingScaleQuarter = 4, ///< Quarter resolution.
+    DecodingScaleEighth  = 8  ///< Eighth resolution.
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 /// \class DatasetReaderBase
 ///
 /// \brief Base class for different kinds of dataset readers.
+///
+/// The dimensions of the stereo camera images are taken from the first left
+/// stereo camera image. The constructors do not check the remaining images,
+/// since this requires to read the headers of all images. The check is
+/// opt-in, i.e. ValidateImagesDimensions has to be called explicitly.
 ///////////////////////////////////////////////////////////////////////////////
 class DatasetReaderBase
 {
@@ -67,6 +104,11 @@ protected:
     uint32                   m_WidthImagesStereo;                      ///< Width of the stereo camera images.
     MatrixFloat64_3x4        m_ProjectionMatrixStereoLeft;             ///< Projection matrix of the left stereo camera.
     MatrixFloat64_3x4        m_ProjectionMatrixStereoRight;            ///< Projection matrix of the right stereo camera.
+    boolean                  m_HasDecodingOptions;                     ///< Flag whether decoding options are set or not.
+    DecodingScale            m_DecodingScale;                          ///< Resolution the images are decoded at.
+    cv::Rect                 m_RegionOfInterestDecoded;                ///< Region of interest (w.r.t. the image decoded at the reduced resolution).
+    MatrixFloat64_3x4        m_ProjectionMatrixStereoLeftDecoded;      ///< Projection matrix of the left stereo camera matching the decoding options.
+    MatrixFloat64_3x4        m_ProjectionMatrixStereoRightDecoded;     ///< Projection matrix of the right stereo camera matching the decoding options.
 
 public:
     ///////////////////////////////////////////////////////////////////////////////
@@ -84,7 +126,79 @@ public:
     virtual ~DatasetReaderBase();
 
     ///////////////////////////////////////////////////////////////////////////////
-    /// \brief  Getter for the height of the stereo camera images.
+    /// \brief      Decodes the left stereo camera image into a caller-owned buffer.
+    ///
+    /// In contrast to GetImageInformationStereoLeft, the filename is not copied
+    /// (it can be looked up by GetFilenameImageStereoLeft) and the image is a
+    /// header pointing to the buffer, i.e. it is overwritten as soon as another
+    /// image is decoded into the same buffer.
+    ///
+    /// \param[in]  Index            Index of the image.
+    /// \param[out] Buffer           Buffer the image is decoded into.
+    /// \param[out] ImageInformation Image information of the left stereo camera image.
+    ///////////////////////////////////////////////////////////////////////////////
+    virtual void DecodeImageStereoLeft(uint64            Index,
+                                       ImageBuffer&      Buffer,
+                                       ImageInformation& ImageInformation) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Decodes the right stereo camera image into a caller-owned buffer.
+    ///
+    /// See DecodeImageStereoLeft.
+    ///
+    /// \param[in]  Index            Index of the image.
+    /// \param[out] Buffer           Buffer the image is decoded into.
+    /// \param[out] ImageInformation Image information of the right stereo camera image.
+    ///////////////////////////////////////////////////////////////////////////////
+    virtual void DecodeImageStereoRight(uint64            Index,
+                                        ImageBuffer&      Buffer,
+                                        ImageInformation& ImageInformation) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Finds the frames whose left stereo camera image was taken
+    ///             within an interval.
+    ///
+    /// \param[in]  TimestampStartNanoseconds Start of the interval (in nanoseconds, included).
+    /// \param[in]  TimestampEndNanoseconds   End of the interval (in nanoseconds, included).
+    /// \param[out] FirstFrameIndex           Index of the first frame within the interval.
+    /// \param[out] NumberOfFrames            Number of frames within the interval.
+    ///////////////////////////////////////////////////////////////////////////////
+    void FindFramesInInterval(const uint64 TimestampStartNanoseconds,
+                              const uint64 TimestampEndNanoseconds,
+                              uint64&      FirstFrameIndex,
+                              uint64&      NumberOfFrames) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Finds the frame whose left stereo camera image was taken closest
+    ///            to the provided timestamp.
+    ///
+    /// \param[in] TimestampNanoseconds Timestamp (in nanoseconds).
+    ///
+    /// \return    Index of the frame.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 FindNearestFrame(const uint64 TimestampNanoseconds) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Getter for the filename of the left stereo camera image.
+    ///
+    /// \param[in] Index Index of the image.
+    ///
+    /// \return    Filename of the image including its absolute path.
+    ///////////////////////////////////////////////////////////////////////////////
+    const std::string& GetFilenameImageStereoLeft(uint64 Index) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Getter for the filename of the right stereo camera image.
+    ///
+    /// \param[in] Index Index of the image.
+    ///
+    /// \return    Filename of the image including its absolute path.
+    ///////////////////////////////////////////////////////////////////////////////
+    const std::string& GetFilenameImageStereoRight(uint64 Index) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the height of the stereo camera images (matching the
+    ///         decoding options).
     ///
     /// \return Height of the stereo camera images.
     ///////////////////////////////////////////////////////////////////////////////
@@ -96,8 +210,8 @@ public:
     /// \param[in]  Index Index of the image.
     /// \param[out] Index Image information of the left stereo camera image.
     ///////////////////////////////////////////////////////////////////////////////
-    void GetImageInformationStereoLeft(uint64            Index,
-                                       ImageInformation& ImageInformation) const;
+    virtual void GetImageInformationStereoLeft(uint64            Index,
+                                               ImageInformation& ImageInformation) const;
 
     ///////////////////////////////////////////////////////////////////////////////
     /// \brief      Getter for the information of the right stereo camera image.
@@ -105,11 +219,12 @@ public:
     /// \param[in]  Index Index of the image.
     /// \param[out] Index Image information of the right stereo camera image.
     ///////////////////////////////////////////////////////////////////////////////
-    void GetImageInformationStereoRight(uint64            Index,
-                                        ImageInformation& ImageInformation) const;
+    virtual void GetImageInformationStereoRight(uint64            Index,
+                                                ImageInformation& ImageInformation) const;
 
     ///////////////////////////////////////////////////////////////////////////////
-    /// \brief  Getter for the width of the stereo camera images.
+    /// \brief  Getter for the width of the stereo camera images (matching the
+    ///         decoding options).
     ///
     /// \return Width of the stereo camera images.
     ///////////////////////////////////////////////////////////////////////////////
@@ -123,23 +238,112 @@ public:
     uint64 GetNumberOfFrames() const;
 
     ///////////////////////////////////////////////////////////////////////////////
-    /// \brief  Getter for the projection matrix of the left stereo camera.
+    /// \brief  Getter for the projection matrix of the left stereo camera
+    ///         (matching the decoding options).
     ///
     /// \return Projection matrix of the left stereo camera.
     ///////////////////////////////////////////////////////////////////////////////
     const MatrixFloat64_3x4& GetProjectionMatrixStereoLeft() const;
 
     ///////////////////////////////////////////////////////////////////////////////
-    /// \brief  Getter for the projection matrix of the right stereo camera.
+    /// \brief  Getter for the projection matrix of the right stereo camera
+    ///         (matching the decoding options).
     ///
     /// \return Projection matrix of the right stereo camera.
     ///////////////////////////////////////////////////////////////////////////////
     const MatrixFloat64_3x4& GetProjectionMatrixStereoRight() const;
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Sets the resolution and the region of interest the images are
+    ///            decoded at.
+    ///
+    /// Reduced resolutions are decoded by the codec where supported (e.g. JPEG),
+    /// otherwise the image is downscaled after decoding. The reduced image
+    /// dimensions are rounded down. The region of interest is cropped without
+    /// copying the image, i.e. the returned image is not necessarily continuous.
+    /// The image dimensions and the projection matrices returned by the getters
+    /// are scaled and shifted accordingly.
+    ///
+    /// \param[in] Scale            Resolution the images are decoded at.
+    /// \param[in] RegionOfInterest Region of interest (w.r.t. the full resolution image, empty for the whole image).
+    ///////////////////////////////////////////////////////////////////////////////
+    void SetDecodingOptions(const DecodingScale Scale,
+                            const cv::Rect&     RegionOfInterest = cv::Rect());
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Checks whether all stereo camera images have the dimensions of
+    ///            the first image or not.
+    ///
+    /// Only the headers of the images are read (see ReadImageDimensions), i.e.
+    /// the check fails for images whose header cannot be parsed. The images
+    /// are distributed to several threads.
+    ///
+    /// \param[in] NumberOfThreads Number of threads used to read the headers.
+    ///
+    /// \return    Flag whether all images have the same dimensions or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    boolean ValidateImagesDimensions(const uint64 NumberOfThreads = 4U) const;
+
 protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief         Crops a decoded image to the region of interest (if decoding
+    ///                options are set).
+    ///
+    /// \param[in,out] Image Decoded image, replaced by a header pointing to the region of interest.
+    ///
+    /// \return        Flag whether the image contains the region of interest or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    boolean ApplyRegionOfInterest(cv::Mat& Image) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Computes the fingerprint of a file or a directory the index is
+    ///             based on.
+    ///
+    /// \param[in]  SourcePath       Path to the file or the directory.
+    /// \param[out] ModificationTime Time of the last modification.
+    /// \param[out] Size             Size of the file (zero for directories).
+    ///
+    /// \return     Flag whether the fingerprint could be computed or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    static boolean ComputeSourceFingerprint(const std::filesystem::path& SourcePath,
+                                            sint64&                      ModificationTime,
+                                            uint64&                      Size);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Creates the name of a temporary file which is renamed to the
+    ///            given file once it is written completely.
+    ///
+    /// The name contains the process and the thread, i.e. several processes and
+    /// threads can write the same file concurrently.
+    ///
+    /// \param[in] Filename Name of the file (including its path).
+    ///
+    /// \return    Name of the temporary file (including its path).
+    ///////////////////////////////////////////////////////////////////////////////
+    static std::filesystem::path CreateTemporaryFilename(const std::filesystem::path& Filename);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Decodes an image into a caller-owned buffer.
+    ///
+    /// The file is read into the encoded image buffer and decoded into the
+    /// grayscale image buffer.
+    ///
+    /// \param[in]  FilenameImage Filename of the image including its absolute path.
+    /// \param[in]  ReadMode      Mode the image is decoded with (see cv::ImreadModes).
+    /// \param[out] Buffer        Buffer the image is decoded into.
+    ///
+    /// \return     Flag whether the image was decoded or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    static boolean DecodeImage(const std::string& FilenameImage,
+                               const sint32       ReadMode,
+                               ImageBuffer&       Buffer);
+
     ///////////////////////////////////////////////////////////////////////////////
     /// \brief      Extracts the dimensions of the image.
     ///
+    /// The dimensions are read from the header of the image. The image is only
+    /// decoded if its format is not supported by ReadImageDimensions.
+    ///
     /// \param[in]  FilenameImage Filename of the image including its absolute path.
     /// \param[out] ImageHeight   Height of the image.
     /// \param[out] ImageWidth    Width of the image.
@@ -147,6 +351,150 @@ protected:
     static void ExtractImagesDimensions(const std::string& FilenameImage,
                                         uint32&            ImageHeight,
                                         uint32&            ImageWidth);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the mode the images are decoded with.
+    ///
+    /// \return Mode the images are decoded with (see cv::ImreadModes).
+    ///////////////////////////////////////////////////////////////////////////////
+    sint32 GetReadMode() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Loads the index of the sequence (filenames, timestamps, image
+    ///            dimensions and projection matrices) from the cache.
+    ///
+    /// The cache is memory-mapped. It is only used if its version matches and if
+    /// none of the files and directories it is based on changed since the cache
+    /// was written (time of the last modification and size).
+    ///
+    /// \param[in] FilenameIndexCache Filename of the cache including its absolute path.
+    /// \param[in] SourcePaths        Files and directories the index is based on.
+    ///
+    /// \return    Flag whether the index was loaded or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    boolean LoadIndexCache(const std::filesystem::path&              FilenameIndexCache,
+                           const std::vector<std::filesystem::path>& SourcePaths);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Parses the dimensions from the header of a JPEG image (first
+    ///             start of frame segment).
+    ///
+    /// \param[in]  ImageStream Stream of the image (positioned at the start of the image).
+    /// \param[out] ImageHeight Height of the image.
+    /// \param[out] ImageWidth  Width of the image.
+    ///
+    /// \return     Flag whether the header could be parsed or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    static boolean ParseHeaderJPEG(std::istream& ImageStream,
+                                   uint32&       ImageHeight,
+                                   uint32&       ImageWidth);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Parses the dimensions from the header of a PNG image (IHDR
+    ///             chunk).
+    ///
+    /// \param[in]  ImageStream Stream of the image (positioned at the start of the image).
+    /// \param[out] ImageHeight Height of the image.
+    /// \param[out] ImageWidth  Width of the image.
+    ///
+    /// \return     Flag whether the header could be parsed or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    static boolean ParseHeaderPNG(std::istream& ImageStream,
+                                  uint32&       ImageHeight,
+                                  uint32&       ImageWidth);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Parses the dimensions from the header of a PNM image (PBM, PGM
+    ///             or PPM).
+    ///
+    /// \param[in]  ImageStream Stream of the image (positioned at the start of the image).
+    /// \param[out] ImageHeight Height of the image.
+    /// \param[out] ImageWidth  Width of the image.
+    ///
+    /// \return     Flag whether the header could be parsed or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    static boolean ParseHeaderPNM(std::istream& ImageStream,
+                                  uint32&       ImageHeight,
+                                  uint32&       ImageWidth);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Parses the index of the sequence from the content of the cache.
+    ///
+    /// \param[in] Content     Content of the cache.
+    /// \param[in] ContentSize Size of the content (in bytes).
+    /// \param[in] SourcePaths Files and directories the index is based on.
+    ///
+    /// \return    Flag whether the index was parsed or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    boolean ParseIndexCache(const uint8*                              Content,
+                            const uint64                              ContentSize,
+                            const std::vector<std::filesystem::path>& SourcePaths);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief         Reads a value from the content of the cache.
+    ///
+    /// \param[in,out] Cursor     Current position in the content (moved behind the value).
+    /// \param[in]     ContentEnd End of the content.
+    /// \param[out]    Value      Value.
+    /// \param[in]     ValueSize  Size of the value (in bytes).
+    ///
+    /// \return        Flag whether the value was read or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    static boolean ReadFromIndexCache(const uint8*& Cursor,
+                                      const uint8*  ContentEnd,
+                                      void*         Value,
+                                      const uint64  ValueSize);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Reads the dimensions of an image without decoding it.
+    ///
+    /// The format is detected by the signature of the file. PNG, JPEG and PNM
+    /// images are supported.
+    ///
+    /// \param[in]  FilenameImage Filename of the image including its absolute path.
+    /// \param[out] ImageHeight   Height of the image.
+    /// \param[out] ImageWidth    Width of the image.
+    ///
+    /// \return     Flag whether the dimensions could be read or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    static boolean ReadImageDimensions(const std::string& FilenameImage,
+                                       uint32&            ImageHeight,
+                                       uint32&            ImageWidth);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief         Reads a string from the content of the cache.
+    ///
+    /// \param[in,out] Cursor     Current position in the content (moved behind the string).
+    /// \param[in]     ContentEnd End of the content.
+    /// \param[out]    Value      String.
+    ///
+    /// \return        Flag whether the string was read or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    static boolean ReadStringFromIndexCache(const uint8*& Cursor,
+                                            const uint8*  ContentEnd,
+                                            std::string&  Value);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Saves the index of the sequence to the cache.
+    ///
+    /// The cache is written to a temporary file which is renamed afterwards, so
+    /// readers never see a partially written cache. Errors are ignored (e.g. if
+    /// the dataset is located on a read-only file system).
+    ///
+    /// \param[in] FilenameIndexCache Filename of the cache including its absolute path.
+    /// \param[in] SourcePaths        Files and directories the index is based on.
+    ///////////////////////////////////////////////////////////////////////////////
+    void SaveIndexCache(const std::filesystem::path&              FilenameIndexCache,
+                        const std::vector<std::filesystem::path>& SourcePaths) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief         Writes a string to the cache.
+    ///
+    /// \param[in,out] IndexCache Stream of the cache.
+    /// \param[in]     Value      String.
+    ///////////////////////////////////////////////////////////////////////////////
+    static void WriteStringToIndexCache(std::ostream&      IndexCache,
+                                        const std::string& Value);
 };
 
 #endif // DATASETREADERBASE_H
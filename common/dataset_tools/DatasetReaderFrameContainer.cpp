@@ -0,0 +1,407 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file DatasetReaderFrameContainer.cpp
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <opencv2/imgproc/imgproc.hpp>
+
+#include "DatasetReaderFrameContainer.h"
+
+DatasetReaderFrameContainer::DatasetReaderFrameContainer(const std::string& FilenameFrameContainer) :
+    DatasetReaderBase(std::filesystem::path(FilenameFrameContainer).parent_path().string(), std::filesystem::path(FilenameFrameContainer).filename().string()),
+    m_Mapping{nullptr},
+    m_MappingSize{0U}
+{
+    // map the frame container into memory
+    const sint32 FileDescriptor{open(FilenameFrameContainer.c_str(), O_RDONLY)};
+
+    if(FileDescriptor < 0)
+    {
+        throw std::invalid_argument("File " + FilenameFrameContainer + " does not exist.");
+    }
+
+    struct stat FileStatus{};
+
+    if((fstat(FileDescriptor, &FileStatus) != 0) || (FileStatus.st_size <= 0))
+    {
+        close(FileDescriptor);
+        throw std::invalid_argument("File " + FilenameFrameContainer + " is not a valid frame container.");
+    }
+
+    m_MappingSize = static_cast<uint64>(FileStatus.st_size);
+
+    // private writable mapping: the images handed out may be modified by the caller, the written pages are copied on write and never reach the file
+    void* Mapping{mmap(nullptr, m_MappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, FileDescriptor, 0)};
+
+    close(FileDescriptor);
+
+    if(Mapping == MAP_FAILED)
+    {
+        throw std::runtime_error("File " + FilenameFrameContainer + " could not be mapped into memory.");
+    }
+
+    m_Mapping = static_cast<uint8*>(Mapping);
+
+    // the frames are usually replayed in ascending order (aggressive read-ahead, pages can be dropped early)
+    madvise(m_Mapping, m_MappingSize, MADV_SEQUENTIAL);
+
+    // parse header and frame table
+    if(!ParseFrameContainer())
+    {
+        munmap(m_Mapping, m_MappingSize);
+        throw std::invalid_argument("File " + FilenameFrameContainer + " is not a valid frame container.");
+    }
+}
+
+DatasetReaderFrameContainer::~DatasetReaderFrameContainer()
+{
+    munmap(m_Mapping, m_MappingSize);
+}
+
+void DatasetReaderFrameContainer::ConvertDataset(const DatasetReaderBase& Reader,
+                                                 const std::string&       FilenameFrameContainer)
+{
+    const uint32 FrameContainerMagic{0x4D524652U}; // "RFRM"
+    const uint32 FrameContainerVersion{1U};
+    const uint64 Alignment{4096U};
+
+    const uint64 NumberOfFrames{Reader.GetNumberOfFrames()};
+    const uint32 HeightImagesStereo{Reader.GetImageHeightStereoImages()};
+    const uint32 WidthImagesStereo{Reader.GetImageWidthStereoImages()};
+
+    const std::filesystem::path FilenameTemporary{CreateTemporaryFilename(FilenameFrameContainer)};
+
+    std::ofstream FrameContainer(FilenameTemporary, std::ios::binary | std::ios::trunc);
+
+    if(!FrameContainer)
+    {
+        throw std::runtime_error("File " + FilenameTemporary.string() + " could not be created.");
+    }
+
+    // write header (the offset of the frame table is patched after the images are written)
+    uint64 OffsetFrameTable{0U};
+
+    FrameContainer.write(reinterpret_cast<const char*>(&FrameContainerMagic), sizeof(FrameContainerMagic));
+    FrameContainer.write(reinterpret_cast<const char*>(&FrameContainerVersion), sizeof(FrameContainerVersion));
+    FrameContainer.write(reinterpret_cast<const char*>(&Alignment), sizeof(Alignment));
+    FrameContainer.write(reinterpret_cast<const char*>(&NumberOfFrames), sizeof(NumberOfFrames));
+    FrameContainer.write(reinterpret_cast<const char*>(&HeightImagesStereo), sizeof(HeightImagesStereo));
+    FrameContainer.write(reinterpret_cast<const char*>(&WidthImagesStereo), sizeof(WidthImagesStereo));
+    FrameContainer.write(reinterpret_cast<const char*>(Reader.GetProjectionMatrixStereoLeft().data()), static_cast<std::streamsize>(sizeof(float64) * Reader.GetProjectionMatrixStereoLeft().size()));
+    FrameContainer.write(reinterpret_cast<const char*>(Reader.GetProjectionMatrixStereoRight().data()), static_cast<std::streamsize>(sizeof(float64) * Reader.GetProjectionMatrixStereoRight().size()));
+
+    const std::streamoff PositionOffsetFrameTable{FrameContainer.tellp()};
+
+    FrameContainer.write(reinterpret_cast<const char*>(&OffsetFrameTable), sizeof(OffsetFrameTable));
+
+    uint64 Position{static_cast<uint64>(PositionOffsetFrameTable) + sizeof(OffsetFrameTable)};
+
+    // write images (each image starts at an aligned offset)
+    ListUInt64               TimestampsImagesStereoLeft;
+    ListUInt64               TimestampsImagesStereoRight;
+    ListUInt64               OffsetsImagesStereoLeft;
+    ListUInt64               OffsetsImagesStereoRight;
+    std::vector<std::string> FilenamesImagesStereoLeft;
+    std::vector<std::string> FilenamesImagesStereoRight;
+
+    const std::function<void(const ImageInformation&, ListUInt64&, ListUInt64&, std::vector<std::string>&)> WriteImage = [&](const ImageInformation& CurrentImageInformation, ListUInt64& Timestamps, ListUInt64& Offsets, std::vector<std::string>& Filenames)
+    {
+        const cv::Mat& Image{CurrentImageInformation.ImageGrayscale};
+
+        if(Image.empty() || (Image.type() != CV_8UC1) || (static_cast<uint32>(Image.rows) != HeightImagesStereo) || (static_cast<uint32>(Image.cols) != WidthImagesStereo))
+        {
+            std::error_code ErrorCode;
+
+            FrameContainer.close();
+            std::filesystem::remove(FilenameTemporary, ErrorCode);
+
+            throw std::invalid_argument("Image " + CurrentImageInformation.FilenameWithAbsolutePath + " is not a grayscale image with the dimensions of the dataset.");
+        }
+
+        Position = WritePadding(FrameContainer, Position, Alignment);
+
+        Timestamps.push_back(CurrentImageInformation.Timestamp);
+        Offsets.push_back(Position);
+        Filenames.push_back(CurrentImageInformation.FilenameWithAbsolutePath);
+
+        // write the image row by row (the decoded image is not necessarily continuous)
+        for(uint32 i_Row{0U}; i_Row < HeightImagesStereo; i_Row++)
+        {
+            FrameContainer.write(Image.ptr<char>(static_cast<sint32>(i_Row)), static_cast<std::streamsize>(WidthImagesStereo));
+        }
+
+        Position += static_cast<uint64>(HeightImagesStereo) * WidthImagesStereo;
+    };
+
+    for(uint64 i_Frame{0U}; i_Frame < NumberOfFrames; i_Frame++)
+    {
+        ImageInformation ImageInformationStereoLeft;
+        ImageInformation ImageInformationStereoRight;
+
+        // a failing image must not leave the temporary file behind
+        try
+        {
+            Reader.GetImageInformationStereoLeft(i_Frame, ImageInformationStereoLeft);
+            Reader.GetImageInformationStereoRight(i_Frame, ImageInformationStereoRight);
+        }
+        catch(...)
+        {
+            std::error_code ErrorCode;
+
+            FrameContainer.close();
+            std::filesystem::remove(FilenameTemporary, ErrorCode);
+
+            throw;
+        }
+
+        WriteImage(ImageInformationStereoLeft, TimestampsImagesStereoLeft, OffsetsImagesStereoLeft, FilenamesImagesStereoLeft);
+        WriteImage(ImageInformationStereoRight, TimestampsImagesStereoRight, OffsetsImagesStereoRight, FilenamesImagesStereoRight);
+    }
+
+    // write frame table (timestamps and offsets of both images, followed by the filenames of the source images)
+    OffsetFrameTable = Position;
+
+    for(uint64 i_Frame{0U}; i_Frame < NumberOfFrames; i_Frame++)
+    {
+        FrameContainer.write(reinterpret_cast<const char*>(&TimestampsImagesStereoLeft[i_Frame]), sizeof(uint64));
+        FrameContainer.write(reinterpret_cast<const char*>(&TimestampsImagesStereoRight[i_Frame]), sizeof(uint64));
+        FrameContainer.write(reinterpret_cast<const char*>(&OffsetsImagesStereoLeft[i_Frame]), sizeof(uint64));
+        FrameContainer.write(reinterpret_cast<const char*>(&OffsetsImagesStereoRight[i_Frame]), sizeof(uint64));
+    }
+
+    for(uint64 i_Frame{0U}; i_Frame < NumberOfFrames; i_Frame++)
+    {
+        WriteStringToIndexCache(FrameContainer, FilenamesImagesStereoLeft[i_Frame]);
+        WriteStringToIndexCache(FrameContainer, FilenamesImagesStereoRight[i_Frame]);
+    }
+
+    // patch the offset of the frame table
+    FrameContainer.seekp(PositionOffsetFrameTable);
+    FrameContainer.write(reinterpret_cast<const char*>(&OffsetFrameTable), sizeof(OffsetFrameTable));
+
+    std::error_code ErrorCode;
+
+    if(!FrameContainer.flush())
+    {
+        FrameContainer.close();
+        std::filesystem::remove(FilenameTemporary, ErrorCode);
+
+        throw std::runtime_error("File " + FilenameTemporary.string() + " could not be written.");
+    }
+
+    FrameContainer.close();
+
+    // replace the frame container atomically
+    std::filesystem::rename(FilenameTemporary, FilenameFrameContainer, ErrorCode);
+
+    if(ErrorCode)
+    {
+        std::filesystem::remove(FilenameTemporary, ErrorCode);
+
+        throw std::runtime_error("File " + FilenameFrameContainer + " could not be written.");
+    }
+}
+
+void DatasetReaderFrameContainer::DecodeImageStereoLeft(uint64            Index,
+                                                        ImageBuffer&      Buffer,
+                                                        ImageInformation& ImageInformation) const
+{
+    // collect image information (without copying the filename)
+    ImageInformation.IsValid   = true;
+    ImageInformation.Index     = Index;
+    ImageInformation.Timestamp = m_TimestampsImagesStereoLeftNanoseconds[Index];
+    ImageInformation.FilenameWithAbsolutePath.clear();
+    ImageInformation.ImageGrayscale = ExtractImage(m_OffsetsImagesStereoLeft[Index], Buffer.ImageGrayscale);
+}
+
+void DatasetReaderFrameContainer::DecodeImageStereoRight(uint64            Index,
+                                                         ImageBuffer&      Buffer,
+                                                         ImageInformation& ImageInformation) const
+{
+    // collect image information (without copying the filename)
+    ImageInformation.IsValid   = true;
+    ImageInformation.Index     = Index;
+    ImageInformation.Timestamp = m_TimestampsImagesStereoRightNanoseconds[Index];
+    ImageInformation.FilenameWithAbsolutePath.clear();
+    ImageInformation.ImageGrayscale = ExtractImage(m_OffsetsImagesStereoRight[Index], Buffer.ImageGrayscale);
+}
+
+void DatasetReaderFrameContainer::GetImageInformationStereoLeft(uint64            Index,
+                                                                ImageInformation& ImageInformation) const
+{
+    // collect image information (the image is a header pointing into the mapping unless a reduced resolution is set)
+    cv::Mat ImageReduced;
+
+    ImageInformation.IsValid                  = true;
+    ImageInformation.Index                    = Index;
+    ImageInformation.Timestamp                = m_TimestampsImagesStereoLeftNanoseconds[Index];
+    ImageInformation.FilenameWithAbsolutePath = m_FilenamesWithPathImagesStereoLeft[Index];
+    ImageInformation.ImageGrayscale           = ExtractImage(m_OffsetsImagesStereoLeft[Index], ImageReduced);
+}
+
+void DatasetReaderFrameContainer::GetImageInformationStereoRight(uint64            Index,
+                                                                 ImageInformation& ImageInformation) const
+{
+    // collect image information (the image is a header pointing into the mapping unless a reduced resolution is set)
+    cv::Mat ImageReduced;
+
+    ImageInformation.IsValid                  = true;
+    ImageInformation.Index                    = Index;
+    ImageInformation.Timestamp                = m_TimestampsImagesStereoRightNanoseconds[Index];
+    ImageInformation.FilenameWithAbsolutePath = m_FilenamesWithPathImagesStereoRight[Index];
+    ImageInformation.ImageGrayscale           = ExtractImage(m_OffsetsImagesStereoRight[Index], ImageReduced);
+}
+
+cv::Mat DatasetReaderFrameContainer::ExtractImage(const uint64 Offset,
+                                                 cv::Mat&     ImageReduced) const
+{
+    const cv::Mat Image(static_cast<sint32>(m_HeightImagesStereo), static_cast<sint32>(m_WidthImagesStereo), CV_8UC1, m_Mapping + Offset);
+
+    if(!m_HasDecodingOptions)
+    {
+        return Image;
+    }
+
+    // region of interest w.r.t. the stored resolution (each reduced pixel merges a block of stored pixels)
+    const sint32 ReductionFactor{static_cast<sint32>(m_DecodingScale)};
+
+    const cv::Mat ImageRegion{Image(cv::Rect(m_RegionOfInterestDecoded.x * ReductionFactor, m_RegionOfInterestDecoded.y * ReductionFactor, m_RegionOfInterestDecoded.width * ReductionFactor, m_RegionOfInterestDecoded.height * ReductionFactor))};
+
+    if(m_DecodingScale == DecodingScaleFull)
+    {
+        return ImageRegion;
+    }
+
+    cv::resize(ImageRegion, ImageReduced, cv::Size(m_RegionOfInterestDecoded.width, m_RegionOfInterestDecoded.height), 0.0, 0.0, cv::INTER_AREA);
+
+    return ImageReduced;
+}
+
+boolean DatasetReaderFrameContainer::ParseFrameContainer()
+{
+    const uint32 FrameContainerMagic{0x4D524652U}; // "RFRM"
+    const uint32 FrameContainerVersion{1U};
+
+    const uint8* Cursor{m_Mapping};
+    const uint8* ContentEnd{m_Mapping + m_MappingSize};
+
+    // check magic number and version
+    uint32 Magic{0U};
+    uint32 Version{0U};
+
+    if(!ReadFromIndexCache(Cursor, ContentEnd, &Magic, sizeof(Magic)) || !ReadFromIndexCache(Cursor, ContentEnd, &Version, sizeof(Version)) || (Magic != FrameContainerMagic) || (Version != FrameContainerVersion))
+    {
+        return false;
+    }
+
+    // read header
+    uint64 Alignment{0U};
+    uint64 NumberOfFrames{0U};
+    uint64 OffsetFrameTable{0U};
+
+    if(!ReadFromIndexCache(Cursor, ContentEnd, &Alignment, sizeof(Alignment)) ||
+       !ReadFromIndexCache(Cursor, ContentEnd, &NumberOfFrames, sizeof(NumberOfFrames)) ||
+       !ReadFromIndexCache(Cursor, ContentEnd, &m_HeightImagesStereo, sizeof(m_HeightImagesStereo)) ||
+       !ReadFromIndexCache(Cursor, ContentEnd, &m_WidthImagesStereo, sizeof(m_WidthImagesStereo)) ||
+       !ReadFromIndexCache(Cursor, ContentEnd, m_ProjectionMatrixStereoLeft.data(), sizeof(float64) * m_ProjectionMatrixStereoLeft.size()) ||
+       !ReadFromIndexCache(Cursor, ContentEnd, m_ProjectionMatrixStereoRight.data(), sizeof(float64) * m_ProjectionMatrixStereoRight.size()) ||
+       !ReadFromIndexCache(Cursor, ContentEnd, &OffsetFrameTable, sizeof(OffsetFrameTable)))
+    {
+        return false;
+    }
+
+    if((Alignment == 0U) || (OffsetFrameTable > m_MappingSize) || (NumberOfFrames > ((m_MappingSize - OffsetFrameTable) / (4U * sizeof(uint64)))))
+    {
+        return false;
+    }
+
+    // read frame table (all images must be aligned and located in front of the frame table)
+    const uint64 ImageSize{static_cast<uint64>(m_HeightImagesStereo) * m_WidthImagesStereo};
+
+    m_TimestampsImagesStereoLeftNanoseconds.resize(NumberOfFrames);
+    m_TimestampsImagesStereoRightNanoseconds.resize(NumberOfFrames);
+    m_OffsetsImagesStereoLeft.resize(NumberOfFrames);
+    m_OffsetsImagesStereoRight.resize(NumberOfFrames);
+    m_FilenamesWithPathImagesStereoLeft.resize(NumberOfFrames);
+    m_FilenamesWithPathImagesStereoRight.resize(NumberOfFrames);
+
+    Cursor = m_Mapping + OffsetFrameTable;
+
+    for(uint64 i_Frame{0U}; i_Frame < NumberOfFrames; i_Frame++)
+    {
+        if(!ReadFromIndexCache(Cursor, ContentEnd, &m_TimestampsImagesStereoLeftNanoseconds[i_Frame], sizeof(uint64)) ||
+           !ReadFromIndexCache(Cursor, ContentEnd, &m_TimestampsImagesStereoRightNanoseconds[i_Frame], sizeof(uint64)) ||
+           !ReadFromIndexCache(Cursor, ContentEnd, &m_OffsetsImagesStereoLeft[i_Frame], sizeof(uint64)) ||
+           !ReadFromIndexCache(Cursor, ContentEnd, &m_OffsetsImagesStereoRight[i_Frame], sizeof(uint64)))
+        {
+            return false;
+        }
+
+        for(const uint64 Offset : {m_OffsetsImagesStereoLeft[i_Frame], m_OffsetsImagesStereoRight[i_Frame]})
+        {
+            if(((Offset % Alignment) != 0U) || (Offset > OffsetFrameTable) || (ImageSize > (OffsetFrameTable - Offset)))
+            {
+                return false;
+            }
+        }
+    }
+
+    for(uint64 i_Frame{0U}; i_Frame < NumberOfFrames; i_Frame++)
+    {
+        if(!ReadStringFromIndexCache(Cursor, ContentEnd, m_FilenamesWithPathImagesStereoLeft[i_Frame]) || !ReadStringFromIndexCache(Cursor, ContentEnd, m_FilenamesWithPathImagesStereoRight[i_Frame]))
+        {
+            return false;
+        }
+    }
+
+    m_NumberOfImagesStereoLeft      = NumberOfFrames;
+    m_NumberOfImagesStereoRight     = NumberOfFrames;
+    m_NumberOfTimestampsStereoLeft  = NumberOfFrames;
+    m_NumberOfTimestampsStereoRight = NumberOfFrames;
+
+    // the frame container must not contain any further data
+    return Cursor == ContentEnd;
+}
+
+uint64 DatasetReaderFrameContainer::WritePadding(std::ostream& FrameContainer,
+                                                 const uint64  Position,
+                                                 const uint64  Alignment)
+{
+    const uint64 PaddingSize{(Alignment - (Position % Alignment)) % Alignment};
+
+    for(uint64 i_Byte{0U}; i_Byte < PaddingSize; i_Byte++)
+    {
+        FrameContainer.put('\0');
+    }
+
+    return Position + PaddingSize;
+}
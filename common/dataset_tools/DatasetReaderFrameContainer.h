@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file DatasetReaderFrameContainer.h
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#ifndef DATASETREADERFRAMECONTAINER_H
+#define DATASETREADERFRAMECONTAINER_H
+
+#include "DatasetReaderBase.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class DatasetReaderFrameContainer
+///
+/// \brief Dataset reader for frame containers holding pre-decoded stereo
+///        camera images.
+///
+/// A frame container is created from any other dataset reader (see
+/// ConvertDataset). It stores the grayscale images of all frames raw and
+/// page-aligned in a single file, together with a table containing the offsets
+/// and timestamps of the images. The container is memory-mapped, i.e. the
+/// images handed out by this reader are headers pointing into the mapping
+/// (nothing is decoded or copied). The mapping is private, i.e. modifying these
+/// images copies the affected pages and never changes the container. The
+/// images are only valid as long as the reader exists; they have to be cloned
+/// if they shall be kept longer.
+///////////////////////////////////////////////////////////////////////////////
+class DatasetReaderFrameContainer : public DatasetReaderBase
+{
+protected:
+    uint8*     m_Mapping;                  ///< Memory-mapped content of the frame container.
+    uint64     m_MappingSize;              ///< Size of the memory-mapped content (in bytes).
+    ListUInt64 m_OffsetsImagesStereoLeft;  ///< List of offsets of the left stereo camera images (w.r.t. the start of the container).
+    ListUInt64 m_OffsetsImagesStereoRight; ///< List of offsets of the right stereo camera images (w.r.t. the start of the container).
+
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Constructor.
+    ///
+    /// \param[in] FilenameFrameContainer Filename of the frame container including its absolute path.
+    ///////////////////////////////////////////////////////////////////////////////
+    explicit DatasetReaderFrameContainer(const std::string& FilenameFrameContainer);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Copy constructor (deleted, the mapping is owned by the reader).
+    ///////////////////////////////////////////////////////////////////////////////
+    DatasetReaderFrameContainer(const DatasetReaderFrameContainer&) = delete;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor.
+    ///////////////////////////////////////////////////////////////////////////////
+    ~DatasetReaderFrameContainer();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Copy assignment operator (deleted, the mapping is owned by the
+    ///        reader).
+    ///////////////////////////////////////////////////////////////////////////////
+    DatasetReaderFrameContainer& operator=(const DatasetReaderFrameContainer&) = delete;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Converts a dataset into a frame container.
+    ///
+    /// All images of the dataset are decoded once by the provided reader. They
+    /// must be grayscale images with the dimensions reported by the reader. The
+    /// container is written to a temporary file which is renamed afterwards.
+    ///
+    /// \param[in] Reader                 Dataset reader used to decode the images.
+    /// \param[in] FilenameFrameContainer Filename of the frame container including its absolute path.
+    ///////////////////////////////////////////////////////////////////////////////
+    static void ConvertDataset(const DatasetReaderBase& Reader,
+                               const std::string&       FilenameFrameContainer);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Decodes the left stereo camera image.
+    ///
+    /// The image points into the mapping. The buffer is only used if a reduced
+    /// resolution is set (see SetDecodingOptions), the image is downscaled into
+    /// it.
+    ///
+    /// \param[in]  Index            Index of the image.
+    /// \param[out] Buffer           Buffer the image is downscaled into.
+    /// \param[out] ImageInformation Image information of the left stereo camera image.
+    ///////////////////////////////////////////////////////////////////////////////
+    void DecodeImageStereoLeft(uint64            Index,
+                               ImageBuffer&      Buffer,
+                               ImageInformation& ImageInformation) const override;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Decodes the right stereo camera image.
+    ///
+    /// The image points into the mapping. The buffer is only used if a reduced
+    /// resolution is set (see SetDecodingOptions), the image is downscaled into
+    /// it.
+    ///
+    /// \param[in]  Index            Index of the image.
+    /// \param[out] Buffer           Buffer the image is downscaled into.
+    /// \param[out] ImageInformation Image information of the right stereo camera image.
+    ///////////////////////////////////////////////////////////////////////////////
+    void DecodeImageStereoRight(uint64            Index,
+                                ImageBuffer&      Buffer,
+                                ImageInformation& ImageInformation) const override;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Getter for the information of the left stereo camera image.
+    ///
+    /// \param[in]  Index            Index of the image.
+    /// \param[out] ImageInformation Image information of the left stereo camera image (the image points into the mapping unless a reduced resolution is set).
+    ///////////////////////////////////////////////////////////////////////////////
+    void GetImageInformationStereoLeft(uint64            Index,
+                                       ImageInformation& ImageInformation) const override;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Getter for the information of the right stereo camera image.
+    ///
+    /// \param[in]  Index            Index of the image.
+    /// \param[out] ImageInformation Image information of the right stereo camera image (the image points into the mapping unless a reduced resolution is set).
+    ///////////////////////////////////////////////////////////////////////////////
+    void GetImageInformationStereoRight(uint64            Index,
+                                        ImageInformation& ImageInformation) const override;
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief         Extracts an image from the mapping according to the decoding
+    ///                options.
+    ///
+    /// The region of interest is a header pointing into the mapping. Only
+    /// reduced resolutions are computed (area interpolation of the region of
+    /// interest).
+    ///
+    /// \param[in]     Offset       Offset of the image (w.r.t. the start of the container).
+    /// \param[in,out] ImageReduced Image the region of interest is downscaled into (reused if its dimensions match).
+    ///
+    /// \return        Extracted image.
+    ///////////////////////////////////////////////////////////////////////////////
+    cv::Mat ExtractImage(const uint64 Offset,
+                         cv::Mat&     ImageReduced) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Parses the header and the frame table of the frame container.
+    ///
+    /// \return Flag whether the frame container is valid or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    boolean ParseFrameContainer();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief         Writes zeros to the frame container until the position is a
+    ///                multiple of the alignment.
+    ///
+    /// \param[in,out] FrameContainer Stream of the frame container.
+    /// \param[in]     Position       Current position in the frame container (in bytes).
+    /// \param[in]     Alignment      Alignment (in bytes).
+    ///
+    /// \return        Position behind the padding (in bytes).
+    ///////////////////////////////////////////////////////////////////////////////
+    static uint64 WritePadding(std::ostream& FrameContainer,
+                               const uint64  Position,
+                               const uint64  Alignment);
+};
+
+#endif // DATASETREADERFRAMECONTAINER_H
@@ -0,0 +1,107 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file ImageBufferPool.cpp
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#include "ImageBufferPool.h"
+
+ImageBufferPool::ImageBufferPool(const uint64 NumberOfBuffers,
+                                 const uint32 HeightImages,
+                                 const uint32 WidthImages,
+                                 const uint64 EncodedImageCapacity) :
+    m_HeightImages{HeightImages},
+    m_WidthImages{WidthImages},
+    m_EncodedImageCapacity{(EncodedImageCapacity > 0U) ? EncodedImageCapacity : static_cast<uint64>(HeightImages) * WidthImages}
+{
+    // preallocate the buffers (returning a buffer to the pool does not allocate memory)
+    m_BufferPool.reserve(NumberOfBuffers);
+
+    for(uint64 i_Buffer{0U}; i_Buffer < NumberOfBuffers; i_Buffer++)
+    {
+        m_BufferPool.push_back(CreateBuffer());
+    }
+}
+
+ImageBufferPool::~ImageBufferPool()
+{
+}
+
+uint64 ImageBufferPool::GetNumberOfAvailableBuffers()
+{
+    const std::lock_guard<std::mutex> Lock(m_BufferPoolMutex);
+
+    return m_BufferPool.size();
+}
+
+std::unique_ptr<ImageBuffer> ImageBufferPool::AcquireBuffer()
+{
+    // take a buffer from the pool (if available)
+    {
+        const std::lock_guard<std::mutex> Lock(m_BufferPoolMutex);
+
+        if(!m_BufferPool.empty())
+        {
+            std::unique_ptr<ImageBuffer> Buffer{std::move(m_BufferPool.back())};
+
+            m_BufferPool.pop_back();
+
+            return Buffer;
+        }
+    }
+
+    // create a new buffer (outside of the lock)
+    return CreateBuffer();
+}
+
+std::unique_ptr<ImageBuffer> ImageBufferPool::CreateBuffer() const
+{
+    std::unique_ptr<ImageBuffer> Buffer{new ImageBuffer};
+
+    Buffer->EncodedImage.reserve(m_EncodedImageCapacity);
+    Buffer->ImageGrayscale.create(static_cast<sint32>(m_HeightImages), static_cast<sint32>(m_WidthImages), CV_8UC1);
+
+    return Buffer;
+}
+
+void ImageBufferPool::ReleaseBuffer(std::unique_ptr<ImageBuffer> Buffer)
+{
+    const std::lock_guard<std::mutex> Lock(m_BufferPoolMutex);
+
+    m_BufferPool.push_back(std::move(Buffer));
+}
+
+ImageBufferPool::BufferLease::BufferLease(ImageBufferPool& Pool) :
+    m_ImageBufferPool{Pool},
+    m_Buffer{Pool.AcquireBuffer()}
+{
+}
+
+ImageBufferPool::BufferLease::~BufferLease()
+{
+    m_ImageBufferPool.ReleaseBuffer(std::move(m_Buffer));
+}
+
+ImageBuffer& ImageBufferPool::BufferLease::GetBuffer() const
+{
+    return *m_Buffer;
+}
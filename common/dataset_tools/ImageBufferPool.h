@@ -0,0 +1,145 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file ImageBufferPool.h
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#ifndef IMAGEBUFFERPOOL_H
+#define IMAGEBUFFERPOOL_H
+
+#include <memory>
+#include <mutex>
+
+#include "DatasetReaderBase.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class ImageBufferPool
+///
+/// \brief Pool of preallocated buffers the images of a dataset are decoded
+///        into.
+///
+/// All buffers are allocated for the image dimensions on construction. A
+/// buffer is leased from the pool (see BufferLease), used by a single thread
+/// and returned to the pool afterwards, i.e. a replay loop decoding into leased
+/// buffers does not allocate memory per frame. If more buffers are leased than
+/// preallocated, additional buffers are created and kept in the pool. A pool
+/// may be shared by several threads; pinned workers should use a pool of
+/// their own so that the buffers are allocated close to the worker.
+///////////////////////////////////////////////////////////////////////////////
+class ImageBufferPool
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \class BufferLease
+    ///
+    /// \brief Lease of a buffer from the pool.
+    ///
+    /// The buffer is taken from the pool on construction and is returned to the
+    /// pool on destruction of the lease.
+    ///////////////////////////////////////////////////////////////////////////////
+    class BufferLease
+    {
+    protected:
+        ImageBufferPool&             m_ImageBufferPool; ///< Pool owning the buffer.
+        std::unique_ptr<ImageBuffer> m_Buffer;          ///< Leased buffer.
+
+    public:
+        ///////////////////////////////////////////////////////////////////////////////
+        /// \brief     Constructor.
+        ///
+        /// \param[in] Pool Pool owning the buffer.
+        ///////////////////////////////////////////////////////////////////////////////
+        explicit BufferLease(ImageBufferPool& Pool);
+
+        ///////////////////////////////////////////////////////////////////////////////
+        /// \brief Destructor.
+        ///////////////////////////////////////////////////////////////////////////////
+        ~BufferLease();
+
+        ///////////////////////////////////////////////////////////////////////////////
+        /// \brief  Getter for the leased buffer.
+        ///
+        /// \return Leased buffer.
+        ///////////////////////////////////////////////////////////////////////////////
+        ImageBuffer& GetBuffer() const;
+    };
+
+protected:
+    const uint32                              m_HeightImages;         ///< Height of the images.
+    const uint32                              m_WidthImages;          ///< Width of the images.
+    const uint64                              m_EncodedImageCapacity; ///< Capacity of the encoded image buffers (in bytes).
+    std::mutex                                m_BufferPoolMutex;      ///< Mutex protecting the pool of buffers.
+    std::vector<std::unique_ptr<ImageBuffer>> m_BufferPool;           ///< Pool of buffers which are currently not leased.
+
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Constructor.
+    ///
+    /// \param[in] NumberOfBuffers      Number of buffers which are preallocated.
+    /// \param[in] HeightImages         Height of the images.
+    /// \param[in] WidthImages          Width of the images.
+    /// \param[in] EncodedImageCapacity Capacity of the encoded image buffers (in bytes, zero to use the size of the decoded image).
+    ///////////////////////////////////////////////////////////////////////////////
+    ImageBufferPool(const uint64 NumberOfBuffers,
+                    const uint32 HeightImages,
+                    const uint32 WidthImages,
+                    const uint64 EncodedImageCapacity = 0U);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor.
+    ///
+    /// All leases must be finished before the pool is destroyed.
+    ///////////////////////////////////////////////////////////////////////////////
+    ~ImageBufferPool();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the number of buffers which are currently not leased.
+    ///
+    /// \return Number of buffers which are currently not leased.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 GetNumberOfAvailableBuffers();
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Takes a buffer from the pool (a new buffer is created if the pool
+    ///         is empty).
+    ///
+    /// \return Buffer.
+    ///////////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<ImageBuffer> AcquireBuffer();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Creates a buffer allocated for the image dimensions.
+    ///
+    /// \return Buffer.
+    ///////////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<ImageBuffer> CreateBuffer() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Returns a buffer to the pool.
+    ///
+    /// \param[in] Buffer Buffer.
+    ///////////////////////////////////////////////////////////////////////////////
+    void ReleaseBuffer(std::unique_ptr<ImageBuffer> Buffer);
+};
+
+#endif // IMAGEBUFFERPOOL_H
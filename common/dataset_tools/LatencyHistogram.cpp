@@ -0,0 +1,119 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file LatencyHistogram.cpp
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#include <algorithm>
+#include <cmath>
+
+#include "LatencyHistogram.h"
+
+LatencyHistogram::LatencyHistogram(const uint64 BinWidthNanoseconds,
+                                   const uint64 NumberOfBins) :
+    m_BinWidthNanoseconds{std::max(BinWidthNanoseconds, static_cast<uint64>(1U))},
+    m_BinCounts(NumberOfBins + 1U, 0U),
+    m_NumberOfLatencies{0U},
+    m_MaximumLatencyNanoseconds{0U},
+    m_SumLatenciesNanoseconds{0.0}
+{
+}
+
+LatencyHistogram::~LatencyHistogram()
+{
+}
+
+void LatencyHistogram::AddLatency(const uint64 LatencyNanoseconds)
+{
+    // latencies beyond the last bin are counted in the overflow bin
+    const uint64 BinIndex{std::min(LatencyNanoseconds / m_BinWidthNanoseconds, static_cast<uint64>(m_BinCounts.size() - 1U))};
+
+    m_BinCounts[BinIndex]++;
+    m_NumberOfLatencies++;
+    m_MaximumLatencyNanoseconds = std::max(m_MaximumLatencyNanoseconds, LatencyNanoseconds);
+    m_SumLatenciesNanoseconds += static_cast<float64>(LatencyNanoseconds);
+}
+
+const ListUInt64& LatencyHistogram::GetBinCounts() const
+{
+    return m_BinCounts;
+}
+
+uint64 LatencyHistogram::GetBinWidth() const
+{
+    return m_BinWidthNanoseconds;
+}
+
+uint64 LatencyHistogram::GetMaximumLatency() const
+{
+    return m_MaximumLatencyNanoseconds;
+}
+
+float64 LatencyHistogram::GetMeanLatency() const
+{
+    if(m_NumberOfLatencies == 0U)
+    {
+        return 0.0;
+    }
+
+    return m_SumLatenciesNanoseconds / static_cast<float64>(m_NumberOfLatencies);
+}
+
+uint64 LatencyHistogram::GetNumberOfLatencies() const
+{
+    return m_NumberOfLatencies;
+}
+
+uint64 LatencyHistogram::GetPercentile(const float64 Percentile) const
+{
+    if(m_NumberOfLatencies == 0U)
+    {
+        return 0U;
+    }
+
+    // number of latencies up to the percentile (at least one)
+    const float64 PercentileClamped{std::min(std::max(Percentile, 0.0), 100.0)}; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    const uint64  Rank{std::max(static_cast<uint64>(std::ceil(PercentileClamped / 100.0 * static_cast<float64>(m_NumberOfLatencies))), static_cast<uint64>(1U))}; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    uint64 CumulativeCount{0U};
+
+    for(uint64 i_Bin{0U}; i_Bin < (m_BinCounts.size() - 1U); i_Bin++)
+    {
+        CumulativeCount += m_BinCounts[i_Bin];
+
+        if(CumulativeCount >= Rank)
+        {
+            return std::min((i_Bin + 1U) * m_BinWidthNanoseconds, m_MaximumLatencyNanoseconds);
+        }
+    }
+
+    return m_MaximumLatencyNanoseconds;
+}
+
+void LatencyHistogram::Reset()
+{
+    std::fill(m_BinCounts.begin(), m_BinCounts.end(), 0U);
+
+    m_NumberOfLatencies         = 0U;
+    m_MaximumLatencyNanoseconds = 0U;
+    m_SumLatenciesNanoseconds   = 0.0;
+}
@@ -0,0 +1,121 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file LatencyHistogram.h
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#ifndef LATENCYHISTOGRAM_H
+#define LATENCYHISTOGRAM_H
+
+#include "../GlobalTypesDerived.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class LatencyHistogram
+///
+/// \brief Class for collecting latencies in a histogram.
+///
+/// The bins have a fixed width, latencies beyond the last bin are counted in
+/// an additional overflow bin. Percentiles are resolved to the upper edge of
+/// their bin, the maximum latency is tracked exactly.
+///////////////////////////////////////////////////////////////////////////////
+class LatencyHistogram
+{
+protected:
+    uint64     m_BinWidthNanoseconds;       ///< Width of a bin (in nanoseconds).
+    ListUInt64 m_BinCounts;                 ///< Counts of the bins (the last entry is the overflow bin).
+    uint64     m_NumberOfLatencies;         ///< Number of latencies.
+    uint64     m_MaximumLatencyNanoseconds; ///< Maximum latency (in nanoseconds).
+    float64    m_SumLatenciesNanoseconds;   ///< Sum of all latencies (in nanoseconds).
+
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Constructor.
+    ///
+    /// \param[in] BinWidthNanoseconds Width of a bin (in nanoseconds).
+    /// \param[in] NumberOfBins        Number of bins (without the overflow bin).
+    ///////////////////////////////////////////////////////////////////////////////
+    LatencyHistogram(const uint64 BinWidthNanoseconds = 100000U,
+                     const uint64 NumberOfBins        = 10000U);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor.
+    ///////////////////////////////////////////////////////////////////////////////
+    ~LatencyHistogram();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Adds a latency to the histogram.
+    ///
+    /// \param[in] LatencyNanoseconds Latency (in nanoseconds).
+    ///////////////////////////////////////////////////////////////////////////////
+    void AddLatency(const uint64 LatencyNanoseconds);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the counts of the bins.
+    ///
+    /// \return Counts of the bins (the last entry is the overflow bin).
+    ///////////////////////////////////////////////////////////////////////////////
+    const ListUInt64& GetBinCounts() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the width of a bin.
+    ///
+    /// \return Width of a bin (in nanoseconds).
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 GetBinWidth() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the maximum latency.
+    ///
+    /// \return Maximum latency (in nanoseconds).
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 GetMaximumLatency() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the mean latency.
+    ///
+    /// \return Mean latency (in nanoseconds).
+    ///////////////////////////////////////////////////////////////////////////////
+    float64 GetMeanLatency() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the number of latencies.
+    ///
+    /// \return Number of latencies.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 GetNumberOfLatencies() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Getter for a percentile of the latencies.
+    ///
+    /// \param[in] Percentile Percentile (between 0 and 100).
+    ///
+    /// \return    Upper edge of the bin containing the percentile (in nanoseconds), the maximum latency for the overflow bin.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 GetPercentile(const float64 Percentile) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Removes all latencies from the histogram.
+    ///////////////////////////////////////////////////////////////////////////////
+    void Reset();
+};
+
+#endif // LATENCYHISTOGRAM_H
@@ -0,0 +1,255 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file PlaybackDriver.cpp
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "PlaybackDriver.h"
+
+PlaybackDriver::PlaybackDriver(const DatasetReaderBase& Reader,
+                               const float64            PlaybackSpeed,
+                               const DropPolicy         Policy,
+                               const uint64             QueueCapacity,
+                               const uint64             NumberOfWorkers) :
+    m_Prefetcher{Reader, NumberOfWorkers},
+    m_PlaybackSpeed{PlaybackSpeed},
+    m_DropPolicy{Policy},
+    m_QueueCapacity{std::max(QueueCapacity, static_cast<uint64>(1U))},
+    m_StopRequested{false},
+    m_IsSensorFinished{false},
+    m_SensorException{nullptr},
+    m_NumberOfFramesEmitted{0U},
+    m_NumberOfFramesDropped{0U},
+    m_NumberOfFramesConsumed{0U}
+{
+    if(PlaybackSpeed <= 0.0)
+    {
+        throw std::invalid_argument("The playback speed must be positive.");
+    }
+}
+
+PlaybackDriver::~PlaybackDriver()
+{
+}
+
+const LatencyHistogram& PlaybackDriver::GetLatencyHistogram() const
+{
+    return m_LatencyHistogram;
+}
+
+uint64 PlaybackDriver::GetNumberOfFramesConsumed() const
+{
+    return m_NumberOfFramesConsumed;
+}
+
+uint64 PlaybackDriver::GetNumberOfFramesDropped() const
+{
+    return m_NumberOfFramesDropped;
+}
+
+uint64 PlaybackDriver::GetNumberOfFramesEmitted() const
+{
+    return m_NumberOfFramesEmitted;
+}
+
+void PlaybackDriver::Run(const std::function<boolean(const ImageInformation&, const ImageInformation&)>& Consumer,
+                         const uint64                                                                    FirstFrameIndex,
+                         const uint64                                                                    NumberOfFrames)
+{
+    // reset the state of a previous playback
+    m_Queue.clear();
+    m_StopRequested          = false;
+    m_IsSensorFinished       = false;
+    m_SensorException        = nullptr;
+    m_NumberOfFramesEmitted  = 0U;
+    m_NumberOfFramesDropped  = 0U;
+    m_NumberOfFramesConsumed = 0U;
+    m_LatencyHistogram.Reset();
+
+    const uint64 NumberOfFramesDataset{m_Prefetcher.GetNumberOfFrames()};
+    const uint64 FirstFrameIndexClamped{std::min(FirstFrameIndex, NumberOfFramesDataset)};
+    const uint64 LastFrameIndex{FirstFrameIndexClamped + std::min(NumberOfFrames, NumberOfFramesDataset - FirstFrameIndexClamped)};
+
+    std::thread SensorThread(&PlaybackDriver::RunSensor, this, FirstFrameIndexClamped, LastFrameIndex);
+
+    try
+    {
+        while(true)
+        {
+            Frame CurrentFrame;
+
+            // wait for the next frame
+            {
+                std::unique_lock<std::mutex> Lock(m_Mutex);
+
+                m_ConsumerCondition.wait(Lock, [this]() { return !m_Queue.empty() || m_IsSensorFinished; });
+
+                if(m_Queue.empty())
+                {
+                    break;
+                }
+
+                CurrentFrame = std::move(m_Queue.front());
+                m_Queue.pop_front();
+            }
+
+            m_SensorCondition.notify_all();
+
+            // process the frame and measure the latency
+            const boolean ContinuePlayback{Consumer(CurrentFrame.StereoLeft, CurrentFrame.StereoRight)};
+
+            const std::chrono::steady_clock::time_point CompletionTime{std::chrono::steady_clock::now()};
+
+            m_LatencyHistogram.AddLatency(static_cast<uint64>(std::max(std::chrono::duration_cast<std::chrono::nanoseconds>(CompletionTime - CurrentFrame.ArrivalTime).count(), static_cast<sint64>(0))));
+
+            m_NumberOfFramesConsumed++;
+
+            if(!ContinuePlayback)
+            {
+                break;
+            }
+        }
+    }
+    catch(...)
+    {
+        RequestStop();
+        SensorThread.join();
+
+        throw;
+    }
+
+    RequestStop();
+    SensorThread.join();
+
+    // frames which are still queued were never consumed
+    m_NumberOfFramesDropped += m_Queue.size();
+    m_Queue.clear();
+
+    // forward a failure of the sensor to the caller
+    if(m_SensorException != nullptr)
+    {
+        std::rethrow_exception(m_SensorException);
+    }
+}
+
+void PlaybackDriver::RequestStop()
+{
+    {
+        const std::lock_guard<std::mutex> Lock(m_Mutex);
+
+        m_StopRequested = true;
+    }
+
+    m_SensorCondition.notify_all();
+}
+
+void PlaybackDriver::RunSensor(const uint64 FirstFrameIndex,
+                               const uint64 LastFrameIndex)
+{
+    const std::chrono::steady_clock::time_point StartTime{std::chrono::steady_clock::now()};
+
+    uint64 FirstTimestamp{0U};
+
+    // a failure (e.g. a corrupted image) ends the emission of frames
+    std::exception_ptr SensorException{nullptr};
+
+    try
+    {
+        for(uint64 i_Frame{FirstFrameIndex}; i_Frame < LastFrameIndex; i_Frame++)
+        {
+            Frame CurrentFrame;
+
+            m_Prefetcher.GetFrame(i_Frame, CurrentFrame.StereoLeft, CurrentFrame.StereoRight);
+
+            // compute the arrival time on the simulated sensor clock
+            if(i_Frame == FirstFrameIndex)
+            {
+                FirstTimestamp = CurrentFrame.StereoLeft.Timestamp;
+            }
+
+            const uint64  ElapsedTimeRecorded{(CurrentFrame.StereoLeft.Timestamp > FirstTimestamp) ? (CurrentFrame.StereoLeft.Timestamp - FirstTimestamp) : 0U};
+            const float64 ElapsedTimePlayback{static_cast<float64>(ElapsedTimeRecorded) / m_PlaybackSpeed};
+
+            CurrentFrame.ArrivalTime = StartTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float64, std::nano>(ElapsedTimePlayback));
+
+            // wait for the arrival of the frame
+            std::unique_lock<std::mutex> Lock(m_Mutex);
+
+            if(m_SensorCondition.wait_until(Lock, CurrentFrame.ArrivalTime, [this]() { return m_StopRequested; }))
+            {
+                break;
+            }
+
+            m_NumberOfFramesEmitted++;
+
+            // handle a full queue according to the drop policy
+            if(m_Queue.size() >= m_QueueCapacity)
+            {
+                if(m_DropPolicy == DropPolicyNone)
+                {
+                    m_SensorCondition.wait(Lock, [this]() { return m_StopRequested || (m_Queue.size() < m_QueueCapacity); });
+
+                    if(m_StopRequested)
+                    {
+                        m_NumberOfFramesDropped++;
+                        break;
+                    }
+                }
+                else if(m_DropPolicy == DropPolicyOldest)
+                {
+                    m_Queue.pop_front();
+                    m_NumberOfFramesDropped++;
+                }
+                else
+                {
+                    m_NumberOfFramesDropped++;
+                    continue;
+                }
+            }
+
+            m_Queue.push_back(std::move(CurrentFrame));
+
+            Lock.unlock();
+            m_ConsumerCondition.notify_all();
+        }
+    }
+    catch(...)
+    {
+        SensorException = std::current_exception();
+    }
+
+    // signal the end of the playback
+    {
+        const std::lock_guard<std::mutex> Lock(m_Mutex);
+
+        m_SensorException  = SensorException;
+        m_IsSensorFinished = true;
+    }
+
+    m_ConsumerCondition.notify_all();
+}
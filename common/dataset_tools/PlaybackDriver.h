@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file PlaybackDriver.h
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#ifndef PLAYBACKDRIVER_H
+#define PLAYBACKDRIVER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <mutex>
+
+#include "DatasetPrefetcher.h"
+#include "LatencyHistogram.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// \enum  DropPolicy
+///
+/// \brief Defines how frames are handled if the consumer lags behind the
+///        sensor.
+///////////////////////////////////////////////////////////////////////////////
+enum DropPolicy
+{
+    DropPolicyNone,   ///< No frames are dropped, the sensor waits for the consumer (the latency grows).
+    DropPolicyOldest, ///< The oldest queued frame is dropped in favor of the arriving one.
+    DropPolicyNewest  ///< The arriving frame is dropped.
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class PlaybackDriver
+///
+/// \brief Class for playing back a dataset at the rate it was recorded.
+///
+/// A sensor thread emits the frames according to a simulated sensor clock,
+/// i.e. each frame arrives after the time elapsed since the first frame (based
+/// on the timestamps of the left stereo camera images) divided by the playback
+/// speed. The images are decoded ahead of their arrival by a prefetcher. The
+/// arriving frames are queued for the consumer, which runs on the thread of
+/// the caller. If the queue is full, the drop policy decides which frame is
+/// dropped.
+///
+/// The latency of a frame is measured from its arrival on the simulated clock
+/// to the completion of the consumer. An exception of the sensor thread (e.g.
+/// a corrupted image) ends the playback and is rethrown by Run.
+///////////////////////////////////////////////////////////////////////////////
+class PlaybackDriver
+{
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \struct Frame
+    ///
+    /// \brief  Frame emitted by the sensor.
+    ///////////////////////////////////////////////////////////////////////////////
+    struct Frame
+    {
+        ImageInformation                      StereoLeft;  ///< Image information of the left stereo camera image.
+        ImageInformation                      StereoRight; ///< Image information of the right stereo camera image.
+        std::chrono::steady_clock::time_point ArrivalTime; ///< Arrival time of the frame on the simulated sensor clock.
+    };
+
+    DatasetPrefetcher       m_Prefetcher;             ///< Prefetcher decoding the images ahead of their arrival.
+    const float64           m_PlaybackSpeed;          ///< Playback speed (multiple of the recorded rate).
+    const DropPolicy        m_DropPolicy;             ///< Policy for frames arriving at a full queue.
+    const uint64            m_QueueCapacity;          ///< Maximum number of frames waiting for the consumer.
+    std::deque<Frame>       m_Queue;                  ///< Frames waiting for the consumer.
+    std::mutex              m_Mutex;                  ///< Mutex protecting the queue, the flags and the counters of the sensor.
+    std::condition_variable m_SensorCondition;        ///< Condition variable signaling the sensor (free space or stop request).
+    std::condition_variable m_ConsumerCondition;      ///< Condition variable signaling the consumer (arrived frame or end of playback).
+    boolean                 m_StopRequested;          ///< Flag defining whether the sensor shall be stopped or not.
+    boolean                 m_IsSensorFinished;       ///< Flag whether the sensor has emitted all frames or not.
+    std::exception_ptr      m_SensorException;        ///< Exception thrown by the sensor (rethrown by Run).
+    uint64                  m_NumberOfFramesEmitted;  ///< Number of frames emitted by the sensor.
+    uint64                  m_NumberOfFramesDropped;  ///< Number of frames dropped.
+    uint64                  m_NumberOfFramesConsumed; ///< Number of frames processed by the consumer.
+    LatencyHistogram        m_LatencyHistogram;       ///< Latencies from the arrival to the completion of the consumer.
+
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Constructor.
+    ///
+    /// \param[in] Reader          Dataset reader used to decode the images (must outlive the driver).
+    /// \param[in] PlaybackSpeed   Playback speed (multiple of the recorded rate, e.g. 2.0 for twice as fast).
+    /// \param[in] Policy          Policy for frames arriving at a full queue.
+    /// \param[in] QueueCapacity   Maximum number of frames waiting for the consumer.
+    /// \param[in] NumberOfWorkers Number of worker threads of the prefetcher.
+    ///////////////////////////////////////////////////////////////////////////////
+    PlaybackDriver(const DatasetReaderBase& Reader,
+                   const float64            PlaybackSpeed   = 1.0,
+                   const DropPolicy         Policy          = DropPolicyOldest,
+                   const uint64             QueueCapacity   = 1U,
+                   const uint64             NumberOfWorkers = 2U);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor.
+    ///////////////////////////////////////////////////////////////////////////////
+    ~PlaybackDriver();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the latencies of the last playback.
+    ///
+    /// \return Histogram of the latencies from the arrival to the completion of the consumer.
+    ///////////////////////////////////////////////////////////////////////////////
+    const LatencyHistogram& GetLatencyHistogram() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the number of frames processed by the consumer in the
+    ///         last playback.
+    ///
+    /// \return Number of frames processed by the consumer.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 GetNumberOfFramesConsumed() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the number of frames dropped in the last playback.
+    ///
+    /// \return Number of frames dropped.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 GetNumberOfFramesDropped() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the number of frames emitted by the sensor in the last
+    ///         playback.
+    ///
+    /// \return Number of frames emitted by the sensor.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 GetNumberOfFramesEmitted() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Plays back the dataset.
+    ///
+    /// The call blocks until all frames are emitted and the queue is drained, or
+    /// until the consumer requests to stop. The statistics of a previous
+    /// playback are reset. If the sensor fails, the frames queued so far are
+    /// consumed and the exception of the sensor is rethrown.
+    ///
+    /// \param[in] Consumer        Function processing a frame (returns false to stop the playback).
+    /// \param[in] FirstFrameIndex Index of the first frame.
+    /// \param[in] NumberOfFrames  Maximum number of frames.
+    ///////////////////////////////////////////////////////////////////////////////
+    void Run(const std::function<boolean(const ImageInformation&, const ImageInformation&)>& Consumer,
+             const uint64                                                                    FirstFrameIndex = 0U,
+             const uint64                                                                    NumberOfFrames  = std::numeric_limits<uint64>::max());
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Requests the sensor to stop.
+    ///////////////////////////////////////////////////////////////////////////////
+    void RequestStop();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Runs the sensor.
+    ///
+    /// \param[in] FirstFrameIndex Index of the first frame.
+    /// \param[in] LastFrameIndex  Index behind the last frame.
+    ///////////////////////////////////////////////////////////////////////////////
+    void RunSensor(const uint64 FirstFrameIndex,
+                   const uint64 LastFrameIndex);
+};
+
+#endif // PLAYBACKDRIVER_H
@@ -0,0 +1,106 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file PoseTrajectory.cpp
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "PoseTrajectory.h"
+#include "TimestampSearch.h"
+
+PoseTrajectory::PoseTrajectory(const ListUInt64&           TimestampsNanoseconds,
+                               const ListMatrixFloat64_4d& Poses) :
+    m_TimestampsNanoseconds{TimestampsNanoseconds}
+{
+    if(TimestampsNanoseconds.size() != Poses.size())
+    {
+        throw std::invalid_argument("The number of timestamps and poses differ.");
+    }
+
+    if(!std::is_sorted(TimestampsNanoseconds.begin(), TimestampsNanoseconds.end()))
+    {
+        throw std::invalid_argument("The timestamps are not sorted.");
+    }
+
+    // split the poses into translations and rotations (the rotations are converted once)
+    m_Translations.reserve(Poses.size());
+    m_Rotations.reserve(Poses.size());
+
+    for(const MatrixFloat64_4d& Pose : Poses)
+    {
+        m_Translations.push_back(Pose.block<3, 1>(0, 3));
+        m_Rotations.emplace_back(MatrixFloat64_3d{Pose.block<3, 3>(0, 0)});
+        m_Rotations.back().normalize();
+    }
+}
+
+PoseTrajectory::~PoseTrajectory()
+{
+}
+
+uint64 PoseTrajectory::GetNumberOfPoses() const
+{
+    return m_TimestampsNanoseconds.size();
+}
+
+const ListUInt64& PoseTrajectory::GetTimestamps() const
+{
+    return m_TimestampsNanoseconds;
+}
+
+boolean PoseTrajectory::InterpolatePose(const uint64      TimestampNanoseconds,
+                                        MatrixFloat64_4d& Pose) const
+{
+    // find the first pose which is not earlier than the timestamp
+    const uint64 IndexNext{TimestampSearch::FindLowerBound(m_TimestampsNanoseconds, TimestampNanoseconds)};
+
+    if(IndexNext == m_TimestampsNanoseconds.size())
+    {
+        return false;
+    }
+
+    Pose.setIdentity();
+
+    if(m_TimestampsNanoseconds[IndexNext] == TimestampNanoseconds)
+    {
+        Pose.block<3, 3>(0, 0) = m_Rotations[IndexNext].toRotationMatrix();
+        Pose.block<3, 1>(0, 3) = m_Translations[IndexNext];
+
+        return true;
+    }
+
+    if(IndexNext == 0U)
+    {
+        return false;
+    }
+
+    // interpolate between the bracketing poses
+    const uint64  IndexPrevious{IndexNext - 1U};
+    const float64 Weight{static_cast<float64>(TimestampNanoseconds - m_TimestampsNanoseconds[IndexPrevious]) / static_cast<float64>(m_TimestampsNanoseconds[IndexNext] - m_TimestampsNanoseconds[IndexPrevious])};
+
+    Pose.block<3, 3>(0, 0) = m_Rotations[IndexPrevious].slerp(Weight, m_Rotations[IndexNext]).toRotationMatrix();
+    Pose.block<3, 1>(0, 3) = ((1.0 - Weight) * m_Translations[IndexPrevious]) + (Weight * m_Translations[IndexNext]);
+
+    return true;
+}
@@ -0,0 +1,87 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file PoseTrajectory.h
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#ifndef POSETRAJECTORY_H
+#define POSETRAJECTORY_H
+
+#include "../GlobalTypesDerived.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class PoseTrajectory
+///
+/// \brief Class for timestamped poses (e.g. from GPS or ground truth logs).
+///
+/// Poses between two timestamps are interpolated linearly in the translation
+/// and spherically (slerp) in the rotation.
+///////////////////////////////////////////////////////////////////////////////
+class PoseTrajectory
+{
+protected:
+    ListUInt64                                                                    m_TimestampsNanoseconds; ///< List of timestamps of the poses (in nanoseconds).
+    ListColumnVectorFloat64_3d                                                    m_Translations;          ///< List of translations of the poses.
+    std::vector<Eigen::Quaterniond, Eigen::aligned_allocator<Eigen::Quaterniond>> m_Rotations;             ///< List of rotations of the poses (unit quaternions).
+
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Constructor.
+    ///
+    /// \param[in] TimestampsNanoseconds Sorted list of timestamps (in nanoseconds).
+    /// \param[in] Poses                 List of poses (4x4 homogeneous transformations).
+    ///////////////////////////////////////////////////////////////////////////////
+    PoseTrajectory(const ListUInt64&           TimestampsNanoseconds,
+                   const ListMatrixFloat64_4d& Poses);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor.
+    ///////////////////////////////////////////////////////////////////////////////
+    ~PoseTrajectory();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the number of poses.
+    ///
+    /// \return Number of poses.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 GetNumberOfPoses() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the timestamps of the poses.
+    ///
+    /// \return Timestamps of the poses (in nanoseconds).
+    ///////////////////////////////////////////////////////////////////////////////
+    const ListUInt64& GetTimestamps() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Interpolates the pose at the provided timestamp.
+    ///
+    /// \param[in]  TimestampNanoseconds Timestamp (in nanoseconds).
+    /// \param[out] Pose                 Interpolated pose.
+    ///
+    /// \return     Flag whether the timestamp lies within the trajectory or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    boolean InterpolatePose(const uint64      TimestampNanoseconds,
+                            MatrixFloat64_4d& Pose) const;
+};
+
+#endif // POSETRAJECTORY_H
@@ -0,0 +1,114 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file SensorStreamMerger.cpp
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#include <algorithm>
+
+#include "SensorStreamMerger.h"
+
+SensorStreamMerger::SensorStreamMerger()
+{
+}
+
+SensorStreamMerger::~SensorStreamMerger()
+{
+}
+
+uint64 SensorStreamMerger::AddStream(const ListUInt64& TimestampsNanoseconds)
+{
+    const uint64 StreamIndex{m_Streams.size()};
+
+    m_Streams.push_back(TimestampsNanoseconds);
+
+    // insert the first element of the stream into the heap
+    if(!TimestampsNanoseconds.empty())
+    {
+        m_StreamHeads.push_back({TimestampsNanoseconds.front(), StreamIndex, 0U});
+        std::push_heap(m_StreamHeads.begin(), m_StreamHeads.end(), IsLater);
+    }
+
+    return StreamIndex;
+}
+
+boolean SensorStreamMerger::GetNext(uint64& StreamIndex,
+                                    uint64& ElementIndex,
+                                    uint64& TimestampNanoseconds)
+{
+    if(m_StreamHeads.empty())
+    {
+        return false;
+    }
+
+    // take the earliest element from the heap
+    std::pop_heap(m_StreamHeads.begin(), m_StreamHeads.end(), IsLater);
+
+    StreamHead& Head{m_StreamHeads.back()};
+
+    StreamIndex          = Head.StreamIndex;
+    ElementIndex         = Head.ElementIndex;
+    TimestampNanoseconds = Head.TimestampNanoseconds;
+
+    // replace it by the next element of the same stream (if available)
+    const ListUInt64& Stream{m_Streams[StreamIndex]};
+
+    if((ElementIndex + 1U) < Stream.size())
+    {
+        Head.ElementIndex         = ElementIndex + 1U;
+        Head.TimestampNanoseconds = Stream[Head.ElementIndex];
+
+        std::push_heap(m_StreamHeads.begin(), m_StreamHeads.end(), IsLater);
+    }
+    else
+    {
+        m_StreamHeads.pop_back();
+    }
+
+    return true;
+}
+
+void SensorStreamMerger::Reset()
+{
+    m_StreamHeads.clear();
+
+    for(uint64 i_Stream{0U}; i_Stream < m_Streams.size(); i_Stream++)
+    {
+        if(!m_Streams[i_Stream].empty())
+        {
+            m_StreamHeads.push_back({m_Streams[i_Stream].front(), i_Stream, 0U});
+        }
+    }
+
+    std::make_heap(m_StreamHeads.begin(), m_StreamHeads.end(), IsLater);
+}
+
+boolean SensorStreamMerger::IsLater(const StreamHead& Head1,
+                                    const StreamHead& Head2)
+{
+    if(Head1.TimestampNanoseconds != Head2.TimestampNanoseconds)
+    {
+        return Head1.TimestampNanoseconds > Head2.TimestampNanoseconds;
+    }
+
+    return Head1.StreamIndex > Head2.StreamIndex;
+}
@@ -0,0 +1,114 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file SensorStreamMerger.h
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#ifndef SENSORSTREAMMERGER_H
+#define SENSORSTREAMMERGER_H
+
+#include <vector>
+
+#include "../GlobalTypesDerived.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class SensorStreamMerger
+///
+/// \brief Class for merging the timestamps of several sensor streams in time
+///        order.
+///
+/// The next element of each stream is kept in a min-heap (k-way merge), i.e.
+/// each step costs O(log k) for k streams. Elements with equal timestamps are
+/// returned in the order of the streams. The timestamps of the streams are
+/// copied, so the lists passed to the merger may be temporaries.
+///////////////////////////////////////////////////////////////////////////////
+class SensorStreamMerger
+{
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \struct StreamHead
+    ///
+    /// \brief  Next element of a stream.
+    ///////////////////////////////////////////////////////////////////////////////
+    struct StreamHead
+    {
+        uint64 TimestampNanoseconds; ///< Timestamp of the element (in nanoseconds).
+        uint64 StreamIndex;          ///< Index of the stream.
+        uint64 ElementIndex;         ///< Index of the element within the stream.
+    };
+
+    std::vector<ListUInt64> m_Streams;     ///< List of streams (copies of the timestamps).
+    std::vector<StreamHead> m_StreamHeads; ///< Min-heap of the next element of each stream.
+
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor.
+    ///////////////////////////////////////////////////////////////////////////////
+    SensorStreamMerger();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor.
+    ///////////////////////////////////////////////////////////////////////////////
+    ~SensorStreamMerger();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Adds a sensor stream (the timestamps are copied).
+    ///
+    /// \param[in] TimestampsNanoseconds Sorted list of timestamps of the stream (in nanoseconds).
+    ///
+    /// \return    Index of the stream.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 AddStream(const ListUInt64& TimestampsNanoseconds);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Getter for the next element in time order.
+    ///
+    /// \param[out] StreamIndex          Index of the stream.
+    /// \param[out] ElementIndex         Index of the element within the stream.
+    /// \param[out] TimestampNanoseconds Timestamp of the element (in nanoseconds).
+    ///
+    /// \return     Flag whether an element was left or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    boolean GetNext(uint64& StreamIndex,
+                    uint64& ElementIndex,
+                    uint64& TimestampNanoseconds);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Restarts the merge at the first element of each stream.
+    ///////////////////////////////////////////////////////////////////////////////
+    void Reset();
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Compares two stream heads (the heap keeps the earliest element
+    ///            on top).
+    ///
+    /// \param[in] Head1 First stream head.
+    /// \param[in] Head2 Second stream head.
+    ///
+    /// \return    Flag whether the first stream head is later than the second one.
+    ///////////////////////////////////////////////////////////////////////////////
+    static boolean IsLater(const StreamHead& Head1,
+                           const StreamHead& Head2);
+};
+
+#endif // SENSORSTREAMMERGER_H
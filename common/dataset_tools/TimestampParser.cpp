@@ -0,0 +1,341 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file TimestampParser.cpp
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "TimestampParser.h"
+
+uint64 TimestampParser::ExtractTimestamps(const std::filesystem::path& FileTimestampsWithPath,
+                                          const uint64                 ColumnIndex,
+                                          const TimestampFormat        Format,
+                                          ListUInt64&                  ListTimestamps)
+{
+    // initialize number of timestamps found
+    uint64 NumberOfTimestampsFound{0U};
+
+    // map the file into memory
+    const sint32 FileDescriptor{open(FileTimestampsWithPath.c_str(), O_RDONLY)};
+
+    if(FileDescriptor < 0)
+    {
+        throw std::invalid_argument("File " + FileTimestampsWithPath.string() + " does not exist.");
+    }
+
+    struct stat FileStatus{};
+
+    if((fstat(FileDescriptor, &FileStatus) != 0) || (FileStatus.st_size <= 0))
+    {
+        close(FileDescriptor);
+        return NumberOfTimestampsFound;
+    }
+
+    const uint64 FileSize{static_cast<uint64>(FileStatus.st_size)};
+
+    void* Mapping{mmap(nullptr, FileSize, PROT_READ, MAP_PRIVATE, FileDescriptor, 0)};
+
+    close(FileDescriptor);
+
+    if(Mapping == MAP_FAILED)
+    {
+        throw std::runtime_error("File " + FileTimestampsWithPath.string() + " could not be mapped into memory.");
+    }
+
+    madvise(Mapping, FileSize, MADV_SEQUENTIAL);
+
+    // parse the file line by line
+    const char* Cursor{static_cast<const char*>(Mapping)};
+    const char* ContentEnd{Cursor + FileSize};
+
+    while(Cursor < ContentEnd)
+    {
+        // find the end of the current line (a trailing carriage return is ignored)
+        const char* LineEnd{static_cast<const char*>(std::memchr(Cursor, '\n', static_cast<uint64>(ContentEnd - Cursor)))};
+
+        if(LineEnd == nullptr)
+        {
+            LineEnd = ContentEnd;
+        }
+
+        const char* NextLine{(LineEnd < ContentEnd) ? (LineEnd + 1) : ContentEnd};
+
+        if((LineEnd > Cursor) && (*(LineEnd - 1) == '\r'))
+        {
+            LineEnd--;
+        }
+
+        // skip leading whitespace and empty lines
+        while((Cursor < LineEnd) && ((*Cursor == ' ') || (*Cursor == '\t')))
+        {
+            Cursor++;
+        }
+
+        if(Cursor == LineEnd)
+        {
+            Cursor = NextLine;
+            continue;
+        }
+
+        // find the column containing the timestamp
+        const char* ColumnFirst{Cursor};
+        const char* ColumnLast{Cursor};
+
+        for(uint64 i_Column{0U}; i_Column <= ColumnIndex; i_Column++)
+        {
+            ColumnFirst = Cursor;
+
+            while((Cursor < LineEnd) && (*Cursor != ' ') && (*Cursor != '\t') && (*Cursor != ',') && (*Cursor != ';'))
+            {
+                Cursor++;
+            }
+
+            ColumnLast = Cursor;
+
+            // skip the separator (whitespace, optionally followed by a comma or a semicolon and further whitespace)
+            while((Cursor < LineEnd) && ((*Cursor == ' ') || (*Cursor == '\t')))
+            {
+                Cursor++;
+            }
+
+            if((Cursor < LineEnd) && ((*Cursor == ',') || (*Cursor == ';')))
+            {
+                Cursor++;
+
+                while((Cursor < LineEnd) && ((*Cursor == ' ') || (*Cursor == '\t')))
+                {
+                    Cursor++;
+                }
+            }
+        }
+
+        // stop at the first line without a valid timestamp
+        uint64 TimestampNanoseconds{0U};
+
+        if(!ParseTimestamp(ColumnFirst, ColumnLast, Format, TimestampNanoseconds))
+        {
+            break;
+        }
+
+        ListTimestamps.push_back(TimestampNanoseconds);
+        NumberOfTimestampsFound++;
+
+        Cursor = NextLine;
+    }
+
+    munmap(Mapping, FileSize);
+
+    return NumberOfTimestampsFound;
+}
+
+boolean TimestampParser::ParseTimestamp(const char*           First,
+                                        const char*           Last,
+                                        const TimestampFormat Format,
+                                        uint64&               TimestampNanoseconds)
+{
+    switch(Format)
+    {
+        case FormatSeconds:
+        {
+            float64 TimestampSeconds{0.0};
+
+            const std::from_chars_result Result{std::from_chars(First, Last, TimestampSeconds)};
+
+            if((Result.ec != std::errc()) || (Result.ptr != Last) || (TimestampSeconds < 0.0))
+            {
+                return false;
+            }
+
+            TimestampNanoseconds = static_cast<uint64>(TimestampSeconds * 1.0e9); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+            return true;
+        }
+        case FormatNanoseconds:
+        {
+            const std::from_chars_result Result{std::from_chars(First, Last, TimestampNanoseconds)};
+
+            return (Result.ec == std::errc()) && (Result.ptr == Last);
+        }
+        case FormatISO8601:
+            return ParseTimestampISO8601(First, Last, false, TimestampNanoseconds);
+        case FormatISO8601TimeOfDay:
+            return ParseTimestampISO8601(First, Last, true, TimestampNanoseconds);
+        default:
+            return false;
+    }
+}
+
+sint64 TimestampParser::ComputeDaysSinceEpoch(const sint64 Year,
+                                              const uint64 Month,
+                                              const uint64 Day)
+{
+    // count the years from March on (the leap day is the last day of the year)
+    const sint64 YearShifted{(Month <= 2U) ? (Year - 1) : Year};
+    const sint64 Era{((YearShifted >= 0) ? YearShifted : (YearShifted - 399)) / 400};           // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    const sint64 YearOfEra{YearShifted - (Era * 400)};                                          // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    const sint64 MonthShifted{static_cast<sint64>((Month > 2U) ? (Month - 3U) : (Month + 9U))}; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    const sint64 DayOfYear{(((153 * MonthShifted) + 2) / 5) + static_cast<sint64>(Day) - 1};    // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    const sint64 DayOfEra{(YearOfEra * 365) + (YearOfEra / 4) - (YearOfEra / 100) + DayOfYear}; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    // 719468 days between 0000-03-01 and 1970-01-01
+    return (Era * 146097) + DayOfEra - 719468; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+}
+
+boolean TimestampParser::ParseCharacter(const char*& Cursor,
+                                        const char*  Last,
+                                        const char   Character)
+{
+    if((Cursor == Last) || (*Cursor != Character))
+    {
+        return false;
+    }
+
+    Cursor++;
+
+    return true;
+}
+
+boolean TimestampParser::ParseDigits(const char*& Cursor,
+                                     const char*  Last,
+                                     const uint64 NumberOfDigits,
+                                     uint64&      Value)
+{
+    if(static_cast<uint64>(Last - Cursor) < NumberOfDigits)
+    {
+        return false;
+    }
+
+    Value = 0U;
+
+    for(uint64 i_Digit{0U}; i_Digit < NumberOfDigits; i_Digit++)
+    {
+        if((*Cursor < '0') || (*Cursor > '9'))
+        {
+            return false;
+        }
+
+        Value = (Value * 10U) + static_cast<uint64>(*Cursor - '0'); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+        Cursor++;
+    }
+
+    return true;
+}
+
+boolean TimestampParser::ParseTimestampISO8601(const char*   First,
+                                               const char*   Last,
+                                               const boolean IgnoreDate,
+                                               uint64&       TimestampNanoseconds)
+{
+    const char* Cursor{First};
+
+    uint64 Year{0U};
+    uint64 Month{0U};
+    uint64 Day{0U};
+    uint64 Hours{0U};
+    uint64 Minutes{0U};
+    uint64 Seconds{0U};
+
+    // parse date (YYYY-MM-DD)
+    if(!ParseDigits(Cursor, Last, 4U, Year) || !ParseCharacter(Cursor, Last, '-') || !ParseDigits(Cursor, Last, 2U, Month) || !ParseCharacter(Cursor, Last, '-') || !ParseDigits(Cursor, Last, 2U, Day))
+    {
+        return false;
+    }
+
+    // parse time (Thh:mm:ss)
+    if(!ParseCharacter(Cursor, Last, 'T') || !ParseDigits(Cursor, Last, 2U, Hours) || !ParseCharacter(Cursor, Last, ':') || !ParseDigits(Cursor, Last, 2U, Minutes) || !ParseCharacter(Cursor, Last, ':') || !ParseDigits(Cursor, Last, 2U, Seconds))
+    {
+        return false;
+    }
+
+    // leap seconds are allowed
+    if((Month < 1U) || (Month > 12U) || (Day < 1U) || (Day > 31U) || (Hours > 23U) || (Minutes > 59U) || (Seconds > 60U)) // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        return false;
+    }
+
+    // parse fraction of a second (digits beyond nanoseconds are truncated)
+    uint64 FractionNanoseconds{0U};
+
+    if(ParseCharacter(Cursor, Last, '.') || ParseCharacter(Cursor, Last, ','))
+    {
+        uint64 NumberOfDigits{0U};
+        uint64 Digit{0U};
+
+        while(ParseDigits(Cursor, Last, 1U, Digit))
+        {
+            if(NumberOfDigits < 9U) // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+            {
+                FractionNanoseconds = (FractionNanoseconds * 10U) + Digit; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+            }
+
+            NumberOfDigits++;
+        }
+
+        if(NumberOfDigits == 0U)
+        {
+            return false;
+        }
+
+        for(uint64 i_Digit{NumberOfDigits}; i_Digit < 9U; i_Digit++) // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+        {
+            FractionNanoseconds *= 10U; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+        }
+    }
+
+    // the timestamp must be given in UTC
+    ParseCharacter(Cursor, Last, 'Z');
+
+    if(Cursor != Last)
+    {
+        return false;
+    }
+
+    // convert into nanoseconds
+    const uint64 NanosecondsPerSecond{1000000000U};
+    const uint64 SecondsPerDay{86400U};
+
+    const uint64 TimeOfDaySeconds{(((Hours * 60U) + Minutes) * 60U) + Seconds}; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    TimestampNanoseconds = (TimeOfDaySeconds * NanosecondsPerSecond) + FractionNanoseconds;
+
+    if(!IgnoreDate)
+    {
+        const sint64 DaysSinceEpoch{ComputeDaysSinceEpoch(static_cast<sint64>(Year), Month, Day)};
+
+        if(DaysSinceEpoch < 0)
+        {
+            return false;
+        }
+
+        TimestampNanoseconds += static_cast<uint64>(DaysSinceEpoch) * SecondsPerDay * NanosecondsPerSecond;
+    }
+
+    return true;
+}
@@ -0,0 +1,150 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file TimestampParser.h
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#ifndef TIMESTAMPPARSER_H
+#define TIMESTAMPPARSER_H
+
+#include <filesystem>
+
+#include "../GlobalTypesDerived.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// \enum  TimestampFormat
+///
+/// \brief Defines the format of the timestamps in a timestamp file.
+///////////////////////////////////////////////////////////////////////////////
+enum TimestampFormat
+{
+    FormatSeconds,         ///< Seconds as floating point number (e.g. 1.036e-01).
+    FormatNanoseconds,     ///< Nanoseconds as integer number.
+    FormatISO8601,         ///< ISO 8601 date and time in UTC (e.g. 2009-08-24T18:47:13.604), converted into nanoseconds since the epoch.
+    FormatISO8601TimeOfDay ///< ISO 8601 date and time, converted into nanoseconds since midnight (the date is ignored).
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class TimestampParser
+///
+/// \brief Class for parsing the timestamps of a dataset.
+///
+/// The timestamp file is memory-mapped and parsed in a single pass without
+/// copying the lines. Each line consists of columns separated by whitespace,
+/// commas or semicolons (consecutive whitespace is a single separator). Empty
+/// lines are skipped, parsing stops at the first line whose timestamp column
+/// cannot be parsed.
+///////////////////////////////////////////////////////////////////////////////
+class TimestampParser
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Extracts the timestamps from a column of the provided file.
+    ///
+    /// \param[in]  FileTimestampsWithPath File containing the timestamps, including the absolute path.
+    /// \param[in]  ColumnIndex            Index of the column containing the timestamps.
+    /// \param[in]  Format                 Format of the timestamps.
+    /// \param[out] ListTimestamps         List of timestamps (in nanoseconds).
+    ///
+    /// \return     Number of timestamps found.
+    ///////////////////////////////////////////////////////////////////////////////
+    static uint64 ExtractTimestamps(const std::filesystem::path& FileTimestampsWithPath,
+                                    const uint64                 ColumnIndex,
+                                    const TimestampFormat        Format,
+                                    ListUInt64&                  ListTimestamps);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Parses a single timestamp.
+    ///
+    /// \param[in]  First                First character of the timestamp.
+    /// \param[in]  Last                 Character behind the timestamp.
+    /// \param[in]  Format               Format of the timestamp.
+    /// \param[out] TimestampNanoseconds Timestamp (in nanoseconds).
+    ///
+    /// \return     Flag whether the timestamp could be parsed or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    static boolean ParseTimestamp(const char*           First,
+                                  const char*           Last,
+                                  const TimestampFormat Format,
+                                  uint64&               TimestampNanoseconds);
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Computes the number of days between the epoch (1970-01-01) and
+    ///            a date of the proleptic Gregorian calendar.
+    ///
+    /// \param[in] Year  Year.
+    /// \param[in] Month Month (1 to 12).
+    /// \param[in] Day   Day of the month (1 to 31).
+    ///
+    /// \return    Number of days since the epoch.
+    ///////////////////////////////////////////////////////////////////////////////
+    static sint64 ComputeDaysSinceEpoch(const sint64 Year,
+                                        const uint64 Month,
+                                        const uint64 Day);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief         Parses a single character.
+    ///
+    /// \param[in,out] Cursor    Current position (moved behind the character).
+    /// \param[in]     Last      Character behind the timestamp.
+    /// \param[in]     Character Expected character.
+    ///
+    /// \return        Flag whether the expected character was found or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    static boolean ParseCharacter(const char*& Cursor,
+                                  const char*  Last,
+                                  const char   Character);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief         Parses a fixed number of decimal digits.
+    ///
+    /// \param[in,out] Cursor         Current position (moved behind the digits).
+    /// \param[in]     Last           Character behind the timestamp.
+    /// \param[in]     NumberOfDigits Number of digits.
+    /// \param[out]    Value          Parsed value.
+    ///
+    /// \return        Flag whether the digits could be parsed or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    static boolean ParseDigits(const char*& Cursor,
+                               const char*  Last,
+                               const uint64 NumberOfDigits,
+                               uint64&      Value);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Parses an ISO 8601 date and time (YYYY-MM-DDThh:mm:ss with an
+    ///             optional fraction of a second and an optional trailing Z).
+    ///
+    /// \param[in]  First                First character of the timestamp.
+    /// \param[in]  Last                 Character behind the timestamp.
+    /// \param[in]  IgnoreDate           Flag whether the date shall be ignored (time of day only) or not.
+    /// \param[out] TimestampNanoseconds Timestamp (in nanoseconds).
+    ///
+    /// \return     Flag whether the timestamp could be parsed or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    static boolean ParseTimestampISO8601(const char*   First,
+                                         const char*   Last,
+                                         const boolean IgnoreDate,
+                                         uint64&       TimestampNanoseconds);
+};
+
+#endif // TIMESTAMPPARSER_H
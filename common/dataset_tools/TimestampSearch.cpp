@@ -0,0 +1,145 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file TimestampSearch.cpp
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include "TimestampSearch.h"
+
+void TimestampSearch::FindInterval(const ListUInt64& Timestamps,
+                                   const uint64      TimestampStart,
+                                   const uint64      TimestampEnd,
+                                   uint64&           FirstIndex,
+                                   uint64&           NumberOfIndices)
+{
+    FirstIndex      = FindLowerBound(Timestamps, TimestampStart);
+    NumberOfIndices = 0U;
+
+    if(TimestampEnd < TimestampStart)
+    {
+        return;
+    }
+
+    // the interval ends in front of the first timestamp which is greater than its end
+    const uint64 LastIndex{(TimestampEnd == std::numeric_limits<uint64>::max()) ? Timestamps.size() : FindLowerBound(Timestamps, TimestampEnd + 1U)};
+
+    NumberOfIndices = LastIndex - FirstIndex;
+}
+
+uint64 TimestampSearch::FindLowerBound(const ListUInt64& Timestamps,
+                                       const uint64      Timestamp)
+{
+    const uint64 NumberOfTimestamps{Timestamps.size()};
+
+    if((NumberOfTimestamps == 0U) || (Timestamp <= Timestamps.front()))
+    {
+        return 0U;
+    }
+
+    if(Timestamp > Timestamps.back())
+    {
+        return NumberOfTimestamps;
+    }
+
+    // estimate the position by linear interpolation (first timestamp < timestamp <= last timestamp)
+    const float64 RelativePosition{static_cast<float64>(Timestamp - Timestamps.front()) / static_cast<float64>(Timestamps.back() - Timestamps.front())};
+    const uint64  EstimatedIndex{std::min(static_cast<uint64>(RelativePosition * static_cast<float64>(NumberOfTimestamps - 1U)), NumberOfTimestamps - 1U)};
+
+    // double the search range until it contains the position (invariant: Timestamps[Lower] < Timestamp <= Timestamps[Upper])
+    uint64 Lower{0U};
+    uint64 Upper{NumberOfTimestamps - 1U};
+    uint64 Step{1U};
+
+    if(Timestamps[EstimatedIndex] < Timestamp)
+    {
+        Lower = EstimatedIndex;
+
+        while(((Upper - Lower) > Step) && (Timestamps[Lower + Step] < Timestamp))
+        {
+            Lower += Step;
+            Step *= 2U;
+        }
+
+        Upper = std::min(Lower + Step, Upper);
+    }
+    else
+    {
+        Upper = EstimatedIndex;
+
+        while(((Upper - Lower) > Step) && (Timestamps[Upper - Step] >= Timestamp))
+        {
+            Upper -= Step;
+            Step *= 2U;
+        }
+
+        // the step may exceed the upper index after the last doubling
+        Lower = (Upper > Step) ? std::max(Upper - Step, Lower) : Lower;
+    }
+
+    // bisect the search range
+    while((Upper - Lower) > 1U)
+    {
+        const uint64 Middle{Lower + ((Upper - Lower) / 2U)};
+
+        if(Timestamps[Middle] < Timestamp)
+        {
+            Lower = Middle;
+        }
+        else
+        {
+            Upper = Middle;
+        }
+    }
+
+    return Upper;
+}
+
+uint64 TimestampSearch::FindNearest(const ListUInt64& Timestamps,
+                                    const uint64      Timestamp)
+{
+    if(Timestamps.empty())
+    {
+        throw std::invalid_argument("The list of timestamps is empty.");
+    }
+
+    const uint64 Index{FindLowerBound(Timestamps, Timestamp)};
+
+    if(Index == 0U)
+    {
+        return Index;
+    }
+
+    if(Index == Timestamps.size())
+    {
+        return Index - 1U;
+    }
+
+    // compare both neighbors
+    const uint64 DistancePrevious{Timestamp - Timestamps[Index - 1U]};
+    const uint64 DistanceNext{Timestamps[Index] - Timestamp};
+
+    return (DistancePrevious <= DistanceNext) ? (Index - 1U) : Index;
+}
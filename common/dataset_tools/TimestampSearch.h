@@ -0,0 +1,87 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file TimestampSearch.h
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#ifndef TIMESTAMPSEARCH_H
+#define TIMESTAMPSEARCH_H
+
+#include "../GlobalTypesDerived.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class TimestampSearch
+///
+/// \brief Class providing searches in sorted lists of timestamps.
+///
+/// The timestamps of a sensor are nearly uniformly distributed, so the
+/// position of a timestamp is estimated by linear interpolation between the
+/// first and the last timestamp. Starting from the estimate, the search range
+/// is doubled until it contains the timestamp and is finally bisected. This
+/// needs a few comparisons for uniform timestamps and is still logarithmic for
+/// arbitrarily distributed ones.
+///////////////////////////////////////////////////////////////////////////////
+class TimestampSearch
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Finds the timestamps within an interval.
+    ///
+    /// \param[in]  Timestamps      Sorted list of timestamps.
+    /// \param[in]  TimestampStart  Start of the interval (included).
+    /// \param[in]  TimestampEnd    End of the interval (included).
+    /// \param[out] FirstIndex      Index of the first timestamp within the interval.
+    /// \param[out] NumberOfIndices Number of timestamps within the interval.
+    ///////////////////////////////////////////////////////////////////////////////
+    static void FindInterval(const ListUInt64& Timestamps,
+                             const uint64      TimestampStart,
+                             const uint64      TimestampEnd,
+                             uint64&           FirstIndex,
+                             uint64&           NumberOfIndices);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Finds the first timestamp which is not less than the provided
+    ///            timestamp.
+    ///
+    /// \param[in] Timestamps Sorted list of timestamps.
+    /// \param[in] Timestamp  Timestamp.
+    ///
+    /// \return    Index of the timestamp (number of timestamps if all timestamps are less).
+    ///////////////////////////////////////////////////////////////////////////////
+    static uint64 FindLowerBound(const ListUInt64& Timestamps,
+                                 const uint64      Timestamp);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Finds the timestamp which is closest to the provided timestamp.
+    ///
+    /// The earlier timestamp is preferred if both neighbors are equally close.
+    ///
+    /// \param[in] Timestamps Sorted list of timestamps (must not be empty).
+    /// \param[in] Timestamp  Timestamp.
+    ///
+    /// \return    Index of the closest timestamp.
+    ///////////////////////////////////////////////////////////////////////////////
+    static uint64 FindNearest(const ListUInt64& Timestamps,
+                              const uint64      Timestamp);
+};
+
+#endif // TIMESTAMPSEARCH_H
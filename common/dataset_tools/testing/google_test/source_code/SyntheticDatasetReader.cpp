@@ -0,0 +1,76 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  SyntheticDatasetReader.cpp
+///
+/// \brief Source file containing the dataset reader providing synthetic
+///        image information for the unit tests.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#include <stdexcept>
+#include <string>
+
+#include "SyntheticDatasetReader.h"
+
+SyntheticDatasetReader::SyntheticDatasetReader(const uint64 NumberOfFrames,
+                                               const uint64 FailingFrameIndex,
+                                               const uint64 FramePeriodNanoseconds) :
+    DatasetReaderBase("", ""),
+    m_FailingFrameIndex{FailingFrameIndex},
+    m_FramePeriodNanoseconds{FramePeriodNanoseconds}
+{
+    for(uint64 i_Frame{0U}; i_Frame < NumberOfFrames; i_Frame++)
+    {
+        m_FilenamesWithPathImagesStereoLeft.push_back("left_" + std::to_string(i_Frame) + ".png");
+        m_FilenamesWithPathImagesStereoRight.push_back("right_" + std::to_string(i_Frame) + ".png");
+    }
+}
+
+SyntheticDatasetReader::~SyntheticDatasetReader()
+{
+}
+
+void SyntheticDatasetReader::GetImageInformationStereoLeft(uint64            Index,
+                                                           ImageInformation& ImageInformation) const
+{
+    Decode(Index, true, ImageInformation);
+}
+
+void SyntheticDatasetReader::GetImageInformationStereoRight(uint64            Index,
+                                                            ImageInformation& ImageInformation) const
+{
+    Decode(Index, false, ImageInformation);
+}
+
+void SyntheticDatasetReader::Decode(const uint64      Index,
+                                    const boolean     IsStereoLeft,
+                                    ImageInformation& ImageInformation) const
+{
+    if(Index == m_FailingFrameIndex)
+    {
+        throw std::runtime_error("Image " + std::to_string(Index) + " is corrupted.");
+    }
+
+    ImageInformation.IsValid                  = true;
+    ImageInformation.Index                    = Index;
+    ImageInformation.Timestamp                = m_FramePeriodNanoseconds * Index + (IsStereoLeft ? 1U : 2U);
+    ImageInformation.FilenameWithAbsolutePath = IsStereoLeft ? m_FilenamesWithPathImagesStereoLeft[Index] : m_FilenamesWithPathImagesStereoRight[Index];
+}
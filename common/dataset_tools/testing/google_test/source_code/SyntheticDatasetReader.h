@@ -0,0 +1,99 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  SyntheticDatasetReader.h
+///
+/// \brief Header file containing the dataset reader providing synthetic
+///        image information for the unit tests.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#ifndef SYNTHETICDATASETREADER_H
+#define SYNTHETICDATASETREADER_H
+
+#include <limits>
+
+#include "../../../DatasetReaderBase.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class SyntheticDatasetReader
+///
+/// \brief Dataset reader providing synthetic image information without
+///        image files.
+///
+/// The timestamp of an image encodes its frame index and its camera, the
+/// frames are spaced by a configurable period. The images of one frame can be
+/// configured to fail with an exception.
+///////////////////////////////////////////////////////////////////////////////
+class SyntheticDatasetReader : public DatasetReaderBase
+{
+protected:
+    const uint64 m_FailingFrameIndex;       ///< Index of the frame whose images fail to decode.
+    const uint64 m_FramePeriodNanoseconds; ///< Time between the timestamps of two consecutive frames (in nanoseconds).
+
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Constructor.
+    ///
+    /// \param[in] NumberOfFrames          Number of frames of the dataset.
+    /// \param[in] FailingFrameIndex       Index of the frame whose images fail to decode.
+    /// \param[in] FramePeriodNanoseconds Time between the timestamps of two consecutive frames (in nanoseconds).
+    ///////////////////////////////////////////////////////////////////////////////
+    SyntheticDatasetReader(const uint64 NumberOfFrames,
+                           const uint64 FailingFrameIndex      = std::numeric_limits<uint64>::max(),
+                           const uint64 FramePeriodNanoseconds = 10U);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor.
+    ///////////////////////////////////////////////////////////////////////////////
+    ~SyntheticDatasetReader();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Getter for the information of the left stereo camera image.
+    ///
+    /// \param[in]  Index            Index of the image.
+    /// \param[out] ImageInformation Image information of the left stereo camera image.
+    ///////////////////////////////////////////////////////////////////////////////
+    void GetImageInformationStereoLeft(uint64            Index,
+                                       ImageInformation& ImageInformation) const override;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Getter for the information of the right stereo camera image.
+    ///
+    /// \param[in]  Index            Index of the image.
+    /// \param[out] ImageInformation Image information of the right stereo camera image.
+    ///////////////////////////////////////////////////////////////////////////////
+    void GetImageInformationStereoRight(uint64            Index,
+                                        ImageInformation& ImageInformation) const override;
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Creates the information of an image.
+    ///
+    /// \param[in]  Index            Index of the image.
+    /// \param[in]  IsStereoLeft     Flag whether the image is the left stereo camera image or not.
+    /// \param[out] ImageInformation Image information.
+    ///////////////////////////////////////////////////////////////////////////////
+    void Decode(const uint64      Index,
+                const boolean     IsStereoLeft,
+                ImageInformation& ImageInformation) const;
+};
+
+#endif // SYNTHETICDATASETREADER_H
@@ -0,0 +1,275 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  Test_BatchRunner.cpp
+///
+/// \brief Source file containing the unit tests for BatchRunner.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../../../BatchRunner.h"
+#include "SyntheticDatasetReader.h"
+
+// definition of macros for the unit tests
+#define TEST_ADDSEQUENCE_SEVERALSHARDS_ISSPLITEVENLY     TEST ///< Define to get a unique test name.
+#define TEST_RUN_SEVERALSEQUENCES_ISPROCESSINGFRAMESONCE TEST ///< Define to get a unique test name.
+#define TEST_RUN_THROWINGSHARD_ISRECORDED                TEST ///< Define to get a unique test name.
+#define TEST_RUN_MISSINGREADER_ISRECORDED                TEST ///< Define to get a unique test name.
+#define TEST_CONSTRUCTOR_EMPTYFACTORY_ISTHROWING         TEST ///< Define to get a unique test name.
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief     Creates a reader factory for synthetic sequences.
+///
+/// The factory returns a null pointer for an unknown sequence.
+///
+/// \param[in] NumberOfFramesSequences Number of frames of the sequences (w.r.t. their names).
+/// \param[in] FailingFrameIndex       Index of the frame whose images fail to decode.
+///
+/// \return    Reader factory.
+///////////////////////////////////////////////////////////////////////////////
+std::function<std::unique_ptr<DatasetReaderBase>(const std::string&)> CreateReaderFactory(const std::map<std::string, uint64>& NumberOfFramesSequences,
+                                                                                          const uint64                          FailingFrameIndex = std::numeric_limits<uint64>::max())
+{
+    return [NumberOfFramesSequences, FailingFrameIndex](const std::string& SequenceName) -> std::unique_ptr<DatasetReaderBase>
+    {
+        const std::map<std::string, uint64>::const_iterator Sequence{NumberOfFramesSequences.find(SequenceName)};
+
+        if(Sequence == NumberOfFramesSequences.end())
+        {
+            return nullptr;
+        }
+
+        return std::make_unique<SyntheticDatasetReader>(Sequence->second, FailingFrameIndex);
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief     Processes the frames of a shard by decoding the left stereo
+///            camera images.
+///
+/// \param[in] Reader Dataset reader.
+/// \param[in] Shard  Shard to be processed.
+///
+/// \return    Number of frames processed.
+///////////////////////////////////////////////////////////////////////////////
+uint64 ProcessFrames(DatasetReaderBase& Reader,
+                     const BatchShard&  Shard)
+{
+    for(uint64 i_Frame{Shard.FirstFrameIndex}; i_Frame < (Shard.FirstFrameIndex + Shard.NumberOfFrames); i_Frame++)
+    {
+        ImageInformation ImageInformationStereoLeft;
+
+        Reader.GetImageInformationStereoLeft(i_Frame, ImageInformationStereoLeft);
+    }
+
+    return Shard.NumberOfFrames;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the split of a sequence into shards.
+///
+/// Tests whether the frames of a sequence are split evenly into contiguous
+/// shards or not. A sequence with 10 frames is split into three shards, a
+/// sequence with two frames into four shards. The expectation is to get the
+/// ranges [0, 4), [4, 7) and [7, 10), and two shards with one frame followed
+/// by two empty shards.
+///////////////////////////////////////////////////////////////////////////////
+TEST_ADDSEQUENCE_SEVERALSHARDS_ISSPLITEVENLY(BatchRunner, Test_AddSequence_SeveralShards_IsSplitEvenly)
+{
+    BatchRunner Runner(CreateReaderFactory({{"Long", 10U}, {"Short", 2U}}), 2U, false);
+
+    ASSERT_EQ(Runner.AddSequence("Long", 3U), 3U);
+    ASSERT_EQ(Runner.AddSequence("Short", 4U), 4U);
+    ASSERT_EQ(Runner.AddSequence("Long", 0U), 1U);
+    ASSERT_EQ(Runner.GetNumberOfShards(), 8U);
+
+    Runner.Run(ProcessFrames);
+
+    const ListUInt64 FirstFrameIndices{0U, 4U, 7U, 0U, 1U, 2U, 2U, 0U};
+    const ListUInt64 NumbersOfFrames{4U, 3U, 3U, 1U, 1U, 0U, 0U, 10U};
+
+    const std::vector<ShardResult>& ShardResults{Runner.GetShardResults()};
+
+    ASSERT_EQ(ShardResults.size(), 8U);
+
+    for(uint64 i_Shard{0U}; i_Shard < ShardResults.size(); i_Shard++)
+    {
+        ASSERT_TRUE(ShardResults[i_Shard].IsSuccessful);
+        ASSERT_EQ(ShardResults[i_Shard].Shard.ShardIndex, i_Shard);
+        ASSERT_EQ(ShardResults[i_Shard].Shard.FirstFrameIndex, FirstFrameIndices[i_Shard]);
+        ASSERT_EQ(ShardResults[i_Shard].Shard.NumberOfFrames, NumbersOfFrames[i_Shard]);
+    }
+
+    ASSERT_EQ(Runner.GetNumberOfFramesProcessed(), 22U);
+    ASSERT_EQ(Runner.GetNumberOfFailedShards(), 0U);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the processing of several sequences.
+///
+/// Tests whether each frame of several sequences is processed exactly once
+/// by a pool of workers or not. The sequences are split into shards and
+/// added as ranges of frames exceeding the end of the sequence. The
+/// expectation is that each frame is processed once and that each shard is
+/// processed by a single worker.
+///////////////////////////////////////////////////////////////////////////////
+TEST_RUN_SEVERALSEQUENCES_ISPROCESSINGFRAMESONCE(BatchRunner, Test_Run_SeveralSequences_IsProcessingFramesOnce)
+{
+    const std::map<std::string, uint64> NumberOfFramesSequences{{"00", 101U}, {"01", 37U}, {"02", 64U}};
+
+    BatchRunner Runner(CreateReaderFactory(NumberOfFramesSequences), 4U, false);
+
+    Runner.AddSequence("00", 7U);
+    Runner.AddSequence("01", 3U);
+    Runner.AddShard("02", 0U, 40U);
+    Runner.AddShard("02", 40U, 100U);
+
+    ASSERT_EQ(Runner.GetNumberOfWorkers(), 4U);
+
+    // each shard writes to its own list of frames
+    std::vector<ListUInt64> FramesShards(Runner.GetNumberOfShards());
+
+    Runner.Run([&FramesShards](DatasetReaderBase& Reader, const BatchShard& Shard)
+               {
+                   for(uint64 i_Frame{Shard.FirstFrameIndex}; i_Frame < (Shard.FirstFrameIndex + Shard.NumberOfFrames); i_Frame++)
+                   {
+                       ImageInformation ImageInformationStereoLeft;
+
+                       Reader.GetImageInformationStereoLeft(i_Frame, ImageInformationStereoLeft);
+
+                       FramesShards[Shard.ShardIndex].push_back(ImageInformationStereoLeft.Index);
+                   }
+
+                   return Shard.NumberOfFrames;
+               });
+
+    ASSERT_EQ(Runner.GetNumberOfFailedShards(), 0U);
+    ASSERT_EQ(Runner.GetNumberOfFramesProcessed(), 202U);
+
+    // count how often each frame was processed
+    std::map<std::string, ListUInt64> NumberOfVisits;
+
+    for(const std::pair<const std::string, uint64>& Sequence : NumberOfFramesSequences)
+    {
+        NumberOfVisits[Sequence.first].assign(Sequence.second, 0U);
+    }
+
+    for(const ShardResult& Result : Runner.GetShardResults())
+    {
+        ASSERT_LT(Result.WorkerIndex, 4U);
+
+        for(const uint64 FrameIndex : FramesShards[Result.Shard.ShardIndex])
+        {
+            NumberOfVisits[Result.Shard.SequenceName][FrameIndex]++;
+        }
+    }
+
+    for(const std::pair<const std::string, ListUInt64>& Visits : NumberOfVisits)
+    {
+        ASSERT_EQ(Visits.second, ListUInt64(Visits.second.size(), 1U)) << "Sequence " << Visits.first;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the processing of a shard which throws an exception.
+///
+/// Tests whether an exception thrown while processing a shard is recorded in
+/// its result without aborting the other shards or not. A sequence with 30
+/// frames, whose frame 17 fails to decode, is split into three shards. The
+/// expectation is that the second shard failed with the message of the
+/// exception and that the other shards are processed successfully.
+///////////////////////////////////////////////////////////////////////////////
+TEST_RUN_THROWINGSHARD_ISRECORDED(BatchRunner, Test_Run_ThrowingShard_IsRecorded)
+{
+    BatchRunner Runner(CreateReaderFactory({{"00", 30U}}, 17U), 2U, false);
+
+    Runner.AddSequence("00", 3U);
+    Runner.Run(ProcessFrames);
+
+    const std::vector<ShardResult>& ShardResults{Runner.GetShardResults()};
+
+    ASSERT_EQ(Runner.GetNumberOfFailedShards(), 1U);
+    ASSERT_EQ(Runner.GetNumberOfFramesProcessed(), 20U);
+
+    ASSERT_TRUE(ShardResults[0].IsSuccessful);
+    ASSERT_FALSE(ShardResults[1].IsSuccessful);
+    ASSERT_TRUE(ShardResults[2].IsSuccessful);
+
+    ASSERT_EQ(ShardResults[1].ErrorMessage, "Image 17 is corrupted.");
+    ASSERT_EQ(ShardResults[1].NumberOfFramesProcessed, 0U);
+    ASSERT_TRUE(ShardResults[0].ErrorMessage.empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the processing of a sequence without a reader.
+///
+/// Tests whether a shard whose reader factory returns a null pointer is
+/// recorded as a failure or not. The expectation is that adding the unknown
+/// sequence succeeds, that its shards fail without calling the processor and
+/// that the shards of the known sequence are processed successfully.
+///////////////////////////////////////////////////////////////////////////////
+TEST_RUN_MISSINGREADER_ISRECORDED(BatchRunner, Test_Run_MissingReader_IsRecorded)
+{
+    BatchRunner Runner(CreateReaderFactory({{"00", 10U}}), 2U, false);
+
+    ASSERT_NO_THROW(Runner.AddSequence("Unknown", 2U));
+    ASSERT_NO_THROW(Runner.AddSequence("00", 2U));
+
+    Runner.Run([](DatasetReaderBase& Reader, const BatchShard& Shard)
+               {
+                   EXPECT_EQ(Shard.SequenceName, "00");
+
+                   return ProcessFrames(Reader, Shard);
+               });
+
+    const std::vector<ShardResult>& ShardResults{Runner.GetShardResults()};
+
+    ASSERT_EQ(Runner.GetNumberOfFailedShards(), 2U);
+    ASSERT_EQ(Runner.GetNumberOfFramesProcessed(), 10U);
+
+    for(uint64 i_Shard{0U}; i_Shard < 2U; i_Shard++)
+    {
+        ASSERT_FALSE(ShardResults[i_Shard].IsSuccessful);
+        ASSERT_NE(ShardResults[i_Shard].ErrorMessage.find("Unknown"), std::string::npos);
+        ASSERT_TRUE(ShardResults[i_Shard + 2U].IsSuccessful);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the constructor with an empty reader factory.
+///
+/// Tests whether a runner without a reader factory is rejected or not. The
+/// expectation is to get an std::invalid_argument exception.
+///////////////////////////////////////////////////////////////////////////////
+TEST_CONSTRUCTOR_EMPTYFACTORY_ISTHROWING(BatchRunner, Test_Constructor_EmptyFactory_IsThrowing)
+{
+    ASSERT_THROW(BatchRunner(nullptr), std::invalid_argument);
+}
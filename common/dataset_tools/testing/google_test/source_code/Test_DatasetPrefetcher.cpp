@@ -0,0 +1,202 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  Test_DatasetPrefetcher.cpp
+///
+/// \brief Source file containing the unit tests for DatasetPrefetcher.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "../../../DatasetPrefetcher.h"
+#include "SyntheticDatasetReader.h"
+
+// definition of macros for the unit tests
+#define TEST_GETFRAME_INORDER_ISMATCHINGREADER       TEST ///< Define to get a unique test name.
+#define TEST_GETFRAME_SKIPPEDFRAMES_ISMATCHINGREADER TEST ///< Define to get a unique test name.
+#define TEST_GETFRAME_RANDOMACCESS_ISMATCHINGREADER  TEST ///< Define to get a unique test name.
+#define TEST_GETFRAME_FAILINGIMAGE_ISRETHROWN        TEST ///< Define to get a unique test name.
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief     Checks the images of a frame.
+///
+/// \param[in] FrameIndex                  Index of the frame.
+/// \param[in] ImageInformationStereoLeft  Image information of the left stereo camera image.
+/// \param[in] ImageInformationStereoRight Image information of the right stereo camera image.
+///////////////////////////////////////////////////////////////////////////////
+void CheckFrame(const uint64            FrameIndex,
+                const ImageInformation& ImageInformationStereoLeft,
+                const ImageInformation& ImageInformationStereoRight)
+{
+    ASSERT_TRUE(ImageInformationStereoLeft.IsValid);
+    ASSERT_TRUE(ImageInformationStereoRight.IsValid);
+    ASSERT_EQ(ImageInformationStereoLeft.Index, FrameIndex);
+    ASSERT_EQ(ImageInformationStereoRight.Index, FrameIndex);
+    ASSERT_EQ(ImageInformationStereoLeft.Timestamp, 10U * FrameIndex + 1U);
+    ASSERT_EQ(ImageInformationStereoRight.Timestamp, 10U * FrameIndex + 2U);
+    ASSERT_EQ(ImageInformationStereoLeft.FilenameWithAbsolutePath, "left_" + std::to_string(FrameIndex) + ".png");
+    ASSERT_EQ(ImageInformationStereoRight.FilenameWithAbsolutePath, "right_" + std::to_string(FrameIndex) + ".png");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief     Reads frames and checks their images.
+///
+/// \param[in] Prefetcher   Prefetcher used to read the frames.
+/// \param[in] FrameIndices Indices of the frames in the order they are read.
+///////////////////////////////////////////////////////////////////////////////
+void ReadFrames(DatasetPrefetcher& Prefetcher,
+                const ListUInt64&  FrameIndices)
+{
+    for(const uint64 FrameIndex : FrameIndices)
+    {
+        ImageInformation ImageInformationStereoLeft;
+        ImageInformation ImageInformationStereoRight;
+
+        Prefetcher.GetFrame(FrameIndex, ImageInformationStereoLeft, ImageInformationStereoRight);
+
+        SCOPED_TRACE("Frame " + std::to_string(FrameIndex));
+
+        CheckFrame(FrameIndex, ImageInformationStereoLeft, ImageInformationStereoRight);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for reading all frames in ascending order.
+///
+/// Tests whether the frames read in ascending order match the images of the
+/// dataset reader or not, both without workers (synchronous decoding), with a
+/// single worker and with several workers. The expectation is to get the
+/// images of each frame.
+///////////////////////////////////////////////////////////////////////////////
+TEST_GETFRAME_INORDER_ISMATCHINGREADER(DatasetPrefetcher, Test_GetFrame_InOrder_IsMatchingReader)
+{
+    const SyntheticDatasetReader Reader(40U);
+
+    ListUInt64 FrameIndices;
+
+    for(uint64 i_Frame{0U}; i_Frame < 40U; i_Frame++)
+    {
+        FrameIndices.push_back(i_Frame);
+    }
+
+    for(const uint64 NumberOfWorkers : {0U, 1U, 4U})
+    {
+        SCOPED_TRACE("Workers " + std::to_string(NumberOfWorkers));
+
+        DatasetPrefetcher Prefetcher(Reader, NumberOfWorkers, 4U);
+
+        ASSERT_EQ(Prefetcher.GetNumberOfFrames(), 40U);
+
+        ReadFrames(Prefetcher, FrameIndices);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for reading frames in ascending order with gaps.
+///
+/// Tests whether skipped frames are dropped from the prefetched window without
+/// affecting the following frames or not. Some gaps are smaller and some are
+/// larger than the window. The expectation is to get the images of each frame
+/// read.
+///////////////////////////////////////////////////////////////////////////////
+TEST_GETFRAME_SKIPPEDFRAMES_ISMATCHINGREADER(DatasetPrefetcher, Test_GetFrame_SkippedFrames_IsMatchingReader)
+{
+    const SyntheticDatasetReader Reader(60U);
+
+    const ListUInt64 FrameIndices{0U, 2U, 3U, 6U, 7U, 15U, 16U, 17U, 19U, 30U, 33U, 34U, 58U, 59U};
+
+    for(const uint64 NumberOfWorkers : {0U, 1U, 4U})
+    {
+        SCOPED_TRACE("Workers " + std::to_string(NumberOfWorkers));
+
+        DatasetPrefetcher Prefetcher(Reader, NumberOfWorkers, 4U);
+
+        ReadFrames(Prefetcher, FrameIndices);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for reading frames in random order.
+///
+/// Tests whether frames outside of the prefetched window (including frames
+/// read before and the same frame twice) are decoded correctly and whether
+/// frames beyond the dataset are rejected or not. The expectation is to get
+/// the images of each frame read and an exception for invalid frames.
+///////////////////////////////////////////////////////////////////////////////
+TEST_GETFRAME_RANDOMACCESS_ISMATCHINGREADER(DatasetPrefetcher, Test_GetFrame_RandomAccess_IsMatchingReader)
+{
+    const SyntheticDatasetReader Reader(50U);
+
+    const ListUInt64 FrameIndices{25U, 3U, 3U, 4U, 49U, 0U, 1U, 2U, 40U, 12U, 13U, 11U, 48U, 49U};
+
+    for(const uint64 NumberOfWorkers : {0U, 1U, 4U})
+    {
+        SCOPED_TRACE("Workers " + std::to_string(NumberOfWorkers));
+
+        DatasetPrefetcher Prefetcher(Reader, NumberOfWorkers, 4U);
+
+        ReadFrames(Prefetcher, FrameIndices);
+
+        ImageInformation ImageInformationStereoLeft;
+        ImageInformation ImageInformationStereoRight;
+
+        ASSERT_THROW(Prefetcher.GetFrame(50U, ImageInformationStereoLeft, ImageInformationStereoRight), std::out_of_range);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for images which fail to decode.
+///
+/// Tests whether an exception thrown while decoding an image is passed to the
+/// consumer requesting the frame or not, both if the frame is read in order
+/// and by random access. The expectation is to get the exception for the
+/// failing frame only and the images of all other frames.
+///////////////////////////////////////////////////////////////////////////////
+TEST_GETFRAME_FAILINGIMAGE_ISRETHROWN(DatasetPrefetcher, Test_GetFrame_FailingImage_IsRethrown)
+{
+    const uint64 FailingFrameIndex{5U};
+
+    const SyntheticDatasetReader Reader(20U, FailingFrameIndex);
+
+    for(const uint64 NumberOfWorkers : {0U, 1U, 4U})
+    {
+        SCOPED_TRACE("Workers " + std::to_string(NumberOfWorkers));
+
+        DatasetPrefetcher Prefetcher(Reader, NumberOfWorkers, 4U);
+
+        ImageInformation ImageInformationStereoLeft;
+        ImageInformation ImageInformationStereoRight;
+
+        ReadFrames(Prefetcher, {0U, 1U, 2U, 3U, 4U});
+
+        ASSERT_THROW(Prefetcher.GetFrame(FailingFrameIndex, ImageInformationStereoLeft, ImageInformationStereoRight), std::runtime_error);
+
+        ReadFrames(Prefetcher, {6U, 7U, 8U, 9U, 10U, 11U});
+
+        // random access to the failing frame (outside of the window)
+        ASSERT_THROW(Prefetcher.GetFrame(FailingFrameIndex, ImageInformationStereoLeft, ImageInformationStereoRight), std::runtime_error);
+
+        ReadFrames(Prefetcher, {6U, 7U, 19U});
+    }
+}
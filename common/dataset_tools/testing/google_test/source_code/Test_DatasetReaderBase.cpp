@@ -0,0 +1,745 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  Test_DatasetReaderBase.cpp
+///
+/// \brief Source file containing the unit tests for DatasetReaderBase.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "SyntheticDatasetReader.h"
+
+// definition of macros for the unit tests
+#define TEST_PARSEHEADER_ALLFORMATS_ISMATCHINGDIMENSIONS      TEST ///< Define to get a unique test name.
+#define TEST_PARSEHEADER_OTHERFORMAT_ISREJECTED               TEST ///< Define to get a unique test name.
+#define TEST_VALIDATEIMAGESDIMENSIONS_MIXEDFORMATS_ISMATCHING TEST ///< Define to get a unique test name.
+#define TEST_VALIDATEIMAGESDIMENSIONS_TRUNCATEDHEADER_ISFALSE TEST ///< Define to get a unique test name.
+#define TEST_INDEXCACHE_SAVEDINDEX_ISLOADED                   TEST ///< Define to get a unique test name.
+#define TEST_INDEXCACHE_MODIFIEDSOURCE_ISINVALIDATED          TEST ///< Define to get a unique test name.
+#define TEST_INDEXCACHE_CONCURRENTSAVES_ISVALID               TEST ///< Define to get a unique test name.
+#define TEST_SETDECODINGOPTIONS_REDUCEDRESOLUTION_ISMATCHING  TEST ///< Define to get a unique test name.
+#define TEST_SETDECODINGOPTIONS_REGIONOFINTEREST_ISCONVERTED  TEST ///< Define to get a unique test name.
+#define TEST_FINDNEARESTFRAME_ALLTIMESTAMPS_ISNEAREST          TEST ///< Define to get a unique test name.
+#define TEST_FINDNEARESTFRAME_MISSINGIMAGES_ISCLAMPED          TEST ///< Define to get a unique test name.
+#define TEST_FINDFRAMESININTERVAL_ALLINTERVALS_ISMATCHING      TEST ///< Define to get a unique test name.
+#define TEST_FINDFRAMESININTERVAL_MISSINGIMAGES_ISCLAMPED      TEST ///< Define to get a unique test name.
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class DatasetReaderBaseExposed
+///
+/// \brief Class exposing the header parsers of the DatasetReaderBase and
+///        allowing to replace the images of the dataset.
+///////////////////////////////////////////////////////////////////////////////
+class DatasetReaderBaseExposed : public SyntheticDatasetReader
+{
+public:
+    using SyntheticDatasetReader::SyntheticDatasetReader;
+    using DatasetReaderBase::LoadIndexCache;
+    using DatasetReaderBase::ParseHeaderJPEG;
+    using DatasetReaderBase::ParseHeaderPNG;
+    using DatasetReaderBase::ParseHeaderPNM;
+    using DatasetReaderBase::ReadImageDimensions;
+    using DatasetReaderBase::SaveIndexCache;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Creates an index of a dataset (filenames, timestamps, image
+    ///            dimensions and projection matrices).
+    ///
+    /// \param[in] NumberOfFrames Number of frames of the dataset.
+    ///////////////////////////////////////////////////////////////////////////////
+    void CreateIndex(const uint64 NumberOfFrames)
+    {
+        m_FilenamesWithPathImagesStereoLeft.clear();
+        m_FilenamesWithPathImagesStereoRight.clear();
+        m_TimestampsImagesStereoLeftNanoseconds.clear();
+        m_TimestampsImagesStereoRightNanoseconds.clear();
+
+        for(uint64 i_Frame{0U}; i_Frame < NumberOfFrames; i_Frame++)
+        {
+            m_FilenamesWithPathImagesStereoLeft.push_back("/dataset/left/" + std::to_string(i_Frame) + ".png");
+            m_FilenamesWithPathImagesStereoRight.push_back("/dataset/right/" + std::to_string(i_Frame) + ".png");
+            m_TimestampsImagesStereoLeftNanoseconds.push_back(1000U * i_Frame + 1U);
+            m_TimestampsImagesStereoRightNanoseconds.push_back(1000U * i_Frame + 2U);
+        }
+
+        m_NumberOfImagesStereoLeft      = NumberOfFrames;
+        m_NumberOfImagesStereoRight     = NumberOfFrames;
+        m_NumberOfTimestampsStereoLeft  = NumberOfFrames;
+        m_NumberOfTimestampsStereoRight = NumberOfFrames;
+        m_HeightImagesStereo            = 376U;
+        m_WidthImagesStereo             = 1241U;
+
+        m_ProjectionMatrixStereoLeft << 718.856, 0.0, 607.1928, 0.0,
+            0.0, 718.856, 185.2157, 0.0,
+            0.0, 0.0, 1.0, 0.0;
+        m_ProjectionMatrixStereoRight << 718.856, 0.0, 607.1928, -386.1448,
+            0.0, 718.856, 185.2157, 0.0,
+            0.0, 0.0, 1.0, 0.0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the region of interest w.r.t. the image decoded at the
+    ///         reduced resolution.
+    ///
+    /// \return Region of interest.
+    ///////////////////////////////////////////////////////////////////////////////
+    const cv::Rect& GetRegionOfInterestDecoded() const
+    {
+        return m_RegionOfInterestDecoded;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Checks whether the index matches the index of another reader or
+    ///            not.
+    ///
+    /// \param[in] Reader Reader the index is compared with.
+    ///
+    /// \return    Flag whether both indices are identical or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    boolean IsIndexMatching(const DatasetReaderBaseExposed& Reader) const
+    {
+        return (m_FilenamesWithPathImagesStereoLeft == Reader.m_FilenamesWithPathImagesStereoLeft) &&
+               (m_FilenamesWithPathImagesStereoRight == Reader.m_FilenamesWithPathImagesStereoRight) &&
+               (m_TimestampsImagesStereoLeftNanoseconds == Reader.m_TimestampsImagesStereoLeftNanoseconds) &&
+               (m_TimestampsImagesStereoRightNanoseconds == Reader.m_TimestampsImagesStereoRightNanoseconds) &&
+               (m_NumberOfImagesStereoLeft == Reader.m_NumberOfImagesStereoLeft) &&
+               (m_NumberOfImagesStereoRight == Reader.m_NumberOfImagesStereoRight) &&
+               (m_NumberOfTimestampsStereoLeft == Reader.m_NumberOfTimestampsStereoLeft) &&
+               (m_NumberOfTimestampsStereoRight == Reader.m_NumberOfTimestampsStereoRight) &&
+               (m_HeightImagesStereo == Reader.m_HeightImagesStereo) &&
+               (m_WidthImagesStereo == Reader.m_WidthImagesStereo) &&
+               (m_ProjectionMatrixStereoLeft == Reader.m_ProjectionMatrixStereoLeft) &&
+               (m_ProjectionMatrixStereoRight == Reader.m_ProjectionMatrixStereoRight);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Replaces the images of the dataset.
+    ///
+    /// \param[in] FilenamesStereoLeft  Filenames of the left stereo camera images (including their absolute path).
+    /// \param[in] FilenamesStereoRight Filenames of the right stereo camera images (including their absolute path).
+    /// \param[in] ImageHeight          Height of the stereo camera images.
+    /// \param[in] ImageWidth           Width of the stereo camera images.
+    ///////////////////////////////////////////////////////////////////////////////
+    void SetImages(const std::vector<std::string>& FilenamesStereoLeft,
+                   const std::vector<std::string>& FilenamesStereoRight,
+                   const uint32                    ImageHeight,
+                   const uint32                    ImageWidth)
+    {
+        m_FilenamesWithPathImagesStereoLeft  = FilenamesStereoLeft;
+        m_FilenamesWithPathImagesStereoRight = FilenamesStereoRight;
+        m_HeightImagesStereo                 = ImageHeight;
+        m_WidthImagesStereo                  = ImageWidth;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the header parsers.
+///
+/// Tests whether the dimensions parsed from the headers of a PNG, a JPEG and a
+/// PGM image match the dimensions of the images or not. The PGM header
+/// contains a comment. The expectation is to get a height of 10 pixels and a
+/// width of 12 pixels for all images.
+///////////////////////////////////////////////////////////////////////////////
+TEST_PARSEHEADER_ALLFORMATS_ISMATCHINGDIMENSIONS(DatasetReaderBase, Test_ParseHeader_AllFormats_IsMatchingDimensions)
+{
+    std::ifstream ImageStreamPNG(DIRECTORY_TEST_DATA "ImageHeader.png", std::ios::binary);
+    std::ifstream ImageStreamJPEG(DIRECTORY_TEST_DATA "ImageHeader.jpg", std::ios::binary);
+    std::ifstream ImageStreamPNM(DIRECTORY_TEST_DATA "ImageHeader.pgm", std::ios::binary);
+
+    uint32 ImageHeightPNG{0U};
+    uint32 ImageWidthPNG{0U};
+    uint32 ImageHeightJPEG{0U};
+    uint32 ImageWidthJPEG{0U};
+    uint32 ImageHeightPNM{0U};
+    uint32 ImageWidthPNM{0U};
+
+    ASSERT_TRUE(DatasetReaderBaseExposed::ParseHeaderPNG(ImageStreamPNG, ImageHeightPNG, ImageWidthPNG));
+    ASSERT_TRUE(DatasetReaderBaseExposed::ParseHeaderJPEG(ImageStreamJPEG, ImageHeightJPEG, ImageWidthJPEG));
+    ASSERT_TRUE(DatasetReaderBaseExposed::ParseHeaderPNM(ImageStreamPNM, ImageHeightPNM, ImageWidthPNM));
+
+    ASSERT_EQ(ImageHeightPNG, 10U);
+    ASSERT_EQ(ImageWidthPNG, 12U);
+    ASSERT_EQ(ImageHeightJPEG, 10U);
+    ASSERT_EQ(ImageWidthJPEG, 12U);
+    ASSERT_EQ(ImageHeightPNM, 10U);
+    ASSERT_EQ(ImageWidthPNM, 12U);
+
+    // the format is detected by the first byte of the file
+    const std::vector<std::string> Filenames{DIRECTORY_TEST_DATA "ImageHeader.png", DIRECTORY_TEST_DATA "ImageHeader.jpg", DIRECTORY_TEST_DATA "ImageHeader.pgm"};
+
+    for(const std::string& Filename : Filenames)
+    {
+        uint32 ImageHeight{0U};
+        uint32 ImageWidth{0U};
+
+        ASSERT_TRUE(DatasetReaderBaseExposed::ReadImageDimensions(Filename, ImageHeight, ImageWidth));
+        ASSERT_EQ(ImageHeight, 10U);
+        ASSERT_EQ(ImageWidth, 12U);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the header parsers with headers they cannot parse.
+///
+/// Tests whether the header parsers reject images of another format, a
+/// truncated PNG header and a missing file or not. The expectation is that
+/// all parsers return false.
+///////////////////////////////////////////////////////////////////////////////
+TEST_PARSEHEADER_OTHERFORMAT_ISREJECTED(DatasetReaderBase, Test_ParseHeader_OtherFormat_IsRejected)
+{
+    std::ifstream ImageStreamPNG(DIRECTORY_TEST_DATA "ImageHeader.png", std::ios::binary);
+    std::ifstream ImageStreamJPEG(DIRECTORY_TEST_DATA "ImageHeader.jpg", std::ios::binary);
+    std::ifstream ImageStreamPNM(DIRECTORY_TEST_DATA "ImageHeader.pgm", std::ios::binary);
+    std::ifstream ImageStreamTruncated(DIRECTORY_TEST_DATA "ImageHeaderTruncated.png", std::ios::binary);
+
+    uint32 ImageHeight{0U};
+    uint32 ImageWidth{0U};
+
+    ASSERT_FALSE(DatasetReaderBaseExposed::ParseHeaderJPEG(ImageStreamPNG, ImageHeight, ImageWidth));
+    ASSERT_FALSE(DatasetReaderBaseExposed::ParseHeaderPNM(ImageStreamJPEG, ImageHeight, ImageWidth));
+    ASSERT_FALSE(DatasetReaderBaseExposed::ParseHeaderPNG(ImageStreamPNM, ImageHeight, ImageWidth));
+    ASSERT_FALSE(DatasetReaderBaseExposed::ParseHeaderPNG(ImageStreamTruncated, ImageHeight, ImageWidth));
+
+    ASSERT_FALSE(DatasetReaderBaseExposed::ReadImageDimensions(DIRECTORY_TEST_DATA "ImageHeaderTruncated.png", ImageHeight, ImageWidth));
+    ASSERT_FALSE(DatasetReaderBaseExposed::ReadImageDimensions(DIRECTORY_TEST_DATA "ImageHeaderMissing.png", ImageHeight, ImageWidth));
+    ASSERT_FALSE(DatasetReaderBaseExposed::ReadImageDimensions(DIRECTORY_TEST_DATA "TimestampsKITTI.txt", ImageHeight, ImageWidth));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the validation of the image dimensions.
+///
+/// Tests whether the validation accepts images of different formats with the
+/// same dimensions or not. The expectation is to accept the images if the
+/// dimensions of the dataset match, and to reject them otherwise.
+///////////////////////////////////////////////////////////////////////////////
+TEST_VALIDATEIMAGESDIMENSIONS_MIXEDFORMATS_ISMATCHING(DatasetReaderBase, Test_ValidateImagesDimensions_MixedFormats_IsMatching)
+{
+    const std::vector<std::string> FilenamesStereoLeft{DIRECTORY_TEST_DATA "ImageHeader.png", DIRECTORY_TEST_DATA "ImageHeader.jpg", DIRECTORY_TEST_DATA "ImageHeader.pgm"};
+    const std::vector<std::string> FilenamesStereoRight{DIRECTORY_TEST_DATA "ImageHeader.pgm", DIRECTORY_TEST_DATA "ImageHeader.png", DIRECTORY_TEST_DATA "ImageHeader.jpg"};
+
+    DatasetReaderBaseExposed Reader(0U);
+
+    Reader.SetImages(FilenamesStereoLeft, FilenamesStereoRight, 10U, 12U);
+
+    ASSERT_TRUE(Reader.ValidateImagesDimensions(1U));
+    ASSERT_TRUE(Reader.ValidateImagesDimensions(4U));
+
+    Reader.SetImages(FilenamesStereoLeft, FilenamesStereoRight, 10U, 13U);
+
+    ASSERT_FALSE(Reader.ValidateImagesDimensions(1U));
+    ASSERT_FALSE(Reader.ValidateImagesDimensions(4U));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the validation of images with a truncated header.
+///
+/// Tests whether the validation rejects an image whose header cannot be
+/// parsed or not. The expectation is that the validation fails instead of
+/// decoding the image.
+///////////////////////////////////////////////////////////////////////////////
+TEST_VALIDATEIMAGESDIMENSIONS_TRUNCATEDHEADER_ISFALSE(DatasetReaderBase, Test_ValidateImagesDimensions_TruncatedHeader_IsFalse)
+{
+    const std::vector<std::string> FilenamesStereoLeft{DIRECTORY_TEST_DATA "ImageHeader.png", DIRECTORY_TEST_DATA "ImageHeader.png"};
+    const std::vector<std::string> FilenamesStereoRight{DIRECTORY_TEST_DATA "ImageHeader.png", DIRECTORY_TEST_DATA "ImageHeaderTruncated.png"};
+
+    DatasetReaderBaseExposed Reader(0U);
+
+    Reader.SetImages(FilenamesStereoLeft, FilenamesStereoRight, 10U, 12U);
+
+    ASSERT_FALSE(Reader.ValidateImagesDimensions(1U));
+    ASSERT_FALSE(Reader.ValidateImagesDimensions(2U));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief      Creates an empty directory for the files written by a test.
+///
+/// \param[in]  TestName Name of the test.
+///
+/// \return     Path to the directory.
+///////////////////////////////////////////////////////////////////////////////
+std::filesystem::path CreateTestDirectory(const std::string& TestName)
+{
+    const std::filesystem::path TestDirectory{std::filesystem::temp_directory_path() / (TestName + "_" + std::to_string(getpid()))};
+
+    std::filesystem::remove_all(TestDirectory);
+    std::filesystem::create_directories(TestDirectory);
+
+    return TestDirectory;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief     Writes a source file of the index (e.g. a timestamp file).
+///
+/// \param[in] FilenameSource Filename of the source file including its path.
+/// \param[in] Content        Content of the source file.
+///////////////////////////////////////////////////////////////////////////////
+void WriteSourceFile(const std::filesystem::path& FilenameSource,
+                     const std::string&           Content)
+{
+    std::ofstream SourceFile(FilenameSource, std::ios::trunc);
+
+    SourceFile << Content;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for loading a saved index.
+///
+/// Tests whether the index loaded from the cache matches the saved index or
+/// not. The expectation is to load an identical index, and to load nothing
+/// from a missing or a truncated cache (i.e. a partially parsed index is
+/// discarded).
+///////////////////////////////////////////////////////////////////////////////
+TEST_INDEXCACHE_SAVEDINDEX_ISLOADED(DatasetReaderBase, Test_IndexCache_SavedIndex_IsLoaded)
+{
+    const std::filesystem::path TestDirectory{CreateTestDirectory("Test_IndexCache_SavedIndex_IsLoaded")};
+    const std::filesystem::path FilenameIndexCache{TestDirectory / "index.cache"};
+    const std::filesystem::path FilenameSource{TestDirectory / "times.txt"};
+    const std::filesystem::path DirectorySource{TestDirectory / "images"};
+
+    WriteSourceFile(FilenameSource, "0.0\n0.1\n0.2\n");
+    std::filesystem::create_directory(DirectorySource);
+
+    DatasetReaderBaseExposed ReaderSaving(0U);
+    DatasetReaderBaseExposed ReaderLoading(0U);
+    DatasetReaderBaseExposed ReaderMissing(0U);
+    DatasetReaderBaseExposed ReaderTruncated(0U);
+
+    ReaderSaving.CreateIndex(25U);
+    ReaderSaving.SaveIndexCache(FilenameIndexCache, {FilenameSource, DirectorySource});
+
+    ASSERT_TRUE(ReaderLoading.LoadIndexCache(FilenameIndexCache, {FilenameSource, DirectorySource}));
+    ASSERT_TRUE(ReaderLoading.IsIndexMatching(ReaderSaving));
+    ASSERT_EQ(ReaderLoading.GetNumberOfFrames(), 25U);
+
+    // missing cache
+    ASSERT_FALSE(ReaderMissing.LoadIndexCache(TestDirectory / "missing.cache", {FilenameSource, DirectorySource}));
+
+    // truncated cache
+    std::filesystem::resize_file(FilenameIndexCache, std::filesystem::file_size(FilenameIndexCache) / 2U);
+
+    ASSERT_FALSE(ReaderTruncated.LoadIndexCache(FilenameIndexCache, {FilenameSource, DirectorySource}));
+    ASSERT_EQ(ReaderTruncated.GetNumberOfFrames(), 0U);
+    ASSERT_EQ(ReaderTruncated.GetImageHeightStereoImages(), 0U);
+    ASSERT_EQ(ReaderTruncated.GetImageWidthStereoImages(), 0U);
+
+    std::filesystem::remove_all(TestDirectory);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the invalidation of the cache by a modified source.
+///
+/// Tests whether the cache is invalidated if a source of the index is touched
+/// or changes its size or not. The expectation is that the cache is not
+/// loaded after the modification, and that the cache saved afterwards (i.e.
+/// the rebuilt index) is loaded again.
+///////////////////////////////////////////////////////////////////////////////
+TEST_INDEXCACHE_MODIFIEDSOURCE_ISINVALIDATED(DatasetReaderBase, Test_IndexCache_ModifiedSource_IsInvalidated)
+{
+    const std::filesystem::path TestDirectory{CreateTestDirectory("Test_IndexCache_ModifiedSource_IsInvalidated")};
+    const std::filesystem::path FilenameIndexCache{TestDirectory / "index.cache"};
+    const std::filesystem::path FilenameSource{TestDirectory / "times.txt"};
+
+    WriteSourceFile(FilenameSource, "0.0\n0.1\n0.2\n");
+
+    DatasetReaderBaseExposed ReaderSaving(0U);
+
+    ReaderSaving.CreateIndex(3U);
+    ReaderSaving.SaveIndexCache(FilenameIndexCache, {FilenameSource});
+
+    // touch the source (same size)
+    std::filesystem::last_write_time(FilenameSource, std::filesystem::last_write_time(FilenameSource) + std::chrono::seconds(2));
+
+    DatasetReaderBaseExposed ReaderTouched(0U);
+
+    ASSERT_FALSE(ReaderTouched.LoadIndexCache(FilenameIndexCache, {FilenameSource}));
+    ASSERT_EQ(ReaderTouched.GetNumberOfFrames(), 0U);
+
+    // rebuild the cache
+    ReaderSaving.SaveIndexCache(FilenameIndexCache, {FilenameSource});
+
+    ASSERT_TRUE(ReaderTouched.LoadIndexCache(FilenameIndexCache, {FilenameSource}));
+    ASSERT_TRUE(ReaderTouched.IsIndexMatching(ReaderSaving));
+
+    // change the size of the source (same modification time)
+    const std::filesystem::file_time_type LastWriteTime{std::filesystem::last_write_time(FilenameSource)};
+
+    WriteSourceFile(FilenameSource, "0.0\n0.1\n0.2\n0.3\n");
+    std::filesystem::last_write_time(FilenameSource, LastWriteTime);
+
+    DatasetReaderBaseExposed ReaderResized(0U);
+
+    ASSERT_FALSE(ReaderResized.LoadIndexCache(FilenameIndexCache, {FilenameSource}));
+
+    // remove the source
+    std::filesystem::remove(FilenameSource);
+
+    DatasetReaderBaseExposed ReaderRemoved(0U);
+
+    ASSERT_FALSE(ReaderRemoved.LoadIndexCache(FilenameIndexCache, {FilenameSource}));
+
+    std::filesystem::remove_all(TestDirectory);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for concurrent saves of the same cache.
+///
+/// Tests whether several threads saving the same cache at the same time leave
+/// a valid cache or not. The expectation is that the cache is loaded after all
+/// threads finished, and that no temporary files are left.
+///////////////////////////////////////////////////////////////////////////////
+TEST_INDEXCACHE_CONCURRENTSAVES_ISVALID(DatasetReaderBase, Test_IndexCache_ConcurrentSaves_IsValid)
+{
+    const std::filesystem::path TestDirectory{CreateTestDirectory("Test_IndexCache_ConcurrentSaves_IsValid")};
+    const std::filesystem::path FilenameIndexCache{TestDirectory / "index.cache"};
+    const std::filesystem::path FilenameSource{TestDirectory / "times.txt"};
+
+    WriteSourceFile(FilenameSource, "0.0\n0.1\n0.2\n");
+
+    DatasetReaderBaseExposed ReaderSaving(0U);
+
+    ReaderSaving.CreateIndex(500U);
+
+    std::vector<std::thread> Threads;
+
+    for(uint64 i_Thread{0U}; i_Thread < 4U; i_Thread++)
+    {
+        Threads.emplace_back([&]()
+        {
+            for(uint64 i_Save{0U}; i_Save < 20U; i_Save++)
+            {
+                ReaderSaving.SaveIndexCache(FilenameIndexCache, {FilenameSource});
+            }
+        });
+    }
+
+    for(std::thread& Thread : Threads)
+    {
+        Thread.join();
+    }
+
+    DatasetReaderBaseExposed ReaderLoading(0U);
+
+    ASSERT_TRUE(ReaderLoading.LoadIndexCache(FilenameIndexCache, {FilenameSource}));
+    ASSERT_TRUE(ReaderLoading.IsIndexMatching(ReaderSaving));
+
+    // only the source and the cache are left
+    uint64 NumberOfFiles{0U};
+
+    for(const std::filesystem::directory_entry& Entry : std::filesystem::directory_iterator(TestDirectory))
+    {
+        static_cast<void>(Entry);
+
+        NumberOfFiles++;
+    }
+
+    ASSERT_EQ(NumberOfFiles, 2U);
+
+    std::filesystem::remove_all(TestDirectory);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief      Projects a point into an image.
+///
+/// \param[in]  ProjectionMatrix Projection matrix of the camera.
+/// \param[in]  Point            Point (homogeneous coordinates).
+///
+/// \return     Pixel coordinates of the projected point.
+///////////////////////////////////////////////////////////////////////////////
+ColumnVectorFloat64_2d ProjectPoint(const MatrixFloat64_3x4&      ProjectionMatrix,
+                                    const ColumnVectorFloat64_4d& Point)
+{
+    const ColumnVectorFloat64_3d PointProjected{ProjectionMatrix * Point};
+
+    return PointProjected.head<2>() / PointProjected(2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the projection matrices at reduced resolutions.
+///
+/// Tests whether the projection matrices matching the decoding options map
+/// the points to the pixel grid of the reduced images or not. The image width
+/// (1241 pixels) is not divisible by the reduction factors. The expectation is
+/// that the center of a full resolution pixel at (u, v) is mapped to
+/// ((u + 0.5) * WidthReduced / Width - 0.5, (v + 0.5) * HeightReduced / Height
+/// - 0.5), shifted by the start of the region of interest.
+///////////////////////////////////////////////////////////////////////////////
+TEST_SETDECODINGOPTIONS_REDUCEDRESOLUTION_ISMATCHING(DatasetReaderBase, Test_SetDecodingOptions_ReducedResolution_IsMatching)
+{
+    DatasetReaderBaseExposed Reader(0U);
+
+    Reader.CreateIndex(1U);
+
+    const MatrixFloat64_3x4 ProjectionMatrixStereoLeft{Reader.GetProjectionMatrixStereoLeft()};
+    const MatrixFloat64_3x4 ProjectionMatrixStereoRight{Reader.GetProjectionMatrixStereoRight()};
+
+    // points projected to the image corners and the image center
+    const ListColumnVectorFloat64_4d Points{ColumnVectorFloat64_4d(-8.0, -2.5, 10.0, 1.0), ColumnVectorFloat64_4d(9.0, 2.6, 10.0, 1.0), ColumnVectorFloat64_4d(0.3, -0.1, 25.0, 1.0)};
+
+    const std::vector<DecodingScale> Scales{DecodingScaleFull, DecodingScaleHalf, DecodingScaleQuarter, DecodingScaleEighth};
+    const std::vector<cv::Rect>      RegionsOfInterest{cv::Rect(), cv::Rect(96, 40, 800, 200)};
+
+    for(const DecodingScale Scale : Scales)
+    {
+        for(const cv::Rect& RegionOfInterest : RegionsOfInterest)
+        {
+            Reader.SetDecodingOptions(Scale, RegionOfInterest);
+
+            const float64 HeightImagesReduced{static_cast<float64>(376 / static_cast<sint32>(Scale))};
+            const float64 WidthImagesReduced{static_cast<float64>(1241 / static_cast<sint32>(Scale))};
+            const float64 RegionStartHorizontal{static_cast<float64>(Reader.GetRegionOfInterestDecoded().x)};
+            const float64 RegionStartVertical{static_cast<float64>(Reader.GetRegionOfInterestDecoded().y)};
+
+            for(const ColumnVectorFloat64_4d& Point : Points)
+            {
+                const ColumnVectorFloat64_2d PixelLeft{ProjectPoint(ProjectionMatrixStereoLeft, Point)};
+                const ColumnVectorFloat64_2d PixelRight{ProjectPoint(ProjectionMatrixStereoRight, Point)};
+                const ColumnVectorFloat64_2d PixelDecodedLeft{ProjectPoint(Reader.GetProjectionMatrixStereoLeft(), Point)};
+                const ColumnVectorFloat64_2d PixelDecodedRight{ProjectPoint(Reader.GetProjectionMatrixStereoRight(), Point)};
+
+                ASSERT_NEAR(PixelDecodedLeft(0), ((PixelLeft(0) + 0.5) * WidthImagesReduced / 1241.0) - 0.5 - RegionStartHorizontal, 1e-9);
+                ASSERT_NEAR(PixelDecodedLeft(1), ((PixelLeft(1) + 0.5) * HeightImagesReduced / 376.0) - 0.5 - RegionStartVertical, 1e-9);
+                ASSERT_NEAR(PixelDecodedRight(0), ((PixelRight(0) + 0.5) * WidthImagesReduced / 1241.0) - 0.5 - RegionStartHorizontal, 1e-9);
+                ASSERT_NEAR(PixelDecodedRight(1), ((PixelRight(1) + 0.5) * HeightImagesReduced / 376.0) - 0.5 - RegionStartVertical, 1e-9);
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the conversion of the region of interest.
+///
+/// Tests whether the region of interest is converted to the reduced
+/// resolution and clipped to the images or not. The expectation is to get the
+/// converted regions (the whole image for an empty region) and an
+/// std::invalid_argument exception for a region outside of the images.
+///////////////////////////////////////////////////////////////////////////////
+TEST_SETDECODINGOPTIONS_REGIONOFINTEREST_ISCONVERTED(DatasetReaderBase, Test_SetDecodingOptions_RegionOfInterest_IsConverted)
+{
+    DatasetReaderBaseExposed Reader(0U);
+
+    Reader.CreateIndex(1U);
+
+    // whole image
+    Reader.SetDecodingOptions(DecodingScaleQuarter, cv::Rect());
+
+    ASSERT_EQ(Reader.GetRegionOfInterestDecoded(), cv::Rect(0, 0, 310, 94));
+    ASSERT_EQ(Reader.GetImageHeightStereoImages(), 94U);
+    ASSERT_EQ(Reader.GetImageWidthStereoImages(), 310U);
+
+    // region inside of the image at full resolution
+    Reader.SetDecodingOptions(DecodingScaleFull, cv::Rect(1, 2, 3, 4));
+
+    ASSERT_EQ(Reader.GetRegionOfInterestDecoded(), cv::Rect(1, 2, 3, 4));
+    ASSERT_EQ(Reader.GetImageHeightStereoImages(), 4U);
+    ASSERT_EQ(Reader.GetImageWidthStereoImages(), 3U);
+
+    // region inside of the image at a reduced resolution
+    Reader.SetDecodingOptions(DecodingScaleQuarter, cv::Rect(96, 40, 800, 200));
+
+    ASSERT_EQ(Reader.GetRegionOfInterestDecoded(), cv::Rect(24, 10, 200, 50));
+
+    // region exceeding the image at the top left corner
+    Reader.SetDecodingOptions(DecodingScaleHalf, cv::Rect(-10, -10, 400, 100));
+
+    ASSERT_EQ(Reader.GetRegionOfInterestDecoded(), cv::Rect(0, 0, 195, 45));
+
+    // region exceeding the image at the bottom right corner
+    Reader.SetDecodingOptions(DecodingScaleHalf, cv::Rect(1000, 300, 1000, 1000));
+
+    ASSERT_EQ(Reader.GetRegionOfInterestDecoded(), cv::Rect(500, 150, 120, 38));
+    ASSERT_EQ(Reader.GetImageHeightStereoImages(), 38U);
+    ASSERT_EQ(Reader.GetImageWidthStereoImages(), 120U);
+
+    // region outside of the image
+    ASSERT_THROW(Reader.SetDecodingOptions(DecodingScaleHalf, cv::Rect(2000, 0, 100, 100)), std::invalid_argument);
+    ASSERT_THROW(Reader.SetDecodingOptions(DecodingScaleFull, cv::Rect(0, 376, 100, 100)), std::invalid_argument);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the search of the nearest frame.
+///
+/// Tests whether the frame whose left stereo camera image was taken closest to
+/// a timestamp is found or not. The timestamps of the frames are 1, 1001,
+/// 2001, 3001 and 4001 nanoseconds. The expectation is to get the first (last)
+/// frame for timestamps before (after) the dataset, the earlier frame for
+/// timestamps in the middle of two frames and an std::out_of_range exception
+/// for a dataset without frames.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FINDNEARESTFRAME_ALLTIMESTAMPS_ISNEAREST(DatasetReaderBase, Test_FindNearestFrame_AllTimestamps_IsNearest)
+{
+    DatasetReaderBaseExposed Reader(0U);
+
+    ASSERT_THROW(Reader.FindNearestFrame(0U), std::out_of_range);
+
+    Reader.CreateIndex(5U);
+
+    // timestamps of the frames
+    for(uint64 i_Frame{0U}; i_Frame < 5U; i_Frame++)
+    {
+        ASSERT_EQ(Reader.FindNearestFrame(1000U * i_Frame + 1U), i_Frame);
+    }
+
+    // timestamps before and after the dataset
+    ASSERT_EQ(Reader.FindNearestFrame(0U), 0U);
+    ASSERT_EQ(Reader.FindNearestFrame(4002U), 4U);
+    ASSERT_EQ(Reader.FindNearestFrame(std::numeric_limits<uint64>::max()), 4U);
+
+    // timestamps between two frames
+    ASSERT_EQ(Reader.FindNearestFrame(500U), 0U);
+    ASSERT_EQ(Reader.FindNearestFrame(502U), 1U);
+    ASSERT_EQ(Reader.FindNearestFrame(2501U), 2U);
+    ASSERT_EQ(Reader.FindNearestFrame(2502U), 3U);
+
+    // timestamps in the middle of two frames
+    ASSERT_EQ(Reader.FindNearestFrame(501U), 0U);
+    ASSERT_EQ(Reader.FindNearestFrame(3501U), 3U);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the search of the nearest frame in a dataset with more
+///        timestamps than images.
+///
+/// Tests whether the nearest frame is limited to the frames with an image or
+/// not. The dataset contains five timestamps but only three images. The
+/// expectation is to get the last frame with an image for timestamps closest
+/// to the timestamps without an image.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FINDNEARESTFRAME_MISSINGIMAGES_ISCLAMPED(DatasetReaderBase, Test_FindNearestFrame_MissingImages_IsClamped)
+{
+    DatasetReaderBaseExposed Reader(0U);
+
+    Reader.CreateIndex(5U);
+    Reader.SetImages({"/dataset/left/0.png", "/dataset/left/1.png", "/dataset/left/2.png"}, {"/dataset/right/0.png", "/dataset/right/1.png", "/dataset/right/2.png"}, 376U, 1241U);
+
+    ASSERT_EQ(Reader.GetNumberOfFrames(), 3U);
+    ASSERT_EQ(Reader.FindNearestFrame(1001U), 1U);
+    ASSERT_EQ(Reader.FindNearestFrame(2001U), 2U);
+    ASSERT_EQ(Reader.FindNearestFrame(3001U), 2U);
+    ASSERT_EQ(Reader.FindNearestFrame(std::numeric_limits<uint64>::max()), 2U);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the search of the frames within an interval.
+///
+/// Tests whether the frames whose left stereo camera image was taken within an
+/// interval are found or not. The timestamps of the frames are 1, 1001, 2001,
+/// 3001 and 4001 nanoseconds. The expectation is to get the frames including
+/// the frames at both limits of the interval and no frames for intervals
+/// between two frames, outside of the dataset or with the end before the
+/// start.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FINDFRAMESININTERVAL_ALLINTERVALS_ISMATCHING(DatasetReaderBase, Test_FindFramesInInterval_AllIntervals_IsMatching)
+{
+    DatasetReaderBaseExposed Reader(0U);
+
+    uint64 FirstFrameIndex;
+    uint64 NumberOfFrames;
+
+    // dataset without frames
+    Reader.FindFramesInInterval(0U, std::numeric_limits<uint64>::max(), FirstFrameIndex, NumberOfFrames);
+
+    ASSERT_EQ(NumberOfFrames, 0U);
+
+    Reader.CreateIndex(5U);
+
+    // whole dataset
+    Reader.FindFramesInInterval(0U, std::numeric_limits<uint64>::max(), FirstFrameIndex, NumberOfFrames);
+
+    ASSERT_EQ(FirstFrameIndex, 0U);
+    ASSERT_EQ(NumberOfFrames, 5U);
+
+    // limits of the interval at the timestamps of frames (included)
+    Reader.FindFramesInInterval(1001U, 3001U, FirstFrameIndex, NumberOfFrames);
+
+    ASSERT_EQ(FirstFrameIndex, 1U);
+    ASSERT_EQ(NumberOfFrames, 3U);
+
+    // limits of the interval next to the timestamps of frames (excluded)
+    Reader.FindFramesInInterval(1002U, 3000U, FirstFrameIndex, NumberOfFrames);
+
+    ASSERT_EQ(FirstFrameIndex, 2U);
+    ASSERT_EQ(NumberOfFrames, 1U);
+
+    // interval containing a single timestamp
+    Reader.FindFramesInInterval(4001U, 4001U, FirstFrameIndex, NumberOfFrames);
+
+    ASSERT_EQ(FirstFrameIndex, 4U);
+    ASSERT_EQ(NumberOfFrames, 1U);
+
+    // interval between two frames
+    Reader.FindFramesInInterval(1002U, 2000U, FirstFrameIndex, NumberOfFrames);
+
+    ASSERT_EQ(NumberOfFrames, 0U);
+
+    // intervals before and after the dataset
+    Reader.FindFramesInInterval(0U, 0U, FirstFrameIndex, NumberOfFrames);
+
+    ASSERT_EQ(NumberOfFrames, 0U);
+
+    Reader.FindFramesInInterval(4002U, std::numeric_limits<uint64>::max(), FirstFrameIndex, NumberOfFrames);
+
+    ASSERT_EQ(NumberOfFrames, 0U);
+
+    // end of the interval before its start
+    Reader.FindFramesInInterval(3001U, 1001U, FirstFrameIndex, NumberOfFrames);
+
+    ASSERT_EQ(NumberOfFrames, 0U);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the search of the frames within an interval in a dataset
+///        with more timestamps than images.
+///
+/// Tests whether the frames within an interval are limited to the frames with
+/// an image or not. The dataset contains five timestamps but only three
+/// images. The expectation is to get only the frames with an image.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FINDFRAMESININTERVAL_MISSINGIMAGES_ISCLAMPED(DatasetReaderBase, Test_FindFramesInInterval_MissingImages_IsClamped)
+{
+    DatasetReaderBaseExposed Reader(0U);
+
+    Reader.CreateIndex(5U);
+    Reader.SetImages({"/dataset/left/0.png", "/dataset/left/1.png", "/dataset/left/2.png"}, {"/dataset/right/0.png", "/dataset/right/1.png", "/dataset/right/2.png"}, 376U, 1241U);
+
+    uint64 FirstFrameIndex;
+    uint64 NumberOfFrames;
+
+    Reader.FindFramesInInterval(1001U, 4001U, FirstFrameIndex, NumberOfFrames);
+
+    ASSERT_EQ(FirstFrameIndex, 1U);
+    ASSERT_EQ(NumberOfFrames, 2U);
+
+    Reader.FindFramesInInterval(3001U, 4001U, FirstFrameIndex, NumberOfFrames);
+
+    ASSERT_EQ(NumberOfFrames, 0U);
+}
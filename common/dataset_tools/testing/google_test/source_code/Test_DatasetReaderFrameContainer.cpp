@@ -0,0 +1,349 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  Test_DatasetReaderFrameContainer.cpp
+///
+/// \brief Source file containing the unit tests for the
+///        DatasetReaderFrameContainer.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "../../../DatasetReaderFrameContainer.h"
+#include "SyntheticDatasetReader.h"
+
+// definition of macros for the unit tests
+#define TEST_CONVERTDATASET_SYNTHETICDATASET_ISROUNDTRIP            TEST ///< Define to get a unique test name.
+#define TEST_CONVERTDATASET_INVALIDIMAGES_ISTHROWING                TEST ///< Define to get a unique test name.
+#define TEST_CONSTRUCTOR_CORRUPTEDCONTAINER_ISTHROWING              TEST ///< Define to get a unique test name.
+#define TEST_GETIMAGEINFORMATION_MODIFIEDIMAGE_ISNOTCHANGINGTHEFILE TEST ///< Define to get a unique test name.
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class SyntheticImagesDatasetReader
+///
+/// \brief Dataset reader providing synthetic images (a pattern encoding the
+///        frame index and the camera of an image).
+///////////////////////////////////////////////////////////////////////////////
+class SyntheticImagesDatasetReader : public SyntheticDatasetReader
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Constructor.
+    ///
+    /// \param[in] NumberOfFrames    Number of frames of the dataset.
+    /// \param[in] ImageHeight       Height of the stereo camera images.
+    /// \param[in] ImageWidth        Width of the stereo camera images.
+    /// \param[in] FailingFrameIndex Index of the frame whose images fail to decode.
+    ///////////////////////////////////////////////////////////////////////////////
+    SyntheticImagesDatasetReader(const uint64 NumberOfFrames,
+                                 const uint32 ImageHeight,
+                                 const uint32 ImageWidth,
+                                 const uint64 FailingFrameIndex = std::numeric_limits<uint64>::max()) :
+        SyntheticDatasetReader(NumberOfFrames, FailingFrameIndex)
+    {
+        m_HeightImagesStereo = ImageHeight;
+        m_WidthImagesStereo  = ImageWidth;
+
+        m_ProjectionMatrixStereoLeft << 718.856, 0.0, 607.1928, 0.0,
+            0.0, 718.856, 185.2157, 0.0,
+            0.0, 0.0, 1.0, 0.0;
+        m_ProjectionMatrixStereoRight << 718.856, 0.0, 607.1928, -386.1448,
+            0.0, 718.856, 185.2157, 0.0,
+            0.0, 0.0, 1.0, 0.0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Getter for the information of the left stereo camera image.
+    ///
+    /// \param[in]  Index            Index of the image.
+    /// \param[out] ImageInformation Image information of the left stereo camera image.
+    ///////////////////////////////////////////////////////////////////////////////
+    void GetImageInformationStereoLeft(uint64            Index,
+                                       ImageInformation& ImageInformation) const override
+    {
+        SyntheticDatasetReader::GetImageInformationStereoLeft(Index, ImageInformation);
+
+        ImageInformation.ImageGrayscale = CreateImage(Index, true);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Getter for the information of the right stereo camera image.
+    ///
+    /// \param[in]  Index            Index of the image.
+    /// \param[out] ImageInformation Image information of the right stereo camera image.
+    ///////////////////////////////////////////////////////////////////////////////
+    void GetImageInformationStereoRight(uint64            Index,
+                                        ImageInformation& ImageInformation) const override
+    {
+        SyntheticDatasetReader::GetImageInformationStereoRight(Index, ImageInformation);
+
+        ImageInformation.ImageGrayscale = CreateImage(Index, false);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Creates the image of a camera.
+    ///
+    /// \param[in] Index        Index of the image.
+    /// \param[in] IsStereoLeft Flag whether the image is the left stereo camera image or not.
+    ///
+    /// \return    Image of the camera.
+    ///////////////////////////////////////////////////////////////////////////////
+    cv::Mat CreateImage(const uint64  Index,
+                        const boolean IsStereoLeft) const
+    {
+        cv::Mat Image(static_cast<sint32>(m_HeightImagesStereo), static_cast<sint32>(m_WidthImagesStereo), CV_8UC1);
+
+        for(sint32 i_Row{0}; i_Row < Image.rows; i_Row++)
+        {
+            for(sint32 i_Column{0}; i_Column < Image.cols; i_Column++)
+            {
+                Image.at<uint8>(i_Row, i_Column) = static_cast<uint8>((7U * Index + 3U * static_cast<uint64>(i_Row) + static_cast<uint64>(i_Column) + (IsStereoLeft ? 0U : 128U)) % 256U);
+            }
+        }
+
+        return Image;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class SyntheticColorImagesDatasetReader
+///
+/// \brief Dataset reader providing synthetic images with three channels, i.e.
+///        images which cannot be stored in a frame container.
+///////////////////////////////////////////////////////////////////////////////
+class SyntheticColorImagesDatasetReader : public SyntheticImagesDatasetReader
+{
+public:
+    using SyntheticImagesDatasetReader::SyntheticImagesDatasetReader;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Getter for the information of the right stereo camera image.
+    ///
+    /// \param[in]  Index            Index of the image.
+    /// \param[out] ImageInformation Image information of the right stereo camera image.
+    ///////////////////////////////////////////////////////////////////////////////
+    void GetImageInformationStereoRight(uint64            Index,
+                                        ImageInformation& ImageInformation) const override
+    {
+        SyntheticImagesDatasetReader::GetImageInformationStereoRight(Index, ImageInformation);
+
+        ImageInformation.ImageGrayscale = cv::Mat(static_cast<sint32>(m_HeightImagesStereo), static_cast<sint32>(m_WidthImagesStereo), CV_8UC3);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief      Creates an empty directory for the frame containers written by a
+///             test.
+///
+/// \param[in]  TestName Name of the test.
+///
+/// \return     Path to the directory.
+///////////////////////////////////////////////////////////////////////////////
+std::filesystem::path CreateFrameContainerDirectory(const std::string& TestName)
+{
+    const std::filesystem::path TestDirectory{std::filesystem::temp_directory_path() / (TestName + "_" + std::to_string(getpid()))};
+
+    std::filesystem::remove_all(TestDirectory);
+    std::filesystem::create_directories(TestDirectory);
+
+    return TestDirectory;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the conversion of a dataset into a frame container.
+///
+/// Tests whether the frame container created from a synthetic dataset matches
+/// the dataset or not. The expectation is to read identical dimensions,
+/// projection matrices, timestamps, filenames and images, and that the
+/// decoded images do not copy the filenames.
+///////////////////////////////////////////////////////////////////////////////
+TEST_CONVERTDATASET_SYNTHETICDATASET_ISROUNDTRIP(DatasetReaderFrameContainer, Test_ConvertDataset_SyntheticDataset_IsRoundTrip)
+{
+    const std::filesystem::path TestDirectory{CreateFrameContainerDirectory("Test_ConvertDataset_SyntheticDataset_IsRoundTrip")};
+    const std::filesystem::path FilenameFrameContainer{TestDirectory / "dataset.frames"};
+
+    const SyntheticImagesDatasetReader Reader(6U, 10U, 12U);
+
+    DatasetReaderFrameContainer::ConvertDataset(Reader, FilenameFrameContainer.string());
+
+    const DatasetReaderFrameContainer FrameContainer(FilenameFrameContainer.string());
+
+    ASSERT_EQ(FrameContainer.GetNumberOfFrames(), 6U);
+    ASSERT_EQ(FrameContainer.GetImageHeightStereoImages(), 10U);
+    ASSERT_EQ(FrameContainer.GetImageWidthStereoImages(), 12U);
+    ASSERT_EQ(FrameContainer.GetProjectionMatrixStereoLeft(), Reader.GetProjectionMatrixStereoLeft());
+    ASSERT_EQ(FrameContainer.GetProjectionMatrixStereoRight(), Reader.GetProjectionMatrixStereoRight());
+
+    ImageBuffer Buffer;
+
+    for(uint64 i_Frame{0U}; i_Frame < 6U; i_Frame++)
+    {
+        ImageInformation ImageInformationExpectedLeft;
+        ImageInformation ImageInformationExpectedRight;
+        ImageInformation ImageInformationLeft;
+        ImageInformation ImageInformationRight;
+        ImageInformation ImageInformationDecodedLeft;
+        ImageInformation ImageInformationDecodedRight;
+
+        Reader.GetImageInformationStereoLeft(i_Frame, ImageInformationExpectedLeft);
+        Reader.GetImageInformationStereoRight(i_Frame, ImageInformationExpectedRight);
+        FrameContainer.GetImageInformationStereoLeft(i_Frame, ImageInformationLeft);
+        FrameContainer.GetImageInformationStereoRight(i_Frame, ImageInformationRight);
+        FrameContainer.DecodeImageStereoLeft(i_Frame, Buffer, ImageInformationDecodedLeft);
+        FrameContainer.DecodeImageStereoRight(i_Frame, Buffer, ImageInformationDecodedRight);
+
+        ASSERT_TRUE(ImageInformationLeft.IsValid);
+        ASSERT_EQ(ImageInformationLeft.Index, i_Frame);
+        ASSERT_EQ(ImageInformationLeft.Timestamp, ImageInformationExpectedLeft.Timestamp);
+        ASSERT_EQ(ImageInformationRight.Timestamp, ImageInformationExpectedRight.Timestamp);
+        ASSERT_EQ(ImageInformationLeft.FilenameWithAbsolutePath, ImageInformationExpectedLeft.FilenameWithAbsolutePath);
+        ASSERT_EQ(ImageInformationRight.FilenameWithAbsolutePath, ImageInformationExpectedRight.FilenameWithAbsolutePath);
+        ASSERT_EQ(cv::countNonZero(ImageInformationLeft.ImageGrayscale != ImageInformationExpectedLeft.ImageGrayscale), 0);
+        ASSERT_EQ(cv::countNonZero(ImageInformationRight.ImageGrayscale != ImageInformationExpectedRight.ImageGrayscale), 0);
+
+        ASSERT_TRUE(ImageInformationDecodedLeft.IsValid);
+        ASSERT_EQ(ImageInformationDecodedLeft.Index, i_Frame);
+        ASSERT_EQ(ImageInformationDecodedLeft.Timestamp, ImageInformationExpectedLeft.Timestamp);
+        ASSERT_EQ(ImageInformationDecodedRight.Timestamp, ImageInformationExpectedRight.Timestamp);
+        ASSERT_TRUE(ImageInformationDecodedLeft.FilenameWithAbsolutePath.empty());
+        ASSERT_TRUE(ImageInformationDecodedRight.FilenameWithAbsolutePath.empty());
+        ASSERT_EQ(cv::countNonZero(ImageInformationDecodedLeft.ImageGrayscale != ImageInformationExpectedLeft.ImageGrayscale), 0);
+        ASSERT_EQ(cv::countNonZero(ImageInformationDecodedRight.ImageGrayscale != ImageInformationExpectedRight.ImageGrayscale), 0);
+    }
+
+    // only the frame container is left (no temporary files)
+    ASSERT_EQ(std::distance(std::filesystem::directory_iterator(TestDirectory), std::filesystem::directory_iterator()), 1);
+
+    std::filesystem::remove_all(TestDirectory);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the conversion of a dataset whose images cannot be stored.
+///
+/// Tests whether the conversion of a dataset with color images or with an
+/// image failing to decode throws an exception or not. The expectation is
+/// that an exception is thrown and that neither the frame container nor a
+/// temporary file is left behind.
+///////////////////////////////////////////////////////////////////////////////
+TEST_CONVERTDATASET_INVALIDIMAGES_ISTHROWING(DatasetReaderFrameContainer, Test_ConvertDataset_InvalidImages_IsThrowing)
+{
+    const std::filesystem::path TestDirectory{CreateFrameContainerDirectory("Test_ConvertDataset_InvalidImages_IsThrowing")};
+    const std::filesystem::path FilenameFrameContainer{TestDirectory / "dataset.frames"};
+
+    const SyntheticColorImagesDatasetReader ReaderColor(4U, 10U, 12U);
+    const SyntheticImagesDatasetReader      ReaderFailing(4U, 10U, 12U, 2U);
+
+    ASSERT_THROW(DatasetReaderFrameContainer::ConvertDataset(ReaderColor, FilenameFrameContainer.string()), std::invalid_argument);
+    ASSERT_TRUE(std::filesystem::is_empty(TestDirectory));
+
+    ASSERT_THROW(DatasetReaderFrameContainer::ConvertDataset(ReaderFailing, FilenameFrameContainer.string()), std::runtime_error);
+    ASSERT_TRUE(std::filesystem::is_empty(TestDirectory));
+
+    std::filesystem::remove_all(TestDirectory);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for opening a corrupted frame container.
+///
+/// Tests whether opening a missing, an empty, a truncated or a corrupted frame
+/// container throws an exception or not. The expectation is that an
+/// std::invalid_argument exception is thrown in all cases.
+///////////////////////////////////////////////////////////////////////////////
+TEST_CONSTRUCTOR_CORRUPTEDCONTAINER_ISTHROWING(DatasetReaderFrameContainer, Test_Constructor_CorruptedContainer_IsThrowing)
+{
+    const std::filesystem::path TestDirectory{CreateFrameContainerDirectory("Test_Constructor_CorruptedContainer_IsThrowing")};
+    const std::filesystem::path FilenameFrameContainer{TestDirectory / "dataset.frames"};
+    const std::filesystem::path FilenameTruncated{TestDirectory / "truncated.frames"};
+    const std::filesystem::path FilenameCorrupted{TestDirectory / "corrupted.frames"};
+    const std::filesystem::path FilenameEmpty{TestDirectory / "empty.frames"};
+
+    const SyntheticImagesDatasetReader Reader(4U, 10U, 12U);
+
+    DatasetReaderFrameContainer::ConvertDataset(Reader, FilenameFrameContainer.string());
+
+    // truncated container (the frame table is missing)
+    std::filesystem::copy_file(FilenameFrameContainer, FilenameTruncated);
+    std::filesystem::resize_file(FilenameTruncated, std::filesystem::file_size(FilenameTruncated) / 2U);
+
+    // corrupted magic number
+    std::filesystem::copy_file(FilenameFrameContainer, FilenameCorrupted);
+    std::fstream CorruptedFile(FilenameCorrupted, std::ios::binary | std::ios::in | std::ios::out);
+    CorruptedFile.put('X');
+    CorruptedFile.close();
+
+    // empty container
+    std::ofstream EmptyFile(FilenameEmpty);
+    EmptyFile.close();
+
+    ASSERT_NO_THROW(DatasetReaderFrameContainer{FilenameFrameContainer.string()});
+    ASSERT_THROW(DatasetReaderFrameContainer{(TestDirectory / "missing.frames").string()}, std::invalid_argument);
+    ASSERT_THROW(DatasetReaderFrameContainer{FilenameTruncated.string()}, std::invalid_argument);
+    ASSERT_THROW(DatasetReaderFrameContainer{FilenameCorrupted.string()}, std::invalid_argument);
+    ASSERT_THROW(DatasetReaderFrameContainer{FilenameEmpty.string()}, std::invalid_argument);
+
+    std::filesystem::remove_all(TestDirectory);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for modifying an image pointing into the mapping.
+///
+/// Tests whether modifying an image handed out by the frame container changes
+/// the frame container or not. The expectation is that the image can be
+/// modified, and that a frame container opened afterwards still contains the
+/// original image.
+///////////////////////////////////////////////////////////////////////////////
+TEST_GETIMAGEINFORMATION_MODIFIEDIMAGE_ISNOTCHANGINGTHEFILE(DatasetReaderFrameContainer, Test_GetImageInformation_ModifiedImage_IsNotChangingTheFile)
+{
+    const std::filesystem::path TestDirectory{CreateFrameContainerDirectory("Test_GetImageInformation_ModifiedImage_IsNotChangingTheFile")};
+    const std::filesystem::path FilenameFrameContainer{TestDirectory / "dataset.frames"};
+
+    const SyntheticImagesDatasetReader Reader(3U, 10U, 12U);
+
+    DatasetReaderFrameContainer::ConvertDataset(Reader, FilenameFrameContainer.string());
+
+    const DatasetReaderFrameContainer FrameContainerModified(FilenameFrameContainer.string());
+
+    ImageInformation ImageInformationExpected;
+    ImageInformation ImageInformationModified;
+    ImageInformation ImageInformationReopened;
+
+    Reader.GetImageInformationStereoLeft(1U, ImageInformationExpected);
+    FrameContainerModified.GetImageInformationStereoLeft(1U, ImageInformationModified);
+
+    ImageInformationModified.ImageGrayscale.setTo(0);
+
+    const DatasetReaderFrameContainer FrameContainerReopened(FilenameFrameContainer.string());
+
+    FrameContainerReopened.GetImageInformationStereoLeft(1U, ImageInformationReopened);
+
+    ASSERT_EQ(cv::countNonZero(ImageInformationModified.ImageGrayscale), 0);
+    ASSERT_EQ(cv::countNonZero(ImageInformationReopened.ImageGrayscale != ImageInformationExpected.ImageGrayscale), 0);
+
+    std::filesystem::remove_all(TestDirectory);
+}
@@ -0,0 +1,205 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  Test_ImageBufferPool.cpp
+///
+/// \brief Source file containing the unit tests for the ImageBufferPool.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "../../../ImageBufferPool.h"
+#include "SyntheticDatasetReader.h"
+
+// definition of macros for the unit tests
+#define TEST_BUFFERLEASE_RELEASEDBUFFER_ISREUSED          TEST ///< Define to get a unique test name.
+#define TEST_DECODEIMAGE_LEASEDBUFFER_ISREUSINGMEMORY     TEST ///< Define to get a unique test name.
+#define TEST_DECODEIMAGE_IMAGEINFORMATION_ISMATCHINGINDEX TEST ///< Define to get a unique test name.
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class ImageFileDatasetReader
+///
+/// \brief Dataset reader whose images are the PGM image of the test data.
+///////////////////////////////////////////////////////////////////////////////
+class ImageFileDatasetReader : public SyntheticDatasetReader
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Constructor.
+    ///
+    /// \param[in] NumberOfFrames Number of frames of the dataset.
+    ///////////////////////////////////////////////////////////////////////////////
+    explicit ImageFileDatasetReader(const uint64 NumberOfFrames) :
+        SyntheticDatasetReader(NumberOfFrames)
+    {
+        for(uint64 i_Frame{0U}; i_Frame < NumberOfFrames; i_Frame++)
+        {
+            m_FilenamesWithPathImagesStereoLeft[i_Frame]  = DIRECTORY_TEST_DATA "ImageHeader.pgm";
+            m_FilenamesWithPathImagesStereoRight[i_Frame] = DIRECTORY_TEST_DATA "ImageHeader.pgm";
+            m_TimestampsImagesStereoLeftNanoseconds.push_back(10U * i_Frame + 1U);
+            m_TimestampsImagesStereoRightNanoseconds.push_back(10U * i_Frame + 2U);
+        }
+
+        m_HeightImagesStereo = 10U;
+        m_WidthImagesStereo  = 12U;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Replaces the left stereo camera image of a frame.
+    ///
+    /// \param[in] Index         Index of the frame.
+    /// \param[in] FilenameImage Filename of the image including its absolute path.
+    ///////////////////////////////////////////////////////////////////////////////
+    void SetImageStereoLeft(const uint64       Index,
+                            const std::string& FilenameImage)
+    {
+        m_FilenamesWithPathImagesStereoLeft[Index] = FilenameImage;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for returning leased buffers to the pool.
+///
+/// Tests whether a finished lease returns its buffer to the pool and whether
+/// the pool creates additional buffers if all buffers are leased or not. The
+/// expectation is that the released buffer is handed out again and that the
+/// additional buffer is kept in the pool.
+///////////////////////////////////////////////////////////////////////////////
+TEST_BUFFERLEASE_RELEASEDBUFFER_ISREUSED(ImageBufferPool, Test_BufferLease_ReleasedBuffer_IsReused)
+{
+    ImageBufferPool Pool(2U, 10U, 12U);
+
+    ASSERT_EQ(Pool.GetNumberOfAvailableBuffers(), 2U);
+
+    const ImageBuffer* ReleasedBuffer{nullptr};
+
+    {
+        const ImageBufferPool::BufferLease Lease(Pool);
+
+        // the buffer is preallocated for the image dimensions
+        ASSERT_EQ(Lease.GetBuffer().ImageGrayscale.rows, 10);
+        ASSERT_EQ(Lease.GetBuffer().ImageGrayscale.cols, 12);
+        ASSERT_EQ(Lease.GetBuffer().ImageGrayscale.type(), CV_8UC1);
+        ASSERT_GE(Lease.GetBuffer().EncodedImage.capacity(), 120U);
+        ASSERT_EQ(Pool.GetNumberOfAvailableBuffers(), 1U);
+
+        ReleasedBuffer = &Lease.GetBuffer();
+    }
+
+    ASSERT_EQ(Pool.GetNumberOfAvailableBuffers(), 2U);
+
+    {
+        const ImageBufferPool::BufferLease LeaseFirst(Pool);
+        const ImageBufferPool::BufferLease LeaseSecond(Pool);
+        const ImageBufferPool::BufferLease LeaseAdditional(Pool);
+
+        ASSERT_EQ(&LeaseFirst.GetBuffer(), ReleasedBuffer);
+        ASSERT_NE(&LeaseSecond.GetBuffer(), &LeaseAdditional.GetBuffer());
+        ASSERT_EQ(Pool.GetNumberOfAvailableBuffers(), 0U);
+    }
+
+    ASSERT_EQ(Pool.GetNumberOfAvailableBuffers(), 3U);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for decoding images into a leased buffer.
+///
+/// Tests whether decoding two images of the same dimensions into a leased
+/// buffer reuses the memory of the buffer or not. The expectation is that the
+/// decoded images point to the preallocated image of the buffer and that the
+/// encoded image buffer is not reallocated.
+///////////////////////////////////////////////////////////////////////////////
+TEST_DECODEIMAGE_LEASEDBUFFER_ISREUSINGMEMORY(ImageBufferPool, Test_DecodeImage_LeasedBuffer_IsReusingMemory)
+{
+    const ImageFileDatasetReader Reader(2U);
+
+    // the encoded image buffer is large enough for the PGM image (including its header)
+    ImageBufferPool                    Pool(1U, Reader.GetImageHeightStereoImages(), Reader.GetImageWidthStereoImages(), 1024U);
+    const ImageBufferPool::BufferLease Lease(Pool);
+
+    ImageBuffer& Buffer{Lease.GetBuffer()};
+
+    const uint8* PreallocatedImage{Buffer.ImageGrayscale.data};
+    const uint8* PreallocatedEncodedImage{Buffer.EncodedImage.data()};
+
+    ImageInformation ImageInformationFirst;
+    ImageInformation ImageInformationSecond;
+
+    Reader.DecodeImageStereoLeft(0U, Buffer, ImageInformationFirst);
+
+    ASSERT_TRUE(ImageInformationFirst.IsValid);
+    ASSERT_EQ(ImageInformationFirst.ImageGrayscale.data, PreallocatedImage);
+    ASSERT_EQ(Buffer.EncodedImage.data(), PreallocatedEncodedImage);
+
+    Reader.DecodeImageStereoRight(1U, Buffer, ImageInformationSecond);
+
+    ASSERT_TRUE(ImageInformationSecond.IsValid);
+    ASSERT_EQ(ImageInformationSecond.ImageGrayscale.data, PreallocatedImage);
+    ASSERT_EQ(ImageInformationSecond.ImageGrayscale.rows, 10);
+    ASSERT_EQ(ImageInformationSecond.ImageGrayscale.cols, 12);
+    ASSERT_EQ(Buffer.EncodedImage.data(), PreallocatedEncodedImage);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the image information of decoded images.
+///
+/// Tests whether the image information of a decoded image contains the index
+/// and the timestamp of the image and an empty filename or not (also for an
+/// image which cannot be decoded). The expectation is that the index and the
+/// timestamp are set, that the filename is cleared and that only the missing
+/// image is invalid.
+///////////////////////////////////////////////////////////////////////////////
+TEST_DECODEIMAGE_IMAGEINFORMATION_ISMATCHINGINDEX(ImageBufferPool, Test_DecodeImage_ImageInformation_IsMatchingIndex)
+{
+    ImageFileDatasetReader Reader(3U);
+
+    Reader.SetImageStereoLeft(2U, DIRECTORY_TEST_DATA "Missing.pgm");
+
+    ImageBufferPool                    Pool(1U, Reader.GetImageHeightStereoImages(), Reader.GetImageWidthStereoImages());
+    const ImageBufferPool::BufferLease Lease(Pool);
+
+    for(uint64 i_Frame{0U}; i_Frame < 3U; i_Frame++)
+    {
+        ImageInformation ImageInformationLeft;
+        ImageInformation ImageInformationRight;
+
+        ImageInformationLeft.FilenameWithAbsolutePath  = "previous.png";
+        ImageInformationRight.FilenameWithAbsolutePath = "previous.png";
+
+        Reader.DecodeImageStereoLeft(i_Frame, Lease.GetBuffer(), ImageInformationLeft);
+        Reader.DecodeImageStereoRight(i_Frame, Lease.GetBuffer(), ImageInformationRight);
+
+        ASSERT_EQ(ImageInformationLeft.IsValid, i_Frame != 2U);
+        ASSERT_EQ(ImageInformationLeft.Index, i_Frame);
+        ASSERT_EQ(ImageInformationLeft.Timestamp, 10U * i_Frame + 1U);
+        ASSERT_TRUE(ImageInformationLeft.FilenameWithAbsolutePath.empty());
+
+        ASSERT_TRUE(ImageInformationRight.IsValid);
+        ASSERT_EQ(ImageInformationRight.Index, i_Frame);
+        ASSERT_EQ(ImageInformationRight.Timestamp, 10U * i_Frame + 2U);
+        ASSERT_TRUE(ImageInformationRight.FilenameWithAbsolutePath.empty());
+    }
+
+    // the filename is still available from the reader
+    ASSERT_EQ(Reader.GetFilenameImageStereoLeft(2U), DIRECTORY_TEST_DATA "Missing.pgm");
+}
@@ -0,0 +1,195 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  Test_LatencyHistogram.cpp
+///
+/// \brief Source file containing the unit tests for LatencyHistogram.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#include <gtest/gtest.h>
+
+#include "../../../LatencyHistogram.h"
+
+// definition of macros for the unit tests
+#define TEST_GETPERCENTILE_EMPTYHISTOGRAM_ISZERO      TEST ///< Define to get a unique test name.
+#define TEST_GETPERCENTILE_SINGLELATENCY_ISLATENCY    TEST ///< Define to get a unique test name.
+#define TEST_GETPERCENTILE_KNOWNLATENCIES_ISUPPEREDGE TEST ///< Define to get a unique test name.
+#define TEST_GETPERCENTILE_OVERFLOWLATENCY_ISMAXIMUM  TEST ///< Define to get a unique test name.
+#define TEST_GETMEANLATENCY_KNOWNLATENCIES_ISMEAN     TEST ///< Define to get a unique test name.
+#define TEST_RESET_KNOWNLATENCIES_ISEMPTY             TEST ///< Define to get a unique test name.
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the statistics of an empty histogram.
+///
+/// Tests whether the percentiles, the mean and the maximum of a histogram
+/// without latencies are zero or not. The expectation is to get zero for all
+/// statistics.
+///////////////////////////////////////////////////////////////////////////////
+TEST_GETPERCENTILE_EMPTYHISTOGRAM_ISZERO(LatencyHistogram, Test_GetPercentile_EmptyHistogram_IsZero)
+{
+    const LatencyHistogram Histogram(10U, 10U);
+
+    ASSERT_EQ(Histogram.GetNumberOfLatencies(), 0U);
+    ASSERT_EQ(Histogram.GetPercentile(0.0), 0U);
+    ASSERT_EQ(Histogram.GetPercentile(50.0), 0U);
+    ASSERT_EQ(Histogram.GetPercentile(100.0), 0U);
+    ASSERT_EQ(Histogram.GetMeanLatency(), 0.0);
+    ASSERT_EQ(Histogram.GetMaximumLatency(), 0U);
+    ASSERT_EQ(Histogram.GetBinCounts(), ListUInt64(11U, 0U));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the statistics of a histogram containing a single latency.
+///
+/// Tests whether all percentiles and the mean of a histogram containing a
+/// latency of 25 nanoseconds are the latency or not. The upper edge of its bin
+/// (30 nanoseconds) exceeds the maximum latency. The expectation is to get 25
+/// nanoseconds for all statistics.
+///////////////////////////////////////////////////////////////////////////////
+TEST_GETPERCENTILE_SINGLELATENCY_ISLATENCY(LatencyHistogram, Test_GetPercentile_SingleLatency_IsLatency)
+{
+    LatencyHistogram Histogram(10U, 10U);
+
+    Histogram.AddLatency(25U);
+
+    ASSERT_EQ(Histogram.GetNumberOfLatencies(), 1U);
+    ASSERT_EQ(Histogram.GetPercentile(0.0), 25U);
+    ASSERT_EQ(Histogram.GetPercentile(50.0), 25U);
+    ASSERT_EQ(Histogram.GetPercentile(100.0), 25U);
+    ASSERT_EQ(Histogram.GetMeanLatency(), 25.0);
+    ASSERT_EQ(Histogram.GetMaximumLatency(), 25U);
+    ASSERT_EQ(Histogram.GetBinCounts()[2], 1U);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the percentiles of known latencies.
+///
+/// Tests whether the percentiles of the latencies 5, 15, 15, 25, 35, 45, 55,
+/// 65, 75 and 85 nanoseconds (bins of 10 nanoseconds) are resolved to the
+/// upper edge of their bin or not. The expectation is to get the upper edge
+/// of the bin containing the latency at the rank of the percentile, limited
+/// to the maximum latency.
+///////////////////////////////////////////////////////////////////////////////
+TEST_GETPERCENTILE_KNOWNLATENCIES_ISUPPEREDGE(LatencyHistogram, Test_GetPercentile_KnownLatencies_IsUpperEdge)
+{
+    LatencyHistogram Histogram(10U, 10U);
+
+    const ListUInt64 Latencies{5U, 15U, 15U, 25U, 35U, 45U, 55U, 65U, 75U, 85U};
+
+    for(const uint64 Latency : Latencies)
+    {
+        Histogram.AddLatency(Latency);
+    }
+
+    ASSERT_EQ(Histogram.GetBinCounts(), ListUInt64({1U, 2U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 0U, 0U}));
+
+    ASSERT_EQ(Histogram.GetPercentile(0.0), 10U);
+    ASSERT_EQ(Histogram.GetPercentile(10.0), 10U);
+    ASSERT_EQ(Histogram.GetPercentile(20.0), 20U);
+    ASSERT_EQ(Histogram.GetPercentile(30.0), 20U);
+    ASSERT_EQ(Histogram.GetPercentile(31.0), 30U);
+    ASSERT_EQ(Histogram.GetPercentile(50.0), 40U);
+    ASSERT_EQ(Histogram.GetPercentile(80.0), 70U);
+    ASSERT_EQ(Histogram.GetPercentile(99.0), 85U);
+    ASSERT_EQ(Histogram.GetPercentile(100.0), 85U);
+
+    // percentiles outside of the valid range are clamped
+    ASSERT_EQ(Histogram.GetPercentile(-5.0), 10U);
+    ASSERT_EQ(Histogram.GetPercentile(150.0), 85U);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the percentiles of latencies in the overflow bin.
+///
+/// Tests whether percentiles in the overflow bin are resolved to the maximum
+/// latency or not. The histogram covers 100 nanoseconds and contains the
+/// latencies 5, 500 and 2000 nanoseconds. The expectation is to get the
+/// maximum latency for percentiles in the overflow bin.
+///////////////////////////////////////////////////////////////////////////////
+TEST_GETPERCENTILE_OVERFLOWLATENCY_ISMAXIMUM(LatencyHistogram, Test_GetPercentile_OverflowLatency_IsMaximum)
+{
+    LatencyHistogram Histogram(10U, 10U);
+
+    Histogram.AddLatency(5U);
+    Histogram.AddLatency(500U);
+    Histogram.AddLatency(2000U);
+
+    ASSERT_EQ(Histogram.GetBinCounts().back(), 2U);
+    ASSERT_EQ(Histogram.GetPercentile(30.0), 10U);
+    ASSERT_EQ(Histogram.GetPercentile(50.0), 2000U);
+    ASSERT_EQ(Histogram.GetPercentile(100.0), 2000U);
+    ASSERT_EQ(Histogram.GetMaximumLatency(), 2000U);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the mean of known latencies.
+///
+/// Tests whether the mean latency is computed from the exact latencies (and
+/// not from the bins) or not. The expectation is to get a mean latency of 42
+/// nanoseconds for the latencies 5, 15, 15, 25, 35, 45, 55, 65, 75 and 85
+/// nanoseconds and of 1042 nanoseconds after adding a latency of 11042
+/// nanoseconds in the overflow bin.
+///////////////////////////////////////////////////////////////////////////////
+TEST_GETMEANLATENCY_KNOWNLATENCIES_ISMEAN(LatencyHistogram, Test_GetMeanLatency_KnownLatencies_IsMean)
+{
+    LatencyHistogram Histogram(10U, 10U);
+
+    const ListUInt64 Latencies{5U, 15U, 15U, 25U, 35U, 45U, 55U, 65U, 75U, 85U};
+
+    for(const uint64 Latency : Latencies)
+    {
+        Histogram.AddLatency(Latency);
+    }
+
+    ASSERT_DOUBLE_EQ(Histogram.GetMeanLatency(), 42.0);
+
+    Histogram.AddLatency(11042U);
+
+    ASSERT_EQ(Histogram.GetNumberOfLatencies(), 11U);
+    ASSERT_DOUBLE_EQ(Histogram.GetMeanLatency(), 1042.0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the reset of a histogram.
+///
+/// Tests whether a histogram containing latencies is empty after a reset or
+/// not. The expectation is to get the statistics of an empty histogram and
+/// the statistics of the latencies added after the reset.
+///////////////////////////////////////////////////////////////////////////////
+TEST_RESET_KNOWNLATENCIES_ISEMPTY(LatencyHistogram, Test_Reset_KnownLatencies_IsEmpty)
+{
+    LatencyHistogram Histogram(10U, 10U);
+
+    Histogram.AddLatency(15U);
+    Histogram.AddLatency(500U);
+    Histogram.Reset();
+
+    ASSERT_EQ(Histogram.GetNumberOfLatencies(), 0U);
+    ASSERT_EQ(Histogram.GetPercentile(50.0), 0U);
+    ASSERT_EQ(Histogram.GetMeanLatency(), 0.0);
+    ASSERT_EQ(Histogram.GetMaximumLatency(), 0U);
+    ASSERT_EQ(Histogram.GetBinCounts(), ListUInt64(11U, 0U));
+
+    Histogram.AddLatency(7U);
+
+    ASSERT_EQ(Histogram.GetPercentile(50.0), 7U);
+    ASSERT_EQ(Histogram.GetMeanLatency(), 7.0);
+}
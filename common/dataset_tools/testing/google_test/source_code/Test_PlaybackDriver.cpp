@@ -0,0 +1,277 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  Test_PlaybackDriver.cpp
+///
+/// \brief Source file containing the unit tests for PlaybackDriver.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#include <chrono>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../../../PlaybackDriver.h"
+#include "SyntheticDatasetReader.h"
+
+// definition of macros for the unit tests
+#define TEST_RUN_DROPPOLICYNONE_ISCONSUMINGALLFRAMES TEST ///< Define to get a unique test name.
+#define TEST_RUN_DROPPOLICYOLDEST_ISDROPPINGOLDEST   TEST ///< Define to get a unique test name.
+#define TEST_RUN_DROPPOLICYNEWEST_ISDROPPINGNEWEST   TEST ///< Define to get a unique test name.
+#define TEST_RUN_RECORDEDRATE_ISPACED                TEST ///< Define to get a unique test name.
+#define TEST_RUN_FAILINGIMAGE_ISRETHROWN             TEST ///< Define to get a unique test name.
+#define TEST_RUN_CONSUMERSTOP_ISSTOPPINGPLAYBACK     TEST ///< Define to get a unique test name.
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief      Plays back a dataset with a consumer which is blocked by the
+///             first frame.
+///
+/// The consumer is blocked for 300 milliseconds, i.e. all frames recorded
+/// within this time arrive while the first frame is processed.
+///
+/// \param[in]  Driver       Driver used for the playback.
+/// \param[out] FrameIndices Indices of the consumed frames.
+///////////////////////////////////////////////////////////////////////////////
+void RunSlowConsumer(PlaybackDriver& Driver,
+                     ListUInt64&     FrameIndices)
+{
+    Driver.Run([&FrameIndices](const ImageInformation& ImageInformationStereoLeft, const ImageInformation&)
+               {
+                   FrameIndices.push_back(ImageInformationStereoLeft.Index);
+
+                   if(FrameIndices.size() == 1U)
+                   {
+                       std::this_thread::sleep_for(std::chrono::milliseconds(300));
+                   }
+
+                   return true;
+               });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for a playback without dropped frames.
+///
+/// Tests whether all frames are consumed in order if the sensor waits for the
+/// consumer or not. The expectation is to consume each frame once and to get
+/// a latency for each frame.
+///////////////////////////////////////////////////////////////////////////////
+TEST_RUN_DROPPOLICYNONE_ISCONSUMINGALLFRAMES(PlaybackDriver, Test_Run_DropPolicyNone_IsConsumingAllFrames)
+{
+    const SyntheticDatasetReader Reader(30U);
+
+    PlaybackDriver Driver(Reader, 1.0, DropPolicyNone, 2U, 2U);
+
+    ListUInt64 FrameIndices;
+
+    Driver.Run([&FrameIndices](const ImageInformation& ImageInformationStereoLeft, const ImageInformation& ImageInformationStereoRight)
+               {
+                   EXPECT_EQ(ImageInformationStereoLeft.Index, ImageInformationStereoRight.Index);
+
+                   FrameIndices.push_back(ImageInformationStereoLeft.Index);
+
+                   return true;
+               });
+
+    ASSERT_EQ(FrameIndices.size(), 30U);
+
+    for(uint64 i_Frame{0U}; i_Frame < 30U; i_Frame++)
+    {
+        ASSERT_EQ(FrameIndices[i_Frame], i_Frame);
+    }
+
+    ASSERT_EQ(Driver.GetNumberOfFramesEmitted(), 30U);
+    ASSERT_EQ(Driver.GetNumberOfFramesDropped(), 0U);
+    ASSERT_EQ(Driver.GetNumberOfFramesConsumed(), 30U);
+    ASSERT_EQ(Driver.GetLatencyHistogram().GetNumberOfLatencies(), 30U);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for a playback dropping the oldest frames.
+///
+/// Tests whether the oldest queued frames are dropped in favor of the arriving
+/// frames if the consumer lags behind the sensor or not. Six frames arrive
+/// while the consumer processes the first frame, the queue holds two frames.
+/// The expectation is to consume the first and the last two frames and to
+/// drop the frames in between.
+///////////////////////////////////////////////////////////////////////////////
+TEST_RUN_DROPPOLICYOLDEST_ISDROPPINGOLDEST(PlaybackDriver, Test_Run_DropPolicyOldest_IsDroppingOldest)
+{
+    const SyntheticDatasetReader Reader(6U, std::numeric_limits<uint64>::max(), 20000000U);
+
+    PlaybackDriver Driver(Reader, 1.0, DropPolicyOldest, 2U, 2U);
+
+    ListUInt64 FrameIndices;
+
+    RunSlowConsumer(Driver, FrameIndices);
+
+    ASSERT_EQ(FrameIndices, ListUInt64({0U, 4U, 5U}));
+    ASSERT_EQ(Driver.GetNumberOfFramesEmitted(), 6U);
+    ASSERT_EQ(Driver.GetNumberOfFramesDropped(), 3U);
+    ASSERT_EQ(Driver.GetNumberOfFramesConsumed(), 3U);
+    ASSERT_EQ(Driver.GetLatencyHistogram().GetNumberOfLatencies(), 3U);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for a playback dropping the newest frames.
+///
+/// Tests whether the arriving frames are dropped if the consumer lags behind
+/// the sensor or not. Six frames arrive while the consumer processes the first
+/// frame, the queue holds two frames. The expectation is to consume the first
+/// three frames and to drop the last three frames.
+///////////////////////////////////////////////////////////////////////////////
+TEST_RUN_DROPPOLICYNEWEST_ISDROPPINGNEWEST(PlaybackDriver, Test_Run_DropPolicyNewest_IsDroppingNewest)
+{
+    const SyntheticDatasetReader Reader(6U, std::numeric_limits<uint64>::max(), 20000000U);
+
+    PlaybackDriver Driver(Reader, 1.0, DropPolicyNewest, 2U, 2U);
+
+    ListUInt64 FrameIndices;
+
+    RunSlowConsumer(Driver, FrameIndices);
+
+    ASSERT_EQ(FrameIndices, ListUInt64({0U, 1U, 2U}));
+    ASSERT_EQ(Driver.GetNumberOfFramesEmitted(), 6U);
+    ASSERT_EQ(Driver.GetNumberOfFramesDropped(), 3U);
+    ASSERT_EQ(Driver.GetNumberOfFramesConsumed(), 3U);
+    ASSERT_EQ(Driver.GetLatencyHistogram().GetNumberOfLatencies(), 3U);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the pacing of the playback.
+///
+/// Tests whether the frames arrive according to their timestamps divided by
+/// the playback speed or not. The frames are 50 milliseconds apart. The
+/// expectation is that no frame is consumed before its arrival, and that the
+/// playback at four times the recorded rate ends before the recorded duration
+/// has elapsed.
+///////////////////////////////////////////////////////////////////////////////
+TEST_RUN_RECORDEDRATE_ISPACED(PlaybackDriver, Test_Run_RecordedRate_IsPaced)
+{
+    const SyntheticDatasetReader Reader(5U, std::numeric_limits<uint64>::max(), 50000000U);
+
+    const ListFloat64 PlaybackSpeeds{1.0, 4.0};
+
+    for(const float64 PlaybackSpeed : PlaybackSpeeds)
+    {
+        PlaybackDriver Driver(Reader, PlaybackSpeed, DropPolicyNone, 2U, 2U);
+
+        std::vector<std::chrono::steady_clock::duration> ConsumptionTimes;
+
+        const std::chrono::steady_clock::time_point StartTime{std::chrono::steady_clock::now()};
+
+        Driver.Run([&ConsumptionTimes, &StartTime](const ImageInformation&, const ImageInformation&)
+                   {
+                       ConsumptionTimes.push_back(std::chrono::steady_clock::now() - StartTime);
+
+                       return true;
+                   });
+
+        const std::chrono::steady_clock::duration PlaybackDuration{std::chrono::steady_clock::now() - StartTime};
+
+        ASSERT_EQ(ConsumptionTimes.size(), 5U);
+
+        for(uint64 i_Frame{0U}; i_Frame < ConsumptionTimes.size(); i_Frame++)
+        {
+            const std::chrono::duration<float64, std::milli> ArrivalTime{50.0 * static_cast<float64>(i_Frame) / PlaybackSpeed};
+
+            ASSERT_GE(ConsumptionTimes[i_Frame], std::chrono::duration_cast<std::chrono::steady_clock::duration>(ArrivalTime));
+        }
+
+        if(PlaybackSpeed > 1.0)
+        {
+            ASSERT_LT(PlaybackDuration, std::chrono::milliseconds(200));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for a playback of a dataset containing a corrupted image.
+///
+/// Tests whether the exception of the sensor thread is rethrown by the
+/// playback or not. The expectation is that the frames in front of the
+/// corrupted image are consumed before the exception is rethrown and that
+/// the driver can be used again afterwards.
+///////////////////////////////////////////////////////////////////////////////
+TEST_RUN_FAILINGIMAGE_ISRETHROWN(PlaybackDriver, Test_Run_FailingImage_IsRethrown)
+{
+    const SyntheticDatasetReader Reader(30U, 12U);
+
+    PlaybackDriver Driver(Reader, 1.0, DropPolicyNone, 2U, 2U);
+
+    ListUInt64 FrameIndices;
+
+    ASSERT_THROW(Driver.Run([&FrameIndices](const ImageInformation& ImageInformationStereoLeft, const ImageInformation&)
+                                 {
+                                     FrameIndices.push_back(ImageInformationStereoLeft.Index);
+
+                                     return true;
+                                 }),
+                 std::runtime_error);
+
+    ASSERT_EQ(FrameIndices.size(), 12U);
+    ASSERT_EQ(FrameIndices.back(), 11U);
+    ASSERT_EQ(Driver.GetNumberOfFramesEmitted(), 12U);
+    ASSERT_EQ(Driver.GetNumberOfFramesConsumed(), 12U);
+
+    // a playback behind the corrupted image succeeds
+    FrameIndices.clear();
+
+    ASSERT_NO_THROW(Driver.Run([&FrameIndices](const ImageInformation& ImageInformationStereoLeft, const ImageInformation&)
+                                    {
+                                        FrameIndices.push_back(ImageInformationStereoLeft.Index);
+
+                                        return true;
+                                    },
+                               13U));
+
+    ASSERT_EQ(FrameIndices.size(), 17U);
+    ASSERT_EQ(FrameIndices.front(), 13U);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for a playback stopped by the consumer.
+///
+/// Tests whether the playback ends if the consumer requests to stop or not.
+/// The expectation is that no further frames are consumed and that the
+/// sensor thread is stopped.
+///////////////////////////////////////////////////////////////////////////////
+TEST_RUN_CONSUMERSTOP_ISSTOPPINGPLAYBACK(PlaybackDriver, Test_Run_ConsumerStop_IsStoppingPlayback)
+{
+    const SyntheticDatasetReader Reader(30U);
+
+    PlaybackDriver Driver(Reader, 1.0, DropPolicyNone, 2U, 2U);
+
+    uint64 NumberOfFramesConsumed{0U};
+
+    Driver.Run([&NumberOfFramesConsumed](const ImageInformation&, const ImageInformation&)
+               {
+                   NumberOfFramesConsumed++;
+
+                   return NumberOfFramesConsumed < 5U;
+               });
+
+    ASSERT_EQ(NumberOfFramesConsumed, 5U);
+    ASSERT_EQ(Driver.GetNumberOfFramesConsumed(), 5U);
+    ASSERT_LT(Driver.GetNumberOfFramesEmitted(), 30U);
+}
@@ -0,0 +1,202 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  Test_PoseTrajectory.cpp
+///
+/// \brief Source file containing the unit tests for PoseTrajectory.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include <Eigen/Geometry>
+
+#include <gtest/gtest.h>
+
+#include "../../../PoseTrajectory.h"
+
+// definition of macros for the unit tests
+#define TEST_INTERPOLATEPOSE_ENDPOINTS_ISMATCHINGPOSES          TEST ///< Define to get a unique test name.
+#define TEST_INTERPOLATEPOSE_MIDPOINT_ISINTERPOLATED            TEST ///< Define to get a unique test name.
+#define TEST_INTERPOLATEPOSE_OPPOSITEHEMISPHERES_ISSHORTESTPATH TEST ///< Define to get a unique test name.
+#define TEST_INTERPOLATEPOSE_OUTOFRANGE_ISFALSE                 TEST ///< Define to get a unique test name.
+#define TEST_CONSTRUCTOR_INVALIDPOSES_ISTHROWING                TEST ///< Define to get a unique test name.
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief     Creates a pose from a rotation about the z-axis and a translation.
+///
+/// \param[in] Angle       Rotation angle about the z-axis (in radians).
+/// \param[in] Translation Translation.
+///
+/// \return    Pose (4x4 homogeneous transformation).
+///////////////////////////////////////////////////////////////////////////////
+MatrixFloat64_4d CreatePose(const float64                 Angle,
+                            const ColumnVectorFloat64_3d& Translation)
+{
+    MatrixFloat64_4d Pose{MatrixFloat64_4d::Identity()};
+
+    Pose.block<3, 3>(0, 0) = Eigen::AngleAxisd(Angle, ColumnVectorFloat64_3d::UnitZ()).toRotationMatrix();
+    Pose.block<3, 1>(0, 3) = Translation;
+
+    return Pose;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the interpolation at the timestamps of the poses.
+///
+/// Tests whether the poses at the first, an inner and the last timestamp of
+/// the trajectory are the poses provided for these timestamps or not. The
+/// expectation is to get the provided poses.
+///////////////////////////////////////////////////////////////////////////////
+TEST_INTERPOLATEPOSE_ENDPOINTS_ISMATCHINGPOSES(PoseTrajectory, Test_InterpolatePose_Endpoints_IsMatchingPoses)
+{
+    const ListUInt64           Timestamps{100U, 200U, 300U};
+    const ListMatrixFloat64_4d Poses{CreatePose(0.1, ColumnVectorFloat64_3d(1.0, 2.0, 3.0)),
+                                     CreatePose(0.5, ColumnVectorFloat64_3d(-1.0, 0.0, 4.0)),
+                                     CreatePose(-0.7, ColumnVectorFloat64_3d(2.0, 2.0, -5.0))};
+
+    const PoseTrajectory Trajectory(Timestamps, Poses);
+
+    ASSERT_EQ(Trajectory.GetNumberOfPoses(), 3U);
+    ASSERT_EQ(Trajectory.GetTimestamps(), Timestamps);
+
+    for(uint64 i_Pose{0U}; i_Pose < Poses.size(); i_Pose++)
+    {
+        MatrixFloat64_4d Pose;
+
+        ASSERT_TRUE(Trajectory.InterpolatePose(Timestamps[i_Pose], Pose));
+        ASSERT_LT((Pose - Poses[i_Pose]).cwiseAbs().maxCoeff(), 1e-12);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the interpolation between two poses.
+///
+/// Tests whether the pose in the middle and at a quarter of the interval
+/// between two poses is interpolated linearly in the translation and
+/// spherically in the rotation or not. The rotations differ by 90 degrees
+/// about the z-axis. The expectation is to get a rotation of 45 (22.5)
+/// degrees and the mean (weighted mean) of the translations.
+///////////////////////////////////////////////////////////////////////////////
+TEST_INTERPOLATEPOSE_MIDPOINT_ISINTERPOLATED(PoseTrajectory, Test_InterpolatePose_Midpoint_IsInterpolated)
+{
+    const float64 Pi{std::acos(-1.0)};
+
+    const ListUInt64           Timestamps{1000U, 2000U};
+    const ListMatrixFloat64_4d Poses{CreatePose(0.0, ColumnVectorFloat64_3d(0.0, 0.0, 0.0)),
+                                     CreatePose(0.5 * Pi, ColumnVectorFloat64_3d(4.0, -8.0, 2.0))};
+
+    const PoseTrajectory Trajectory(Timestamps, Poses);
+
+    MatrixFloat64_4d Pose;
+
+    ASSERT_TRUE(Trajectory.InterpolatePose(1500U, Pose));
+    ASSERT_LT((Pose - CreatePose(0.25 * Pi, ColumnVectorFloat64_3d(2.0, -4.0, 1.0))).cwiseAbs().maxCoeff(), 1e-9);
+
+    ASSERT_TRUE(Trajectory.InterpolatePose(1250U, Pose));
+    ASSERT_LT((Pose - CreatePose(0.125 * Pi, ColumnVectorFloat64_3d(1.0, -2.0, 0.5))).cwiseAbs().maxCoeff(), 1e-9);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the interpolation between rotations whose quaternions lie
+///        in opposite hemispheres.
+///
+/// Tests whether the rotation between a rotation of 100 degrees and a rotation
+/// of -100 degrees about the z-axis follows the shortest path or not. The dot
+/// product of both quaternions is negative. The expectation is to get a
+/// rotation of 180 degrees in the middle (and not the identity of the long
+/// path).
+///////////////////////////////////////////////////////////////////////////////
+TEST_INTERPOLATEPOSE_OPPOSITEHEMISPHERES_ISSHORTESTPATH(PoseTrajectory, Test_InterpolatePose_OppositeHemispheres_IsShortestPath)
+{
+    const float64 Pi{std::acos(-1.0)};
+    const float64 Angle{100.0 * Pi / 180.0};
+
+    const ListUInt64           Timestamps{0U, 100U};
+    const ListMatrixFloat64_4d Poses{CreatePose(Angle, ColumnVectorFloat64_3d::Zero()),
+                                     CreatePose(-Angle, ColumnVectorFloat64_3d::Zero())};
+
+    // check the precondition of the test
+    const Eigen::Quaterniond RotationFirst{MatrixFloat64_3d{Poses[0].block<3, 3>(0, 0)}};
+    const Eigen::Quaterniond RotationSecond{MatrixFloat64_3d{Poses[1].block<3, 3>(0, 0)}};
+
+    ASSERT_LT(RotationFirst.dot(RotationSecond), 0.0);
+
+    const PoseTrajectory Trajectory(Timestamps, Poses);
+
+    MatrixFloat64_4d Pose;
+
+    ASSERT_TRUE(Trajectory.InterpolatePose(50U, Pose));
+    ASSERT_LT((Pose - CreatePose(Pi, ColumnVectorFloat64_3d::Zero())).cwiseAbs().maxCoeff(), 1e-9);
+
+    ASSERT_TRUE(Trajectory.InterpolatePose(25U, Pose));
+    ASSERT_LT((Pose - CreatePose(Angle + 0.5 * (Pi - Angle), ColumnVectorFloat64_3d::Zero())).cwiseAbs().maxCoeff(), 1e-9);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the interpolation outside of the trajectory.
+///
+/// Tests whether the interpolation at timestamps before the first pose, after
+/// the last pose and of an empty trajectory fails or not. The expectation is
+/// that no pose is interpolated in all cases, and that the timestamps
+/// adjacent to the limits are interpolated.
+///////////////////////////////////////////////////////////////////////////////
+TEST_INTERPOLATEPOSE_OUTOFRANGE_ISFALSE(PoseTrajectory, Test_InterpolatePose_OutOfRange_IsFalse)
+{
+    const ListUInt64           Timestamps{100U, 200U};
+    const ListMatrixFloat64_4d Poses{CreatePose(0.0, ColumnVectorFloat64_3d::Zero()),
+                                     CreatePose(0.2, ColumnVectorFloat64_3d::Ones())};
+
+    const PoseTrajectory Trajectory(Timestamps, Poses);
+
+    MatrixFloat64_4d Pose;
+
+    ASSERT_FALSE(Trajectory.InterpolatePose(0U, Pose));
+    ASSERT_FALSE(Trajectory.InterpolatePose(99U, Pose));
+    ASSERT_FALSE(Trajectory.InterpolatePose(201U, Pose));
+    ASSERT_FALSE(Trajectory.InterpolatePose(std::numeric_limits<uint64>::max(), Pose));
+
+    ASSERT_TRUE(Trajectory.InterpolatePose(101U, Pose));
+    ASSERT_TRUE(Trajectory.InterpolatePose(199U, Pose));
+
+    const PoseTrajectory TrajectoryEmpty(ListUInt64{}, ListMatrixFloat64_4d{});
+
+    ASSERT_EQ(TrajectoryEmpty.GetNumberOfPoses(), 0U);
+    ASSERT_FALSE(TrajectoryEmpty.InterpolatePose(0U, Pose));
+    ASSERT_FALSE(TrajectoryEmpty.InterpolatePose(100U, Pose));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the constructor with invalid poses.
+///
+/// Tests whether a trajectory with a different number of timestamps and poses
+/// and a trajectory with unsorted timestamps are rejected or not. The
+/// expectation is to get an exception in both cases.
+///////////////////////////////////////////////////////////////////////////////
+TEST_CONSTRUCTOR_INVALIDPOSES_ISTHROWING(PoseTrajectory, Test_Constructor_InvalidPoses_IsThrowing)
+{
+    const ListMatrixFloat64_4d Poses{CreatePose(0.0, ColumnVectorFloat64_3d::Zero()),
+                                     CreatePose(0.2, ColumnVectorFloat64_3d::Ones())};
+
+    ASSERT_THROW(PoseTrajectory(ListUInt64{100U}, Poses), std::invalid_argument);
+    ASSERT_THROW(PoseTrajectory(ListUInt64{200U, 100U}, Poses), std::invalid_argument);
+}
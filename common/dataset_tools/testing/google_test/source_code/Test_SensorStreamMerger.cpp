@@ -0,0 +1,111 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  Test_SensorStreamMerger.cpp
+///
+/// \brief Source file containing the unit tests for SensorStreamMerger.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#include <gtest/gtest.h>
+
+#include "../../../SensorStreamMerger.h"
+
+// definition of macros for the unit tests
+#define TEST_GETNEXT_THREESTREAMS_ISINTIMEORDER TEST ///< Define to get a unique test name.
+#define TEST_GETNEXT_TEMPORARYSTREAMS_ISCOPIED  TEST ///< Define to get a unique test name.
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the order of the merged elements.
+///
+/// Tests whether the elements of three streams (one of them empty) are
+/// returned in time order or not. The expectation is that elements with equal
+/// timestamps are returned in the order of the streams and that a reset
+/// restarts the merge.
+///////////////////////////////////////////////////////////////////////////////
+TEST_GETNEXT_THREESTREAMS_ISINTIMEORDER(SensorStreamMerger, Test_GetNext_ThreeStreams_IsInTimeOrder)
+{
+    const ListUInt64 TimestampsFirst{10U, 20U, 30U, 40U};
+    const ListUInt64 TimestampsSecond;
+    const ListUInt64 TimestampsThird{5U, 20U, 45U};
+
+    const ListUInt64 StreamIndicesExpected{2U, 0U, 0U, 2U, 0U, 0U, 2U};
+    const ListUInt64 ElementIndicesExpected{0U, 0U, 1U, 1U, 2U, 3U, 2U};
+    const ListUInt64 TimestampsExpected{5U, 10U, 20U, 20U, 30U, 40U, 45U};
+
+    SensorStreamMerger Merger;
+
+    ASSERT_EQ(Merger.AddStream(TimestampsFirst), 0U);
+    ASSERT_EQ(Merger.AddStream(TimestampsSecond), 1U);
+    ASSERT_EQ(Merger.AddStream(TimestampsThird), 2U);
+
+    for(uint64 i_Pass{0U}; i_Pass < 2U; i_Pass++)
+    {
+        ListUInt64 StreamIndices;
+        ListUInt64 ElementIndices;
+        ListUInt64 Timestamps;
+
+        uint64 StreamIndex{0U};
+        uint64 ElementIndex{0U};
+        uint64 TimestampNanoseconds{0U};
+
+        while(Merger.GetNext(StreamIndex, ElementIndex, TimestampNanoseconds))
+        {
+            StreamIndices.push_back(StreamIndex);
+            ElementIndices.push_back(ElementIndex);
+            Timestamps.push_back(TimestampNanoseconds);
+        }
+
+        ASSERT_EQ(StreamIndices, StreamIndicesExpected);
+        ASSERT_EQ(ElementIndices, ElementIndicesExpected);
+        ASSERT_EQ(Timestamps, TimestampsExpected);
+
+        Merger.Reset();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for streams passed as temporaries.
+///
+/// Tests whether streams which are destroyed after adding them can still be
+/// merged or not. The expectation is to get all elements in time order.
+///////////////////////////////////////////////////////////////////////////////
+TEST_GETNEXT_TEMPORARYSTREAMS_ISCOPIED(SensorStreamMerger, Test_GetNext_TemporaryStreams_IsCopied)
+{
+    SensorStreamMerger Merger;
+
+    Merger.AddStream(ListUInt64({1U, 3U, 5U}));
+    Merger.AddStream(ListUInt64({2U, 4U, 6U}));
+
+    Merger.Reset();
+
+    ListUInt64 Timestamps;
+
+    uint64 StreamIndex{0U};
+    uint64 ElementIndex{0U};
+    uint64 TimestampNanoseconds{0U};
+
+    while(Merger.GetNext(StreamIndex, ElementIndex, TimestampNanoseconds))
+    {
+        Timestamps.push_back(TimestampNanoseconds);
+    }
+
+    ASSERT_EQ(Timestamps, ListUInt64({1U, 2U, 3U, 4U, 5U, 6U}));
+}
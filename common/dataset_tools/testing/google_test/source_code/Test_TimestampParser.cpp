@@ -0,0 +1,345 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  Test_TimestampParser.cpp
+///
+/// \brief Source file containing the unit tests for TimestampParser.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "../../../TimestampParser.h"
+
+// definition of macros for the unit tests
+#define TEST_EXTRACTTIMESTAMPS_KITTI_ISMATCHINGPREVIOUSPARSER           TEST ///< Define to get a unique test name.
+#define TEST_EXTRACTTIMESTAMPS_4SEASONS_ISMATCHINGPREVIOUSPARSER        TEST ///< Define to get a unique test name.
+#define TEST_EXTRACTTIMESTAMPS_ASRL_ISMATCHINGPREVIOUSPARSER            TEST ///< Define to get a unique test name.
+#define TEST_EXTRACTTIMESTAMPS_ASRLDEVONISLAND_ISMATCHINGPREVIOUSPARSER TEST ///< Define to get a unique test name.
+#define TEST_EXTRACTTIMESTAMPS_CRLFANDEMPTYLINES_ISSKIPPED              TEST ///< Define to get a unique test name.
+#define TEST_EXTRACTTIMESTAMPS_COMMAANDSEMICOLON_ISSEPARATOR            TEST ///< Define to get a unique test name.
+#define TEST_EXTRACTTIMESTAMPS_INVALIDLINE_ISSTOPPING                   TEST ///< Define to get a unique test name.
+#define TEST_EXTRACTTIMESTAMPS_MISSINGFILE_ISTHROWING                   TEST ///< Define to get a unique test name.
+#define TEST_PARSETIMESTAMP_ISO8601FRACTION_ISSCALED                    TEST ///< Define to get a unique test name.
+#define TEST_PARSETIMESTAMP_ISO8601DATE_ISMATCHINGEPOCH                 TEST ///< Define to get a unique test name.
+#define TEST_PARSETIMESTAMP_INVALIDTIMESTAMP_ISREJECTED                 TEST ///< Define to get a unique test name.
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief     Writes a timestamp file into the temporary directory.
+///
+/// \param[in] Filename Name of the timestamp file.
+/// \param[in] Content  Content of the timestamp file.
+///
+/// \return    Timestamp file, including the absolute path.
+///////////////////////////////////////////////////////////////////////////////
+std::filesystem::path WriteTimestampFile(const std::string& Filename,
+                                         const std::string& Content)
+{
+    const std::filesystem::path FileTimestampsWithPath{std::filesystem::temp_directory_path() / Filename};
+
+    std::ofstream File(FileTimestampsWithPath, std::ios::binary);
+
+    File << Content;
+
+    return FileTimestampsWithPath;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief      Parses a single timestamp given as a string.
+///
+/// \param[in]  Timestamp            Timestamp.
+/// \param[in]  Format               Format of the timestamp.
+/// \param[out] TimestampNanoseconds Timestamp (in nanoseconds).
+///
+/// \return     Flag whether the timestamp could be parsed or not.
+///////////////////////////////////////////////////////////////////////////////
+boolean ParseTimestampString(const std::string&    Timestamp,
+                             const TimestampFormat Format,
+                             uint64&               TimestampNanoseconds)
+{
+    return TimestampParser::ParseTimestamp(Timestamp.data(), Timestamp.data() + Timestamp.size(), Format, TimestampNanoseconds);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the timestamps of the KITTI dataset.
+///
+/// Tests whether the timestamps of a KITTI timestamp file (seconds in
+/// scientific notation) do match the timestamps of the previous parser or
+/// not. The expectation is to get the truncated nanoseconds.
+///////////////////////////////////////////////////////////////////////////////
+TEST_EXTRACTTIMESTAMPS_KITTI_ISMATCHINGPREVIOUSPARSER(TimestampParser, Test_ExtractTimestamps_KITTI_IsMatchingPreviousParser)
+{
+    const ListUInt64 ListTimestampsExpected{0U, 103646200U, 207292500U, 310938600U, 414584800U, 518231000U};
+
+    ListUInt64 ListTimestamps;
+
+    const uint64 NumberOfTimestamps{TimestampParser::ExtractTimestamps(DIRECTORY_TEST_DATA "TimestampsKITTI.txt", 0U, FormatSeconds, ListTimestamps)};
+
+    ASSERT_EQ(NumberOfTimestamps, ListTimestampsExpected.size());
+    ASSERT_EQ(ListTimestamps, ListTimestampsExpected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the timestamps of the 4Seasons dataset.
+///
+/// Tests whether the timestamps of a 4Seasons timestamp file (frame ID,
+/// seconds and exposure time separated by commas) do match the timestamps of
+/// the previous parser or not. The expectation is to get the nanoseconds of
+/// the second column, including the rounding of the double precision value.
+///////////////////////////////////////////////////////////////////////////////
+TEST_EXTRACTTIMESTAMPS_4SEASONS_ISMATCHINGPREVIOUSPARSER(TimestampParser, Test_ExtractTimestamps_4Seasons_IsMatchingPreviousParser)
+{
+    const ListUInt64 ListTimestampsExpected{1585213853613007104U, 1585213853680974848U, 1585213853748944128U, 1585213853816912896U, 1585213853884881920U};
+
+    ListUInt64 ListTimestamps;
+
+    const uint64 NumberOfTimestamps{TimestampParser::ExtractTimestamps(DIRECTORY_TEST_DATA "Timestamps4Seasons.txt", 1U, FormatSeconds, ListTimestamps)};
+
+    ASSERT_EQ(NumberOfTimestamps, ListTimestampsExpected.size());
+    ASSERT_EQ(ListTimestamps, ListTimestampsExpected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the timestamps of the ASRL dataset.
+///
+/// Tests whether the timestamps of an ASRL timestamp file (vertex and
+/// nanoseconds separated by a comma) do match the timestamps of the previous
+/// parser or not. The expectation is to get the nanoseconds unchanged.
+///////////////////////////////////////////////////////////////////////////////
+TEST_EXTRACTTIMESTAMPS_ASRL_ISMATCHINGPREVIOUSPARSER(TimestampParser, Test_ExtractTimestamps_ASRL_IsMatchingPreviousParser)
+{
+    const ListUInt64 ListTimestampsExpected{1358277302108547000U, 1358277302208412000U, 1358277302308277000U, 1358277302408142000U, 1358277302508007000U};
+
+    ListUInt64 ListTimestamps;
+
+    const uint64 NumberOfTimestamps{TimestampParser::ExtractTimestamps(DIRECTORY_TEST_DATA "TimestampsASRL.txt", 1U, FormatNanoseconds, ListTimestamps)};
+
+    ASSERT_EQ(NumberOfTimestamps, ListTimestampsExpected.size());
+    ASSERT_EQ(ListTimestamps, ListTimestampsExpected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the timestamps of the ASRL Devon Island dataset.
+///
+/// Tests whether the timestamps of an ASRL Devon Island timestamp file (index
+/// and ISO 8601 date and time with milliseconds) do match the timestamps of
+/// the previous parser or not. The expectation is to get the nanoseconds since
+/// midnight, including the carry into the next minute.
+///////////////////////////////////////////////////////////////////////////////
+TEST_EXTRACTTIMESTAMPS_ASRLDEVONISLAND_ISMATCHINGPREVIOUSPARSER(TimestampParser, Test_ExtractTimestamps_ASRLDevonIsland_IsMatchingPreviousParser)
+{
+    const ListUInt64 ListTimestampsExpected{67633604000000U, 67633704000000U, 67633804000000U, 67633905000000U, 67634005000000U, 67679999000000U, 67680099000000U};
+
+    ListUInt64 ListTimestamps;
+
+    const uint64 NumberOfTimestamps{TimestampParser::ExtractTimestamps(DIRECTORY_TEST_DATA "TimestampsASRLDevonIsland.txt", 1U, FormatISO8601TimeOfDay, ListTimestamps)};
+
+    ASSERT_EQ(NumberOfTimestamps, ListTimestampsExpected.size());
+    ASSERT_EQ(ListTimestamps, ListTimestampsExpected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for line endings and empty lines.
+///
+/// Tests whether carriage returns, empty lines, lines containing whitespace
+/// only and a missing line feed at the end of the file are handled or not.
+/// The expectation is to get one timestamp per non-empty line.
+///////////////////////////////////////////////////////////////////////////////
+TEST_EXTRACTTIMESTAMPS_CRLFANDEMPTYLINES_ISSKIPPED(TimestampParser, Test_ExtractTimestamps_CRLFAndEmptyLines_IsSkipped)
+{
+    const std::filesystem::path FileTimestampsWithPath{WriteTimestampFile("TimestampsCRLF.txt", "\r\n0.5\r\n\r\n  \t\r\n\t 1.25 \r\n\n2.0")};
+
+    const ListUInt64 ListTimestampsExpected{500000000U, 1250000000U, 2000000000U};
+
+    ListUInt64 ListTimestamps;
+
+    const uint64 NumberOfTimestamps{TimestampParser::ExtractTimestamps(FileTimestampsWithPath, 0U, FormatSeconds, ListTimestamps)};
+
+    std::filesystem::remove(FileTimestampsWithPath);
+
+    ASSERT_EQ(NumberOfTimestamps, ListTimestampsExpected.size());
+    ASSERT_EQ(ListTimestamps, ListTimestampsExpected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the separators of the columns.
+///
+/// Tests whether whitespace, commas and semicolons (with and without
+/// surrounding whitespace) separate the columns or not. The expectation is to
+/// get the timestamps of the third column.
+///////////////////////////////////////////////////////////////////////////////
+TEST_EXTRACTTIMESTAMPS_COMMAANDSEMICOLON_ISSEPARATOR(TimestampParser, Test_ExtractTimestamps_CommaAndSemicolon_IsSeparator)
+{
+    const std::filesystem::path FileTimestampsWithPath{WriteTimestampFile("TimestampsSeparators.txt", "0,a,100\n1;b;200\n2 c  300\n3 , d\t;\t400\n4\t e,500,x\n")};
+
+    const ListUInt64 ListTimestampsExpected{100U, 200U, 300U, 400U, 500U};
+
+    ListUInt64 ListTimestamps;
+
+    const uint64 NumberOfTimestamps{TimestampParser::ExtractTimestamps(FileTimestampsWithPath, 2U, FormatNanoseconds, ListTimestamps)};
+
+    std::filesystem::remove(FileTimestampsWithPath);
+
+    ASSERT_EQ(NumberOfTimestamps, ListTimestampsExpected.size());
+    ASSERT_EQ(ListTimestamps, ListTimestampsExpected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for a line without a valid timestamp.
+///
+/// Tests whether parsing stops at the first line without a valid timestamp
+/// or not. The expectation is to get the timestamps in front of the line
+/// only, both for an invalid value and for a missing column.
+///////////////////////////////////////////////////////////////////////////////
+TEST_EXTRACTTIMESTAMPS_INVALIDLINE_ISSTOPPING(TimestampParser, Test_ExtractTimestamps_InvalidLine_IsStopping)
+{
+    const std::filesystem::path FileTimestampsWithPathInvalidValue{WriteTimestampFile("TimestampsInvalidValue.txt", "0 10\n1 20\n2 3O\n3 40\n")};
+    const std::filesystem::path FileTimestampsWithPathMissingColumn{WriteTimestampFile("TimestampsMissingColumn.txt", "0 10\n1\n2 30\n")};
+
+    ListUInt64 ListTimestampsInvalidValue;
+    ListUInt64 ListTimestampsMissingColumn;
+
+    const uint64 NumberOfTimestampsInvalidValue{TimestampParser::ExtractTimestamps(FileTimestampsWithPathInvalidValue, 1U, FormatNanoseconds, ListTimestampsInvalidValue)};
+    const uint64 NumberOfTimestampsMissingColumn{TimestampParser::ExtractTimestamps(FileTimestampsWithPathMissingColumn, 1U, FormatNanoseconds, ListTimestampsMissingColumn)};
+
+    std::filesystem::remove(FileTimestampsWithPathInvalidValue);
+    std::filesystem::remove(FileTimestampsWithPathMissingColumn);
+
+    ASSERT_EQ(NumberOfTimestampsInvalidValue, 2U);
+    ASSERT_EQ(ListTimestampsInvalidValue, ListUInt64({10U, 20U}));
+    ASSERT_EQ(NumberOfTimestampsMissingColumn, 1U);
+    ASSERT_EQ(ListTimestampsMissingColumn, ListUInt64({10U}));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for missing and empty timestamp files.
+///
+/// Tests whether a missing timestamp file throws an exception or not. The
+/// expectation is to get an exception for a missing file and no timestamps
+/// for an empty file.
+///////////////////////////////////////////////////////////////////////////////
+TEST_EXTRACTTIMESTAMPS_MISSINGFILE_ISTHROWING(TimestampParser, Test_ExtractTimestamps_MissingFile_IsThrowing)
+{
+    const std::filesystem::path FileTimestampsWithPathEmpty{WriteTimestampFile("TimestampsEmpty.txt", "")};
+
+    ListUInt64 ListTimestamps;
+
+    ASSERT_THROW(TimestampParser::ExtractTimestamps(DIRECTORY_TEST_DATA "TimestampsMissing.txt", 0U, FormatSeconds, ListTimestamps), std::invalid_argument);
+
+    const uint64 NumberOfTimestampsEmpty{TimestampParser::ExtractTimestamps(FileTimestampsWithPathEmpty, 0U, FormatSeconds, ListTimestamps)};
+
+    std::filesystem::remove(FileTimestampsWithPathEmpty);
+
+    ASSERT_EQ(NumberOfTimestampsEmpty, 0U);
+    ASSERT_TRUE(ListTimestamps.empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the fraction of a second of ISO 8601 timestamps.
+///
+/// Tests whether fractions with 1 to 12 digits are scaled to nanoseconds or
+/// not, both with a dot and a comma as decimal mark and with and without a
+/// trailing Z. The expectation is that fewer than 9 digits are scaled and
+/// digits beyond nanoseconds are truncated.
+///////////////////////////////////////////////////////////////////////////////
+TEST_PARSETIMESTAMP_ISO8601FRACTION_ISSCALED(TimestampParser, Test_ParseTimestamp_ISO8601Fraction_IsScaled)
+{
+    const std::string Digits{"987654321987"};
+    const uint64      TimeOfDayNanoseconds{67633000000000U}; // 18:47:13 in nanoseconds
+
+    uint64 FractionNanosecondsExpected{0U};
+    uint64 Scale{100000000U};
+
+    for(uint64 i_NumberOfDigits{1U}; i_NumberOfDigits <= Digits.size(); i_NumberOfDigits++)
+    {
+        if(i_NumberOfDigits <= 9U)
+        {
+            FractionNanosecondsExpected += static_cast<uint64>(Digits[i_NumberOfDigits - 1U] - '0') * Scale;
+            Scale /= 10U;
+        }
+
+        const std::string Fraction{Digits.substr(0U, i_NumberOfDigits)};
+
+        for(const std::string& Timestamp : {"2009-08-24T18:47:13." + Fraction, "2009-08-24T18:47:13," + Fraction, "2009-08-24T18:47:13." + Fraction + "Z"})
+        {
+            uint64 TimestampNanoseconds{0U};
+
+            ASSERT_TRUE(ParseTimestampString(Timestamp, FormatISO8601TimeOfDay, TimestampNanoseconds)) << Timestamp;
+            ASSERT_EQ(TimestampNanoseconds, TimeOfDayNanoseconds + FractionNanosecondsExpected) << Timestamp;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the date of ISO 8601 timestamps.
+///
+/// Tests whether the date of ISO 8601 timestamps is converted into the time
+/// since the epoch or not. The expectation is to match the POSIX time, also
+/// for a leap day and a leap second.
+///////////////////////////////////////////////////////////////////////////////
+TEST_PARSETIMESTAMP_ISO8601DATE_ISMATCHINGEPOCH(TimestampParser, Test_ParseTimestamp_ISO8601Date_IsMatchingEpoch)
+{
+    uint64 TimestampNanoseconds{0U};
+
+    ASSERT_TRUE(ParseTimestampString("1970-01-01T00:00:00Z", FormatISO8601, TimestampNanoseconds));
+    ASSERT_EQ(TimestampNanoseconds, 0U);
+
+    ASSERT_TRUE(ParseTimestampString("2009-08-24T18:47:13.604Z", FormatISO8601, TimestampNanoseconds));
+    ASSERT_EQ(TimestampNanoseconds, 1251139633604000000U);
+
+    ASSERT_TRUE(ParseTimestampString("2000-02-29T23:59:60", FormatISO8601, TimestampNanoseconds));
+    ASSERT_EQ(TimestampNanoseconds, 951868800000000000U);
+
+    // the date is ignored for the time of day
+    ASSERT_TRUE(ParseTimestampString("2000-02-29T23:59:60", FormatISO8601TimeOfDay, TimestampNanoseconds));
+    ASSERT_EQ(TimestampNanoseconds, 86400000000000U);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for invalid timestamps.
+///
+/// Tests whether malformed timestamps are rejected or not. The expectation is
+/// that none of the timestamps can be parsed.
+///////////////////////////////////////////////////////////////////////////////
+TEST_PARSETIMESTAMP_INVALIDTIMESTAMP_ISREJECTED(TimestampParser, Test_ParseTimestamp_InvalidTimestamp_IsRejected)
+{
+    uint64 TimestampNanoseconds{0U};
+
+    // ISO 8601
+    ASSERT_FALSE(ParseTimestampString("2009-08-24T18:47:13.", FormatISO8601, TimestampNanoseconds));
+    ASSERT_FALSE(ParseTimestampString("2009-08-24T18:47:13.604ZZ", FormatISO8601, TimestampNanoseconds));
+    ASSERT_FALSE(ParseTimestampString("2009-08-24T18:47:13+01:00", FormatISO8601, TimestampNanoseconds));
+    ASSERT_FALSE(ParseTimestampString("2009-08-24 18:47:13", FormatISO8601, TimestampNanoseconds));
+    ASSERT_FALSE(ParseTimestampString("2009-13-24T18:47:13", FormatISO8601, TimestampNanoseconds));
+    ASSERT_FALSE(ParseTimestampString("2009-08-24T24:00:00", FormatISO8601, TimestampNanoseconds));
+    ASSERT_FALSE(ParseTimestampString("2009-08-24T18:47:61", FormatISO8601, TimestampNanoseconds));
+    ASSERT_FALSE(ParseTimestampString("1969-12-31T23:59:59", FormatISO8601, TimestampNanoseconds));
+
+    // seconds and nanoseconds
+    ASSERT_FALSE(ParseTimestampString("", FormatSeconds, TimestampNanoseconds));
+    ASSERT_FALSE(ParseTimestampString("-1.0", FormatSeconds, TimestampNanoseconds));
+    ASSERT_FALSE(ParseTimestampString("1.0s", FormatSeconds, TimestampNanoseconds));
+    ASSERT_FALSE(ParseTimestampString("-1", FormatNanoseconds, TimestampNanoseconds));
+    ASSERT_FALSE(ParseTimestampString("1.5", FormatNanoseconds, TimestampNanoseconds));
+}
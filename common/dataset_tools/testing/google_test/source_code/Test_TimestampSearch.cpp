@@ -0,0 +1,241 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  Test_TimestampSearch.cpp
+///
+/// \brief Source file containing the unit tests for TimestampSearch.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "../../../TimestampSearch.h"
+
+// definition of macros for the unit tests
+#define TEST_FINDLOWERBOUND_UNIFORMTIMESTAMPS_ISMATCHINGSTD        TEST ///< Define to get a unique test name.
+#define TEST_FINDLOWERBOUND_SKEWEDTIMESTAMPS_ISMATCHINGSTD         TEST ///< Define to get a unique test name.
+#define TEST_FINDLOWERBOUND_DUPLICATETIMESTAMPS_ISMATCHINGSTD      TEST ///< Define to get a unique test name.
+#define TEST_FINDLOWERBOUND_SINGLEANDEQUALTIMESTAMPS_ISMATCHINGSTD TEST ///< Define to get a unique test name.
+#define TEST_FINDLOWERBOUND_STEPBEYONDFRONT_ISMATCHINGSTD          TEST ///< Define to get a unique test name.
+#define TEST_FINDNEAREST_EMPTYTIMESTAMPS_ISTHROWING                TEST ///< Define to get a unique test name.
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief     Checks the searches against the searches of the standard library.
+///
+/// Each timestamp of the list, its neighbors and the limits of the value range
+/// are used as queries. FindLowerBound is compared to std::lower_bound,
+/// FindInterval to std::lower_bound and std::upper_bound and FindNearest to a
+/// linear search.
+///
+/// \param[in] Timestamps Sorted list of timestamps.
+///////////////////////////////////////////////////////////////////////////////
+void CheckTimestampSearch(const ListUInt64& Timestamps)
+{
+    ListUInt64 Queries{0U, 1U, std::numeric_limits<uint64>::max()};
+
+    for(const uint64 Timestamp : Timestamps)
+    {
+        Queries.push_back(Timestamp);
+        Queries.push_back(Timestamp + 1U);
+
+        if(Timestamp > 0U)
+        {
+            Queries.push_back(Timestamp - 1U);
+        }
+    }
+
+    for(const uint64 Query : Queries)
+    {
+        const uint64 IndexExpected{static_cast<uint64>(std::lower_bound(Timestamps.begin(), Timestamps.end(), Query) - Timestamps.begin())};
+
+        ASSERT_EQ(TimestampSearch::FindLowerBound(Timestamps, Query), IndexExpected) << "Query: " << Query;
+
+        // interval of the query and its successor
+        const uint64 QueryEnd{(Query < std::numeric_limits<uint64>::max()) ? (Query + 1U) : Query};
+        const uint64 LastIndexExpected{static_cast<uint64>(std::upper_bound(Timestamps.begin(), Timestamps.end(), QueryEnd) - Timestamps.begin())};
+
+        uint64 FirstIndex{0U};
+        uint64 NumberOfIndices{0U};
+
+        TimestampSearch::FindInterval(Timestamps, Query, QueryEnd, FirstIndex, NumberOfIndices);
+
+        ASSERT_EQ(FirstIndex, IndexExpected) << "Query: " << Query;
+        ASSERT_EQ(NumberOfIndices, LastIndexExpected - IndexExpected) << "Query: " << Query;
+
+        // the earlier timestamp is preferred if both neighbors are equally close
+        if(!Timestamps.empty())
+        {
+            uint64 IndexNearestExpected{0U};
+
+            for(uint64 i_Timestamp{1U}; i_Timestamp < Timestamps.size(); i_Timestamp++)
+            {
+                const uint64 DistanceCurrent{(Timestamps[i_Timestamp] > Query) ? (Timestamps[i_Timestamp] - Query) : (Query - Timestamps[i_Timestamp])};
+                const uint64 DistanceBest{(Timestamps[IndexNearestExpected] > Query) ? (Timestamps[IndexNearestExpected] - Query) : (Query - Timestamps[IndexNearestExpected])};
+
+                if(DistanceCurrent < DistanceBest)
+                {
+                    IndexNearestExpected = i_Timestamp;
+                }
+            }
+
+            const uint64 IndexNearest{TimestampSearch::FindNearest(Timestamps, Query)};
+
+            ASSERT_EQ(Timestamps[IndexNearest], Timestamps[IndexNearestExpected]) << "Query: " << Query;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for uniformly distributed timestamps.
+///
+/// Tests whether the lower bound of uniformly distributed timestamps with a
+/// small jitter does match std::lower_bound or not. The expectation is to get
+/// identical indices for all queries.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FINDLOWERBOUND_UNIFORMTIMESTAMPS_ISMATCHINGSTD(TimestampSearch, Test_FindLowerBound_UniformTimestamps_IsMatchingStd)
+{
+    std::mt19937 RandomNumberEngine(42U);
+
+    std::uniform_int_distribution<uint64> DistributionJitter(0U, 1000U);
+
+    ListUInt64 Timestamps;
+
+    for(uint64 i_Timestamp{0U}; i_Timestamp < 1000U; i_Timestamp++)
+    {
+        Timestamps.push_back(1000000000U + (i_Timestamp * 100000000U) + DistributionJitter(RandomNumberEngine));
+    }
+
+    CheckTimestampSearch(Timestamps);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for skewed timestamps.
+///
+/// Tests whether the lower bound of timestamps whose distances grow
+/// exponentially does match std::lower_bound or not. The interpolated
+/// estimate is far off for these timestamps. The expectation is to get
+/// identical indices for all queries.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FINDLOWERBOUND_SKEWEDTIMESTAMPS_ISMATCHINGSTD(TimestampSearch, Test_FindLowerBound_SkewedTimestamps_IsMatchingStd)
+{
+    std::mt19937 RandomNumberEngine(7U);
+
+    std::exponential_distribution<float64> DistributionDistance(1.0);
+
+    ListUInt64 TimestampsGrowing;
+    ListUInt64 TimestampsClustered;
+
+    // distances double every 20 timestamps
+    for(uint64 i_Timestamp{0U}; i_Timestamp < 500U; i_Timestamp++)
+    {
+        TimestampsGrowing.push_back(static_cast<uint64>(std::pow(2.0, static_cast<float64>(i_Timestamp) / 20.0)));
+    }
+
+    // dense cluster at the beginning and a single outlier at the end
+    uint64 Timestamp{0U};
+
+    for(uint64 i_Timestamp{0U}; i_Timestamp < 500U; i_Timestamp++)
+    {
+        Timestamp += static_cast<uint64>(DistributionDistance(RandomNumberEngine) * 1000.0) + 1U;
+        TimestampsClustered.push_back(Timestamp);
+    }
+
+    TimestampsClustered.push_back(Timestamp * 1000000U);
+
+    CheckTimestampSearch(TimestampsGrowing);
+    CheckTimestampSearch(TimestampsClustered);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for timestamps with many duplicates.
+///
+/// Tests whether the lower bound of timestamps with long runs of equal values
+/// does match std::lower_bound or not. The expectation is to get the first
+/// index of each run.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FINDLOWERBOUND_DUPLICATETIMESTAMPS_ISMATCHINGSTD(TimestampSearch, Test_FindLowerBound_DuplicateTimestamps_IsMatchingStd)
+{
+    std::mt19937 RandomNumberEngine(3U);
+
+    std::uniform_int_distribution<uint64> DistributionValue(0U, 20U);
+
+    ListUInt64 Timestamps;
+
+    for(uint64 i_Timestamp{0U}; i_Timestamp < 500U; i_Timestamp++)
+    {
+        Timestamps.push_back(DistributionValue(RandomNumberEngine) * 10U);
+    }
+
+    std::sort(Timestamps.begin(), Timestamps.end());
+
+    CheckTimestampSearch(Timestamps);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for an empty list, a single timestamp and equal timestamps.
+///
+/// Tests whether the lower bound of degenerated lists of timestamps does
+/// match std::lower_bound or not. The expectation is to get identical indices
+/// for all queries.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FINDLOWERBOUND_SINGLEANDEQUALTIMESTAMPS_ISMATCHINGSTD(TimestampSearch, Test_FindLowerBound_SingleAndEqualTimestamps_IsMatchingStd)
+{
+    CheckTimestampSearch(ListUInt64());
+    CheckTimestampSearch(ListUInt64({1000U}));
+    CheckTimestampSearch(ListUInt64(7U, 42U));
+    CheckTimestampSearch(ListUInt64({0U, std::numeric_limits<uint64>::max()}));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for a search step beyond the front of the list.
+///
+/// Tests whether the lower bound does match std::lower_bound or not if the
+/// doubled search step exceeds the estimated index while searching backwards.
+/// The expectation is to get identical indices without reading outside of the
+/// list.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FINDLOWERBOUND_STEPBEYONDFRONT_ISMATCHINGSTD(TimestampSearch, Test_FindLowerBound_StepBeyondFront_IsMatchingStd)
+{
+    const ListUInt64 TimestampsFirst{0U, 90U, 95U, 97U, 98U, 100U};
+    const ListUInt64 TimestampsSecond{0U, 10U, 10U, 10U, 10U};
+
+    ASSERT_EQ(TimestampSearch::FindLowerBound(TimestampsFirst, 90U), 1U);
+    ASSERT_EQ(TimestampSearch::FindLowerBound(TimestampsSecond, 10U), 1U);
+
+    CheckTimestampSearch(TimestampsFirst);
+    CheckTimestampSearch(TimestampsSecond);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the nearest timestamp of an empty list.
+///
+/// Tests whether the search for the nearest timestamp in an empty list throws
+/// an exception or not. The expectation is to get an exception.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FINDNEAREST_EMPTYTIMESTAMPS_ISTHROWING(TimestampSearch, Test_FindNearest_EmptyTimestamps_IsThrowing)
+{
+    ASSERT_THROW(TimestampSearch::FindNearest(ListUInt64(), 0U), std::invalid_argument);
+}
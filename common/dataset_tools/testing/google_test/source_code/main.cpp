@@ -0,0 +1,39 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  main.cpp
+///
+/// \brief Entry point for the unit tests of the dataset tools.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#include <gtest/gtest.h>
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Entry point for the unit tests of the dataset tools.
+///
+/// Main function which serves as entry point for the unit tests of the dataset tools.
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
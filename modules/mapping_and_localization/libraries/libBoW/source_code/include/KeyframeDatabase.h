@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  KeyframeDatabase.h
+///
+/// \brief Header file containing the KeyframeDatabase class.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#ifndef KEYFRAMEDATABASE_H
+#define KEYFRAMEDATABASE_H
+
+#include <GlobalTypesDerived.h>
+
+#include "VocabularyTree.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class KeyframeDatabase
+///
+/// \brief Class for retrieving keyframes which are similar to a query image.
+///
+/// The bag-of-words vectors of the keyframes are stored in inverted files,
+/// i.e. for each visual word the keyframes it occurs in together with its
+/// weight. A query only visits the inverted files of its own words, hence its
+/// runtime depends on the number of keyframes sharing words with the query
+/// rather than on the total number of keyframes. The direct indices of the
+/// keyframes are stored as well to restrict the subsequent descriptor matching
+/// to features passing the same nodes (see VocabularyTree::FindCorrespondences).
+///
+/// Queries are const and can be run concurrently, adding keyframes must not
+/// overlap with queries.
+///////////////////////////////////////////////////////////////////////////////
+class KeyframeDatabase
+{
+protected:
+    const VocabularyTree&                      m_VocabularyTree;          ///< Vocabulary the bag-of-words vectors are based on.
+    std::vector<ListUInt64>                    m_InvertedFileKeyframeIDs; ///< IDs of the keyframes each visual word occurs in.
+    std::vector<ListFloat64>                   m_InvertedFileWeights;     ///< Weights of each visual word in the keyframes it occurs in.
+    std::vector<VocabularyTree::FeatureVector> m_DirectIndices;           ///< Direct indices of the keyframes.
+
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Constructor.
+    ///
+    /// \param[in] Vocabulary Trained vocabulary the bag-of-words vectors are based on.
+    ///////////////////////////////////////////////////////////////////////////////
+    explicit KeyframeDatabase(const VocabularyTree& Vocabulary);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor.
+    ///////////////////////////////////////////////////////////////////////////////
+    ~KeyframeDatabase();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Adds a keyframe to the database.
+    ///
+    /// The bag-of-words vector is validated before the database is modified,
+    /// i.e. a rejected keyframe leaves the database unchanged. An
+    /// std::invalid_argument exception is thrown if the number of words does
+    /// not match the number of weights, an std::out_of_range exception if a
+    /// word is not part of the vocabulary.
+    ///
+    /// \param[in] BoW      Bag-of-words vector of the keyframe.
+    /// \param[in] Features Direct index of the keyframe.
+    ///
+    /// \return    ID of the keyframe.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 AddKeyframe(const VocabularyTree::BoWVector&     BoW,
+                       const VocabularyTree::FeatureVector& Features);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Removes all keyframes from the database.
+    ///////////////////////////////////////////////////////////////////////////////
+    void Clear();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Retrieves the keyframes which are most similar to a query
+    ///             image.
+    ///
+    /// \param[in]  BoW                    Bag-of-words vector of the query image.
+    /// \param[in]  MaximumNumberOfResults Maximum number of retrieved keyframes.
+    /// \param[out] KeyframeIDs            IDs of the retrieved keyframes (sorted by their score in descending order).
+    /// \param[out] Scores                 Scores of the retrieved keyframes (see VocabularyTree::ComputeScore).
+    ///////////////////////////////////////////////////////////////////////////////
+    void Query(const VocabularyTree::BoWVector& BoW,
+               const uint64                     MaximumNumberOfResults,
+               ListUInt64&                      KeyframeIDs,
+               ListFloat64&                     Scores) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Getter for the direct index of a keyframe.
+    ///
+    /// \param[in] KeyframeID ID of the keyframe.
+    ///
+    /// \return    Direct index of the keyframe.
+    ///////////////////////////////////////////////////////////////////////////////
+    const VocabularyTree::FeatureVector& GetFeatureVector(const uint64 KeyframeID) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the number of keyframes in the database.
+    ///
+    /// \return Number of keyframes.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 GetNumberOfKeyframes() const;
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Checks whether a bag-of-words vector is based on the vocabulary
+    ///            of the database or not.
+    ///
+    /// An exception is thrown if the number of words does not match the number
+    /// of weights (std::invalid_argument) or if a word is not part of the
+    /// vocabulary (std::out_of_range).
+    ///
+    /// \param[in] BoW Bag-of-words vector.
+    ///////////////////////////////////////////////////////////////////////////////
+    void ValidateBoWVector(const VocabularyTree::BoWVector& BoW) const;
+};
+
+#endif // KEYFRAMEDATABASE_H
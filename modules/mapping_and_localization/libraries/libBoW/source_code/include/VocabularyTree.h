@@ -0,0 +1,236 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  VocabularyTree.h
+///
+/// \brief Header file containing the VocabularyTree class.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#ifndef VOCABULARYTREE_H
+#define VOCABULARYTREE_H
+
+#include <random>
+
+#include <opencv2/core/core.hpp>
+#include <opencv2/features2d/features2d.hpp>
+
+#include <GlobalTypesDerived.h>
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class VocabularyTree
+///
+/// \brief Class for quantizing binary descriptors into visual words.
+///
+/// The vocabulary is a tree which is learned by hierarchical k-means++
+/// clustering in Hamming space (the cluster centers are the bitwise majority
+/// of their members). The leaves of the tree are the visual words, each of
+/// which is weighted by its inverse document frequency in the training images.
+///
+/// The nodes are stored in breadth-first order in flat arrays, i.e. the
+/// children of a node are contiguous in memory and a descriptor is quantized
+/// by a linear scan over a few cache lines per level.
+///
+/// The tree is immutable after training, i.e. a trained instance can be used
+/// by several threads concurrently.
+///////////////////////////////////////////////////////////////////////////////
+class VocabularyTree
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \struct BoWVector
+    ///
+    /// \brief  Sparse bag-of-words vector of an image (TF-IDF weights, unit L1
+    ///         norm).
+    ///////////////////////////////////////////////////////////////////////////////
+    struct BoWVector
+    {
+        ListUInt64  WordIDs;     ///< IDs of the visual words occurring in the image (sorted in ascending order).
+        ListFloat64 WordWeights; ///< Weights of the visual words.
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \struct FeatureVector
+    ///
+    /// \brief  Direct index of an image, i.e. the features grouped by the node
+    ///         they pass at a certain level of the tree.
+    ///////////////////////////////////////////////////////////////////////////////
+    struct FeatureVector
+    {
+        ListUInt64              NodeIDs;        ///< IDs of the nodes (sorted in ascending order).
+        std::vector<ListUInt64> FeatureIndices; ///< Indices of the features passing each node.
+    };
+
+protected:
+    const uint64       m_BranchingFactor;           ///< Maximum number of children of a node.
+    const uint64       m_NumberOfLevels;            ///< Maximum number of levels below the root node.
+    const uint64       m_MaximumNumberOfIterations; ///< Maximum number of k-means iterations per node.
+    const uint64       m_SeedValue;                 ///< Seed value used to initialize the random number engine.
+    uint64             m_DescriptorSize;            ///< Size of the descriptors (in bytes).
+    std::vector<uint8> m_NodeDescriptors;           ///< Descriptors (cluster centers) of all nodes (contiguous, in breadth-first order).
+    ListUInt64         m_NodeFirstChildren;         ///< Index of the first child of each node (children are contiguous).
+    ListUInt64         m_NodeNumberOfChildren;      ///< Number of children of each node (zero for leaves).
+    ListUInt64         m_NodeWordIDs;               ///< ID of the visual word of each node (only valid for leaves).
+    ListFloat64        m_WordWeights;               ///< Inverse document frequency of each visual word.
+
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Constructor.
+    ///
+    /// \param[in] BranchingFactor           Maximum number of children of a node.
+    /// \param[in] NumberOfLevels            Maximum number of levels below the root node.
+    /// \param[in] MaximumNumberOfIterations Maximum number of k-means iterations per node.
+    /// \param[in] SeedValue                 Seed value used to initialize the random number engine.
+    ///////////////////////////////////////////////////////////////////////////////
+    VocabularyTree(const uint64 BranchingFactor           = 10U,
+                   const uint64 NumberOfLevels            = 6U,
+                   const uint64 MaximumNumberOfIterations = 10U,
+                   const uint64 SeedValue                 = 0U);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor.
+    ///////////////////////////////////////////////////////////////////////////////
+    ~VocabularyTree();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Learns the vocabulary from the descriptors of training images.
+    ///
+    /// \param[in] TrainingDescriptors Binary descriptors of each training image (8-bit unsigned integers, one descriptor per row).
+    ///////////////////////////////////////////////////////////////////////////////
+    void Train(const std::vector<cv::Mat>& TrainingDescriptors);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Quantizes the descriptors of an image.
+    ///
+    /// \param[in]  Descriptors      Binary descriptors of the image (one descriptor per row).
+    /// \param[in]  DirectIndexLevel Level of the nodes used for the direct index (1 = children of the root node).
+    /// \param[out] BoW              Bag-of-words vector of the image.
+    /// \param[out] Features         Direct index of the image.
+    ///////////////////////////////////////////////////////////////////////////////
+    void Transform(const cv::Mat& Descriptors,
+                   const uint64   DirectIndexLevel,
+                   BoWVector&     BoW,
+                   FeatureVector& Features) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the number of nodes of the tree.
+    ///
+    /// \return Number of nodes (including the root node).
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 GetNumberOfNodes() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the number of visual words.
+    ///
+    /// \return Number of visual words.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 GetNumberOfWords() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Checks whether the vocabulary is trained or not.
+    ///
+    /// \return Flag whether the vocabulary is trained or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    boolean IsTrained() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Computes the similarity of two bag-of-words vectors.
+    ///
+    /// The similarity is based on the L1 distance of the vectors, i.e.
+    /// s = 1 - 0.5 * |v - w|, and is in the range [0, 1].
+    ///
+    /// \param[in] BoWA First bag-of-words vector.
+    /// \param[in] BoWB Second bag-of-words vector.
+    ///
+    /// \return    Similarity of both vectors.
+    ///////////////////////////////////////////////////////////////////////////////
+    static float64 ComputeScore(const BoWVector& BoWA,
+                                const BoWVector& BoWB);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Finds feature correspondences between two images by their
+    ///             direct indices.
+    ///
+    /// Only features which pass the same node of the tree are compared. A match
+    /// is accepted if it passes the ratio test and if no other query feature is
+    /// closer to the same train feature.
+    ///
+    /// \param[in]  QueryDescriptors Binary descriptors of the query image (one descriptor per row).
+    /// \param[in]  QueryFeatures    Direct index of the query image.
+    /// \param[in]  TrainDescriptors Binary descriptors of the train image (one descriptor per row).
+    /// \param[in]  TrainFeatures    Direct index of the train image.
+    /// \param[in]  RatioDistance    Ratio between first and second best distance to consider a match to be a good one.
+    /// \param[out] Matches          Feature correspondences between both images.
+    ///////////////////////////////////////////////////////////////////////////////
+    static void FindCorrespondences(const cv::Mat&           QueryDescriptors,
+                                    const FeatureVector&     QueryFeatures,
+                                    const cv::Mat&           TrainDescriptors,
+                                    const FeatureVector&     TrainFeatures,
+                                    const float64            RatioDistance,
+                                    std::vector<cv::DMatch>& Matches);
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Clusters descriptors by k-means++ in Hamming space.
+    ///
+    /// If there are not more descriptors than the branching factor, each
+    /// descriptor forms a cluster on its own.
+    ///
+    /// \param[in]     Descriptors        Descriptors of all training images (contiguous).
+    /// \param[in]     DescriptorIndices  Indices of the descriptors which shall be clustered.
+    /// \param[in,out] RandomNumberEngine Random number engine used for the seeding.
+    /// \param[out]    Centers            Cluster centers (contiguous).
+    /// \param[out]    Clusters           Indices of the descriptors of each cluster.
+    ///////////////////////////////////////////////////////////////////////////////
+    void ClusterDescriptors(const std::vector<uint8>& Descriptors,
+                            const ListUInt64&         DescriptorIndices,
+                            std::mt19937&             RandomNumberEngine,
+                            std::vector<uint8>&       Centers,
+                            std::vector<ListUInt64>&  Clusters) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Computes the Hamming distance of two binary descriptors.
+    ///
+    /// \param[in] DescriptorA    First descriptor.
+    /// \param[in] DescriptorB    Second descriptor.
+    /// \param[in] DescriptorSize Size of the descriptors (in bytes).
+    ///
+    /// \return    Hamming distance.
+    ///////////////////////////////////////////////////////////////////////////////
+    static uint64 ComputeHammingDistance(const uint8* DescriptorA,
+                                         const uint8* DescriptorB,
+                                         const uint64 DescriptorSize);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Finds the visual word of a descriptor.
+    ///
+    /// \param[in]  Descriptor       Descriptor.
+    /// \param[in]  DirectIndexLevel Level of the node used for the direct index.
+    /// \param[out] DirectIndexNode  Node passed at the direct index level (the leaf if the tree is less deep).
+    ///
+    /// \return     ID of the visual word.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 FindWord(const uint8* Descriptor,
+                    const uint64 DirectIndexLevel,
+                    uint64&      DirectIndexNode) const;
+};
+
+#endif // VOCABULARYTREE_H
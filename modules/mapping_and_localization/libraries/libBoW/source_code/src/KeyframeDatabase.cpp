@@ -0,0 +1,169 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  KeyframeDatabase.cpp
+///
+/// \brief Source file containing the KeyframeDatabase class.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "../include/KeyframeDatabase.h"
+
+KeyframeDatabase::KeyframeDatabase(const VocabularyTree& Vocabulary) :
+    m_VocabularyTree{Vocabulary}
+{
+    if(!m_VocabularyTree.IsTrained())
+    {
+        throw std::invalid_argument("KeyframeDatabase: The vocabulary is not trained.");
+    }
+
+    m_InvertedFileKeyframeIDs.resize(m_VocabularyTree.GetNumberOfWords());
+    m_InvertedFileWeights.resize(m_VocabularyTree.GetNumberOfWords());
+}
+
+KeyframeDatabase::~KeyframeDatabase()
+{
+}
+
+uint64 KeyframeDatabase::AddKeyframe(const VocabularyTree::BoWVector&     BoW,
+                                     const VocabularyTree::FeatureVector& Features)
+{
+    // validate all words before the inverted files are modified
+    ValidateBoWVector(BoW);
+
+    const uint64 KeyframeID{m_DirectIndices.size()};
+
+    for(uint64 i_Word{0U}; i_Word < BoW.WordIDs.size(); i_Word++)
+    {
+        const uint64 WordID{BoW.WordIDs[i_Word]};
+
+        m_InvertedFileKeyframeIDs[WordID].push_back(KeyframeID);
+        m_InvertedFileWeights[WordID].push_back(BoW.WordWeights[i_Word]);
+    }
+
+    m_DirectIndices.push_back(Features);
+
+    return KeyframeID;
+}
+
+void KeyframeDatabase::Clear()
+{
+    for(uint64 i_Word{0U}; i_Word < m_InvertedFileKeyframeIDs.size(); i_Word++)
+    {
+        m_InvertedFileKeyframeIDs[i_Word].clear();
+        m_InvertedFileWeights[i_Word].clear();
+    }
+
+    m_DirectIndices.clear();
+}
+
+void KeyframeDatabase::Query(const VocabularyTree::BoWVector& BoW,
+                             const uint64                     MaximumNumberOfResults,
+                             ListUInt64&                      KeyframeIDs,
+                             ListFloat64&                     Scores) const
+{
+    // clean output
+    KeyframeIDs.clear();
+    Scores.clear();
+
+    ValidateBoWVector(BoW);
+
+    // accumulate the scores of the keyframes sharing words with the query (same score as VocabularyTree::ComputeScore)
+    ListFloat64 AccumulatedScores(m_DirectIndices.size(), 0.0);
+    ListUInt64  CandidateIDs;
+
+    for(uint64 i_Word{0U}; i_Word < BoW.WordIDs.size(); i_Word++)
+    {
+        const uint64 WordID{BoW.WordIDs[i_Word]};
+
+        const ListUInt64&  InvertedFileKeyframeIDs{m_InvertedFileKeyframeIDs[WordID]};
+        const ListFloat64& InvertedFileWeights{m_InvertedFileWeights[WordID]};
+        const float64      WeightQuery{BoW.WordWeights[i_Word]};
+
+        for(uint64 i_Entry{0U}; i_Entry < InvertedFileKeyframeIDs.size(); i_Entry++)
+        {
+            const uint64  KeyframeID{InvertedFileKeyframeIDs[i_Entry]};
+            const float64 WeightKeyframe{InvertedFileWeights[i_Entry]};
+            const float64 Score{WeightQuery + WeightKeyframe - std::abs(WeightQuery - WeightKeyframe)};
+
+            // the score of a keyframe sharing a word with non-zero weight is positive
+            if(Score <= 0.0)
+            {
+                continue;
+            }
+
+            if(AccumulatedScores[KeyframeID] == 0.0)
+            {
+                CandidateIDs.push_back(KeyframeID);
+            }
+
+            AccumulatedScores[KeyframeID] += Score;
+        }
+    }
+
+    // select the best keyframes
+    const uint64 NumberOfResults{std::min(MaximumNumberOfResults, static_cast<uint64>(CandidateIDs.size()))};
+
+    std::partial_sort(CandidateIDs.begin(), CandidateIDs.begin() + static_cast<sint64>(NumberOfResults), CandidateIDs.end(), [&AccumulatedScores](const uint64 KeyframeIDA, const uint64 KeyframeIDB) { return (AccumulatedScores[KeyframeIDA] > AccumulatedScores[KeyframeIDB]) || ((AccumulatedScores[KeyframeIDA] == AccumulatedScores[KeyframeIDB]) && (KeyframeIDA < KeyframeIDB)); });
+
+    KeyframeIDs.assign(CandidateIDs.begin(), CandidateIDs.begin() + static_cast<sint64>(NumberOfResults));
+    Scores.reserve(NumberOfResults);
+
+    for(const uint64 KeyframeID : KeyframeIDs)
+    {
+        Scores.push_back(0.5 * AccumulatedScores[KeyframeID]);
+    }
+}
+
+const VocabularyTree::FeatureVector& KeyframeDatabase::GetFeatureVector(const uint64 KeyframeID) const
+{
+    if(KeyframeID >= m_DirectIndices.size())
+    {
+        throw std::out_of_range("KeyframeDatabase: The keyframe ID is out of range.");
+    }
+
+    return m_DirectIndices[KeyframeID];
+}
+
+uint64 KeyframeDatabase::GetNumberOfKeyframes() const
+{
+    return m_DirectIndices.size();
+}
+
+void KeyframeDatabase::ValidateBoWVector(const VocabularyTree::BoWVector& BoW) const
+{
+    if(BoW.WordIDs.size() != BoW.WordWeights.size())
+    {
+        throw std::invalid_argument("KeyframeDatabase: The number of words does not match the number of weights.");
+    }
+
+    for(const uint64 WordID : BoW.WordIDs)
+    {
+        if(WordID >= m_InvertedFileKeyframeIDs.size())
+        {
+            throw std::out_of_range("KeyframeDatabase: The bag-of-words vector does not match the vocabulary.");
+        }
+    }
+}
@@ -0,0 +1,661 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  VocabularyTree.cpp
+///
+/// \brief Source file containing the VocabularyTree class.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "../include/VocabularyTree.h"
+
+VocabularyTree::VocabularyTree(const uint64 BranchingFactor,
+                               const uint64 NumberOfLevels,
+                               const uint64 MaximumNumberOfIterations,
+                               const uint64 SeedValue) :
+    m_BranchingFactor{BranchingFactor},
+    m_NumberOfLevels{NumberOfLevels},
+    m_MaximumNumberOfIterations{MaximumNumberOfIterations},
+    m_SeedValue{SeedValue},
+    m_DescriptorSize{0U}
+{
+    if(m_BranchingFactor < 2U)
+    {
+        throw std::invalid_argument("VocabularyTree: The branching factor must be at least 2.");
+    }
+
+    if(m_NumberOfLevels < 1U)
+    {
+        throw std::invalid_argument("VocabularyTree: The number of levels must be at least 1.");
+    }
+}
+
+VocabularyTree::~VocabularyTree()
+{
+}
+
+void VocabularyTree::Train(const std::vector<cv::Mat>& TrainingDescriptors)
+{
+    // check training descriptors
+    uint64 NumberOfDescriptors{0U};
+    uint64 DescriptorSize{0U};
+
+    for(const cv::Mat& Descriptors : TrainingDescriptors)
+    {
+        if(Descriptors.rows == 0)
+        {
+            continue;
+        }
+
+        if((Descriptors.type() != CV_8U) || ((DescriptorSize != 0U) && (static_cast<uint64>(Descriptors.cols) != DescriptorSize)))
+        {
+            throw std::invalid_argument("VocabularyTree: The training descriptors must be binary descriptors of the same size.");
+        }
+
+        DescriptorSize = static_cast<uint64>(Descriptors.cols);
+        NumberOfDescriptors += static_cast<uint64>(Descriptors.rows);
+    }
+
+    if(NumberOfDescriptors == 0U)
+    {
+        throw std::invalid_argument("VocabularyTree: No training descriptors are provided.");
+    }
+
+    // copy training descriptors into a contiguous buffer
+    std::vector<uint8> Descriptors(NumberOfDescriptors * DescriptorSize);
+    uint64             DescriptorCounter{0U};
+
+    for(const cv::Mat& DescriptorsImage : TrainingDescriptors)
+    {
+        for(sint32 i_Row{0}; i_Row < DescriptorsImage.rows; i_Row++)
+        {
+            std::memcpy(&Descriptors[DescriptorCounter * DescriptorSize], DescriptorsImage.ptr<uint8>(i_Row), DescriptorSize);
+            DescriptorCounter++;
+        }
+    }
+
+    // reset the tree (root node only)
+    m_DescriptorSize = DescriptorSize;
+
+    m_NodeDescriptors.assign(m_DescriptorSize, 0U);
+    m_NodeFirstChildren.assign(1U, 0U);
+    m_NodeNumberOfChildren.assign(1U, 0U);
+    m_NodeWordIDs.assign(1U, 0U);
+    m_WordWeights.clear();
+
+    // build the tree in breadth-first order (the children of a node are appended to the end of the node arrays)
+    std::mt19937 RandomNumberEngine(static_cast<std::mt19937::result_type>(m_SeedValue));
+
+    std::vector<ListUInt64> NodeMembers(1U, ListUInt64(NumberOfDescriptors));
+    ListUInt64              NodeLevels(1U, 0U);
+    std::vector<uint8>      Centers;
+    std::vector<ListUInt64> Clusters;
+
+    for(uint64 i_Descriptor{0U}; i_Descriptor < NumberOfDescriptors; i_Descriptor++)
+    {
+        NodeMembers[0][i_Descriptor] = i_Descriptor;
+    }
+
+    for(uint64 i_Node{0U}; i_Node < NodeMembers.size(); i_Node++)
+    {
+        if((NodeLevels[i_Node] < m_NumberOfLevels) && (NodeMembers[i_Node].size() > 1U))
+        {
+            ClusterDescriptors(Descriptors, NodeMembers[i_Node], RandomNumberEngine, Centers, Clusters);
+        }
+        else
+        {
+            Clusters.clear();
+        }
+
+        // nodes whose descriptors cannot be split any further remain leaves
+        if(Clusters.size() > 1U)
+        {
+            m_NodeFirstChildren[i_Node]    = NodeMembers.size();
+            m_NodeNumberOfChildren[i_Node] = Clusters.size();
+
+            m_NodeDescriptors.insert(m_NodeDescriptors.end(), Centers.begin(), Centers.end());
+            m_NodeFirstChildren.resize(m_NodeFirstChildren.size() + Clusters.size(), 0U);
+            m_NodeNumberOfChildren.resize(m_NodeNumberOfChildren.size() + Clusters.size(), 0U);
+            m_NodeWordIDs.resize(m_NodeWordIDs.size() + Clusters.size(), 0U);
+            NodeLevels.resize(NodeLevels.size() + Clusters.size(), NodeLevels[i_Node] + 1U);
+
+            for(ListUInt64& Cluster : Clusters)
+            {
+                NodeMembers.push_back(std::move(Cluster));
+            }
+        }
+
+        // members are not needed anymore
+        ListUInt64().swap(NodeMembers[i_Node]);
+    }
+
+    // assign the visual words to the leaves
+    uint64 NumberOfWords{0U};
+
+    for(uint64 i_Node{0U}; i_Node < m_NodeNumberOfChildren.size(); i_Node++)
+    {
+        if(m_NodeNumberOfChildren[i_Node] == 0U)
+        {
+            m_NodeWordIDs[i_Node] = NumberOfWords;
+            NumberOfWords++;
+        }
+    }
+
+    // compute the inverse document frequencies of the visual words
+    const float64 NumberOfImages{static_cast<float64>(TrainingDescriptors.size())};
+
+    ListUInt64 NumberOfImagesPerWord(NumberOfWords, 0U);
+    ListUInt64 LastImagePerWord(NumberOfWords, std::numeric_limits<uint64>::max());
+    uint64     DirectIndexNode{0U};
+
+    for(uint64 i_Image{0U}; i_Image < TrainingDescriptors.size(); i_Image++)
+    {
+        for(sint32 i_Row{0}; i_Row < TrainingDescriptors[i_Image].rows; i_Row++)
+        {
+            const uint64 WordID{FindWord(TrainingDescriptors[i_Image].ptr<uint8>(i_Row), 0U, DirectIndexNode)};
+
+            if(LastImagePerWord[WordID] != i_Image)
+            {
+                LastImagePerWord[WordID] = i_Image;
+                NumberOfImagesPerWord[WordID]++;
+            }
+        }
+    }
+
+    m_WordWeights.resize(NumberOfWords);
+
+    for(uint64 i_Word{0U}; i_Word < NumberOfWords; i_Word++)
+    {
+        // words which are never reached by the training descriptors are treated like words occurring in a single image
+        const float64 DocumentFrequency{static_cast<float64>(std::max(NumberOfImagesPerWord[i_Word], static_cast<uint64>(1U)))};
+
+        m_WordWeights[i_Word] = std::log(NumberOfImages / DocumentFrequency);
+    }
+}
+
+void VocabularyTree::Transform(const cv::Mat& Descriptors,
+                               const uint64   DirectIndexLevel,
+                               BoWVector&     BoW,
+                               FeatureVector& Features) const
+{
+    // clean output
+    BoW.WordIDs.clear();
+    BoW.WordWeights.clear();
+    Features.NodeIDs.clear();
+    Features.FeatureIndices.clear();
+
+    if(!IsTrained())
+    {
+        throw std::invalid_argument("VocabularyTree: The vocabulary is not trained.");
+    }
+
+    if(Descriptors.rows == 0)
+    {
+        return;
+    }
+
+    if((Descriptors.type() != CV_8U) || (static_cast<uint64>(Descriptors.cols) != m_DescriptorSize))
+    {
+        throw std::invalid_argument("VocabularyTree: The descriptors do not match the vocabulary.");
+    }
+
+    // quantize all descriptors (pairs of word / node and feature index)
+    const uint64 NumberOfFeatures{static_cast<uint64>(Descriptors.rows)};
+
+    std::vector<std::pair<uint64, uint64>> FeatureWords(NumberOfFeatures);
+    std::vector<std::pair<uint64, uint64>> FeatureNodes(NumberOfFeatures);
+
+    for(uint64 i_Feature{0U}; i_Feature < NumberOfFeatures; i_Feature++)
+    {
+        uint64 DirectIndexNode{0U};
+
+        const uint64 WordID{FindWord(Descriptors.ptr<uint8>(static_cast<sint32>(i_Feature)), DirectIndexLevel, DirectIndexNode)};
+
+        FeatureWords[i_Feature] = std::make_pair(WordID, i_Feature);
+        FeatureNodes[i_Feature] = std::make_pair(DirectIndexNode, i_Feature);
+    }
+
+    std::sort(FeatureWords.begin(), FeatureWords.end());
+    std::sort(FeatureNodes.begin(), FeatureNodes.end());
+
+    // accumulate TF-IDF weights of the words
+    float64 SumOfWeights{0.0};
+
+    for(const std::pair<uint64, uint64>& FeatureWord : FeatureWords)
+    {
+        const float64 Weight{m_WordWeights[FeatureWord.first]};
+
+        if(BoW.WordIDs.empty() || (BoW.WordIDs.back() != FeatureWord.first))
+        {
+            BoW.WordIDs.push_back(FeatureWord.first);
+            BoW.WordWeights.push_back(Weight);
+        }
+        else
+        {
+            BoW.WordWeights.back() += Weight;
+        }
+
+        SumOfWeights += Weight;
+    }
+
+    // normalize the bag-of-words vector (unit L1 norm)
+    if(SumOfWeights > 0.0)
+    {
+        for(float64& WordWeight : BoW.WordWeights)
+        {
+            WordWeight /= SumOfWeights;
+        }
+    }
+
+    // group the features by their node (direct index)
+    for(const std::pair<uint64, uint64>& FeatureNode : FeatureNodes)
+    {
+        if(Features.NodeIDs.empty() || (Features.NodeIDs.back() != FeatureNode.first))
+        {
+            Features.NodeIDs.push_back(FeatureNode.first);
+            Features.FeatureIndices.emplace_back();
+        }
+
+        Features.FeatureIndices.back().push_back(FeatureNode.second);
+    }
+}
+
+uint64 VocabularyTree::GetNumberOfNodes() const
+{
+    return m_NodeNumberOfChildren.size();
+}
+
+uint64 VocabularyTree::GetNumberOfWords() const
+{
+    return m_WordWeights.size();
+}
+
+boolean VocabularyTree::IsTrained() const
+{
+    return !m_WordWeights.empty();
+}
+
+float64 VocabularyTree::ComputeScore(const BoWVector& BoWA,
+                                     const BoWVector& BoWB)
+{
+    // only common words contribute to the score since |v - w| = |v| + |w| for the remaining ones
+    float64 Score{0.0};
+    uint64  IndexA{0U};
+    uint64  IndexB{0U};
+
+    while((IndexA < BoWA.WordIDs.size()) && (IndexB < BoWB.WordIDs.size()))
+    {
+        if(BoWA.WordIDs[IndexA] < BoWB.WordIDs[IndexB])
+        {
+            IndexA++;
+        }
+        else if(BoWA.WordIDs[IndexA] > BoWB.WordIDs[IndexB])
+        {
+            IndexB++;
+        }
+        else
+        {
+            const float64 WeightA{BoWA.WordWeights[IndexA]};
+            const float64 WeightB{BoWB.WordWeights[IndexB]};
+
+            Score += WeightA + WeightB - std::abs(WeightA - WeightB);
+
+            IndexA++;
+            IndexB++;
+        }
+    }
+
+    return 0.5 * Score;
+}
+
+void VocabularyTree::FindCorrespondences(const cv::Mat&           QueryDescriptors,
+                                         const FeatureVector&     QueryFeatures,
+                                         const cv::Mat&           TrainDescriptors,
+                                         const FeatureVector&     TrainFeatures,
+                                         const float64            RatioDistance,
+                                         std::vector<cv::DMatch>& Matches)
+{
+    // clean output
+    Matches.clear();
+
+    if((QueryDescriptors.type() != CV_8U) || (TrainDescriptors.type() != CV_8U) || (QueryDescriptors.cols != TrainDescriptors.cols))
+    {
+        throw std::invalid_argument("VocabularyTree: The descriptors must be binary descriptors of the same size.");
+    }
+
+    const uint64 DescriptorSize{static_cast<uint64>(QueryDescriptors.cols)};
+
+    // match the features of common nodes only
+    uint64 IndexQuery{0U};
+    uint64 IndexTrain{0U};
+
+    while((IndexQuery < QueryFeatures.NodeIDs.size()) && (IndexTrain < TrainFeatures.NodeIDs.size()))
+    {
+        if(QueryFeatures.NodeIDs[IndexQuery] < TrainFeatures.NodeIDs[IndexTrain])
+        {
+            IndexQuery++;
+        }
+        else if(QueryFeatures.NodeIDs[IndexQuery] > TrainFeatures.NodeIDs[IndexTrain])
+        {
+            IndexTrain++;
+        }
+        else
+        {
+            const ListUInt64& TrainIndices{TrainFeatures.FeatureIndices[IndexTrain]};
+
+            for(const uint64 QueryIndex : QueryFeatures.FeatureIndices[IndexQuery])
+            {
+                const uint8* QueryDescriptor{QueryDescriptors.ptr<uint8>(static_cast<sint32>(QueryIndex))};
+
+                uint64 DistanceBest{std::numeric_limits<uint64>::max()};
+                uint64 DistanceSecondBest{std::numeric_limits<uint64>::max()};
+                uint64 IndexBest{0U};
+
+                for(const uint64 TrainIndex : TrainIndices)
+                {
+                    const uint64 Distance{ComputeHammingDistance(QueryDescriptor, TrainDescriptors.ptr<uint8>(static_cast<sint32>(TrainIndex)), DescriptorSize)};
+
+                    if(Distance < DistanceBest)
+                    {
+                        DistanceSecondBest = DistanceBest;
+                        DistanceBest       = Distance;
+                        IndexBest          = TrainIndex;
+                    }
+                    else if(Distance < DistanceSecondBest)
+                    {
+                        DistanceSecondBest = Distance;
+                    }
+                }
+
+                // ratio test (a single candidate passes)
+                if((DistanceSecondBest == std::numeric_limits<uint64>::max()) || (static_cast<float64>(DistanceBest) < (RatioDistance * static_cast<float64>(DistanceSecondBest))))
+                {
+                    Matches.emplace_back(static_cast<sint32>(QueryIndex), static_cast<sint32>(IndexBest), static_cast<float32>(DistanceBest));
+                }
+            }
+
+            IndexQuery++;
+            IndexTrain++;
+        }
+    }
+
+    // keep the best match of each train feature
+    std::sort(Matches.begin(), Matches.end(), [](const cv::DMatch& MatchA, const cv::DMatch& MatchB) { return (MatchA.trainIdx < MatchB.trainIdx) || ((MatchA.trainIdx == MatchB.trainIdx) && (MatchA.distance < MatchB.distance)); });
+
+    Matches.erase(std::unique(Matches.begin(), Matches.end(), [](const cv::DMatch& MatchA, const cv::DMatch& MatchB) { return MatchA.trainIdx == MatchB.trainIdx; }), Matches.end());
+}
+
+void VocabularyTree::ClusterDescriptors(const std::vector<uint8>& Descriptors,
+                                        const ListUInt64&         DescriptorIndices,
+                                        std::mt19937&             RandomNumberEngine,
+                                        std::vector<uint8>&       Centers,
+                                        std::vector<ListUInt64>&  Clusters) const
+{
+    const uint64 NumberOfDescriptors{DescriptorIndices.size()};
+
+    // each descriptor forms a cluster on its own if there are only a few of them
+    if(NumberOfDescriptors <= m_BranchingFactor)
+    {
+        Centers.resize(NumberOfDescriptors * m_DescriptorSize);
+        Clusters.assign(NumberOfDescriptors, ListUInt64());
+
+        for(uint64 i_Descriptor{0U}; i_Descriptor < NumberOfDescriptors; i_Descriptor++)
+        {
+            std::memcpy(&Centers[i_Descriptor * m_DescriptorSize], &Descriptors[DescriptorIndices[i_Descriptor] * m_DescriptorSize], m_DescriptorSize);
+            Clusters[i_Descriptor].push_back(DescriptorIndices[i_Descriptor]);
+        }
+
+        return;
+    }
+
+    // k-means++ seeding (the probability to choose a descriptor is proportional to its squared distance to the closest center)
+    std::uniform_int_distribution<uint64> UniformDistribution(0U, NumberOfDescriptors - 1U);
+    std::uniform_real_distribution<float64> UniformDistributionReal(0.0, 1.0);
+
+    ListFloat64 SquaredDistances(NumberOfDescriptors, std::numeric_limits<float64>::max());
+    uint64      NumberOfCenters{0U};
+    uint64      ChosenDescriptor{UniformDistribution(RandomNumberEngine)};
+
+    Centers.resize(m_BranchingFactor * m_DescriptorSize);
+
+    while(NumberOfCenters < m_BranchingFactor)
+    {
+        const uint8* Center{&Centers[NumberOfCenters * m_DescriptorSize]};
+
+        std::memcpy(&Centers[NumberOfCenters * m_DescriptorSize], &Descriptors[DescriptorIndices[ChosenDescriptor] * m_DescriptorSize], m_DescriptorSize);
+        NumberOfCenters++;
+
+        float64 SumOfSquaredDistances{0.0};
+
+        for(uint64 i_Descriptor{0U}; i_Descriptor < NumberOfDescriptors; i_Descriptor++)
+        {
+            const float64 Distance{static_cast<float64>(ComputeHammingDistance(Center, &Descriptors[DescriptorIndices[i_Descriptor] * m_DescriptorSize], m_DescriptorSize))};
+
+            SquaredDistances[i_Descriptor] = std::min(SquaredDistances[i_Descriptor], Distance * Distance);
+            SumOfSquaredDistances += SquaredDistances[i_Descriptor];
+        }
+
+        // all descriptors coincide with a center
+        if(SumOfSquaredDistances <= 0.0)
+        {
+            break;
+        }
+
+        const float64 Threshold{UniformDistributionReal(RandomNumberEngine) * SumOfSquaredDistances};
+        float64       CumulativeSum{0.0};
+
+        ChosenDescriptor = NumberOfDescriptors - 1U;
+
+        for(uint64 i_Descriptor{0U}; i_Descriptor < NumberOfDescriptors; i_Descriptor++)
+        {
+            CumulativeSum += SquaredDistances[i_Descriptor];
+
+            if((CumulativeSum > Threshold) && (SquaredDistances[i_Descriptor] > 0.0))
+            {
+                ChosenDescriptor = i_Descriptor;
+                break;
+            }
+        }
+    }
+
+    Centers.resize(NumberOfCenters * m_DescriptorSize);
+
+    // k-means iterations (assignment to the closest center, update by the bitwise majority of the members)
+    const uint64 NumberOfBits{8U * m_DescriptorSize};
+
+    ListUInt64 Assignments(NumberOfDescriptors, NumberOfCenters);
+    ListUInt64 ClusterSizes(NumberOfCenters);
+    ListUInt64 BitCounts(NumberOfCenters * NumberOfBits);
+
+    for(uint64 i_Iteration{0U};; i_Iteration++)
+    {
+        boolean AssignmentsChanged{false};
+
+        for(uint64 i_Descriptor{0U}; i_Descriptor < NumberOfDescriptors; i_Descriptor++)
+        {
+            const uint8* Descriptor{&Descriptors[DescriptorIndices[i_Descriptor] * m_DescriptorSize]};
+
+            uint64 DistanceBest{std::numeric_limits<uint64>::max()};
+            uint64 CenterBest{0U};
+
+            for(uint64 i_Center{0U}; i_Center < NumberOfCenters; i_Center++)
+            {
+                const uint64 Distance{ComputeHammingDistance(Descriptor, &Centers[i_Center * m_DescriptorSize], m_DescriptorSize)};
+
+                if(Distance < DistanceBest)
+                {
+                    DistanceBest = Distance;
+                    CenterBest   = i_Center;
+                }
+            }
+
+            if(Assignments[i_Descriptor] != CenterBest)
+            {
+                Assignments[i_Descriptor] = CenterBest;
+                AssignmentsChanged        = true;
+            }
+        }
+
+        if(!AssignmentsChanged || (i_Iteration >= m_MaximumNumberOfIterations))
+        {
+            break;
+        }
+
+        std::fill(ClusterSizes.begin(), ClusterSizes.end(), 0U);
+        std::fill(BitCounts.begin(), BitCounts.end(), 0U);
+
+        for(uint64 i_Descriptor{0U}; i_Descriptor < NumberOfDescriptors; i_Descriptor++)
+        {
+            const uint8* Descriptor{&Descriptors[DescriptorIndices[i_Descriptor] * m_DescriptorSize]};
+            uint64*      BitCountsCenter{&BitCounts[Assignments[i_Descriptor] * NumberOfBits]};
+
+            ClusterSizes[Assignments[i_Descriptor]]++;
+
+            for(uint64 i_Bit{0U}; i_Bit < NumberOfBits; i_Bit++)
+            {
+                BitCountsCenter[i_Bit] += (Descriptor[i_Bit / 8U] >> (i_Bit % 8U)) & 1U;
+            }
+        }
+
+        for(uint64 i_Center{0U}; i_Center < NumberOfCenters; i_Center++)
+        {
+            // empty clusters keep their center
+            if(ClusterSizes[i_Center] == 0U)
+            {
+                continue;
+            }
+
+            uint8*        Center{&Centers[i_Center * m_DescriptorSize]};
+            const uint64* BitCountsCenter{&BitCounts[i_Center * NumberOfBits]};
+
+            std::memset(Center, 0, m_DescriptorSize);
+
+            for(uint64 i_Bit{0U}; i_Bit < NumberOfBits; i_Bit++)
+            {
+                if((2U * BitCountsCenter[i_Bit]) > ClusterSizes[i_Center])
+                {
+                    Center[i_Bit / 8U] = static_cast<uint8>(Center[i_Bit / 8U] | (1U << (i_Bit % 8U)));
+                }
+            }
+        }
+    }
+
+    // collect the members of the clusters (empty clusters are removed)
+    Clusters.assign(NumberOfCenters, ListUInt64());
+
+    for(uint64 i_Descriptor{0U}; i_Descriptor < NumberOfDescriptors; i_Descriptor++)
+    {
+        Clusters[Assignments[i_Descriptor]].push_back(DescriptorIndices[i_Descriptor]);
+    }
+
+    uint64 NumberOfClusters{0U};
+
+    for(uint64 i_Center{0U}; i_Center < NumberOfCenters; i_Center++)
+    {
+        if(!Clusters[i_Center].empty())
+        {
+            if(NumberOfClusters != i_Center)
+            {
+                std::memcpy(&Centers[NumberOfClusters * m_DescriptorSize], &Centers[i_Center * m_DescriptorSize], m_DescriptorSize);
+                Clusters[NumberOfClusters] = std::move(Clusters[i_Center]);
+            }
+
+            NumberOfClusters++;
+        }
+    }
+
+    Centers.resize(NumberOfClusters * m_DescriptorSize);
+    Clusters.resize(NumberOfClusters);
+}
+
+uint64 VocabularyTree::ComputeHammingDistance(const uint8* DescriptorA,
+                                              const uint8* DescriptorB,
+                                              const uint64 DescriptorSize)
+{
+    uint64 Distance{0U};
+    uint64 i_Byte{0U};
+
+    // compare 64-bit words (unaligned loads by memcpy)
+    for(; (i_Byte + 8U) <= DescriptorSize; i_Byte += 8U)
+    {
+        uint64 WordA{0U};
+        uint64 WordB{0U};
+
+        std::memcpy(&WordA, DescriptorA + i_Byte, 8U);
+        std::memcpy(&WordB, DescriptorB + i_Byte, 8U);
+
+        Distance += static_cast<uint64>(__builtin_popcountll(WordA ^ WordB));
+    }
+
+    // compare remaining bytes
+    for(; i_Byte < DescriptorSize; i_Byte++)
+    {
+        Distance += static_cast<uint64>(__builtin_popcount(static_cast<uint32>(DescriptorA[i_Byte] ^ DescriptorB[i_Byte])));
+    }
+
+    return Distance;
+}
+
+uint64 VocabularyTree::FindWord(const uint8* Descriptor,
+                                const uint64 DirectIndexLevel,
+                                uint64&      DirectIndexNode) const
+{
+    uint64 Node{0U};
+    uint64 Level{0U};
+
+    DirectIndexNode = 0U;
+
+    // descend to the closest child until a leaf is reached
+    while(m_NodeNumberOfChildren[Node] > 0U)
+    {
+        const uint64 FirstChild{m_NodeFirstChildren[Node]};
+        const uint64 LastChild{FirstChild + m_NodeNumberOfChildren[Node]};
+
+        uint64 DistanceBest{std::numeric_limits<uint64>::max()};
+
+        for(uint64 i_Child{FirstChild}; i_Child < LastChild; i_Child++)
+        {
+            const uint64 Distance{ComputeHammingDistance(Descriptor, &m_NodeDescriptors[i_Child * m_DescriptorSize], m_DescriptorSize)};
+
+            if(Distance < DistanceBest)
+            {
+                DistanceBest = Distance;
+                Node         = i_Child;
+            }
+        }
+
+        Level++;
+
+        if(Level <= DirectIndexLevel)
+        {
+            DirectIndexNode = Node;
+        }
+    }
+
+    return m_NodeWordIDs[Node];
+}
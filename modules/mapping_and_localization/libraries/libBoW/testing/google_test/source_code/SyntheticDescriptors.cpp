@@ -0,0 +1,105 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  SyntheticDescriptors.cpp
+///
+/// \brief Source file containing the creation of synthetic binary descriptors
+///        for the unit tests.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#include <random>
+
+#include "SyntheticDescriptors.h"
+
+cv::Mat CreateClusterCenters(const sint32 NumberOfClusters,
+                             const uint32 Seed)
+{
+    std::mt19937 RandomNumberEngine(Seed);
+
+    std::uniform_int_distribution<sint32> DistributionByte(0, 255);
+
+    cv::Mat Centers(NumberOfClusters, 32, CV_8U);
+
+    for(sint32 i_Cluster{0}; i_Cluster < NumberOfClusters; i_Cluster++)
+    {
+        for(sint32 i_Byte{0}; i_Byte < 32; i_Byte++)
+        {
+            Centers.at<uint8>(i_Cluster, i_Byte) = static_cast<uint8>(DistributionByte(RandomNumberEngine));
+        }
+    }
+
+    return Centers;
+}
+
+cv::Mat CreateNoisyDescriptors(const cv::Mat&    Centers,
+                               const ListUInt64& ClusterIndices,
+                               const uint64      NumberOfFlippedBits,
+                               const uint32      Seed)
+{
+    std::mt19937 RandomNumberEngine(Seed);
+
+    std::uniform_int_distribution<sint32> DistributionBit(0, 8 * Centers.cols - 1);
+
+    const sint32 NumberOfDescriptors{static_cast<sint32>(ClusterIndices.size())};
+
+    cv::Mat Descriptors(NumberOfDescriptors, Centers.cols, CV_8U);
+
+    for(sint32 i_Descriptor{0}; i_Descriptor < NumberOfDescriptors; i_Descriptor++)
+    {
+        Centers.row(static_cast<sint32>(ClusterIndices[static_cast<uint64>(i_Descriptor)])).copyTo(Descriptors.row(i_Descriptor));
+
+        for(uint64 i_Flip{0U}; i_Flip < NumberOfFlippedBits; i_Flip++)
+        {
+            const sint32 Bit{DistributionBit(RandomNumberEngine)};
+
+            Descriptors.at<uint8>(i_Descriptor, Bit / 8) = static_cast<uint8>(Descriptors.at<uint8>(i_Descriptor, Bit / 8) ^ (1U << (Bit % 8)));
+        }
+    }
+
+    return Descriptors;
+}
+
+std::vector<cv::Mat> CreateTrainingImages(const cv::Mat& Centers,
+                                          const uint64   NumberOfImages,
+                                          const uint32   Seed)
+{
+    const uint64 NumberOfClusters{static_cast<uint64>(Centers.rows)};
+
+    std::vector<cv::Mat> TrainingImages;
+
+    for(uint64 i_Image{0U}; i_Image < NumberOfImages; i_Image++)
+    {
+        ListUInt64 ClusterIndices;
+
+        for(uint64 i_Cluster{0U}; i_Cluster < NumberOfClusters; i_Cluster++)
+        {
+            if((i_Cluster % NumberOfImages) <= i_Image)
+            {
+                ClusterIndices.push_back(i_Cluster);
+                ClusterIndices.push_back(i_Cluster);
+            }
+        }
+
+        TrainingImages.push_back(CreateNoisyDescriptors(Centers, ClusterIndices, 4U, Seed + static_cast<uint32>(i_Image)));
+    }
+
+    return TrainingImages;
+}
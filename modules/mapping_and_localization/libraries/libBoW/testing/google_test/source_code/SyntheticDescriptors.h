@@ -0,0 +1,83 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  SyntheticDescriptors.h
+///
+/// \brief Header file containing the creation of synthetic binary descriptors
+///        for the unit tests.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#ifndef SYNTHETICDESCRIPTORS_H
+#define SYNTHETICDESCRIPTORS_H
+
+#include <vector>
+
+#include <opencv2/core/core.hpp>
+
+#include <GlobalTypesDerived.h>
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief     Creates random 256-bit cluster centers.
+///
+/// \param[in] NumberOfClusters Number of clusters.
+/// \param[in] Seed             Seed value of the random number engine.
+///
+/// \return    Cluster centers (one center per row).
+///////////////////////////////////////////////////////////////////////////////
+cv::Mat CreateClusterCenters(const sint32 NumberOfClusters,
+                             const uint32 Seed);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief     Creates noisy descriptors of given clusters.
+///
+/// Each descriptor is a copy of its cluster center with a few random bits
+/// flipped.
+///
+/// \param[in] Centers             Cluster centers (one center per row).
+/// \param[in] ClusterIndices      Cluster of each descriptor.
+/// \param[in] NumberOfFlippedBits Maximum number of flipped bits of each descriptor.
+/// \param[in] Seed                Seed value of the random number engine.
+///
+/// \return    Descriptors (one descriptor per row).
+///////////////////////////////////////////////////////////////////////////////
+cv::Mat CreateNoisyDescriptors(const cv::Mat&    Centers,
+                               const ListUInt64& ClusterIndices,
+                               const uint64      NumberOfFlippedBits,
+                               const uint32      Seed);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief     Creates the descriptors of training images.
+///
+/// Image i contains two noisy descriptors of each cluster c with
+/// (c % NumberOfImages) <= i, i.e. the clusters occur in a different number
+/// of images and their inverse document frequencies differ.
+///
+/// \param[in] Centers        Cluster centers (one center per row).
+/// \param[in] NumberOfImages Number of training images.
+/// \param[in] Seed           Seed value of the random number engine.
+///
+/// \return    Descriptors of each training image.
+///////////////////////////////////////////////////////////////////////////////
+std::vector<cv::Mat> CreateTrainingImages(const cv::Mat& Centers,
+                                          const uint64   NumberOfImages,
+                                          const uint32   Seed);
+
+#endif // SYNTHETICDESCRIPTORS_H
@@ -0,0 +1,225 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  Test_KeyframeDatabase.cpp
+///
+/// \brief Source file containing the unit tests for KeyframeDatabase.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#include <algorithm>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "../../../source_code/include/KeyframeDatabase.h"
+#include "SyntheticDescriptors.h"
+
+// definition of macros for the unit tests
+#define TEST_QUERY_TRAININGIMAGES_ISMATCHINGSCORE     TEST ///< Define to get a unique test name.
+#define TEST_DATABASE_UNTRAINEDVOCABULARY_ISTHROWING  TEST ///< Define to get a unique test name.
+#define TEST_ADDKEYFRAME_REJECTEDKEYFRAME_ISUNCHANGED TEST ///< Define to get a unique test name.
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the scores of the keyframes retrieved by a query.
+///
+/// Tests whether the scores accumulated from the inverted files match the
+/// scores of VocabularyTree::ComputeScore() or not. All training images are
+/// stored as keyframes and used as queries. The expectation is to retrieve
+/// all keyframes with a positive score in descending order of their scores,
+/// the query image itself with a score of one and the same ranking if the
+/// number of results is limited.
+///////////////////////////////////////////////////////////////////////////////
+TEST_QUERY_TRAININGIMAGES_ISMATCHINGSCORE(KeyframeDatabase, Test_Query_TrainingImages_IsMatchingScore)
+{
+    const uint64 NumberOfImages{8U};
+
+    const cv::Mat              Centers{CreateClusterCenters(64, 1U)};
+    const std::vector<cv::Mat> TrainingImages{CreateTrainingImages(Centers, NumberOfImages, 2U)};
+
+    VocabularyTree Vocabulary(4U, 3U, 10U, 3U);
+
+    Vocabulary.Train(TrainingImages);
+
+    KeyframeDatabase Database(Vocabulary);
+
+    std::vector<VocabularyTree::BoWVector>     BoWs(NumberOfImages);
+    std::vector<VocabularyTree::FeatureVector> Features(NumberOfImages);
+
+    for(uint64 i_Image{0U}; i_Image < NumberOfImages; i_Image++)
+    {
+        Vocabulary.Transform(TrainingImages[i_Image], 1U, BoWs[i_Image], Features[i_Image]);
+
+        ASSERT_EQ(Database.AddKeyframe(BoWs[i_Image], Features[i_Image]), i_Image);
+    }
+
+    ASSERT_EQ(Database.GetNumberOfKeyframes(), NumberOfImages);
+
+    for(uint64 i_Image{0U}; i_Image < NumberOfImages; i_Image++)
+    {
+        ASSERT_EQ(Database.GetFeatureVector(i_Image).NodeIDs, Features[i_Image].NodeIDs);
+        ASSERT_EQ(Database.GetFeatureVector(i_Image).FeatureIndices, Features[i_Image].FeatureIndices);
+    }
+
+    ASSERT_THROW(Database.GetFeatureVector(NumberOfImages), std::out_of_range);
+
+    // the first image contains only words which occur in all images (zero weights)
+    for(uint64 i_Image{1U}; i_Image < NumberOfImages; i_Image++)
+    {
+        ListUInt64  KeyframeIDs;
+        ListFloat64 Scores;
+
+        Database.Query(BoWs[i_Image], NumberOfImages, KeyframeIDs, Scores);
+
+        ASSERT_EQ(KeyframeIDs.size(), Scores.size());
+        ASSERT_FALSE(KeyframeIDs.empty());
+        ASSERT_NEAR(Scores[0], 1.0, 1e-12);
+        ASSERT_TRUE(std::is_sorted(Scores.rbegin(), Scores.rend()));
+        ASSERT_NE(std::find(KeyframeIDs.begin(), KeyframeIDs.end(), i_Image), KeyframeIDs.end());
+
+        for(uint64 i_Keyframe{0U}; i_Keyframe < NumberOfImages; i_Keyframe++)
+        {
+            const float64 ScoreExpected{VocabularyTree::ComputeScore(BoWs[i_Image], BoWs[i_Keyframe])};
+
+            const ListUInt64::const_iterator Result{std::find(KeyframeIDs.begin(), KeyframeIDs.end(), i_Keyframe)};
+
+            if(Result == KeyframeIDs.end())
+            {
+                ASSERT_NEAR(ScoreExpected, 0.0, 1e-12);
+            }
+            else
+            {
+                ASSERT_NEAR(Scores[static_cast<uint64>(Result - KeyframeIDs.begin())], ScoreExpected, 1e-12);
+            }
+        }
+
+        // a limited number of results keeps the best keyframes
+        ListUInt64  KeyframeIDsLimited;
+        ListFloat64 ScoresLimited;
+
+        Database.Query(BoWs[i_Image], 3U, KeyframeIDsLimited, ScoresLimited);
+
+        const uint64 NumberOfResults{std::min(KeyframeIDs.size(), static_cast<uint64>(3U))};
+
+        ASSERT_EQ(KeyframeIDsLimited, ListUInt64(KeyframeIDs.begin(), KeyframeIDs.begin() + static_cast<sint64>(NumberOfResults)));
+        ASSERT_EQ(ScoresLimited, ListFloat64(Scores.begin(), Scores.begin() + static_cast<sint64>(NumberOfResults)));
+    }
+
+    // no keyframes are retrieved after clearing the database
+    ListUInt64  KeyframeIDs;
+    ListFloat64 Scores;
+
+    Database.Clear();
+    Database.Query(BoWs[NumberOfImages - 1U], NumberOfImages, KeyframeIDs, Scores);
+
+    ASSERT_EQ(Database.GetNumberOfKeyframes(), 0U);
+    ASSERT_TRUE(KeyframeIDs.empty());
+    ASSERT_TRUE(Scores.empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the handling of an untrained vocabulary and of foreign
+///        bag-of-words vectors.
+///
+/// Tests whether a database based on an untrained vocabulary and bag-of-words
+/// vectors with words which are not part of the vocabulary are rejected or
+/// not. The expectation is to get an exception in each case.
+///////////////////////////////////////////////////////////////////////////////
+TEST_DATABASE_UNTRAINEDVOCABULARY_ISTHROWING(KeyframeDatabase, Test_Database_UntrainedVocabulary_IsThrowing)
+{
+    const VocabularyTree VocabularyUntrained;
+
+    ASSERT_THROW(KeyframeDatabase{VocabularyUntrained}, std::invalid_argument);
+
+    VocabularyTree Vocabulary(4U, 2U);
+
+    Vocabulary.Train(std::vector<cv::Mat>{CreateClusterCenters(16, 4U)});
+
+    KeyframeDatabase Database(Vocabulary);
+
+    VocabularyTree::BoWVector     BoW;
+    VocabularyTree::FeatureVector Features;
+    ListUInt64                    KeyframeIDs;
+    ListFloat64                   Scores;
+
+    BoW.WordIDs.push_back(Vocabulary.GetNumberOfWords());
+    BoW.WordWeights.push_back(1.0);
+
+    ASSERT_THROW(Database.AddKeyframe(BoW, Features), std::out_of_range);
+    ASSERT_THROW(Database.Query(BoW, 1U, KeyframeIDs, Scores), std::out_of_range);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the state of the database after a rejected keyframe.
+///
+/// Tests whether a keyframe whose bag-of-words vector contains a foreign word
+/// behind valid words or a different number of words and weights leaves the
+/// database unchanged or not. The expectation is that queries afterwards do
+/// not retrieve the rejected keyframe and that the next keyframe gets the
+/// first ID.
+///////////////////////////////////////////////////////////////////////////////
+TEST_ADDKEYFRAME_REJECTEDKEYFRAME_ISUNCHANGED(KeyframeDatabase, Test_AddKeyframe_RejectedKeyframe_IsUnchanged)
+{
+    VocabularyTree Vocabulary(4U, 2U);
+
+    Vocabulary.Train(std::vector<cv::Mat>{CreateClusterCenters(16, 4U)});
+
+    KeyframeDatabase Database(Vocabulary);
+
+    VocabularyTree::BoWVector     BoWValid;
+    VocabularyTree::FeatureVector Features;
+    ListUInt64                    KeyframeIDs;
+    ListFloat64                   Scores;
+
+    BoWValid.WordIDs     = {0U, 1U};
+    BoWValid.WordWeights = {0.5, 0.5};
+
+    // the foreign word follows valid words
+    VocabularyTree::BoWVector BoWForeignWord{BoWValid};
+
+    BoWForeignWord.WordIDs.push_back(Vocabulary.GetNumberOfWords());
+    BoWForeignWord.WordWeights.push_back(0.5);
+
+    ASSERT_THROW(Database.AddKeyframe(BoWForeignWord, Features), std::out_of_range);
+
+    // a weight is missing
+    VocabularyTree::BoWVector BoWMissingWeight{BoWValid};
+
+    BoWMissingWeight.WordWeights.pop_back();
+
+    ASSERT_THROW(Database.AddKeyframe(BoWMissingWeight, Features), std::invalid_argument);
+    ASSERT_THROW(Database.Query(BoWMissingWeight, 1U, KeyframeIDs, Scores), std::invalid_argument);
+
+    ASSERT_EQ(Database.GetNumberOfKeyframes(), 0U);
+
+    Database.Query(BoWValid, 10U, KeyframeIDs, Scores);
+
+    ASSERT_TRUE(KeyframeIDs.empty());
+    ASSERT_TRUE(Scores.empty());
+
+    // the next keyframe is the only one retrieved
+    ASSERT_EQ(Database.AddKeyframe(BoWValid, Features), 0U);
+
+    Database.Query(BoWValid, 10U, KeyframeIDs, Scores);
+
+    ASSERT_EQ(KeyframeIDs, ListUInt64({0U}));
+    ASSERT_EQ(Scores.size(), 1U);
+    ASSERT_NEAR(Scores[0], 1.0, 1e-12);
+}
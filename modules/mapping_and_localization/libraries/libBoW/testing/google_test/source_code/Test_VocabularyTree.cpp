@@ -0,0 +1,356 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  Test_VocabularyTree.cpp
+///
+/// \brief Source file containing the unit tests for VocabularyTree.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "../../../source_code/include/VocabularyTree.h"
+#include "SyntheticDescriptors.h"
+
+// definition of macros for the unit tests
+#define TEST_TRANSFORM_CLUSTEREDDESCRIPTORS_ISWEIGHTEDBYIDF      TEST ///< Define to get a unique test name.
+#define TEST_CORRESPONDENCES_ROOTLEVEL_ISMATCHINGBRUTEFORCE      TEST ///< Define to get a unique test name.
+#define TEST_CORRESPONDENCES_DIRECTINDEXLEVEL_ISMATCHINGCLUSTERS TEST ///< Define to get a unique test name.
+#define TEST_VOCABULARY_INVALIDINPUT_ISTHROWING                  TEST ///< Define to get a unique test name.
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief      Finds feature correspondences by brute force.
+///
+/// Each query descriptor is compared against all train descriptors (in
+/// ascending order). A match is accepted if it passes the ratio test and if no
+/// other query descriptor is closer to the same train descriptor.
+///
+/// \param[in]  QueryDescriptors Binary descriptors of the query image (one descriptor per row).
+/// \param[in]  TrainDescriptors Binary descriptors of the train image (one descriptor per row).
+/// \param[in]  RatioDistance    Ratio between first and second best distance to consider a match to be a good one.
+/// \param[out] Matches          Feature correspondences sorted by the train index.
+///////////////////////////////////////////////////////////////////////////////
+void FindCorrespondencesBruteForce(const cv::Mat&           QueryDescriptors,
+                                   const cv::Mat&           TrainDescriptors,
+                                   const float64            RatioDistance,
+                                   std::vector<cv::DMatch>& Matches)
+{
+    Matches.clear();
+
+    for(sint32 i_Query{0}; i_Query < QueryDescriptors.rows; i_Query++)
+    {
+        float64 DistanceBest{std::numeric_limits<float64>::max()};
+        float64 DistanceSecondBest{std::numeric_limits<float64>::max()};
+        sint32  IndexBest{0};
+
+        for(sint32 i_Train{0}; i_Train < TrainDescriptors.rows; i_Train++)
+        {
+            const float64 Distance{cv::norm(QueryDescriptors.row(i_Query), TrainDescriptors.row(i_Train), cv::NORM_HAMMING)};
+
+            if(Distance < DistanceBest)
+            {
+                DistanceSecondBest = DistanceBest;
+                DistanceBest       = Distance;
+                IndexBest          = i_Train;
+            }
+            else if(Distance < DistanceSecondBest)
+            {
+                DistanceSecondBest = Distance;
+            }
+        }
+
+        if(DistanceBest < (RatioDistance * DistanceSecondBest))
+        {
+            Matches.emplace_back(i_Query, IndexBest, static_cast<float32>(DistanceBest));
+        }
+    }
+
+    // keep the best match of each train descriptor
+    std::sort(Matches.begin(), Matches.end(), [](const cv::DMatch& MatchA, const cv::DMatch& MatchB) { return (MatchA.trainIdx < MatchB.trainIdx) || ((MatchA.trainIdx == MatchB.trainIdx) && (MatchA.distance < MatchB.distance)); });
+
+    Matches.erase(std::unique(Matches.begin(), Matches.end(), [](const cv::DMatch& MatchA, const cv::DMatch& MatchB) { return MatchA.trainIdx == MatchB.trainIdx; }), Matches.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the bag-of-words vectors of clustered descriptors.
+///
+/// Tests whether the bag-of-words vectors are weighted by the term frequency
+/// and the inverse document frequency of the training images or not. The
+/// document frequencies are counted from the bag-of-words vectors of the
+/// training images. The expectation is to get sorted words, a unit L1 norm,
+/// the expected TF-IDF weights and a complete direct index.
+///////////////////////////////////////////////////////////////////////////////
+TEST_TRANSFORM_CLUSTEREDDESCRIPTORS_ISWEIGHTEDBYIDF(VocabularyTree, Test_Transform_ClusteredDescriptors_IsWeightedByIDF)
+{
+    const uint64 NumberOfImages{8U};
+    const uint64 NumberOfClusters{64U};
+
+    const cv::Mat              Centers{CreateClusterCenters(static_cast<sint32>(NumberOfClusters), 1U)};
+    const std::vector<cv::Mat> TrainingImages{CreateTrainingImages(Centers, NumberOfImages, 2U)};
+
+    VocabularyTree Vocabulary(4U, 3U, 10U, 3U);
+
+    ASSERT_FALSE(Vocabulary.IsTrained());
+
+    Vocabulary.Train(TrainingImages);
+
+    const uint64 NumberOfWords{Vocabulary.GetNumberOfWords()};
+
+    ASSERT_TRUE(Vocabulary.IsTrained());
+    ASSERT_GT(NumberOfWords, 1U);
+    ASSERT_LE(NumberOfWords, 64U);
+    ASSERT_LE(Vocabulary.GetNumberOfNodes(), 1U + 4U + 16U + 64U);
+
+    // count the training images each word occurs in
+    ListUInt64 NumberOfImagesPerWord(NumberOfWords, 0U);
+
+    VocabularyTree::BoWVector     BoW;
+    VocabularyTree::FeatureVector Features;
+
+    for(const cv::Mat& TrainingImage : TrainingImages)
+    {
+        Vocabulary.Transform(TrainingImage, 0U, BoW, Features);
+
+        for(const uint64 WordID : BoW.WordIDs)
+        {
+            NumberOfImagesPerWord[WordID]++;
+        }
+    }
+
+    // each cluster occurs once in the query image
+    ListUInt64 ClusterIndices(NumberOfClusters);
+
+    for(uint64 i_Cluster{0U}; i_Cluster < NumberOfClusters; i_Cluster++)
+    {
+        ClusterIndices[i_Cluster] = i_Cluster;
+    }
+
+    const cv::Mat Descriptors{CreateNoisyDescriptors(Centers, ClusterIndices, 4U, 4U)};
+
+    // expected TF-IDF weights (the word of each descriptor is determined on its own)
+    ListFloat64 WeightsExpected(NumberOfWords, 0.0);
+    float64     SumOfWeights{0.0};
+
+    for(sint32 i_Descriptor{0}; i_Descriptor < Descriptors.rows; i_Descriptor++)
+    {
+        Vocabulary.Transform(Descriptors.row(i_Descriptor), 0U, BoW, Features);
+
+        ASSERT_EQ(BoW.WordIDs.size(), 1U);
+
+        const uint64  WordID{BoW.WordIDs[0]};
+        const float64 Weight{std::log(static_cast<float64>(NumberOfImages) / static_cast<float64>(std::max(NumberOfImagesPerWord[WordID], static_cast<uint64>(1U))))};
+
+        WeightsExpected[WordID] += Weight;
+        SumOfWeights += Weight;
+    }
+
+    ASSERT_GT(SumOfWeights, 0.0);
+
+    Vocabulary.Transform(Descriptors, 1U, BoW, Features);
+
+    ASSERT_EQ(BoW.WordIDs.size(), BoW.WordWeights.size());
+    ASSERT_TRUE(std::is_sorted(BoW.WordIDs.begin(), BoW.WordIDs.end()));
+    ASSERT_EQ(std::adjacent_find(BoW.WordIDs.begin(), BoW.WordIDs.end()), BoW.WordIDs.end());
+
+    float64 NormL1{0.0};
+
+    for(uint64 i_Word{0U}; i_Word < BoW.WordIDs.size(); i_Word++)
+    {
+        ASSERT_LT(BoW.WordIDs[i_Word], NumberOfWords);
+        ASSERT_NEAR(BoW.WordWeights[i_Word], WeightsExpected[BoW.WordIDs[i_Word]] / SumOfWeights, 1e-12);
+
+        NormL1 += std::abs(BoW.WordWeights[i_Word]);
+    }
+
+    ASSERT_NEAR(NormL1, 1.0, 1e-12);
+
+    // the direct index contains each feature exactly once (the children of the root node are the nodes 1 to 4)
+    ASSERT_EQ(Features.NodeIDs.size(), Features.FeatureIndices.size());
+    ASSERT_TRUE(std::is_sorted(Features.NodeIDs.begin(), Features.NodeIDs.end()));
+
+    ListUInt64 FeatureIndices;
+
+    for(uint64 i_Node{0U}; i_Node < Features.NodeIDs.size(); i_Node++)
+    {
+        ASSERT_GE(Features.NodeIDs[i_Node], 1U);
+        ASSERT_LE(Features.NodeIDs[i_Node], 4U);
+
+        FeatureIndices.insert(FeatureIndices.end(), Features.FeatureIndices[i_Node].begin(), Features.FeatureIndices[i_Node].end());
+    }
+
+    std::sort(FeatureIndices.begin(), FeatureIndices.end());
+
+    ASSERT_EQ(FeatureIndices, ClusterIndices);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the feature correspondences at the root level.
+///
+/// Tests whether the feature correspondences of a direct index at the root
+/// level (i.e. all features share the root node) match the brute force
+/// correspondences or not. Some clusters occur twice in the train image, i.e.
+/// their matches fail the ratio test. The expectation is to get the same
+/// matches as by brute force.
+///////////////////////////////////////////////////////////////////////////////
+TEST_CORRESPONDENCES_ROOTLEVEL_ISMATCHINGBRUTEFORCE(VocabularyTree, Test_Correspondences_RootLevel_IsMatchingBruteForce)
+{
+    const uint64 NumberOfClusters{64U};
+
+    const cv::Mat Centers{CreateClusterCenters(static_cast<sint32>(NumberOfClusters), 5U)};
+
+    VocabularyTree Vocabulary(4U, 3U, 10U, 6U);
+
+    Vocabulary.Train(CreateTrainingImages(Centers, 8U, 7U));
+
+    ListUInt64 ClusterIndicesQuery;
+    ListUInt64 ClusterIndicesTrain;
+
+    for(uint64 i_Cluster{0U}; i_Cluster < NumberOfClusters; i_Cluster++)
+    {
+        ClusterIndicesQuery.push_back(i_Cluster);
+        ClusterIndicesTrain.push_back(NumberOfClusters - 1U - i_Cluster);
+
+        if(i_Cluster < 16U)
+        {
+            ClusterIndicesTrain.push_back(i_Cluster);
+        }
+    }
+
+    const cv::Mat QueryDescriptors{CreateNoisyDescriptors(Centers, ClusterIndicesQuery, 6U, 8U)};
+    const cv::Mat TrainDescriptors{CreateNoisyDescriptors(Centers, ClusterIndicesTrain, 6U, 9U)};
+
+    VocabularyTree::BoWVector     QueryBoW;
+    VocabularyTree::BoWVector     TrainBoW;
+    VocabularyTree::FeatureVector QueryFeatures;
+    VocabularyTree::FeatureVector TrainFeatures;
+
+    Vocabulary.Transform(QueryDescriptors, 0U, QueryBoW, QueryFeatures);
+    Vocabulary.Transform(TrainDescriptors, 0U, TrainBoW, TrainFeatures);
+
+    ASSERT_EQ(QueryFeatures.NodeIDs, ListUInt64{0U});
+    ASSERT_EQ(TrainFeatures.NodeIDs, ListUInt64{0U});
+
+    std::vector<cv::DMatch> Matches;
+    std::vector<cv::DMatch> MatchesExpected;
+
+    VocabularyTree::FindCorrespondences(QueryDescriptors, QueryFeatures, TrainDescriptors, TrainFeatures, 0.8, Matches);
+    FindCorrespondencesBruteForce(QueryDescriptors, TrainDescriptors, 0.8, MatchesExpected);
+
+    ASSERT_GE(MatchesExpected.size(), NumberOfClusters / 2U);
+    ASSERT_EQ(Matches.size(), MatchesExpected.size());
+
+    for(uint64 i_Match{0U}; i_Match < Matches.size(); i_Match++)
+    {
+        ASSERT_EQ(Matches[i_Match].trainIdx, MatchesExpected[i_Match].trainIdx);
+        ASSERT_EQ(Matches[i_Match].distance, MatchesExpected[i_Match].distance);
+        ASSERT_EQ(static_cast<float64>(Matches[i_Match].distance), cv::norm(QueryDescriptors.row(Matches[i_Match].queryIdx), TrainDescriptors.row(Matches[i_Match].trainIdx), cv::NORM_HAMMING));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the feature correspondences at a deeper level of the
+///        direct index.
+///
+/// Tests whether the feature correspondences between two images of the same
+/// clusters are found if only features sharing a node at the second level
+/// are compared or not. The expectation is to find at least 90% of the
+/// clusters and no wrong matches.
+///////////////////////////////////////////////////////////////////////////////
+TEST_CORRESPONDENCES_DIRECTINDEXLEVEL_ISMATCHINGCLUSTERS(VocabularyTree, Test_Correspondences_DirectIndexLevel_IsMatchingClusters)
+{
+    const uint64 NumberOfClusters{64U};
+
+    const cv::Mat Centers{CreateClusterCenters(static_cast<sint32>(NumberOfClusters), 10U)};
+
+    VocabularyTree Vocabulary(4U, 3U, 10U, 11U);
+
+    Vocabulary.Train(CreateTrainingImages(Centers, 8U, 12U));
+
+    ListUInt64 ClusterIndicesQuery;
+    ListUInt64 ClusterIndicesTrain;
+
+    for(uint64 i_Cluster{0U}; i_Cluster < NumberOfClusters; i_Cluster++)
+    {
+        ClusterIndicesQuery.push_back(i_Cluster);
+        ClusterIndicesTrain.push_back(NumberOfClusters - 1U - i_Cluster);
+    }
+
+    const cv::Mat QueryDescriptors{CreateNoisyDescriptors(Centers, ClusterIndicesQuery, 4U, 13U)};
+    const cv::Mat TrainDescriptors{CreateNoisyDescriptors(Centers, ClusterIndicesTrain, 4U, 14U)};
+
+    VocabularyTree::BoWVector     QueryBoW;
+    VocabularyTree::BoWVector     TrainBoW;
+    VocabularyTree::FeatureVector QueryFeatures;
+    VocabularyTree::FeatureVector TrainFeatures;
+
+    Vocabulary.Transform(QueryDescriptors, 2U, QueryBoW, QueryFeatures);
+    Vocabulary.Transform(TrainDescriptors, 2U, TrainBoW, TrainFeatures);
+
+    ASSERT_GT(QueryFeatures.NodeIDs.size(), 4U);
+
+    std::vector<cv::DMatch> Matches;
+
+    VocabularyTree::FindCorrespondences(QueryDescriptors, QueryFeatures, TrainDescriptors, TrainFeatures, 0.8, Matches);
+
+    ASSERT_GE(10U * Matches.size(), 9U * NumberOfClusters);
+
+    for(const cv::DMatch& Match : Matches)
+    {
+        ASSERT_EQ(static_cast<uint64>(Match.trainIdx), NumberOfClusters - 1U - static_cast<uint64>(Match.queryIdx));
+        ASSERT_EQ(static_cast<float64>(Match.distance), cv::norm(QueryDescriptors.row(Match.queryIdx), TrainDescriptors.row(Match.trainIdx), cv::NORM_HAMMING));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the handling of invalid input.
+///
+/// Tests whether invalid parameters, invalid training descriptors and
+/// descriptors which do not match the vocabulary are rejected or not. The
+/// expectation is to get an exception in each case.
+///////////////////////////////////////////////////////////////////////////////
+TEST_VOCABULARY_INVALIDINPUT_ISTHROWING(VocabularyTree, Test_Vocabulary_InvalidInput_IsThrowing)
+{
+    const cv::Mat Centers{CreateClusterCenters(16, 15U)};
+    const cv::Mat DescriptorsShort{Centers.colRange(0, 16).clone()};
+
+    VocabularyTree::BoWVector     BoW;
+    VocabularyTree::FeatureVector Features;
+    std::vector<cv::DMatch>       Matches;
+
+    ASSERT_THROW(VocabularyTree(1U, 3U), std::invalid_argument);
+    ASSERT_THROW(VocabularyTree(4U, 0U), std::invalid_argument);
+
+    VocabularyTree Vocabulary(4U, 2U);
+
+    ASSERT_THROW(Vocabulary.Transform(Centers, 0U, BoW, Features), std::invalid_argument);
+    ASSERT_THROW(Vocabulary.Train(std::vector<cv::Mat>()), std::invalid_argument);
+    ASSERT_THROW(Vocabulary.Train(std::vector<cv::Mat>{Centers, DescriptorsShort}), std::invalid_argument);
+    ASSERT_FALSE(Vocabulary.IsTrained());
+
+    Vocabulary.Train(std::vector<cv::Mat>{Centers});
+
+    ASSERT_THROW(Vocabulary.Transform(DescriptorsShort, 0U, BoW, Features), std::invalid_argument);
+    ASSERT_THROW(VocabularyTree::FindCorrespondences(Centers, Features, DescriptorsShort, Features, 0.8, Matches), std::invalid_argument);
+}
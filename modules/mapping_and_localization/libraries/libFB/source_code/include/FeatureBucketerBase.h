@@ -103,6 +103,19 @@ public:
     ///////////////////////////////////////////////////////////////////////////////
     void BucketFeatures(const ListColumnVectorFloat64_2d& ImagePoints);
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Computes the bucket ID for a single feature.
+    ///
+    /// \param[in]  CoordinateImagePointHorizontal Horizontal position of the feature in the image.
+    /// \param[in]  CoordinateImagePointVertical   Vertical position of the feature in the image.
+    /// \param[out] BucketID                       ID of the bucket from top left to bottom right.
+    ///
+    /// \return     Flag whether the ID is valid or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    boolean ComputeBucketID(const float64 CoordinateImagePointHorizontal,
+                            const float64 CoordinateImagePointVertical,
+                            uint16&       BucketID) const;
+
     ///////////////////////////////////////////////////////////////////////////////
     /// \brief  Getter for the size of each bucket in horizontal direction.
     ///
@@ -117,6 +130,24 @@ public:
     ///////////////////////////////////////////////////////////////////////////////
     float64 GetBucketSizeVertical() const;
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Getter for the list of indices of the features inside a bucket.
+    ///
+    /// The features need to be bucketed before the indices are available.
+    ///
+    /// \param[in] BucketID ID of the bucket from top left to bottom right.
+    ///
+    /// \return    List of indices of the features inside the bucket.
+    ///////////////////////////////////////////////////////////////////////////////
+    const ListUInt64& GetFeatureIndicesInBucket(const uint16 BucketID) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the feature mask.
+    ///
+    /// \return Mask defining the buckets and the number of features in each bucket.
+    ///////////////////////////////////////////////////////////////////////////////
+    const MatrixUInt8& GetFeatureMask() const;
+
     ///////////////////////////////////////////////////////////////////////////////
     /// \brief  Getter for the number of buckets in horizontal direction.
     ///
@@ -185,19 +216,6 @@ protected:
     ///////////////////////////////////////////////////////////////////////////////
     virtual void BucketFeaturesWithScheme() = 0;
 
-    ///////////////////////////////////////////////////////////////////////////////
-    /// \brief      Computes the bucket ID for a single feature.
-    ///
-    /// \param[in]  CoordinateImagePointHorizontal Horizontal position of the feature in the image.
-    /// \param[in]  CoordinateImagePointVertical   Vertical position of the feature in the image.
-    /// \param[out] BucketID                       ID of the bucket from top left to bottom right.
-    ///
-    /// \return     Flag whether the ID is valid or not.
-    ///////////////////////////////////////////////////////////////////////////////
-    boolean ComputeBucketID(const float64 CoordinateImagePointHorizontal,
-                            const float64 CoordinateImagePointVertical,
-                            uint16&       BucketID) const;
-
     ///////////////////////////////////////////////////////////////////////////////
     /// \brief     Computes the bucket IDs for all features.
     ///
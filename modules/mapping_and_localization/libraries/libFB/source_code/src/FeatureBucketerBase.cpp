@@ -25,6 +25,9 @@ You should have received a copy of the GNU General Public License along with
 the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
 */
 
+#include <stdexcept>
+#include <string>
+
 #include "../include/FeatureBucketerBase.h"
 
 FeatureBucketerBase::FeatureBucketerBase(const uint64 NumberOfPixelsHorizontal,
@@ -82,6 +85,33 @@ void FeatureBucketerBase::BucketFeatures(const ListColumnVectorFloat64_2d& Image
     BucketFeaturesWithScheme();
 }
 
+boolean FeatureBucketerBase::ComputeBucketID(const float64 CoordinateImagePointHorizontal,
+                                             const float64 CoordinateImagePointVertical,
+                                             uint16&       BucketID) const
+{
+    // check whether the current feature is visible in the image or not
+    boolean BucketIDIsValid{false};
+
+    const boolean ImagePointIsVisibleHorizontal{((CoordinateImagePointHorizontal >= 0.0) && (CoordinateImagePointHorizontal < static_cast<float32>(m_NumberOfPixelsHorizontal)))};
+    const boolean ImagePointIsVisibleVertical{((CoordinateImagePointVertical >= 0.0) && (CoordinateImagePointVertical < static_cast<float32>(m_NumberOfPixelsVertical)))};
+
+    if(ImagePointIsVisibleHorizontal && ImagePointIsVisibleVertical)
+    {
+        // compute bucket IDs in horizontal and vertical direction
+        const uint8 BucketIDHorizontal{static_cast<uint8>(CoordinateImagePointHorizontal / m_BucketSizeHorizontal)};
+        const uint8 BucketIDVertical{static_cast<uint8>(CoordinateImagePointVertical / m_BucketSizeVertical)};
+
+        // compute bucket ID
+        BucketID = BucketIDVertical * m_NumberOfBucketsHorizontal + BucketIDHorizontal;
+
+        // make bucket ID valid
+        BucketIDIsValid = true;
+    }
+
+    // return whether the bucket ID is valid or not
+    return BucketIDIsValid;
+}
+
 float64 FeatureBucketerBase::GetBucketSizeHorizontal() const
 {
     return m_BucketSizeHorizontal;
@@ -92,6 +122,22 @@ float64 FeatureBucketerBase::GetBucketSizeVertical() const
     return m_BucketSizeVertical;
 }
 
+const ListUInt64& FeatureBucketerBase::GetFeatureIndicesInBucket(const uint16 BucketID) const
+{
+    // check if bucket ID is in range
+    if(BucketID >= m_FeatureIndices.size())
+    {
+        throw std::out_of_range("BucketID " + std::to_string(BucketID) + " is out of range.");
+    }
+
+    return m_FeatureIndices[BucketID];
+}
+
+const MatrixUInt8& FeatureBucketerBase::GetFeatureMask() const
+{
+    return m_FeatureMask;
+}
+
 uint8 FeatureBucketerBase::GetNumberOfBucketsHorizontal() const
 {
     return m_NumberOfBucketsHorizontal;
@@ -156,33 +202,6 @@ const ListUInt64& FeatureBucketerBase::GetSelectedIndices() const
     return m_SelectedIndices;
 }
 
-boolean FeatureBucketerBase::ComputeBucketID(const float64 CoordinateImagePointHorizontal,
-                                             const float64 CoordinateImagePointVertical,
-                                             uint16&       BucketID) const
-{
-    // check whether the current feature is visible in the image or not
-    boolean BucketIDIsValid{false};
-
-    const boolean ImagePointIsVisibleHorizontal{((CoordinateImagePointHorizontal >= 0.0) && (CoordinateImagePointHorizontal < static_cast<float32>(m_NumberOfPixelsHorizontal)))};
-    const boolean ImagePointIsVisibleVertical{((CoordinateImagePointVertical >= 0.0) && (CoordinateImagePointVertical < static_cast<float32>(m_NumberOfPixelsVertical)))};
-
-    if(ImagePointIsVisibleHorizontal && ImagePointIsVisibleVertical)
-    {
-        // compute bucket IDs in horizontal and vertical direction
-        const uint8 BucketIDHorizontal{static_cast<uint8>(CoordinateImagePointHorizontal / m_BucketSizeHorizontal)};
-        const uint8 BucketIDVertical{static_cast<uint8>(CoordinateImagePointVertical / m_BucketSizeVertical)};
-
-        // compute bucket ID
-        BucketID = BucketIDVertical * m_NumberOfBucketsHorizontal + BucketIDHorizontal;
-
-        // make bucket ID valid
-        BucketIDIsValid = true;
-    }
-
-    // return whether the bucket ID is valid or not
-    return BucketIDIsValid;
-}
-
 void FeatureBucketerBase::ComputeBucketIDs(const ListColumnVectorFloat64_2d& ImagePoints)
 {
     // get number of image points
@@ -30,12 +30,16 @@ the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
 #include "../../../source_code/include/FeatureBucketerByOrder.h"
 
 // definition of macros for the unit tests
+#define TEST_BUCKETID_450_150_BYORDER_ISMATCHING                             TEST ///< Define to get a unique test name.
+#define TEST_BUCKETID_OUTSIDEIMAGE_BYORDER_ISINVALID                         TEST ///< Define to get a unique test name.
 #define TEST_BUCKETSIZEHORIZONTAL_DEFAULTCONSTRUCTOR_BYORDER_ISMATCHING      TEST ///< Define to get a unique test name.
 #define TEST_BUCKETSIZEHORIZONTAL_80_BYORDER_ISMATCHING                      TEST ///< Define to get a unique test name.
 #define TEST_BUCKETSIZEHORIZONTAL_250_BYORDER_ISMATCHING                     TEST ///< Define to get a unique test name.
 #define TEST_BUCKETSIZEVERTICAL_DEFAULTCONSTRUCTOR_BYORDER_ISMATCHING        TEST ///< Define to get a unique test name.
 #define TEST_BUCKETSIZEVERTICAL_50_BYORDER_ISMATCHING                        TEST ///< Define to get a unique test name.
 #define TEST_BUCKETSIZEVERTICAL_300_BYORDER_ISMATCHING                       TEST ///< Define to get a unique test name.
+#define TEST_FEATUREINDICESINBUCKET_5_BYORDER_ISMATCHING                     TEST ///< Define to get a unique test name.
+#define TEST_FEATUREMASK_BYORDER_ISMATCHING                                  TEST ///< Define to get a unique test name.
 #define TEST_NUMBEROFBUCKETSHORIZONTAL_DEFAULTCONSTRUCTOR_BYORDER_ISMATCHING TEST ///< Define to get a unique test name.
 #define TEST_NUMBEROFBUCKETSHORIZONTAL_4_BYORDER_ISMATCHING                  TEST ///< Define to get a unique test name.
 #define TEST_NUMBEROFBUCKETSHORIZONTAL_10_BYORDER_ISMATCHING                 TEST ///< Define to get a unique test name.
@@ -53,6 +57,53 @@ the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
 #define TEST_REJECTEDFEATURE_0_BYORDER_ISMATCHING                            TEST ///< Define to get a unique test name.
 #define TEST_SELECTEDFEATURE_0_BYORDER_ISMATCHING                            TEST ///< Define to get a unique test name.
 
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the bucket ID of a single feature.
+///
+/// Tests whether the bucket ID of a feature does match the expected bucket ID
+/// or not. The expectation is to get the bucket in the fourth column of the
+/// second row.
+///////////////////////////////////////////////////////////////////////////////
+TEST_BUCKETID_450_150_BYORDER_ISMATCHING(FeatureBucketerByOrder, Test_BucketID_450_150_ByOrder_IsMatching)
+{
+    const uint64 NumberOfPixelsHorizontal{600U};
+    const uint64 NumberOfPixelsVertical{200U};
+    const uint8  NumberOfBucketsHorizontal{4U};
+    const uint8  NumberOfBucketsVertical{2U};
+    const uint16 BucketIDExpected{7U};
+
+    const FeatureBucketerByOrder Bucketer(NumberOfPixelsHorizontal, NumberOfPixelsVertical, NumberOfBucketsHorizontal, NumberOfBucketsVertical);
+
+    uint16 BucketID{0U};
+
+    const boolean BucketIDIsValid{Bucketer.ComputeBucketID(450.0, 150.0, BucketID)};
+
+    ASSERT_TRUE(BucketIDIsValid);
+    ASSERT_EQ(BucketID, BucketIDExpected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the bucket ID of a feature outside the image.
+///
+/// Tests whether the bucket ID of a feature outside the image is marked as
+/// invalid or not. The expectation is to get an invalid bucket ID.
+///////////////////////////////////////////////////////////////////////////////
+TEST_BUCKETID_OUTSIDEIMAGE_BYORDER_ISINVALID(FeatureBucketerByOrder, Test_BucketID_OutsideImage_ByOrder_IsInvalid)
+{
+    const uint64 NumberOfPixelsHorizontal{600U};
+    const uint64 NumberOfPixelsVertical{200U};
+    const uint8  NumberOfBucketsHorizontal{4U};
+    const uint8  NumberOfBucketsVertical{2U};
+
+    const FeatureBucketerByOrder Bucketer(NumberOfPixelsHorizontal, NumberOfPixelsVertical, NumberOfBucketsHorizontal, NumberOfBucketsVertical);
+
+    uint16 BucketID{0U};
+
+    const boolean BucketIDIsValid{Bucketer.ComputeBucketID(600.0, 150.0, BucketID)};
+
+    ASSERT_FALSE(BucketIDIsValid);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief Test for the bucket size in horizontal direction.
 ///
@@ -165,6 +216,83 @@ TEST_BUCKETSIZEVERTICAL_300_BYORDER_ISMATCHING(FeatureBucketerByOrder, Test_Buck
     ASSERT_DOUBLE_EQ(Bucketer.GetBucketSizeVertical(), BucketSizeVertical);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the feature indices inside a bucket.
+///
+/// Tests whether the indices of the features inside a bucket are matching the
+/// expected indices or not. Three features are placed in each bucket. Hence,
+/// the expectation is to get the indices 5, 13 and 21 for bucket 5.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FEATUREINDICESINBUCKET_5_BYORDER_ISMATCHING(FeatureBucketerByOrder, Test_FeatureIndicesInBucket_5_ByOrder_IsMatching)
+{
+    const uint64 NumberOfPixelsHorizontal{600U};
+    const uint64 NumberOfPixelsVertical{200U};
+    const uint8  NumberOfBucketsHorizontal{4U};
+    const uint8  NumberOfBucketsVertical{2U};
+    const uint64 MaximumNumberOfFeaturesPerBucket{2U};
+    const uint16 BucketID{5U};
+
+    FeatureBucketerByOrder Bucketer(NumberOfPixelsHorizontal, NumberOfPixelsVertical, NumberOfBucketsHorizontal, NumberOfBucketsVertical, MaximumNumberOfFeaturesPerBucket);
+
+    ListColumnVectorFloat64_2d ImagePoints;
+
+    const uint64  NumberOfFeaturesPerBucket{3U};
+    const float64 PixelOffset{2.0};
+    const float64 BucketSizeHorizontal{Bucketer.GetBucketSizeHorizontal()};
+    const float64 BucketSizeVertical{Bucketer.GetBucketSizeVertical()};
+
+    for(uint64 i_ImagePoint{0U}; i_ImagePoint < NumberOfFeaturesPerBucket; i_ImagePoint++)
+    {
+        for(uint8 i_Row{0U}; i_Row < NumberOfBucketsVertical; i_Row++)
+        {
+            const float64 CoordinateVertical{BucketSizeVertical * (0.5 + static_cast<float64>(i_Row)) + static_cast<float64>(i_ImagePoint) * PixelOffset};
+
+            for(uint8 i_Column{0U}; i_Column < NumberOfBucketsHorizontal; i_Column++)
+            {
+                const float64 CoordinateHorizontal{BucketSizeHorizontal * (0.5 + static_cast<float64>(i_Column)) + static_cast<float64>(i_ImagePoint) * PixelOffset};
+
+                const ColumnVectorFloat64_2d ImagePoint(CoordinateHorizontal, CoordinateVertical);
+
+                ImagePoints.push_back(ImagePoint);
+            }
+        }
+    }
+
+    Bucketer.BucketFeatures(ImagePoints);
+
+    const ListUInt64& FeatureIndices{Bucketer.GetFeatureIndicesInBucket(BucketID)};
+
+    ASSERT_EQ(FeatureIndices.size(), NumberOfFeaturesPerBucket);
+    ASSERT_EQ(FeatureIndices[0], 5U);
+    ASSERT_EQ(FeatureIndices[1], 13U);
+    ASSERT_EQ(FeatureIndices[2], 21U);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the feature mask.
+///
+/// Tests whether the feature mask does match the mask provided to the
+/// constructor or not.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FEATUREMASK_BYORDER_ISMATCHING(FeatureBucketerByOrder, Test_FeatureMask_ByOrder_IsMatching)
+{
+    const uint64 NumberOfPixelsHorizontal{1000U};
+    const uint64 NumberOfPixelsVertical{600U};
+    const uint8  NumberOfBucketsHorizontal{4U};
+    const uint8  NumberOfBucketsVertical{2U};
+
+    MatrixUInt8 FeatureMask(NumberOfBucketsVertical, NumberOfBucketsHorizontal);
+    FeatureMask << 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U;
+
+    const FeatureBucketerByOrder Bucketer(NumberOfPixelsHorizontal, NumberOfPixelsVertical, FeatureMask);
+
+    const MatrixUInt8& FeatureMaskBucketer{Bucketer.GetFeatureMask()};
+
+    ASSERT_EQ(FeatureMaskBucketer.rows(), NumberOfBucketsVertical);
+    ASSERT_EQ(FeatureMaskBucketer.cols(), NumberOfBucketsHorizontal);
+    ASSERT_TRUE(FeatureMaskBucketer == FeatureMask);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief Test for number of buckets in horizontal direction.
 ///
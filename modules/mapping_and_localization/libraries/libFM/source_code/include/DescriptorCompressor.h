@@ -0,0 +1,355 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  DescriptorCompressor.h
+///
+/// \brief Header file containing the DescriptorCompressor class.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#ifndef DESCRIPTORCOMPRESSOR_H
+#define DESCRIPTORCOMPRESSOR_H
+
+#include <opencv2/core/core.hpp>
+#include <opencv2/features2d/features2d.hpp>
+
+#include <GlobalTypesDerived.h>
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class DescriptorCompressor
+///
+/// \brief Class for matching floating point descriptors in a compressed
+///        domain.
+///
+/// The descriptors are projected onto a principal subspace learned from
+/// training descriptors and quantized to 8-bit signed integers. The
+/// candidates of each query descriptor are ranked by an integer dot product
+/// and only the best candidates are re-ranked by their exact Euclidean
+/// distance. The number of re-ranked candidates is tuned during the training
+/// such that the recall of the ratio test (w.r.t. exact matching) stays within
+/// the given tolerance.
+///
+/// The descriptors of an image can be compressed once (see Compress) and
+/// matched against several other images without compressing them again. The
+/// dot products of the common numbers of dimensions (16, 32, 64 and 128) are
+/// computed by kernels of fixed length.
+///
+/// The compressor is immutable after training, i.e. a trained instance can be
+/// used by several threads concurrently.
+///////////////////////////////////////////////////////////////////////////////
+class DescriptorCompressor
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \struct CompressedDescriptors
+    ///
+    /// \brief  Compressed descriptors of a set of floating point descriptors.
+    ///////////////////////////////////////////////////////////////////////////////
+    struct CompressedDescriptors
+    {
+        cv::Mat    Descriptors;  ///< Compressed descriptors (8-bit signed integers, one descriptor per row).
+        ListSInt64 SquaredNorms; ///< Squared norms of the compressed descriptors.
+    };
+
+protected:
+    const uint64     m_NumberOfDimensions;        ///< Number of dimensions of the compressed descriptors.
+    const float64    m_MaximumRecallLoss;         ///< Maximum loss of recall of the ratio test w.r.t. exact matching.
+    const uint64     m_MaximumNumberOfCandidates; ///< Maximum number of candidates which are re-ranked by their exact distance.
+    RowVectorFloat64 m_Mean;                      ///< Mean of the training descriptors.
+    MatrixFloat64    m_Projection;                ///< Projection onto the principal subspace (one principal component per column).
+    float64          m_QuantizationScale;         ///< Scale mapping the projected descriptors to 8-bit signed integers.
+    uint64           m_NumberOfCandidates;        ///< Number of candidates which are re-ranked by their exact distance.
+    float64          m_Recall;                    ///< Recall of the ratio test on the training descriptors.
+    boolean          m_IsTrained;                 ///< Flag whether the compressor is trained or not.
+
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Constructor.
+    ///
+    /// \param[in] NumberOfDimensions        Number of dimensions of the compressed descriptors.
+    /// \param[in] MaximumRecallLoss         Maximum loss of recall of the ratio test w.r.t. exact matching.
+    /// \param[in] MaximumNumberOfCandidates Maximum number of candidates which are re-ranked by their exact distance.
+    ///////////////////////////////////////////////////////////////////////////////
+    DescriptorCompressor(const uint64  NumberOfDimensions        = 64U,
+                         const float64 MaximumRecallLoss         = 0.02,
+                         const uint64  MaximumNumberOfCandidates = 64U);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor.
+    ///////////////////////////////////////////////////////////////////////////////
+    ~DescriptorCompressor();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Learns the principal subspace and the quantization from training
+    ///            descriptors.
+    ///
+    /// The first half of the training descriptors is matched against the second
+    /// half to tune the number of re-ranked candidates.
+    ///
+    /// \param[in] TrainingDescriptors Training descriptors (32-bit floating point, one descriptor per row).
+    /// \param[in] RatioDistance       Ratio between first and second best distance used for tuning.
+    ///////////////////////////////////////////////////////////////////////////////
+    void Train(const cv::Mat& TrainingDescriptors,
+               const float64  RatioDistance = 0.7);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Compresses descriptors.
+    ///
+    /// An exception is thrown if the compressor is not trained or if the layout
+    /// of the descriptors differs from the layout of the training descriptors.
+    ///
+    /// \param[in]  Descriptors           Descriptors (32-bit floating point, one descriptor per row).
+    /// \param[out] CompressedDescriptors Compressed descriptors (8-bit signed integers, one descriptor per row).
+    /// \param[out] SquaredNorms          Squared norms of the compressed descriptors.
+    ///////////////////////////////////////////////////////////////////////////////
+    void Compress(const cv::Mat& Descriptors,
+                  cv::Mat&       CompressedDescriptors,
+                  ListSInt64&    SquaredNorms) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Compresses descriptors.
+    ///
+    /// An exception is thrown if the compressor is not trained or if the layout
+    /// of the descriptors differs from the layout of the training descriptors.
+    ///
+    /// \param[in]  Descriptors Descriptors (32-bit floating point, one descriptor per row).
+    /// \param[out] Compressed  Compressed descriptors and their squared norms.
+    ///////////////////////////////////////////////////////////////////////////////
+    void Compress(const cv::Mat&         Descriptors,
+                  CompressedDescriptors& Compressed) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Finds the two best matches of each query descriptor.
+    ///
+    /// \param[in]  QueryDescriptors Query descriptors (one descriptor per row).
+    /// \param[in]  TrainDescriptors Train descriptors (one descriptor per row).
+    /// \param[out] Matches          Two best matches of each query descriptor (sorted by their exact distance).
+    ///////////////////////////////////////////////////////////////////////////////
+    void FindTwoBestMatches(const cv::Mat&                        QueryDescriptors,
+                            const cv::Mat&                        TrainDescriptors,
+                            std::vector<std::vector<cv::DMatch>>& Matches) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Finds the two best matches of each query descriptor using
+    ///             descriptors which are already compressed.
+    ///
+    /// An exception is thrown if the number of compressed descriptors differs
+    /// from the number of descriptors.
+    ///
+    /// \param[in]  QueryDescriptors           Query descriptors (one descriptor per row).
+    /// \param[in]  CompressedQueryDescriptors Compressed query descriptors (see Compress).
+    /// \param[in]  TrainDescriptors           Train descriptors (one descriptor per row).
+    /// \param[in]  CompressedTrainDescriptors Compressed train descriptors (see Compress).
+    /// \param[out] Matches                    Two best matches of each query descriptor (sorted by their exact distance).
+    ///////////////////////////////////////////////////////////////////////////////
+    void FindTwoBestMatches(const cv::Mat&                        QueryDescriptors,
+                            const CompressedDescriptors&          CompressedQueryDescriptors,
+                            const cv::Mat&                        TrainDescriptors,
+                            const CompressedDescriptors&          CompressedTrainDescriptors,
+                            std::vector<std::vector<cv::DMatch>>& Matches) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the number of dimensions of the compressed descriptors.
+    ///
+    /// \return Number of dimensions of the compressed descriptors.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 GetNumberOfDimensions() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the number of candidates which are re-ranked by their
+    ///         exact distance.
+    ///
+    /// \return Number of re-ranked candidates.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 GetNumberOfCandidates() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the recall of the ratio test on the training descriptors.
+    ///
+    /// \return Recall of the ratio test.
+    ///////////////////////////////////////////////////////////////////////////////
+    float64 GetRecall() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Checks whether two sets of descriptors can be matched by the
+    ///            compressor or not.
+    ///
+    /// \param[in] QueryDescriptors Query descriptors (one descriptor per row).
+    /// \param[in] TrainDescriptors Train descriptors (one descriptor per row).
+    ///
+    /// \return    Flag whether the descriptors can be matched by the compressor or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    boolean IsCompatible(const cv::Mat& QueryDescriptors,
+                         const cv::Mat& TrainDescriptors) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Checks whether the compressor is trained or not.
+    ///
+    /// \return Flag whether the compressor is trained or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    boolean IsTrained() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Computes the dot product of two compressed descriptors.
+    ///
+    /// The products are accumulated in 32-bit integers. The length is a compile
+    /// time constant and the integer sum can be reordered, hence the compiler can
+    /// vectorize the loop with the baseline instruction set of the target (e.g.
+    /// SSE2), no target specific flags are needed. Instantiated for 16, 32, 64
+    /// and 128 elements.
+    ///
+    /// \tparam    Length      Number of elements of the descriptors.
+    /// \param[in] DescriptorA First descriptor.
+    /// \param[in] DescriptorB Second descriptor.
+    ///
+    /// \return    Dot product.
+    ///////////////////////////////////////////////////////////////////////////////
+    template<uint64 Length>
+    static sint32 ComputeDotProduct(const sint8* DescriptorA,
+                                    const sint8* DescriptorB);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Computes the dot product of two compressed descriptors of any
+    ///            length.
+    ///
+    /// \param[in] DescriptorA First descriptor.
+    /// \param[in] DescriptorB Second descriptor.
+    /// \param[in] Length      Number of elements of the descriptors.
+    ///
+    /// \return    Dot product.
+    ///////////////////////////////////////////////////////////////////////////////
+    static sint32 ComputeDotProduct(const sint8* DescriptorA,
+                                    const sint8* DescriptorB,
+                                    const uint64 Length);
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Finds the two best matches of each query descriptor using a
+    ///             given number of re-ranked candidates.
+    ///
+    /// \param[in]  QueryDescriptors   Query descriptors (one descriptor per row).
+    /// \param[in]  TrainDescriptors   Train descriptors (one descriptor per row).
+    /// \param[in]  NumberOfCandidates Number of candidates which are re-ranked by their exact distance.
+    /// \param[out] Matches            Two best matches of each query descriptor (sorted by their exact distance).
+    ///////////////////////////////////////////////////////////////////////////////
+    void FindTwoBestMatches(const cv::Mat&                        QueryDescriptors,
+                            const cv::Mat&                        TrainDescriptors,
+                            const uint64                          NumberOfCandidates,
+                            std::vector<std::vector<cv::DMatch>>& Matches) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Finds the two best matches of each query descriptor using
+    ///             compressed descriptors and a given number of re-ranked
+    ///             candidates.
+    ///
+    /// \param[in]  QueryDescriptors           Query descriptors (one descriptor per row).
+    /// \param[in]  CompressedQueryDescriptors Compressed query descriptors.
+    /// \param[in]  TrainDescriptors           Train descriptors (one descriptor per row).
+    /// \param[in]  CompressedTrainDescriptors Compressed train descriptors.
+    /// \param[in]  NumberOfCandidates         Number of candidates which are re-ranked by their exact distance.
+    /// \param[out] Matches                    Two best matches of each query descriptor (sorted by their exact distance).
+    ///////////////////////////////////////////////////////////////////////////////
+    void FindTwoBestMatches(const cv::Mat&                        QueryDescriptors,
+                            const CompressedDescriptors&          CompressedQueryDescriptors,
+                            const cv::Mat&                        TrainDescriptors,
+                            const CompressedDescriptors&          CompressedTrainDescriptors,
+                            const uint64                          NumberOfCandidates,
+                            std::vector<std::vector<cv::DMatch>>& Matches) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Computes the approximate squared distances between a compressed
+    ///             query descriptor and all compressed train descriptors.
+    ///
+    /// The squared norm of the query descriptor is omitted, since it is the same
+    /// for all train descriptors.
+    ///
+    /// \tparam     Length                     Number of elements of the compressed descriptors.
+    /// \param[in]  CompressedQuery            Compressed query descriptor.
+    /// \param[in]  CompressedTrainDescriptors Compressed train descriptors.
+    /// \param[out] ApproximateDistances       Approximate squared distances to all train descriptors (the size defines the number of train descriptors).
+    ///////////////////////////////////////////////////////////////////////////////
+    template<uint64 Length>
+    static void ComputeApproximateDistances(const sint8*                 CompressedQuery,
+                                            const CompressedDescriptors& CompressedTrainDescriptors,
+                                            ListSInt64&                  ApproximateDistances);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Dispatches the computation of the approximate squared distances
+    ///             to the kernel of the number of dimensions.
+    ///
+    /// \param[in]  CompressedQuery            Compressed query descriptor.
+    /// \param[in]  CompressedTrainDescriptors Compressed train descriptors.
+    /// \param[out] ApproximateDistances       Approximate squared distances to all train descriptors (the size defines the number of train descriptors).
+    ///////////////////////////////////////////////////////////////////////////////
+    void ComputeApproximateDistances(const sint8*                 CompressedQuery,
+                                     const CompressedDescriptors& CompressedTrainDescriptors,
+                                     ListSInt64&                  ApproximateDistances) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Finds the two best matches of each query descriptor by their
+    ///             exact distance.
+    ///
+    /// \param[in]  QueryDescriptors Query descriptors (one descriptor per row).
+    /// \param[in]  TrainDescriptors Train descriptors (one descriptor per row).
+    /// \param[out] Matches          Two best matches of each query descriptor (sorted by their exact distance).
+    ///////////////////////////////////////////////////////////////////////////////
+    static void FindTwoBestMatchesExact(const cv::Mat&                        QueryDescriptors,
+                                        const cv::Mat&                        TrainDescriptors,
+                                        std::vector<std::vector<cv::DMatch>>& Matches);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Checks whether compressed descriptors belong to a set of
+    ///            descriptors or not.
+    ///
+    /// \param[in] Descriptors Descriptors (one descriptor per row).
+    /// \param[in] Compressed  Compressed descriptors.
+    ///
+    /// \return    Flag whether the compressed descriptors belong to the descriptors or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    boolean IsCompressionOf(const cv::Mat&               Descriptors,
+                            const CompressedDescriptors& Compressed) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Checks whether the two best matches pass the ratio test or not.
+    ///
+    /// \param[in] Matches       Two best matches (sorted by their distance).
+    /// \param[in] RatioDistance Ratio between first and second best distance to consider a match to be a good one.
+    ///
+    /// \return    Flag whether the matches pass the ratio test or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    static boolean PassesRatioTest(const std::vector<cv::DMatch>& Matches,
+                                   const float64                  RatioDistance);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Selects the two best candidates.
+    ///
+    /// \param[in]  QueryIndex         Row of the query descriptor.
+    /// \param[in]  CandidateIndices   Rows of the candidates in the train descriptors.
+    /// \param[in]  CandidateDistances Exact distances of the candidates.
+    /// \param[out] Matches            Two best matches of the query descriptor (sorted by their distance).
+    ///////////////////////////////////////////////////////////////////////////////
+    static void SelectTwoBestCandidates(const uint64             QueryIndex,
+                                        const ListUInt64&        CandidateIndices,
+                                        const ListFloat64&       CandidateDistances,
+                                        std::vector<cv::DMatch>& Matches);
+};
+
+#endif // DESCRIPTORCOMPRESSOR_H
@@ -0,0 +1,296 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  DescriptorDistance.h
+///
+/// \brief Header file containing the DescriptorDistance class.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#ifndef DESCRIPTORDISTANCE_H
+#define DESCRIPTORDISTANCE_H
+
+#include <opencv2/core/core.hpp>
+
+#include <GlobalTypesDerived.h>
+
+///////////////////////////////////////////////////////////////////////////////
+/// \enum  DescriptorKernel
+///
+/// \brief Defines the kernel used to compute the distance between descriptors.
+///////////////////////////////////////////////////////////////////////////////
+enum DescriptorKernel
+{
+    KernelGeneric,   ///< Unknown descriptor layout (distances are computed by OpenCV).
+    KernelBinary256, ///< 256-bit binary descriptors (e.g. ORB) compared by the Hamming distance.
+    KernelBinary512, ///< 512-bit binary descriptors (e.g. BRISK) compared by the Hamming distance.
+    KernelFloat64,   ///< 64-dimensional floating point descriptors (e.g. SURF) compared by the Euclidean distance.
+    KernelFloat128   ///< 128-dimensional floating point descriptors (e.g. SIFT) compared by the Euclidean distance.
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \struct DescriptorKernelTraits
+///
+/// \brief  Traits defining the descriptor layout of a distance kernel.
+///
+/// \tparam Kernel Kernel whose descriptor layout is defined.
+///////////////////////////////////////////////////////////////////////////////
+template<DescriptorKernel Kernel>
+struct DescriptorKernelTraits;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \struct DescriptorKernelTraits<KernelBinary256>
+///
+/// \brief  Traits of the kernel for 256-bit binary descriptors.
+///////////////////////////////////////////////////////////////////////////////
+template<>
+struct DescriptorKernelTraits<KernelBinary256>
+{
+    using ElementType = uint8;                     ///< Type of the descriptor elements.
+    static constexpr uint64  NumberOfElements{32U}; ///< Number of elements of each descriptor.
+    static constexpr boolean IsBinary{true};        ///< Flag whether the descriptors are compared by the Hamming distance (Euclidean distance otherwise).
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \struct DescriptorKernelTraits<KernelBinary512>
+///
+/// \brief  Traits of the kernel for 512-bit binary descriptors.
+///////////////////////////////////////////////////////////////////////////////
+template<>
+struct DescriptorKernelTraits<KernelBinary512>
+{
+    using ElementType = uint8;                     ///< Type of the descriptor elements.
+    static constexpr uint64  NumberOfElements{64U}; ///< Number of elements of each descriptor.
+    static constexpr boolean IsBinary{true};        ///< Flag whether the descriptors are compared by the Hamming distance (Euclidean distance otherwise).
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \struct DescriptorKernelTraits<KernelFloat64>
+///
+/// \brief  Traits of the kernel for 64-dimensional floating point descriptors.
+///////////////////////////////////////////////////////////////////////////////
+template<>
+struct DescriptorKernelTraits<KernelFloat64>
+{
+    using ElementType = float32;                   ///< Type of the descriptor elements.
+    static constexpr uint64  NumberOfElements{64U}; ///< Number of elements of each descriptor.
+    static constexpr boolean IsBinary{false};       ///< Flag whether the descriptors are compared by the Hamming distance (Euclidean distance otherwise).
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \struct DescriptorKernelTraits<KernelFloat128>
+///
+/// \brief  Traits of the kernel for 128-dimensional floating point descriptors.
+///////////////////////////////////////////////////////////////////////////////
+template<>
+struct DescriptorKernelTraits<KernelFloat128>
+{
+    using ElementType = float32;                    ///< Type of the descriptor elements.
+    static constexpr uint64  NumberOfElements{128U}; ///< Number of elements of each descriptor.
+    static constexpr boolean IsBinary{false};        ///< Flag whether the descriptors are compared by the Hamming distance (Euclidean distance otherwise).
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class DescriptorDistance
+///
+/// \brief Class providing fixed-width distance kernels for feature descriptors.
+///
+/// There is one kernel per metric, the descriptor width is a template
+/// parameter taken from the traits of the kernel (see DescriptorKernelTraits).
+/// Hence, the loops have a constant trip count and are unrolled by the
+/// compiler. The Hamming kernels compare 64-bit words, the Euclidean kernels
+/// accumulate the squared differences in order (the reduction is not
+/// vectorized, since this would require reassociation, e.g. -ffast-math). The
+/// kernel is selected once for a set of descriptors and applied to a whole
+/// row of distances, i.e. there is no dispatch for each comparison.
+/// Descriptors which do not match any of the kernels are compared by
+/// cv::norm().
+///////////////////////////////////////////////////////////////////////////////
+class DescriptorDistance
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Selects the kernel for a set of descriptors.
+    ///
+    /// \param[in] Descriptors Descriptors (one descriptor per row).
+    /// \param[in] NormType    Norm used to compare the descriptors (e.g. cv::NORM_HAMMING).
+    ///
+    /// \return    Kernel for the descriptors.
+    ///////////////////////////////////////////////////////////////////////////////
+    static DescriptorKernel SelectKernel(const cv::Mat& Descriptors,
+                                         const sint32   NormType);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Selects the kernel for comparing two sets of descriptors.
+    ///
+    /// \param[in] QueryDescriptors Query descriptors (one descriptor per row).
+    /// \param[in] TrainDescriptors Train descriptors (one descriptor per row).
+    /// \param[in] NormType         Norm used to compare the descriptors (e.g. cv::NORM_HAMMING).
+    ///
+    /// \return    Kernel for the descriptors (generic kernel if the layouts of both sets differ).
+    ///////////////////////////////////////////////////////////////////////////////
+    static DescriptorKernel SelectKernel(const cv::Mat& QueryDescriptors,
+                                         const cv::Mat& TrainDescriptors,
+                                         const sint32   NormType);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Computes the distances between a query descriptor and all
+    ///             train descriptors.
+    ///
+    /// \param[in]  QueryDescriptors Query descriptors (one descriptor per row).
+    /// \param[in]  QueryIndex       Row of the query descriptor.
+    /// \param[in]  TrainDescriptors Train descriptors (one descriptor per row).
+    /// \param[in]  Kernel           Kernel used to compute the distances.
+    /// \param[in]  NormType         Norm used to compare the descriptors (only used by the generic kernel).
+    /// \param[out] Distances        Distances to all train descriptors.
+    ///////////////////////////////////////////////////////////////////////////////
+    static void ComputeDistances(const cv::Mat&         QueryDescriptors,
+                                 const uint64           QueryIndex,
+                                 const cv::Mat&         TrainDescriptors,
+                                 const DescriptorKernel Kernel,
+                                 const sint32           NormType,
+                                 ListFloat64&           Distances);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Computes the distances between a query descriptor and a subset
+    ///             of the train descriptors.
+    ///
+    /// \param[in]  QueryDescriptors Query descriptors (one descriptor per row).
+    /// \param[in]  QueryIndex       Row of the query descriptor.
+    /// \param[in]  TrainDescriptors Train descriptors (one descriptor per row).
+    /// \param[in]  TrainIndices     Rows of the train descriptors which shall be compared.
+    /// \param[in]  Kernel           Kernel used to compute the distances.
+    /// \param[in]  NormType         Norm used to compare the descriptors (only used by the generic kernel).
+    /// \param[out] Distances        Distances to the selected train descriptors.
+    ///////////////////////////////////////////////////////////////////////////////
+    static void ComputeDistances(const cv::Mat&         QueryDescriptors,
+                                 const uint64           QueryIndex,
+                                 const cv::Mat&         TrainDescriptors,
+                                 const ListUInt64&      TrainIndices,
+                                 const DescriptorKernel Kernel,
+                                 const sint32           NormType,
+                                 ListFloat64&           Distances);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Computes the Hamming distance between two binary descriptors.
+    ///
+    /// Instantiated for 32 and 64 bytes (256-bit and 512-bit descriptors).
+    ///
+    /// \tparam    NumberOfBytes Number of bytes of each descriptor (multiple of 8).
+    /// \param[in] DescriptorA   First descriptor.
+    /// \param[in] DescriptorB   Second descriptor.
+    ///
+    /// \return    Hamming distance.
+    ///////////////////////////////////////////////////////////////////////////////
+    template<uint64 NumberOfBytes>
+    static uint32 ComputeHammingDistance(const uint8* DescriptorA,
+                                         const uint8* DescriptorB);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Computes the Euclidean distance between two floating point
+    ///            descriptors.
+    ///
+    /// Instantiated for 64 and 128 elements.
+    ///
+    /// \tparam    NumberOfElements Number of elements of each descriptor.
+    /// \param[in] DescriptorA      First descriptor.
+    /// \param[in] DescriptorB      Second descriptor.
+    ///
+    /// \return    Euclidean distance.
+    ///////////////////////////////////////////////////////////////////////////////
+    template<uint64 NumberOfElements>
+    static float64 ComputeEuclideanDistance(const float32* DescriptorA,
+                                            const float32* DescriptorB);
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Computes the distance between two descriptors using a kernel.
+    ///
+    /// \tparam    Kernel      Kernel used to compute the distance.
+    /// \param[in] DescriptorA First descriptor.
+    /// \param[in] DescriptorB Second descriptor.
+    ///
+    /// \return    Distance.
+    ///////////////////////////////////////////////////////////////////////////////
+    template<DescriptorKernel Kernel>
+    static float64 ComputeDistance(const typename DescriptorKernelTraits<Kernel>::ElementType* DescriptorA,
+                                   const typename DescriptorKernelTraits<Kernel>::ElementType* DescriptorB);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Computes the distances between a query descriptor and train
+    ///             descriptors using a kernel.
+    ///
+    /// \tparam     Kernel            Kernel used to compute the distances.
+    /// \tparam     TrainRowSelector  Callable mapping the index of a distance to the row of the train descriptor.
+    /// \param[in]  QueryDescriptors  Query descriptors (one descriptor per row).
+    /// \param[in]  QueryIndex        Row of the query descriptor.
+    /// \param[in]  TrainDescriptors  Train descriptors (one descriptor per row).
+    /// \param[in]  SelectTrainRow    Selector of the train rows.
+    /// \param[out] Distances         Distances to the selected train descriptors (the size defines the number of distances).
+    ///////////////////////////////////////////////////////////////////////////////
+    template<DescriptorKernel Kernel, typename TrainRowSelector>
+    static void ComputeDistances(const cv::Mat&          QueryDescriptors,
+                                 const uint64            QueryIndex,
+                                 const cv::Mat&          TrainDescriptors,
+                                 const TrainRowSelector& SelectTrainRow,
+                                 ListFloat64&            Distances);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Dispatches the computation of distances to the kernel.
+    ///
+    /// \tparam     TrainRowSelector Callable mapping the index of a distance to the row of the train descriptor.
+    /// \param[in]  QueryDescriptors Query descriptors (one descriptor per row).
+    /// \param[in]  QueryIndex       Row of the query descriptor.
+    /// \param[in]  TrainDescriptors Train descriptors (one descriptor per row).
+    /// \param[in]  SelectTrainRow   Selector of the train rows.
+    /// \param[in]  Kernel           Kernel used to compute the distances.
+    /// \param[in]  NormType         Norm used to compare the descriptors (only used by the generic kernel).
+    /// \param[out] Distances        Distances to the selected train descriptors (the size defines the number of distances).
+    ///////////////////////////////////////////////////////////////////////////////
+    template<typename TrainRowSelector>
+    static void DispatchDistances(const cv::Mat&          QueryDescriptors,
+                                  const uint64            QueryIndex,
+                                  const cv::Mat&          TrainDescriptors,
+                                  const TrainRowSelector& SelectTrainRow,
+                                  const DescriptorKernel  Kernel,
+                                  const sint32            NormType,
+                                  ListFloat64&            Distances);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Computes the number of set bits in a 64-bit word.
+    ///
+    /// \param[in] Word Word whose bits shall be counted.
+    ///
+    /// \return    Number of set bits.
+    ///////////////////////////////////////////////////////////////////////////////
+    static uint32 CountBits(const uint64 Word);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Loads a 64-bit word from an unaligned address.
+    ///
+    /// \param[in] Address Address of the word.
+    ///
+    /// \return    Loaded word.
+    ///////////////////////////////////////////////////////////////////////////////
+    static uint64 LoadWord(const uint8* Address);
+};
+
+#endif // DESCRIPTORDISTANCE_H
@@ -28,28 +28,187 @@ the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
 #ifndef FEATUREMATCHER_H
 #define FEATUREMATCHER_H
 
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+
 #include <opencv2/core/core.hpp>
 #include <opencv2/features2d/features2d.hpp>
 
 #include <GlobalTypesDerived.h>
 
+#include "../../../libFB/source_code/include/FeatureBucketerByOrder.h"
+#include "DescriptorCompressor.h"
+#include "DescriptorDistance.h"
+
 ///////////////////////////////////////////////////////////////////////////////
 /// \class FeatureMatcher
 ///
 /// \brief Class for creating feature correspondences between images.
+///
+/// The configuration of the feature matcher is immutable after construction
+/// and all methods are const. Hence, a single instance can be used by several
+/// threads concurrently. The OpenCV objects (which are not thread-safe) are
+/// leased from a pool: each call takes a set of resources (a detector and a
+/// clone of the descriptor matcher) from the pool or creates a new one, and
+/// returns it to the pool afterwards. The pool grows to the number of threads
+/// using the instance concurrently.
+///
+/// The resources also contain the scratch buffers of the matching (features,
+/// descriptors, feature chains, candidates and matches), which keep their
+/// capacity across calls. Hence, the chaining of the features and the windowed
+/// and stereo matching do not allocate any working memory once the buffers
+/// have grown to the size of the images. The state of the
+/// bucketed feature extraction (the adapted FAST thresholds) belongs to an
+/// image stream instead of a thread, hence it is owned by the caller.
+///
+/// Detectors can only be created per thread if a factory for the detector is
+/// provided. Otherwise, all threads share the same detector and the access to
+/// it is serialized.
+///
+/// The default configuration matches the descriptors by fixed-width distance
+/// kernels which are selected once per call based on the layout of the
+/// descriptors (see DescriptorDistance). A brute force matcher provided by the
+/// caller is only replaced by the kernels on request, any other descriptor
+/// matcher is used as it is for the chained matching (generic fallback). The
+/// windowed and the stereo matching compare each feature with its candidates
+/// directly, either by the kernels or by cv::norm(). In both cases, the norm of
+/// a brute force matcher is used (the default norm of the detector for any
+/// other descriptor matcher).
+/// Floating point descriptors can optionally be matched in a compressed domain
+/// (see DescriptorCompressor).
+///
+/// Per-stage statistics (timings and counts) can be collected for each call
+/// of FindCorrespondences. The collection is only compiled in if
+/// FM_COLLECT_STATISTICS is defined (CMake option OPTION_COLLECT_STATISTICS),
+/// otherwise the statistics stay empty and the calls pay nothing.
 ///////////////////////////////////////////////////////////////////////////////
 class FeatureMatcher
 {
+public:
+    using FeatureDetectorFactory = std::function<cv::Ptr<cv::Feature2D>()>; ///< Alias for factories creating feature detectors.
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \struct Statistics
+    ///
+    /// \brief  Per-stage statistics of a single call of FindCorrespondences.
+    ///
+    /// The image pairs are the pairs of consecutive images, the last pair closes
+    /// the chains with the first image. All times are in milliseconds.
+    ///////////////////////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        ListFloat64 DetectionTimes;           ///< Time needed to detect the features in each image.
+        ListFloat64 DescriptionTimes;         ///< Time needed to calculate the descriptors in each image.
+        ListUInt64  NumberOfFeatures;         ///< Number of features extracted in each image.
+        ListFloat64 MatchingTimes;            ///< Time needed to match the features of each image pair.
+        ListUInt64  NumberOfCandidates;       ///< Number of feature chains matched in each image pair.
+        ListUInt64  NumberOfGoodMatches;      ///< Number of matches passing the ratio test in each image pair.
+        uint64      NumberOfClosedChains{0U}; ///< Number of feature chains closed by the last image pair.
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \struct BucketedDetectionState
+    ///
+    /// \brief  State of the bucketed feature extraction of a single image stream.
+    ///
+    /// The FAST threshold of each bucket is adapted from image to image, hence
+    /// each image stream (e.g. each camera) needs its own state. The thresholds
+    /// are initialized on the first image and whenever the bucket layout or the
+    /// initial threshold changes. A state must not be used by several threads
+    /// concurrently.
+    ///////////////////////////////////////////////////////////////////////////////
+    struct BucketedDetectionState
+    {
+        std::vector<uint8> BucketThresholds;     ///< FAST thresholds of all buckets (empty before the first image).
+        uint8              InitialThreshold{0U}; ///< FAST threshold used to initialize the thresholds of the buckets.
+    };
+
 protected:
-    cv::Ptr<cv::Feature2D> m_FeatureDetector;         ///< Detector for the features and extractor for the descriptors.
-    cv::DescriptorMatcher* m_DescriptorMatcher;       ///< Matcher for the feature descriptors.
-    float64                m_RatioDistance;           ///< Ratio between first and second best distance to consider a match to be a good one.
-    boolean                m_ParametersSetInternally; ///< Flag defining whether the class members have been set internally or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \struct MatchingResources
+    ///
+    /// \brief  Resources which are used by a single thread at a time.
+    ///////////////////////////////////////////////////////////////////////////////
+    struct MatchingResources
+    {
+        cv::Ptr<cv::Feature2D>                                   FeatureDetector;              ///< Detector for the features and extractor for the descriptors (empty if the shared detector is used).
+        cv::Ptr<cv::DescriptorMatcher>                           DescriptorMatcher;            ///< Matcher for the feature descriptors.
+        std::vector<std::vector<cv::KeyPoint>>                   FeaturesInBuckets;            ///< Features detected in each bucket.
+        std::vector<std::vector<cv::KeyPoint>>                   ExtractedFeatures;            ///< Features extracted in all images of the current call.
+        std::vector<cv::Mat>                                     FeatureDescriptors;           ///< Descriptors of the features extracted in all images of the current call.
+        std::vector<ListUInt64>                                  FeatureChains;                ///< Feature indices of the chains in all images of the current call.
+        cv::Mat                                                  QueryDescriptors;             ///< Descriptors of the current chain ends (only the first rows up to the number of chains are valid).
+        std::vector<DescriptorCompressor::CompressedDescriptors> CompressedFeatureDescriptors; ///< Compressed descriptors of all images of the current call (only valid for images matched by the compressor).
+        DescriptorCompressor::CompressedDescriptors              CompressedQueryDescriptors;   ///< Compressed descriptors of the current chain ends (view of the first rows of the buffer).
+        cv::Mat                                                  CompressedQueryBuffer;        ///< Buffer for the compressed descriptors of the chain ends.
+        std::vector<cv::DMatch>                                  TwoBestMatches;               ///< Two best matches of each chain end (flat, two entries per chain end).
+        std::vector<std::vector<cv::DMatch>>                     KnnMatches;                   ///< Matches of the descriptor matcher and the compressor (nested layout of OpenCV).
+        ListFloat64                                              Distances;                    ///< Distances of a query descriptor to all train descriptors.
+        ListUInt64                                               BestMatchesQuery;             ///< Best match of each query feature of the windowed matching (each left feature of the stereo matching).
+        ListFloat64                                              BestDistancesQuery;           ///< Distance of the best match of each query feature of the windowed matching.
+        ListUInt64                                               BestMatchesTarget;            ///< Best match of each target feature of the windowed matching (each right feature of the stereo matching).
+        ListFloat64                                              BestDistancesTarget;          ///< Distance of the best match of each target feature of the windowed matching (each right feature of the stereo matching).
+        ListUInt64                                               CandidateIndices;             ///< Candidates of the current feature of the windowed and the stereo matching.
+        ListFloat64                                              CandidateDistances;           ///< Distances of the current feature to its candidates.
+        std::vector<ListUInt64>                                  RowIndex;                     ///< Features of the right image of the stereo matching indexed by their rows.
+        Statistics*                                              CallStatistics{nullptr};      ///< Statistics of the current call (nullptr if no statistics shall be collected).
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \class ResourceLease
+    ///
+    /// \brief Lease of matching resources from the pool.
+    ///
+    /// The resources are taken from the pool on construction and are returned to
+    /// the pool on destruction of the lease.
+    ///////////////////////////////////////////////////////////////////////////////
+    class ResourceLease
+    {
+    protected:
+        const FeatureMatcher&              m_FeatureMatcher; ///< Feature matcher owning the pool.
+        std::unique_ptr<MatchingResources> m_Resources;      ///< Leased resources.
+
+    public:
+        ///////////////////////////////////////////////////////////////////////////////
+        /// \brief     Constructor.
+        ///
+        /// \param[in] Matcher Feature matcher owning the pool.
+        ///////////////////////////////////////////////////////////////////////////////
+        explicit ResourceLease(const FeatureMatcher& Matcher);
+
+        ///////////////////////////////////////////////////////////////////////////////
+        /// \brief Destructor.
+        ///////////////////////////////////////////////////////////////////////////////
+        ~ResourceLease();
+
+        ///////////////////////////////////////////////////////////////////////////////
+        /// \brief  Getter for the leased resources.
+        ///
+        /// \return Leased resources.
+        ///////////////////////////////////////////////////////////////////////////////
+        MatchingResources& GetResources() const;
+    };
+
+    const FeatureDetectorFactory                            m_FeatureDetectorFactory; ///< Factory creating a detector for each set of resources (empty if the shared detector is used).
+    const cv::Ptr<cv::Feature2D>                            m_FeatureDetector;        ///< Shared detector for the features and extractor for the descriptors.
+    const cv::Ptr<cv::DescriptorMatcher>                    m_DescriptorMatcher;      ///< Matcher for the feature descriptors (prototype which is cloned for each set of resources).
+    const sint32                                            m_NormType;               ///< Norm used to compare the descriptors (norm of the brute force matcher, default norm of the detector otherwise).
+    const float64                                           m_RatioDistance;          ///< Ratio between first and second best distance to consider a match to be a good one.
+    const boolean                                           m_UseDescriptorKernels;   ///< Flag whether the descriptors are matched by the fixed-width distance kernels or by the descriptor matcher.
+    const DescriptorCompressor*                             m_DescriptorCompressor;   ///< Compressor used to match floating point descriptors (nullptr if the descriptors shall not be compressed).
+    mutable std::mutex                                      m_FeatureDetectorMutex;   ///< Mutex serializing the access to the shared detector.
+    mutable std::mutex                                      m_ResourcePoolMutex;      ///< Mutex protecting the pool of resources.
+    mutable std::vector<std::unique_ptr<MatchingResources>> m_ResourcePool;           ///< Pool of resources which are currently not leased.
 
 public:
     ///////////////////////////////////////////////////////////////////////////////
     /// \brief     Constructor.
     ///
+    /// An ORB detector is created for each set of resources and the descriptors
+    /// are matched by brute force (using the Hamming distance kernels).
+    ///
     /// \param[in] RatioDistance Ratio between first and second best distance to consider a match to be a good one.
     ///////////////////////////////////////////////////////////////////////////////
     FeatureMatcher(const float64 RatioDistance = 0.7);
@@ -57,29 +216,730 @@ public:
     ///////////////////////////////////////////////////////////////////////////////
     /// \brief     Constructor.
     ///
-    /// \param[in] FeatureDetector   Detector for the features and extractor for the descriptors.
-    /// \param[in] DescriptorMatcher Matcher for the feature descriptors.
-    /// \param[in] RatioDistance     Ratio between first and second best distance to consider a match to be a good one.
+    /// All threads share the given detector, i.e. the access to the detector is
+    /// serialized. The distance kernels can only replace a brute force matcher,
+    /// an exception is thrown for any other type of descriptor matcher. The
+    /// kernels and the windowed and stereo matching use the norm of the matcher.
+    ///
+    /// \param[in] FeatureDetector      Detector for the features and extractor for the descriptors.
+    /// \param[in] DescriptorMatcher    Matcher for the feature descriptors.
+    /// \param[in] RatioDistance        Ratio between first and second best distance to consider a match to be a good one.
+    /// \param[in] Compressor           Trained compressor used to match floating point descriptors (nullptr if the descriptors shall not be compressed).
+    /// \param[in] UseDescriptorKernels Flag whether the brute force matcher shall be replaced by the fixed-width distance kernels or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    FeatureMatcher(const cv::Ptr<cv::Feature2D>&         FeatureDetector,
+                   const cv::Ptr<cv::DescriptorMatcher>& DescriptorMatcher,
+                   const float64                         RatioDistance        = 0.7,
+                   const DescriptorCompressor*           Compressor           = nullptr,
+                   const boolean                         UseDescriptorKernels = false);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Constructor.
+    ///
+    /// A detector is created by the factory for each set of resources, i.e. the
+    /// threads do not share a detector. The distance kernels can only replace a
+    /// brute force matcher, an exception is thrown for any other type of
+    /// descriptor matcher. The kernels and the windowed and stereo matching use
+    /// the norm of the matcher.
+    ///
+    /// \param[in] DetectorFactory      Factory creating detectors for the features and extractors for the descriptors.
+    /// \param[in] DescriptorMatcher    Matcher for the feature descriptors.
+    /// \param[in] RatioDistance        Ratio between first and second best distance to consider a match to be a good one.
+    /// \param[in] Compressor           Trained compressor used to match floating point descriptors (nullptr if the descriptors shall not be compressed).
+    /// \param[in] UseDescriptorKernels Flag whether the brute force matcher shall be replaced by the fixed-width distance kernels or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    FeatureMatcher(const FeatureDetectorFactory&         DetectorFactory,
+                   const cv::Ptr<cv::DescriptorMatcher>& DescriptorMatcher,
+                   const float64                         RatioDistance        = 0.7,
+                   const DescriptorCompressor*           Compressor           = nullptr,
+                   const boolean                         UseDescriptorKernels = false);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor (deleted, a raw pointer to the detector would be
+    ///        owned by the matcher without notice).
+    ///////////////////////////////////////////////////////////////////////////////
+    FeatureMatcher(cv::Feature2D*                        FeatureDetector,
+                   const cv::Ptr<cv::DescriptorMatcher>& DescriptorMatcher,
+                   const float64                         RatioDistance        = 0.7,
+                   const DescriptorCompressor*           Compressor           = nullptr,
+                   const boolean                         UseDescriptorKernels = false) = delete;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor (deleted, a raw pointer to the descriptor matcher
+    ///        would be owned by the matcher without notice).
     ///////////////////////////////////////////////////////////////////////////////
     FeatureMatcher(const cv::Ptr<cv::Feature2D>& FeatureDetector,
                    cv::DescriptorMatcher*        DescriptorMatcher,
-                   const float64                 RatioDistance = 0.7);
+                   const float64                 RatioDistance        = 0.7,
+                   const DescriptorCompressor*   Compressor           = nullptr,
+                   const boolean                 UseDescriptorKernels = false) = delete;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor (deleted, a raw pointer to the descriptor matcher
+    ///        would be owned by the matcher without notice).
+    ///////////////////////////////////////////////////////////////////////////////
+    FeatureMatcher(const FeatureDetectorFactory& DetectorFactory,
+                   cv::DescriptorMatcher*        DescriptorMatcher,
+                   const float64                 RatioDistance        = 0.7,
+                   const DescriptorCompressor*   Compressor           = nullptr,
+                   const boolean                 UseDescriptorKernels = false) = delete;
 
     ///////////////////////////////////////////////////////////////////////////////
     /// \brief Destructor.
     ///////////////////////////////////////////////////////////////////////////////
     ~FeatureMatcher();
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Creates a grid index of target features for the windowed
+    ///            matching.
+    ///
+    /// The cells of the uniform grid are at least as large as the cell size (at
+    /// most 255 cells in each direction). An exception is thrown if the cell size
+    /// is not positive.
+    ///
+    /// \param[in] ExtractedFeaturesTarget  Features extracted in the target image.
+    /// \param[in] NumberOfPixelsHorizontal Number of pixels of the target image in horizontal direction.
+    /// \param[in] NumberOfPixelsVertical   Number of pixels of the target image in vertical direction.
+    /// \param[in] CellSize                 Minimum size of the grid cells (in pixels, typically the search radius).
+    ///
+    /// \return    Grid index containing the target features.
+    ///////////////////////////////////////////////////////////////////////////////
+    static FeatureBucketerByOrder CreateGridIndex(const std::vector<cv::KeyPoint>& ExtractedFeaturesTarget,
+                                                  const uint64                     NumberOfPixelsHorizontal,
+                                                  const uint64                     NumberOfPixelsVertical,
+                                                  const float64                    CellSize);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Extract features and calculate their descriptors.
+    ///
+    /// \param[in]  Image              Image where the features shall be extracted.
+    /// \param[out] ExtractedFeatures  Features extracted in the image.
+    /// \param[out] FeatureDescriptors Descriptors of the extracted features.
+    ///////////////////////////////////////////////////////////////////////////////
+    void ExtractFeatures(const cv::Mat&             Image,
+                         std::vector<cv::KeyPoint>& ExtractedFeatures,
+                         cv::Mat&                   FeatureDescriptors) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief         Extract bucketed features and calculate their descriptors.
+    ///
+    /// A FAST (or AGAST) detector is applied to each bucket of the feature
+    /// bucketer separately (in parallel), using the FAST threshold of the bucket.
+    /// The detector has to be a FAST, AGAST or ORB detector (std::invalid_argument
+    /// is thrown otherwise). For ORB, only its FAST stage is applied to the
+    /// buckets, i.e. the features are detected at full resolution only, their
+    /// orientations are computed by the intensity centroid (like ORB does) and
+    /// the detector computes the descriptors. The threshold of each bucket is
+    /// adapted from image to image such that the bucket yields roughly the
+    /// number of features defined by the feature mask. If a bucket yields less
+    /// features, the detection is repeated with the minimum threshold. Only the
+    /// strongest features of each bucket are kept and the descriptors are
+    /// calculated for these features only. An exception is thrown if the
+    /// minimum threshold is larger than the initial threshold.
+    ///
+    /// \param[in]     Image              Image where the features shall be extracted.
+    /// \param[in]     Bucketer           Feature bucketer defining the buckets and the number of features in each bucket.
+    /// \param[in,out] State              State of the bucketed extraction of the image stream the image belongs to.
+    /// \param[out]    ExtractedFeatures  Features extracted in the image.
+    /// \param[out]    FeatureDescriptors Descriptors of the extracted features.
+    /// \param[in]     InitialThreshold   FAST threshold used for the first image.
+    /// \param[in]     MinimumThreshold   Lowest FAST threshold used for buckets with too few features.
+    ///////////////////////////////////////////////////////////////////////////////
+    void ExtractFeatures(const cv::Mat&             Image,
+                         const FeatureBucketerBase& Bucketer,
+                         BucketedDetectionState&    State,
+                         std::vector<cv::KeyPoint>& ExtractedFeatures,
+                         cv::Mat&                   FeatureDescriptors,
+                         const uint8                InitialThreshold = 20U,
+                         const uint8                MinimumThreshold = 5U) const;
+
     ///////////////////////////////////////////////////////////////////////////////
     /// \brief      Find feature correspondences in the images.
     ///
     /// \param[in]  Images                 List of images where feature correspondences shall be found.
     /// \param[out] FeatureCorrespondences Image coordinate of the feature correspondences in all images.
+    /// \param[out] CallStatistics         Statistics of the call (nullptr if no statistics shall be collected).
     ///
     /// \return     Number of feature correspondences found.
     ///////////////////////////////////////////////////////////////////////////////
     uint64 FindCorrespondences(const std::vector<cv::Mat>&              Images,
-                               std::vector<ListColumnVectorFloat64_2d>& FeatureCorrespondences);
+                               std::vector<ListColumnVectorFloat64_2d>& FeatureCorrespondences,
+                               Statistics*                              CallStatistics = nullptr) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief         Find feature correspondences in the images using bucketed
+    ///                features.
+    ///
+    /// Each image belongs to its own image stream, i.e. the i-th image is
+    /// extracted using the i-th state (e.g. the states of the left and right
+    /// camera at the current and the previous time step). The list of states
+    /// is resized to the number of images.
+    ///
+    /// \param[in]     Images                 List of images where feature correspondences shall be found.
+    /// \param[in]     Bucketer               Feature bucketer defining the buckets and the number of features in each bucket.
+    /// \param[in,out] States                 States of the bucketed extraction of the image streams (one per image).
+    /// \param[out]    FeatureCorrespondences Image coordinate of the feature correspondences in all images.
+    /// \param[in]     InitialThreshold       FAST threshold used for the first image.
+    /// \param[in]     MinimumThreshold       Lowest FAST threshold used for buckets with too few features.
+    /// \param[out]    CallStatistics         Statistics of the call (nullptr if no statistics shall be collected).
+    ///
+    /// \return        Number of feature correspondences found.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 FindCorrespondences(const std::vector<cv::Mat>&              Images,
+                               const FeatureBucketerBase&               Bucketer,
+                               std::vector<BucketedDetectionState>&     States,
+                               std::vector<ListColumnVectorFloat64_2d>& FeatureCorrespondences,
+                               const uint8                              InitialThreshold = 20U,
+                               const uint8                              MinimumThreshold = 5U,
+                               Statistics*                              CallStatistics   = nullptr) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Find feature correspondences in the images (structure-of-arrays
+    ///             output with single precision).
+    ///
+    /// The image coordinates of each image are stored in a 2xN matrix, i.e. the
+    /// i-th column of all matrices belongs to the i-th feature correspondence.
+    /// The output is allocated once and filled in a single pass.
+    ///
+    /// \param[in]  Images                 List of images where feature correspondences shall be found.
+    /// \param[out] FeatureCorrespondences Image coordinates of the feature correspondences in all images (one 2xN matrix per image).
+    /// \param[out] FeatureIndices         Indices of the corresponding features in all images (one row per image, one column per feature correspondence).
+    /// \param[out] CallStatistics         Statistics of the call (nullptr if no statistics shall be collected).
+    ///
+    /// \return     Number of feature correspondences found.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 FindCorrespondences(const std::vector<cv::Mat>& Images,
+                               ListMatrixFloat32_2xX&      FeatureCorrespondences,
+                               MatrixUInt64&               FeatureIndices,
+                               Statistics*                 CallStatistics = nullptr) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Find feature correspondences in the images (structure-of-arrays
+    ///             output with double precision).
+    ///
+    /// The image coordinates of each image are stored in a 2xN matrix, i.e. the
+    /// i-th column of all matrices belongs to the i-th feature correspondence.
+    /// The output is allocated once and filled in a single pass.
+    ///
+    /// \param[in]  Images                 List of images where feature correspondences shall be found.
+    /// \param[out] FeatureCorrespondences Image coordinates of the feature correspondences in all images (one 2xN matrix per image).
+    /// \param[out] FeatureIndices         Indices of the corresponding features in all images (one row per image, one column per feature correspondence).
+    /// \param[out] CallStatistics         Statistics of the call (nullptr if no statistics shall be collected).
+    ///
+    /// \return     Number of feature correspondences found.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 FindCorrespondences(const std::vector<cv::Mat>& Images,
+                               ListMatrixFloat64_2xX&      FeatureCorrespondences,
+                               MatrixUInt64&               FeatureIndices,
+                               Statistics*                 CallStatistics = nullptr) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Find feature correspondences inside a search window.
+    ///
+    /// Each query feature is only compared against the target features which are
+    /// inside a circular search window around its predicted position (e.g. from
+    /// a motion prior or a constant velocity model). The target features are
+    /// indexed by a uniform grid (using the bucket IDs of a feature bucketer)
+    /// whose cells are as large as the search radius, i.e. the matching cost
+    /// depends on the local feature density only. A feature
+    /// correspondence is only accepted if it passes the ratio test and if no
+    /// other query feature matches the target feature better. A query feature
+    /// with a single candidate cannot be checked by the ratio test, hence its
+    /// match is only accepted if single candidates are accepted explicitly.
+    ///
+    /// The grid index is created on each call, which costs a pass over the target
+    /// features and an allocation per grid cell. For repeated queries against
+    /// the same target image, the grid index should be created once (see
+    /// CreateGridIndex) and passed to the overload taking the grid index. An
+    /// exception is thrown if the search radius is not positive or if the number
+    /// of descriptors does not match the number of predicted image points or
+    /// target features. Query features without a finite prediction are skipped.
+    ///
+    /// \param[in]  FeatureDescriptorsQuery  Descriptors of the query features.
+    /// \param[in]  PredictedImagePoints     Predicted positions of the query features in the target image.
+    /// \param[in]  ExtractedFeaturesTarget  Features extracted in the target image.
+    /// \param[in]  FeatureDescriptorsTarget Descriptors of the features extracted in the target image.
+    /// \param[in]  NumberOfPixelsHorizontal Number of pixels of the target image in horizontal direction.
+    /// \param[in]  NumberOfPixelsVertical   Number of pixels of the target image in vertical direction.
+    /// \param[in]  SearchRadius             Radius of the search window around the predicted positions (in pixels).
+    /// \param[out] Matches                  Matches between the query features and the target features.
+    /// \param[in]  AcceptSingleCandidates   Flag whether the matches of query features with a single candidate are accepted or not.
+    ///
+    /// \return     Number of feature correspondences found.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 FindCorrespondencesInWindow(const cv::Mat&                    FeatureDescriptorsQuery,
+                                       const ListColumnVectorFloat64_2d& PredictedImagePoints,
+                                       const std::vector<cv::KeyPoint>&  ExtractedFeaturesTarget,
+                                       const cv::Mat&                    FeatureDescriptorsTarget,
+                                       const uint64                      NumberOfPixelsHorizontal,
+                                       const uint64                      NumberOfPixelsVertical,
+                                       const float64                     SearchRadius,
+                                       std::vector<cv::DMatch>&          Matches,
+                                       const boolean                     AcceptSingleCandidates = false) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Find feature correspondences inside a search window using a
+    ///             prebuilt grid index.
+    ///
+    /// Same as the overload without grid index, but the grid index of the target
+    /// features is provided by the caller (see CreateGridIndex). The grid index
+    /// must have bucketed exactly the target features (in the same order). The
+    /// search radius does not need to match the cell size of the grid index. An
+    /// exception is thrown if the search radius is not positive, if the number of
+    /// descriptors does not match the number of predicted image points or target
+    /// features or if the grid index contains an index beyond the target
+    /// features. Query features without a finite prediction are skipped.
+    ///
+    /// \param[in]  FeatureDescriptorsQuery  Descriptors of the query features.
+    /// \param[in]  PredictedImagePoints     Predicted positions of the query features in the target image.
+    /// \param[in]  ExtractedFeaturesTarget  Features extracted in the target image.
+    /// \param[in]  FeatureDescriptorsTarget Descriptors of the features extracted in the target image.
+    /// \param[in]  GridIndex                Grid index containing the target features.
+    /// \param[in]  SearchRadius             Radius of the search window around the predicted positions (in pixels).
+    /// \param[out] Matches                  Matches between the query features and the target features.
+    /// \param[in]  AcceptSingleCandidates   Flag whether the matches of query features with a single candidate are accepted or not.
+    ///
+    /// \return     Number of feature correspondences found.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 FindCorrespondencesInWindow(const cv::Mat&                    FeatureDescriptorsQuery,
+                                       const ListColumnVectorFloat64_2d& PredictedImagePoints,
+                                       const std::vector<cv::KeyPoint>&  ExtractedFeaturesTarget,
+                                       const cv::Mat&                    FeatureDescriptorsTarget,
+                                       const FeatureBucketerBase&        GridIndex,
+                                       const float64                     SearchRadius,
+                                       std::vector<cv::DMatch>&          Matches,
+                                       const boolean                     AcceptSingleCandidates = false) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Find feature correspondences in a rectified stereo image pair.
+    ///
+    /// The features of the right image are indexed by their row. Each feature of
+    /// the left image is only compared against the features of the right image
+    /// which are inside a band of rows around its own row and inside the valid
+    /// disparity range. A feature correspondence is only accepted if it passes
+    /// the ratio test and if both features are the best match of each other. A
+    /// feature of the left image with a single candidate cannot be checked by
+    /// the ratio test, hence its match is only accepted if single candidates
+    /// are accepted explicitly. An exception is thrown if the maximum row
+    /// distance or the maximum disparity is negative.
+    ///
+    /// \param[in]  ImageStereoLeft                   Left image of the rectified stereo image pair.
+    /// \param[in]  ImageStereoRight                  Right image of the rectified stereo image pair.
+    /// \param[out] FeatureCorrespondencesStereoLeft  Image coordinates of the feature correspondences in the left image.
+    /// \param[out] FeatureCorrespondencesStereoRight Image coordinates of the feature correspondences in the right image.
+    /// \param[in]  MaximumRowDistance                Maximum distance between the rows of corresponding features (in pixels).
+    /// \param[in]  MaximumDisparity                  Maximum disparity of corresponding features (in pixels).
+    /// \param[in]  AcceptSingleCandidates            Flag whether the matches of features with a single candidate are accepted or not.
+    ///
+    /// \return     Number of feature correspondences found.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 FindCorrespondencesStereo(const cv::Mat&              ImageStereoLeft,
+                                     const cv::Mat&              ImageStereoRight,
+                                     ListColumnVectorFloat64_2d& FeatureCorrespondencesStereoLeft,
+                                     ListColumnVectorFloat64_2d& FeatureCorrespondencesStereoRight,
+                                     const float64               MaximumRowDistance     = 2.0,
+                                     const float64               MaximumDisparity       = 128.0,
+                                     const boolean               AcceptSingleCandidates = false) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Match the features of the images.
+    ///
+    /// The features of the first image are matched against the features of the
+    /// second image, the surviving ones against the third image and so on. A
+    /// feature correspondence is only accepted if all matches pass the ratio
+    /// test and if the chain of matches is closed by the last image pair.
+    ///
+    /// \param[in]  ExtractedFeatures      Features extracted in all images.
+    /// \param[in]  FeatureDescriptors     Descriptors of the features extracted in all images.
+    /// \param[out] FeatureCorrespondences Image coordinate of the feature correspondences in all images.
+    ///
+    /// \return     Number of feature correspondences found.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 MatchFeatures(const std::vector<std::vector<cv::KeyPoint>>& ExtractedFeatures,
+                         const std::vector<cv::Mat>&                   FeatureDescriptors,
+                         std::vector<ListColumnVectorFloat64_2d>&      FeatureCorrespondences) const;
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Gets the detector which shall be used with the resources.
+    ///
+    /// If the resources do not contain an own detector, the shared detector is
+    /// returned and locked until the lock is released.
+    ///
+    /// \param[in]  Resources Leased resources.
+    /// \param[out] Lock      Lock of the shared detector (not locked if the resources contain an own detector).
+    ///
+    /// \return     Detector for the features and extractor for the descriptors.
+    ///////////////////////////////////////////////////////////////////////////////
+    cv::Feature2D& AccessFeatureDetector(MatchingResources&            Resources,
+                                         std::unique_lock<std::mutex>& Lock) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Takes a set of resources from the pool (or creates a new one if the
+    ///         pool is empty).
+    ///
+    /// \return Set of resources.
+    ///////////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<MatchingResources> AcquireResources() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Attaches the statistics of a call to the leased resources.
+    ///
+    /// The statistics are cleared and the lists are pre-allocated for the given
+    /// number of images. The statistics are detached when the resources are
+    /// returned to the pool.
+    ///
+    /// \param[in]  NumberOfImages Number of images of the call.
+    /// \param[in]  Resources      Leased resources.
+    /// \param[out] CallStatistics Statistics of the call (nullptr if no statistics shall be collected).
+    ///////////////////////////////////////////////////////////////////////////////
+    static void AttachStatistics(const uint64       NumberOfImages,
+                                 MatchingResources& Resources,
+                                 Statistics*        CallStatistics);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Chains the features of the images.
+    ///
+    /// The features of the first image are matched against the features of the
+    /// second image, the surviving ones against the third image and so on. A
+    /// feature chain is only kept if all matches pass the ratio test and if the
+    /// chain is closed by the last image pair.
+    ///
+    /// \param[in]  FeatureDescriptors Descriptors of the features extracted in all images.
+    /// \param[in]  Resources          Leased resources.
+    /// \param[out] FeatureChains      Feature indices of the chains in all images (only the first entries up to the number of chains are valid).
+    ///
+    /// \return     Number of feature chains found.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 ChainFeatures(const std::vector<cv::Mat>& FeatureDescriptors,
+                         MatchingResources&          Resources,
+                         std::vector<ListUInt64>&    FeatureChains) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Checks whether the distance kernels can replace the descriptor
+    ///        matcher or not.
+    ///
+    /// An exception is thrown if the kernels are requested for a descriptor
+    /// matcher which is not a brute force matcher.
+    ///////////////////////////////////////////////////////////////////////////////
+    void CheckDescriptorKernels() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Determines the norm used to compare the descriptors.
+    ///
+    /// \param[in] DescriptorMatcher Matcher for the feature descriptors.
+    /// \param[in] FeatureDetector   Detector for the features and extractor for the descriptors.
+    ///
+    /// \return    Norm of the matcher if it is a brute force matcher, default norm of the detector otherwise.
+    ///////////////////////////////////////////////////////////////////////////////
+    static sint32 DetermineNormType(const cv::Ptr<cv::DescriptorMatcher>& DescriptorMatcher,
+                                    const cv::Ptr<cv::Feature2D>&         FeatureDetector);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Collects the feature correspondences from the feature chains.
+    ///
+    /// \param[in]  ExtractedFeatures      Features extracted in all images.
+    /// \param[in]  FeatureChains          Feature indices of the chains in all images.
+    /// \param[in]  NumberOfChains         Number of feature chains.
+    /// \param[out] FeatureCorrespondences Image coordinate of the feature correspondences in all images.
+    ///////////////////////////////////////////////////////////////////////////////
+    static void CollectFeatureCorrespondences(const std::vector<std::vector<cv::KeyPoint>>& ExtractedFeatures,
+                                              const std::vector<ListUInt64>&                FeatureChains,
+                                              const uint64                                  NumberOfChains,
+                                              std::vector<ListColumnVectorFloat64_2d>&      FeatureCorrespondences);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Collects the feature correspondences from the feature chains
+    ///             into matrices.
+    ///
+    /// \tparam     ListMatrix2xX          List of 2xN matrices (single or double precision).
+    /// \param[in]  ExtractedFeatures      Features extracted in all images.
+    /// \param[in]  FeatureChains          Feature indices of the chains in all images.
+    /// \param[in]  NumberOfChains         Number of feature chains.
+    /// \param[out] FeatureCorrespondences Image coordinates of the feature correspondences in all images (one 2xN matrix per image).
+    /// \param[out] FeatureIndices         Indices of the corresponding features in all images (one row per image, one column per feature correspondence).
+    ///////////////////////////////////////////////////////////////////////////////
+    template<typename ListMatrix2xX>
+    static void CollectFeatureCorrespondences(const std::vector<std::vector<cv::KeyPoint>>& ExtractedFeatures,
+                                              const std::vector<ListUInt64>&                FeatureChains,
+                                              const uint64                                  NumberOfChains,
+                                              ListMatrix2xX&                                FeatureCorrespondences,
+                                              MatrixUInt64&                                 FeatureIndices);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Computes the distances between a query descriptor and its
+    ///             candidates.
+    ///
+    /// The fixed-width distance kernel is used if UsesDescriptorKernel() holds
+    /// for the kernel. Otherwise, the distances are computed by cv::norm. The
+    /// descriptor matcher is never used, since not all matchers can be
+    /// restricted to the candidates (e.g. FLANN based matchers ignore masks).
+    ///
+    /// \param[in]  QueryDescriptors   Query descriptors (one descriptor per row).
+    /// \param[in]  QueryIndex         Index of the query descriptor.
+    /// \param[in]  TrainDescriptors   Train descriptors (one descriptor per row).
+    /// \param[in]  CandidateIndices   Indices of the candidates in the train descriptors.
+    /// \param[in]  Kernel             Kernel selected for the descriptors.
+    /// \param[in]  NormType           Norm of the descriptors.
+    /// \param[out] CandidateDistances Distances of the query descriptor to the candidates.
+    ///////////////////////////////////////////////////////////////////////////////
+    void ComputeCandidateDistances(const cv::Mat&         QueryDescriptors,
+                                   const uint64           QueryIndex,
+                                   const cv::Mat&         TrainDescriptors,
+                                   const ListUInt64&      CandidateIndices,
+                                   const DescriptorKernel Kernel,
+                                   const sint32           NormType,
+                                   ListFloat64&           CandidateDistances) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Computes the distance to the image border which a feature needs
+    ///            to get a descriptor.
+    ///
+    /// \param[in] FeatureDetector FAST, AGAST or ORB detector.
+    ///
+    /// \return    Distance to the image border (in pixels).
+    ///////////////////////////////////////////////////////////////////////////////
+    static sint32 ComputeDescriptorBorder(const cv::Feature2D& FeatureDetector);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Computes the time elapsed since a point in time.
+    ///
+    /// \param[in] StartTime Point in time where the measurement started.
+    ///
+    /// \return    Elapsed time (in milliseconds).
+    ///////////////////////////////////////////////////////////////////////////////
+    static float64 ComputeElapsedTime(const std::chrono::steady_clock::time_point& StartTime);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Computes the radius of the patch which orients the features of
+    ///            a detector.
+    ///
+    /// \param[in] FeatureDetector FAST, AGAST or ORB detector.
+    ///
+    /// \return    Radius of the patch (in pixels, zero for detectors without orientation).
+    ///////////////////////////////////////////////////////////////////////////////
+    static sint32 ComputeOrientationRadius(const cv::Feature2D& FeatureDetector);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief         Computes the orientations of features by the intensity
+    ///                centroid.
+    ///
+    /// The orientation of a feature points from the feature to the intensity
+    /// centroid of a circular patch around the feature (as computed by ORB).
+    ///
+    /// \param[in]     Image    Gray scale image where the features were detected.
+    /// \param[in]     Radius   Radius of the circular patch (in pixels).
+    /// \param[in,out] Features Features whose orientations shall be computed (in degrees).
+    ///////////////////////////////////////////////////////////////////////////////
+    static void ComputeOrientations(const cv::Mat&             Image,
+                                    const sint32               Radius,
+                                    std::vector<cv::KeyPoint>& Features);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Creates the detector applied to the buckets.
+    ///
+    /// The detector is a copy of a FAST or AGAST detector (with a different
+    /// threshold) or the FAST detector used by ORB (which does not orient its
+    /// features, see ComputeOrientations). Only FAST, AGAST and ORB
+    /// detectors are supported, since the threshold of the other detectors is
+    /// not comparable.
+    ///
+    /// \param[in] FeatureDetector FAST, AGAST or ORB detector.
+    /// \param[in] Threshold       FAST threshold of the bucket detector.
+    ///
+    /// \return    FAST or AGAST detector.
+    ///////////////////////////////////////////////////////////////////////////////
+    static cv::Ptr<cv::Feature2D> CreateBucketDetector(const cv::Feature2D& FeatureDetector,
+                                                       const uint8          Threshold);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Creates an index assigning the features to the image rows.
+    ///
+    /// Each feature is assigned to all rows which are within the maximum row
+    /// distance w.r.t. the vertical position of the feature.
+    ///
+    /// \param[in]  ExtractedFeatures  Features which shall be indexed.
+    /// \param[in]  NumberOfRows       Number of rows of the image.
+    /// \param[in]  MaximumRowDistance Maximum distance between the row and the vertical position of the feature (in pixels).
+    /// \param[out] RowIndex           List containing the feature indices for all rows.
+    ///////////////////////////////////////////////////////////////////////////////
+    static void CreateRowIndex(const std::vector<cv::KeyPoint>& ExtractedFeatures,
+                               const uint64                     NumberOfRows,
+                               const float64                    MaximumRowDistance,
+                               std::vector<ListUInt64>&         RowIndex);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief         Detect features inside a bucket.
+    ///
+    /// The detection region is extended by the radius of the FAST circle, so
+    /// features close to the border of the bucket can be detected as well.
+    /// Features outside of the bucket are discarded.
+    ///
+    /// \param[in]     Image            Image where the features shall be detected.
+    /// \param[in]     BucketRegion     Region of the bucket in the image.
+    /// \param[in,out] FeatureDetector  FAST or AGAST detector (its threshold is set to the threshold of the bucket).
+    /// \param[in]     Threshold        FAST threshold.
+    /// \param[out]    FeaturesInBucket Features detected inside the bucket (in image coordinates).
+    ///////////////////////////////////////////////////////////////////////////////
+    static void DetectFeaturesInBucket(const cv::Mat&             Image,
+                                       const cv::Rect&            BucketRegion,
+                                       cv::Feature2D&             FeatureDetector,
+                                       const uint8                Threshold,
+                                       std::vector<cv::KeyPoint>& FeaturesInBucket);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Extract the features of all images and chain them using
+    ///             leased resources.
+    ///
+    /// The features, descriptors and feature chains are stored in the buffers of
+    /// the resources.
+    ///
+    /// \param[in]     Images           List of images where feature correspondences shall be found.
+    /// \param[in]     Bucketer         Feature bucketer used for the extraction (nullptr if the features shall not be bucketed).
+    /// \param[in,out] States           States of the bucketed extraction of the image streams (bucketed extraction only, one per image).
+    /// \param[in]     InitialThreshold FAST threshold used for the first image (bucketed extraction only).
+    /// \param[in]     MinimumThreshold Lowest FAST threshold used for buckets with too few features (bucketed extraction only).
+    /// \param[in]     Resources        Leased resources.
+    /// \param[out]    CallStatistics   Statistics of the call (nullptr if no statistics shall be collected).
+    ///
+    /// \return        Number of feature chains found.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 ExtractAndChainFeatures(const std::vector<cv::Mat>&          Images,
+                                   const FeatureBucketerBase*           Bucketer,
+                                   std::vector<BucketedDetectionState>* States,
+                                   const uint8                          InitialThreshold,
+                                   const uint8                          MinimumThreshold,
+                                   MatchingResources&                   Resources,
+                                   Statistics*                          CallStatistics) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Extract features and calculate their descriptors using leased
+    ///             resources.
+    ///
+    /// \param[in]  Image              Image where the features shall be extracted.
+    /// \param[in]  Resources          Leased resources.
+    /// \param[out] ExtractedFeatures  Features extracted in the image.
+    /// \param[out] FeatureDescriptors Descriptors of the extracted features.
+    ///////////////////////////////////////////////////////////////////////////////
+    void ExtractFeatures(const cv::Mat&             Image,
+                         MatchingResources&         Resources,
+                         std::vector<cv::KeyPoint>& ExtractedFeatures,
+                         cv::Mat&                   FeatureDescriptors) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief         Extract bucketed features and calculate their descriptors
+    ///                using leased resources.
+    ///
+    /// \param[in]     Image              Image where the features shall be extracted.
+    /// \param[in]     Bucketer           Feature bucketer defining the buckets and the number of features in each bucket.
+    /// \param[in,out] State              State of the bucketed extraction of the image stream the image belongs to.
+    /// \param[in]     InitialThreshold   FAST threshold used for the first image.
+    /// \param[in]     MinimumThreshold   Lowest FAST threshold used for buckets with too few features.
+    /// \param[in]     Resources          Leased resources.
+    /// \param[out]    ExtractedFeatures  Features extracted in the image.
+    /// \param[out]    FeatureDescriptors Descriptors of the extracted features.
+    ///////////////////////////////////////////////////////////////////////////////
+    void ExtractFeatures(const cv::Mat&             Image,
+                         const FeatureBucketerBase& Bucketer,
+                         BucketedDetectionState&    State,
+                         const uint8                InitialThreshold,
+                         const uint8                MinimumThreshold,
+                         MatchingResources&         Resources,
+                         std::vector<cv::KeyPoint>& ExtractedFeatures,
+                         cv::Mat&                   FeatureDescriptors) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Finds the two best matches of each query descriptor.
+    ///
+    /// The compressor is used if the compressed descriptors are provided. The
+    /// fixed-width distance kernels are used if UsesDescriptorKernel() holds for
+    /// the selected kernel. Otherwise, the descriptor matcher of the resources
+    /// is used.
+    ///
+    /// \param[in]  QueryDescriptors           Query descriptors (one descriptor per row).
+    /// \param[in]  CompressedQueryDescriptors Compressed query descriptors (nullptr if the descriptors are not matched by the compressor).
+    /// \param[in]  TrainDescriptors           Train descriptors (one descriptor per row).
+    /// \param[in]  CompressedTrainDescriptors Compressed train descriptors (nullptr if the descriptors are not matched by the compressor).
+    /// \param[in]  Resources                  Leased resources.
+    /// \param[out] Matches                    Two best matches of each query descriptor (entries 2i and 2i+1 for the i-th query descriptor, sorted by their distance, missing matches have a negative train index).
+    ///////////////////////////////////////////////////////////////////////////////
+    void FindTwoBestMatches(const cv::Mat&                                     QueryDescriptors,
+                            const DescriptorCompressor::CompressedDescriptors* CompressedQueryDescriptors,
+                            const cv::Mat&                                     TrainDescriptors,
+                            const DescriptorCompressor::CompressedDescriptors* CompressedTrainDescriptors,
+                            MatchingResources&                                 Resources,
+                            std::vector<cv::DMatch>&                           Matches) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Converts nested matches into the flat layout of the two best
+    ///             matches.
+    ///
+    /// \param[in]  KnnMatches Matches of each query descriptor (sorted by their distance).
+    /// \param[out] Matches    Two best matches of each query descriptor (entries 2i and 2i+1 for the i-th query descriptor, missing matches have a negative train index).
+    ///////////////////////////////////////////////////////////////////////////////
+    static void FlattenMatches(const std::vector<std::vector<cv::DMatch>>& KnnMatches,
+                               std::vector<cv::DMatch>&                    Matches);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Match the features of the images using leased resources.
+    ///
+    /// \param[in]  ExtractedFeatures      Features extracted in all images.
+    /// \param[in]  FeatureDescriptors     Descriptors of the features extracted in all images.
+    /// \param[in]  Resources              Leased resources.
+    /// \param[out] FeatureCorrespondences Image coordinate of the feature correspondences in all images.
+    ///
+    /// \return     Number of feature correspondences found.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 MatchFeatures(const std::vector<std::vector<cv::KeyPoint>>& ExtractedFeatures,
+                         const std::vector<cv::Mat>&                   FeatureDescriptors,
+                         MatchingResources&                            Resources,
+                         std::vector<ListColumnVectorFloat64_2d>&      FeatureCorrespondences) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Returns a set of resources to the pool.
+    ///
+    /// \param[in] Resources Set of resources.
+    ///////////////////////////////////////////////////////////////////////////////
+    void ReleaseResources(std::unique_ptr<MatchingResources> Resources) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief         Sets the FAST threshold of a detector.
+    ///
+    /// \param[in,out] FeatureDetector FAST, AGAST or ORB detector.
+    /// \param[in]     Threshold       FAST threshold.
+    ///////////////////////////////////////////////////////////////////////////////
+    static void SetDetectorThreshold(cv::Feature2D& FeatureDetector,
+                                     const uint8    Threshold);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Checks whether the descriptors are matched by a fixed-width
+    ///            distance kernel or by the descriptor matcher.
+    ///
+    /// The kernels are only used if they are enabled (default configuration or
+    /// on request) and if the layout of the descriptors is supported by a
+    /// kernel.
+    ///
+    /// \param[in] Kernel Kernel selected for the descriptors.
+    ///
+    /// \return    Flag whether the kernel is used or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    boolean UsesDescriptorKernel(const DescriptorKernel Kernel) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Walks along the feature chains and passes each feature of each
+    ///            chain to a writer.
+    ///
+    /// \tparam    CorrespondenceWriter Callable taking the image index, the chain index, the feature index and the image point of the feature.
+    /// \param[in] ExtractedFeatures    Features extracted in all images.
+    /// \param[in] FeatureChains        Feature indices of the chains in all images.
+    /// \param[in] NumberOfChains       Number of feature chains.
+    /// \param[in] WriteCorrespondence  Writer storing the feature in the output.
+    ///////////////////////////////////////////////////////////////////////////////
+    template<typename CorrespondenceWriter>
+    static void WalkFeatureChains(const std::vector<std::vector<cv::KeyPoint>>& ExtractedFeatures,
+                                  const std::vector<ListUInt64>&                FeatureChains,
+                                  const uint64                                  NumberOfChains,
+                                  const CorrespondenceWriter&                   WriteCorrespondence);
 };
 
 #endif // FEATUREMATCHER_H
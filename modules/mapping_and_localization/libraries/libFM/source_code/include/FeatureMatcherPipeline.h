@@ -0,0 +1,159 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  FeatureMatcherPipeline.h
+///
+/// \brief Header file containing the FeatureMatcherPipeline class.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#ifndef FEATUREMATCHERPIPELINE_H
+#define FEATUREMATCHERPIPELINE_H
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+
+#include <opencv2/core/core.hpp>
+#include <opencv2/features2d/features2d.hpp>
+
+#include <GlobalTypesDerived.h>
+
+#include "FeatureMatcher.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// \struct FeatureCorrespondenceResult
+///
+/// \brief  Feature correspondences found in a set of images.
+///////////////////////////////////////////////////////////////////////////////
+struct FeatureCorrespondenceResult
+{
+    uint64                                  NumberOfCorrespondences{0U}; ///< Number of feature correspondences found.
+    std::vector<ListColumnVectorFloat64_2d> FeatureCorrespondences;      ///< Image coordinate of the feature correspondences in all images.
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class FeatureMatcherPipeline
+///
+/// \brief Class for finding feature correspondences asynchronously.
+///
+/// The pipeline consists of two stages running in their own threads: the
+/// extraction of the features and the matching of the features. Hence, the
+/// extraction of the features of a set of images overlaps with the matching of
+/// the previous set of images and with the processing of the results by the
+/// caller. The throughput is limited by the slowest stage instead of the sum
+/// of all stages.
+///
+/// Both stages are connected by bounded queues. If a queue is full, the
+/// preceding stage (or the caller) is blocked until the next stage has taken a
+/// job from the queue (backpressure).
+///
+/// The i-th image of all image sets is treated as the same image stream, i.e.
+/// the FAST thresholds of the bucketed extraction are adapted per position.
+///////////////////////////////////////////////////////////////////////////////
+class FeatureMatcherPipeline
+{
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \struct ExtractionJob
+    ///
+    /// \brief  Job of the extraction stage.
+    ///////////////////////////////////////////////////////////////////////////////
+    struct ExtractionJob
+    {
+        std::vector<cv::Mat>                      Images; ///< List of images where feature correspondences shall be found.
+        std::promise<FeatureCorrespondenceResult> Result; ///< Promise for the feature correspondences.
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \struct MatchingJob
+    ///
+    /// \brief  Job of the matching stage.
+    ///////////////////////////////////////////////////////////////////////////////
+    struct MatchingJob
+    {
+        std::vector<std::vector<cv::KeyPoint>>    ExtractedFeatures;  ///< Features extracted in all images.
+        std::vector<cv::Mat>                      FeatureDescriptors; ///< Descriptors of the features extracted in all images.
+        std::promise<FeatureCorrespondenceResult> Result;             ///< Promise for the feature correspondences.
+    };
+
+    const FeatureMatcher&                               m_FeatureMatcher;          ///< Feature matcher used to extract and match the features.
+    const FeatureBucketerBase*                          m_FeatureBucketer;         ///< Feature bucketer used for the extraction (nullptr if the features shall not be bucketed).
+    const uint64                                        m_QueueCapacity;           ///< Maximum number of jobs in each queue.
+    std::vector<FeatureMatcher::BucketedDetectionState> m_BucketedDetectionStates; ///< States of the bucketed extraction (one per image position, only used by the extraction stage).
+    std::deque<ExtractionJob>                           m_ExtractionQueue;         ///< Queue containing the jobs of the extraction stage.
+    std::deque<MatchingJob>                             m_MatchingQueue;           ///< Queue containing the jobs of the matching stage.
+    std::mutex                                          m_Mutex;                   ///< Mutex protecting the queues and the flags.
+    std::condition_variable                             m_ExtractionCondition;     ///< Condition variable signaling changes of the extraction queue.
+    std::condition_variable                             m_MatchingCondition;       ///< Condition variable signaling changes of the matching queue.
+    boolean                                             m_StopRequested;           ///< Flag defining whether the pipeline shall be stopped or not.
+    boolean                                             m_ExtractionFinished;      ///< Flag defining whether the extraction stage has finished or not.
+    std::thread                                         m_ExtractionThread;        ///< Thread running the extraction stage.
+    std::thread                                         m_MatchingThread;          ///< Thread running the matching stage.
+
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Constructor.
+    ///
+    /// \param[in] Matcher       Feature matcher used to extract and match the features.
+    /// \param[in] QueueCapacity Maximum number of jobs in each queue.
+    /// \param[in] Bucketer      Feature bucketer used for the extraction (nullptr if the features shall not be bucketed).
+    ///////////////////////////////////////////////////////////////////////////////
+    FeatureMatcherPipeline(const FeatureMatcher&      Matcher,
+                           const uint64               QueueCapacity = 2U,
+                           const FeatureBucketerBase* Bucketer      = nullptr);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor.
+    ///
+    /// All pending jobs are finished before the threads are stopped.
+    ///////////////////////////////////////////////////////////////////////////////
+    ~FeatureMatcherPipeline();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Find feature correspondences in the images asynchronously.
+    ///
+    /// The call blocks as long as the extraction queue is full. The images are
+    /// not copied, i.e. their content must not be changed until the result is
+    /// available. An exception is thrown if no image is provided (the job is
+    /// not queued).
+    ///
+    /// \param[in] Images List of images where feature correspondences shall be found.
+    ///
+    /// \return    Future for the feature correspondences.
+    ///////////////////////////////////////////////////////////////////////////////
+    std::future<FeatureCorrespondenceResult> FindCorrespondencesAsync(const std::vector<cv::Mat>& Images);
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Runs the extraction stage.
+    ///////////////////////////////////////////////////////////////////////////////
+    void RunExtraction();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Runs the matching stage.
+    ///////////////////////////////////////////////////////////////////////////////
+    void RunMatching();
+};
+
+#endif // FEATUREMATCHERPIPELINE_H
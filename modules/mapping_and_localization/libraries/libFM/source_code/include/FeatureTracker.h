@@ -0,0 +1,166 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  FeatureTracker.h
+///
+/// \brief Header file containing the FeatureTracker class.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#ifndef FEATURETRACKER_H
+#define FEATURETRACKER_H
+
+#include <opencv2/core/core.hpp>
+#include <opencv2/features2d/features2d.hpp>
+
+#include <GlobalTypesDerived.h>
+
+#include "FeatureMatcher.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class FeatureTracker
+///
+/// \brief Class for tracking features over a sequence of images.
+///
+/// The feature tracker keeps persistent tracks with unique IDs. The tracks are
+/// stored in a pool with one list per attribute (IDs, ages, positions,
+/// velocities and descriptors). The active tracks always occupy the first
+/// entries of the lists, i.e. they are available as contiguous arrays. The
+/// memory of the pool is allocated once and the entries of terminated tracks
+/// are recycled for new tracks.
+///
+/// With each new image, the active tracks are extended by matching their last
+/// descriptors against the features of the new image inside a search window
+/// around the position predicted by a constant velocity model. Tracks which
+/// cannot be extended are terminated and unmatched features start new tracks.
+/// Tracks with a single feature inside their search window are extended by
+/// default, as the mutual check of the target features still guards them.
+///////////////////////////////////////////////////////////////////////////////
+class FeatureTracker
+{
+protected:
+    const FeatureMatcher&      m_FeatureMatcher;         ///< Feature matcher used to extract and match the features.
+    const uint64               m_MaximumNumberOfTracks;  ///< Maximum number of active tracks.
+    const float64              m_SearchRadius;           ///< Radius of the search window around the predicted positions (in pixels).
+    const boolean              m_AcceptSingleCandidates; ///< Flag whether tracks with a single feature inside their search window are extended or not.
+    uint64                     m_NumberOfTracks;         ///< Number of active tracks.
+    uint64                     m_NextTrackID;            ///< ID assigned to the next new track.
+    ListUInt64                 m_TrackIDs;               ///< List containing the IDs of the active tracks.
+    ListUInt64                 m_TrackAges;              ///< List containing the ages (i.e. number of images) of the active tracks.
+    ListColumnVectorFloat64_2d m_TrackImagePoints;       ///< List containing the last image coordinates of the active tracks.
+    ListColumnVectorFloat64_2d m_TrackVelocities;        ///< List containing the last velocities of the active tracks (in pixels per image).
+    cv::Mat                    m_TrackDescriptors;       ///< Last descriptors of the tracks (one row per track, only the first rows belong to active tracks).
+    ListColumnVectorFloat64_2d m_PredictedImagePoints;   ///< List containing the predicted image coordinates of the active tracks.
+    ListBoolean                m_TrackIsExtended;        ///< List defining whether the active tracks have been extended or not.
+    ListBoolean                m_FeatureIsAssigned;      ///< List defining whether the extracted features have been assigned to a track or not.
+    std::vector<cv::KeyPoint>  m_ExtractedFeatures;      ///< Features extracted in the current image.
+    cv::Mat                    m_FeatureDescriptors;     ///< Descriptors of the features extracted in the current image.
+    std::vector<cv::DMatch>    m_Matches;                ///< Matches between the active tracks and the extracted features.
+
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Constructor.
+    ///
+    /// \param[in] Matcher                Feature matcher used to extract and match the features.
+    /// \param[in] MaximumNumberOfTracks  Maximum number of active tracks.
+    /// \param[in] SearchRadius           Radius of the search window around the predicted positions (in pixels).
+    /// \param[in] AcceptSingleCandidates Flag whether tracks with a single feature inside their search window are extended or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    FeatureTracker(const FeatureMatcher& Matcher,
+                   const uint64          MaximumNumberOfTracks  = 1000U,
+                   const float64         SearchRadius           = 30.0,
+                   const boolean         AcceptSingleCandidates = true);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor.
+    ///////////////////////////////////////////////////////////////////////////////
+    ~FeatureTracker();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the number of active tracks.
+    ///
+    /// \return Number of active tracks.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 GetNumberOfTracks() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the ages of the active tracks.
+    ///
+    /// \return List containing the ages (i.e. number of images) of the active tracks.
+    ///////////////////////////////////////////////////////////////////////////////
+    const ListUInt64& GetTrackAges() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the last descriptors of the active tracks.
+    ///
+    /// \return Descriptors of the active tracks (one row per track, no data is copied).
+    ///////////////////////////////////////////////////////////////////////////////
+    cv::Mat GetTrackDescriptors() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the IDs of the active tracks.
+    ///
+    /// \return List containing the IDs of the active tracks.
+    ///////////////////////////////////////////////////////////////////////////////
+    const ListUInt64& GetTrackIDs() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the last image coordinates of the active tracks.
+    ///
+    /// \return List containing the last image coordinates of the active tracks.
+    ///////////////////////////////////////////////////////////////////////////////
+    const ListColumnVectorFloat64_2d& GetTrackImagePoints() const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Extend the tracks by a new image.
+    ///
+    /// \param[in] Image New image of the sequence.
+    ///
+    /// \return    Number of active tracks after processing the image.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 ProcessImage(const cv::Mat& Image);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Terminate all tracks.
+    ///////////////////////////////////////////////////////////////////////////////
+    void Reset();
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Extend the active tracks by the matched features.
+    ///////////////////////////////////////////////////////////////////////////////
+    void ExtendTracks();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Start new tracks for the features which are not assigned to a track.
+    ///////////////////////////////////////////////////////////////////////////////
+    void StartTracks();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Terminate the active tracks which have not been extended.
+    ///
+    /// The entry of a terminated track is replaced by the last active track.
+    /// Hence, the active tracks always occupy the first entries of the lists.
+    ///////////////////////////////////////////////////////////////////////////////
+    void TerminateTracks();
+};
+
+#endif // FEATURETRACKER_H
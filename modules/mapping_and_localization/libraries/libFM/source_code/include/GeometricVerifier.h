@@ -0,0 +1,205 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  GeometricVerifier.h
+///
+/// \brief Header file containing the GeometricVerifier class.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#ifndef GEOMETRICVERIFIER_H
+#define GEOMETRICVERIFIER_H
+
+#include <GlobalTypesDerived.h>
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class GeometricVerifier
+///
+/// \brief Class for rejecting outliers of feature correspondences by their
+///        geometry.
+///
+/// The epipolar geometry is estimated by preemptive RANSAC: a fixed number of
+/// fundamental matrix hypotheses is generated by the normalized 8-point
+/// algorithm, all hypotheses are scored on a first block of correspondences,
+/// the worse half is discarded, the remaining ones are scored on the next
+/// block and so on. The Sampson distances of a block are computed for all
+/// hypotheses at once (one matrix product for all hypotheses).
+///
+/// The samples are drawn progressively (PROSAC): the first hypotheses are
+/// drawn from the first correspondences only and the set grows until it
+/// covers all correspondences. Hence, correspondences which are sorted by
+/// their quality (best first) yield good hypotheses early. Unsorted
+/// correspondences are sampled (almost) uniformly.
+///
+/// The inlier threshold is a Sampson distance in the unit of the image
+/// coordinates which are verified. For pixel coordinates (fundamental matrix)
+/// it is in pixels. For normalized image coordinates (essential matrix) it is
+/// in normalized units, i.e. a threshold of t pixels corresponds to t / f for
+/// a focal length of f pixels.
+///
+/// The verification is deterministic for a given seed value and all methods
+/// are const, i.e. a single instance can be used by several threads.
+///////////////////////////////////////////////////////////////////////////////
+class GeometricVerifier
+{
+protected:
+    const uint64  m_NumberOfHypotheses; ///< Number of fundamental matrix hypotheses.
+    const uint64  m_BlockSize;          ///< Number of correspondences scored before half of the hypotheses are discarded.
+    const float64 m_InlierThreshold;    ///< Maximum Sampson distance of an inlier (in the unit of the image coordinates).
+    const uint64  m_SeedValue;          ///< Seed value used to initialize the random number engine.
+
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Constructor.
+    ///
+    /// \param[in] NumberOfHypotheses Number of fundamental matrix hypotheses.
+    /// \param[in] BlockSize          Number of correspondences scored before half of the hypotheses are discarded.
+    /// \param[in] InlierThreshold    Maximum Sampson distance of an inlier (in pixels for pixel coordinates, divided by the focal length for normalized image coordinates).
+    /// \param[in] SeedValue          Seed value used to initialize the random number engine.
+    ///////////////////////////////////////////////////////////////////////////////
+    GeometricVerifier(const uint64  NumberOfHypotheses = 128U,
+                      const uint64  BlockSize          = 100U,
+                      const float64 InlierThreshold    = 1.0,
+                      const uint64  SeedValue          = 0U);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor.
+    ///////////////////////////////////////////////////////////////////////////////
+    ~GeometricVerifier();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Verifies feature correspondences by the epipolar geometry.
+    ///
+    /// The fundamental matrix of the best hypothesis is refined by all of its
+    /// inliers. If normalized image coordinates are provided, the fundamental
+    /// matrix is an essential matrix (without enforcing equal singular values)
+    /// and the inlier threshold is applied to the normalized image coordinates,
+    /// i.e. it has to be given in pixels divided by the focal length. An
+    /// exception is thrown if the number of image points differs between both
+    /// images.
+    ///
+    /// \param[in]  ImagePointsFirst  Image coordinates of the feature correspondences in the first image.
+    /// \param[in]  ImagePointsSecond Image coordinates of the feature correspondences in the second image.
+    /// \param[out] FundamentalMatrix Fundamental matrix (x_2^T * F * x_1 = 0, zero if no model was found).
+    /// \param[out] InlierMask        Flag for each feature correspondence whether it is an inlier or not.
+    ///
+    /// \return     Number of inliers.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 VerifyFundamental(const MatrixFloat64_2xX& ImagePointsFirst,
+                             const MatrixFloat64_2xX& ImagePointsSecond,
+                             MatrixFloat64_3d&        FundamentalMatrix,
+                             ListBoolean&             InlierMask) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Verifies feature correspondences of a rectified stereo image
+    ///             pair.
+    ///
+    /// A feature correspondence is an inlier if the rows of both features are
+    /// close to each other and if the disparity is inside the valid range. An
+    /// exception is thrown if the number of image points differs between both
+    /// images.
+    ///
+    /// \param[in]  ImagePointsStereoLeft  Image coordinates of the feature correspondences in the left image.
+    /// \param[in]  ImagePointsStereoRight Image coordinates of the feature correspondences in the right image.
+    /// \param[in]  MaximumRowDistance     Maximum distance between the rows of corresponding features (in pixels).
+    /// \param[in]  MaximumDisparity       Maximum disparity of corresponding features (in pixels).
+    /// \param[out] InlierMask             Flag for each feature correspondence whether it is an inlier or not.
+    ///
+    /// \return     Number of inliers.
+    ///////////////////////////////////////////////////////////////////////////////
+    static uint64 VerifyStereo(const MatrixFloat64_2xX& ImagePointsStereoLeft,
+                               const MatrixFloat64_2xX& ImagePointsStereoRight,
+                               const float64            MaximumRowDistance,
+                               const float64            MaximumDisparity,
+                               ListBoolean&             InlierMask);
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Computes a fundamental matrix by the normalized 8-point
+    ///             algorithm.
+    ///
+    /// \param[in]  ImagePointsFirst  Image coordinates of the feature correspondences in the first image.
+    /// \param[in]  ImagePointsSecond Image coordinates of the feature correspondences in the second image.
+    /// \param[in]  Indices           Indices of the feature correspondences which shall be used (at least 8).
+    /// \param[out] FundamentalMatrix Fundamental matrix (rank 2, unit Frobenius norm).
+    ///
+    /// \return     Flag whether the fundamental matrix could be computed or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    static boolean ComputeFundamentalMatrix(const MatrixFloat64_2xX& ImagePointsFirst,
+                                            const MatrixFloat64_2xX& ImagePointsSecond,
+                                            const ListUInt64&        Indices,
+                                            MatrixFloat64_3d&        FundamentalMatrix);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Computes the normalizing transformation of image points.
+    ///
+    /// The transformation moves the centroid of the image points to the origin
+    /// and scales them to an average distance of sqrt(2) from the origin.
+    ///
+    /// \param[in]  ImagePoints    Image coordinates.
+    /// \param[in]  Indices        Indices of the image points which shall be used.
+    /// \param[out] Transformation Normalizing transformation (homogeneous coordinates).
+    ///
+    /// \return     Flag whether the transformation could be computed or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    static boolean ComputeNormalization(const MatrixFloat64_2xX& ImagePoints,
+                                        const ListUInt64&        Indices,
+                                        MatrixFloat64_3d&        Transformation);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Computes the inliers of a fundamental matrix.
+    ///
+    /// An exception is thrown if the number of image points differs between
+    /// both images.
+    ///
+    /// \param[in]  ImagePointsFirst  Image coordinates of the feature correspondences in the first image.
+    /// \param[in]  ImagePointsSecond Image coordinates of the feature correspondences in the second image.
+    /// \param[in]  FundamentalMatrix Fundamental matrix.
+    /// \param[out] InlierMask        Flag for each feature correspondence whether it is an inlier or not.
+    ///
+    /// \return     Number of inliers.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 ComputeInliers(const MatrixFloat64_2xX& ImagePointsFirst,
+                          const MatrixFloat64_2xX& ImagePointsSecond,
+                          const MatrixFloat64_3d&  FundamentalMatrix,
+                          ListBoolean&             InlierMask) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Scores hypotheses on a block of feature correspondences.
+    ///
+    /// The score of a hypothesis is increased by the number of feature
+    /// correspondences of the block whose Sampson distance is below the inlier
+    /// threshold.
+    ///
+    /// \param[in]     Hypotheses        Fundamental matrices of the hypotheses (stacked vertically).
+    /// \param[in]     HypothesisIndices Indices of the hypotheses which shall be scored.
+    /// \param[in]     PointsFirst       Homogeneous image coordinates of the block in the first image.
+    /// \param[in]     PointsSecond      Homogeneous image coordinates of the block in the second image.
+    /// \param[in,out] Scores            Scores of all hypotheses.
+    ///////////////////////////////////////////////////////////////////////////////
+    void ScoreHypotheses(const MatrixFloat64& Hypotheses,
+                         const ListUInt64&    HypothesisIndices,
+                         const MatrixFloat64& PointsFirst,
+                         const MatrixFloat64& PointsSecond,
+                         ListUInt64&          Scores) const;
+};
+
+#endif // GEOMETRICVERIFIER_H
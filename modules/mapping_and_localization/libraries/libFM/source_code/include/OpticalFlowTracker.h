@@ -0,0 +1,217 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  OpticalFlowTracker.h
+///
+/// \brief Header file containing the OpticalFlowTracker class.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#ifndef OPTICALFLOWTRACKER_H
+#define OPTICALFLOWTRACKER_H
+
+#include <opencv2/core/core.hpp>
+
+#include <GlobalTypesDerived.h>
+
+#include "../../../libFB/source_code/include/FeatureBucketerBase.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class OpticalFlowTracker
+///
+/// \brief Class for tracking features by means of pyramidal Lucas-Kanade
+///        optical flow.
+///
+/// In contrast to the detect-and-match approach of the FeatureMatcher, the
+/// features are propagated from image to image by the optical flow. Hence,
+/// neither a detection nor a descriptor computation is required for features
+/// which are already tracked. Optionally, each track is verified by tracking
+/// it backwards from the new to the previous image (forward-backward check).
+///
+/// New features are only detected in buckets of the feature bucketer in which
+/// the number of tracked features dropped below the number of features
+/// defined by the feature mask. Hence, the feature bucketer decides where the
+/// tracks get replenished.
+///
+/// The tracker handles several image streams (e.g. the images of a stereo
+/// camera) at once. The streams are independent of each other and are
+/// processed in parallel.
+///////////////////////////////////////////////////////////////////////////////
+class OpticalFlowTracker
+{
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \struct TrackingStream
+    ///
+    /// \brief  State of the tracks of a single image stream.
+    ///////////////////////////////////////////////////////////////////////////////
+    struct TrackingStream
+    {
+        std::vector<cv::Mat>       PyramidPrevious;        ///< Image pyramid of the previous image.
+        std::vector<cv::Mat>       PyramidCurrent;         ///< Image pyramid of the current image.
+        std::vector<cv::Point2f>   ImagePointsPrevious;    ///< Image coordinates of the tracks in the previous image.
+        std::vector<cv::Point2f>   ImagePointsCurrent;     ///< Image coordinates of the tracks in the current image.
+        std::vector<cv::Point2f>   ImagePointsBackward;    ///< Image coordinates of the tracks tracked back into the previous image.
+        std::vector<cv::Point2f>   ImagePointsDetected;    ///< Image coordinates of the features detected in a single bucket.
+        std::vector<uint8>         StatusForward;          ///< Status of the forward tracking.
+        std::vector<uint8>         StatusBackward;         ///< Status of the backward tracking.
+        std::vector<float32>       TrackingErrors;         ///< Errors of the optical flow computation.
+        std::vector<ListUInt64>    TrackIndicesInBuckets;  ///< List containing the track indices for all buckets.
+        ListUInt64                 TrackIDs;               ///< List containing the IDs of the tracks.
+        ListUInt64                 TrackAges;              ///< List containing the ages (i.e. number of images) of the tracks.
+        ListColumnVectorFloat64_2d TrackImagePoints;       ///< List containing the image coordinates of the tracks in the current image.
+        uint64                     NextTrackID{0U};        ///< ID assigned to the next new track.
+    };
+
+    const FeatureBucketerBase&  m_FeatureBucketer;             ///< Feature bucketer defining where new features are detected.
+    const uint64                m_NumberOfStreams;             ///< Number of image streams.
+    const sint32                m_NumberOfPyramidLevels;       ///< Number of pyramid levels (0 means that only the original image is used).
+    const cv::Size              m_WindowSize;                  ///< Size of the search window on each pyramid level.
+    const boolean               m_UseForwardBackwardCheck;     ///< Flag defining whether the forward-backward check is used or not.
+    const float64               m_MaximumForwardBackwardError; ///< Maximum distance between the original and the backward tracked image point (in pixels).
+    const float64               m_MinimumDistance;             ///< Minimum distance between two features (in pixels).
+    const float64               m_QualityLevel;                ///< Minimal accepted quality of new features relative to the best feature in the bucket.
+    std::vector<TrackingStream> m_TrackingStreams;             ///< States of the tracks of all image streams.
+
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Constructor.
+    ///
+    /// \param[in] Bucketer                    Feature bucketer defining where new features are detected.
+    /// \param[in] NumberOfStreams             Number of image streams.
+    /// \param[in] NumberOfPyramidLevels       Number of pyramid levels (0 means that only the original image is used).
+    /// \param[in] WindowSize                  Size of the (quadratic) search window on each pyramid level.
+    /// \param[in] UseForwardBackwardCheck     Flag defining whether the forward-backward check is used or not.
+    /// \param[in] MaximumForwardBackwardError Maximum distance between the original and the backward tracked image point (in pixels).
+    /// \param[in] MinimumDistance             Minimum distance between two features (in pixels).
+    /// \param[in] QualityLevel                Minimal accepted quality of new features relative to the best feature in the bucket.
+    ///////////////////////////////////////////////////////////////////////////////
+    OpticalFlowTracker(const FeatureBucketerBase& Bucketer,
+                       const uint64               NumberOfStreams             = 1U,
+                       const uint8                NumberOfPyramidLevels       = 3U,
+                       const uint16               WindowSize                  = 21U,
+                       const boolean              UseForwardBackwardCheck     = true,
+                       const float64              MaximumForwardBackwardError = 1.0,
+                       const float64              MinimumDistance             = 10.0,
+                       const float64              QualityLevel                = 0.01);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor.
+    ///////////////////////////////////////////////////////////////////////////////
+    ~OpticalFlowTracker();
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Getter for the number of tracks of an image stream.
+    ///
+    /// \param[in] StreamIndex Index of the image stream.
+    ///
+    /// \return    Number of tracks.
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64 GetNumberOfTracks(const uint64 StreamIndex) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Getter for the ages of the tracks of an image stream.
+    ///
+    /// \param[in] StreamIndex Index of the image stream.
+    ///
+    /// \return    List containing the ages (i.e. number of images) of the tracks.
+    ///////////////////////////////////////////////////////////////////////////////
+    const ListUInt64& GetTrackAges(const uint64 StreamIndex) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Getter for the IDs of the tracks of an image stream.
+    ///
+    /// \param[in] StreamIndex Index of the image stream.
+    ///
+    /// \return    List containing the IDs of the tracks.
+    ///////////////////////////////////////////////////////////////////////////////
+    const ListUInt64& GetTrackIDs(const uint64 StreamIndex) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Getter for the image coordinates of the tracks of an image stream.
+    ///
+    /// \param[in] StreamIndex Index of the image stream.
+    ///
+    /// \return    List containing the image coordinates of the tracks in the last image.
+    ///////////////////////////////////////////////////////////////////////////////
+    const ListColumnVectorFloat64_2d& GetTrackImagePoints(const uint64 StreamIndex) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Extend the tracks of all image streams by new images.
+    ///
+    /// The image streams are processed in parallel. An exception is thrown if
+    /// the number of images does not match the number of image streams or if
+    /// the size of an image does not match the size of the feature bucketer.
+    ///
+    /// \param[in] Images List containing one new (grayscale) image for each image stream.
+    ///////////////////////////////////////////////////////////////////////////////
+    void ProcessImages(const std::vector<cv::Mat>& Images);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Terminate all tracks of all image streams.
+    ///////////////////////////////////////////////////////////////////////////////
+    void Reset();
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Checks whether the stream index is valid or not.
+    ///
+    /// \param[in] StreamIndex Index of the image stream.
+    ///////////////////////////////////////////////////////////////////////////////
+    void CheckStreamIndex(const uint64 StreamIndex) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief     Checks whether an image point is closer to a track than the
+    ///            minimum distance or not.
+    ///
+    /// Only the tracks of the buckets which overlap with the minimum distance
+    /// around the image point are checked, i.e. the tracks need to be assigned
+    /// to the buckets.
+    ///
+    /// \param[in] ImagePoint Image coordinates of the image point.
+    /// \param[in] Stream     State of the tracks of the image stream.
+    ///
+    /// \return    Flag whether the image point is close to a track or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    boolean IsCloseToTrack(const cv::Point2f&    ImagePoint,
+                           const TrackingStream& Stream) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief         Detect new features in all buckets which contain less
+    ///                tracks than defined by the feature mask.
+    ///
+    /// \param[in]     Image  Current image of the stream.
+    /// \param[in,out] Stream State of the tracks of the image stream.
+    ///////////////////////////////////////////////////////////////////////////////
+    void ReplenishTracks(const cv::Mat& Image,
+                         TrackingStream& Stream) const;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief         Extend the tracks of a single image stream by a new image.
+    ///
+    /// \param[in]     Image  New image of the stream.
+    /// \param[in,out] Stream State of the tracks of the image stream.
+    ///////////////////////////////////////////////////////////////////////////////
+    void TrackStream(const cv::Mat& Image,
+                     TrackingStream& Stream) const;
+};
+
+#endif // OPTICALFLOWTRACKER_H
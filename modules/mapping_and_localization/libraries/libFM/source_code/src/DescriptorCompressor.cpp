@@ -0,0 +1,513 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  DescriptorCompressor.cpp
+///
+/// \brief Source file containing the DescriptorCompressor class.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+#include <Eigen/Eigenvalues>
+
+#include "../include/DescriptorCompressor.h"
+#include "../include/DescriptorDistance.h"
+
+DescriptorCompressor::DescriptorCompressor(const uint64  NumberOfDimensions,
+                                           const float64 MaximumRecallLoss,
+                                           const uint64  MaximumNumberOfCandidates) :
+    m_NumberOfDimensions{NumberOfDimensions},
+    m_MaximumRecallLoss{MaximumRecallLoss},
+    m_MaximumNumberOfCandidates{std::max(MaximumNumberOfCandidates, static_cast<uint64>(2U))},
+    m_QuantizationScale{1.0},
+    m_NumberOfCandidates{m_MaximumNumberOfCandidates},
+    m_Recall{0.0},
+    m_IsTrained{false}
+{
+}
+
+DescriptorCompressor::~DescriptorCompressor()
+{
+}
+
+void DescriptorCompressor::Train(const cv::Mat& TrainingDescriptors,
+                                 const float64  RatioDistance)
+{
+    // get size of the training data
+    const uint64 NumberOfTrainingDescriptors{static_cast<uint64>(TrainingDescriptors.rows)};
+    const uint64 NumberOfInputDimensions{static_cast<uint64>(TrainingDescriptors.cols)};
+
+    if((TrainingDescriptors.type() != CV_32F) || (NumberOfTrainingDescriptors < 4U) || (m_NumberOfDimensions == 0U) || (m_NumberOfDimensions > NumberOfInputDimensions))
+    {
+        throw std::invalid_argument("Training descriptors must contain at least 4 floating point descriptors with at least " + std::to_string(m_NumberOfDimensions) + " dimensions.");
+    }
+
+    const cv::Mat TrainingDescriptorsContinuous{TrainingDescriptors.isContinuous() ? TrainingDescriptors : TrainingDescriptors.clone()};
+
+    const MatrixFloat64 Descriptors{Eigen::Map<const Eigen::Matrix<float32, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>(TrainingDescriptorsContinuous.ptr<float32>(0), static_cast<sint64>(NumberOfTrainingDescriptors), static_cast<sint64>(NumberOfInputDimensions)).cast<float64>()};
+
+    // compute mean and covariance of the training descriptors
+    m_Mean = Descriptors.colwise().mean();
+
+    const MatrixFloat64 CenteredDescriptors{Descriptors.rowwise() - m_Mean};
+    const MatrixFloat64 Covariance{(CenteredDescriptors.transpose() * CenteredDescriptors) / static_cast<float64>(NumberOfTrainingDescriptors - 1U)};
+
+    // keep the principal components with the largest eigenvalues (the eigenvalues are sorted in increasing order)
+    const Eigen::SelfAdjointEigenSolver<MatrixFloat64> EigenSolver(Covariance);
+
+    m_Projection = EigenSolver.eigenvectors().rightCols(static_cast<sint64>(m_NumberOfDimensions)).rowwise().reverse();
+
+    // map the largest projected value to the largest 8-bit signed integer
+    const float64 MaximumProjectedValue{(CenteredDescriptors * m_Projection).cwiseAbs().maxCoeff()};
+
+    m_QuantizationScale = (MaximumProjectedValue > 0.0) ? (127.0 / MaximumProjectedValue) : 1.0;
+    m_IsTrained         = true;
+
+    // match the first half of the training descriptors against the second half by their exact distance
+    const sint32  NumberOfQueryDescriptors{static_cast<sint32>(NumberOfTrainingDescriptors / 2U)};
+    const cv::Mat QueryDescriptors{TrainingDescriptorsContinuous.rowRange(0, NumberOfQueryDescriptors)};
+    const cv::Mat TrainDescriptors{TrainingDescriptorsContinuous.rowRange(NumberOfQueryDescriptors, static_cast<sint32>(NumberOfTrainingDescriptors))};
+
+    std::vector<std::vector<cv::DMatch>> MatchesExact;
+
+    FindTwoBestMatchesExact(QueryDescriptors, TrainDescriptors, MatchesExact);
+
+    uint64 NumberOfGoodMatchesExact{0U};
+
+    for(const std::vector<cv::DMatch>& CurrentMatches : MatchesExact)
+    {
+        if(PassesRatioTest(CurrentMatches, RatioDistance))
+        {
+            NumberOfGoodMatchesExact++;
+        }
+    }
+
+    // compress the descriptors once for all numbers of re-ranked candidates
+    CompressedDescriptors CompressedQueryDescriptors;
+    CompressedDescriptors CompressedTrainDescriptors;
+
+    Compress(QueryDescriptors, CompressedQueryDescriptors);
+    Compress(TrainDescriptors, CompressedTrainDescriptors);
+
+    // increase the number of re-ranked candidates until the recall is within the tolerance
+    std::vector<std::vector<cv::DMatch>> MatchesCompressed;
+
+    uint64 NumberOfCandidates{2U};
+
+    while(true)
+    {
+        FindTwoBestMatches(QueryDescriptors, CompressedQueryDescriptors, TrainDescriptors, CompressedTrainDescriptors, NumberOfCandidates, MatchesCompressed);
+
+        uint64 NumberOfGoodMatchesCompressed{0U};
+
+        for(sint32 i_Query{0}; i_Query < NumberOfQueryDescriptors; i_Query++)
+        {
+            const std::vector<cv::DMatch>& CurrentMatchesExact{MatchesExact[i_Query]};
+            const std::vector<cv::DMatch>& CurrentMatchesCompressed{MatchesCompressed[i_Query]};
+
+            if(PassesRatioTest(CurrentMatchesExact, RatioDistance) && PassesRatioTest(CurrentMatchesCompressed, RatioDistance) && (CurrentMatchesExact[0].trainIdx == CurrentMatchesCompressed[0].trainIdx))
+            {
+                NumberOfGoodMatchesCompressed++;
+            }
+        }
+
+        m_NumberOfCandidates = NumberOfCandidates;
+        m_Recall             = (NumberOfGoodMatchesExact > 0U) ? (static_cast<float64>(NumberOfGoodMatchesCompressed) / static_cast<float64>(NumberOfGoodMatchesExact)) : 1.0;
+
+        if((m_Recall >= (1.0 - m_MaximumRecallLoss)) || (NumberOfCandidates >= m_MaximumNumberOfCandidates))
+        {
+            break;
+        }
+
+        NumberOfCandidates = std::min(2U * NumberOfCandidates, m_MaximumNumberOfCandidates);
+    }
+}
+
+void DescriptorCompressor::Compress(const cv::Mat& Descriptors,
+                                    cv::Mat&       CompressedDescriptors,
+                                    ListSInt64&    SquaredNorms) const
+{
+    // get number of descriptors
+    const uint64 NumberOfDescriptors{static_cast<uint64>(Descriptors.rows)};
+
+    if(!m_IsTrained)
+    {
+        throw std::invalid_argument("The compressor must be trained before descriptors can be compressed.");
+    }
+
+    if((NumberOfDescriptors > 0U) && ((Descriptors.type() != CV_32F) || (static_cast<sint64>(Descriptors.cols) != m_Mean.cols())))
+    {
+        throw std::invalid_argument("Descriptors must be floating point descriptors with " + std::to_string(m_Mean.cols()) + " dimensions.");
+    }
+
+    CompressedDescriptors.create(static_cast<sint32>(NumberOfDescriptors), static_cast<sint32>(m_NumberOfDimensions), CV_8S);
+    SquaredNorms.resize(NumberOfDescriptors);
+
+    if(NumberOfDescriptors == 0U)
+    {
+        return;
+    }
+
+    // project the descriptors onto the principal subspace
+    const cv::Mat DescriptorsContinuous{Descriptors.isContinuous() ? Descriptors : Descriptors.clone()};
+
+    const Eigen::Map<const Eigen::Matrix<float32, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> DescriptorMap(DescriptorsContinuous.ptr<float32>(0), static_cast<sint64>(NumberOfDescriptors), static_cast<sint64>(DescriptorsContinuous.cols));
+
+    const MatrixFloat64 ProjectedDescriptors{((DescriptorMap.cast<float64>().rowwise() - m_Mean) * m_Projection) * m_QuantizationScale};
+
+    // quantize the projected descriptors
+    for(uint64 i_Descriptor{0U}; i_Descriptor < NumberOfDescriptors; i_Descriptor++)
+    {
+        sint8* CompressedDescriptor{CompressedDescriptors.ptr<sint8>(static_cast<sint32>(i_Descriptor))};
+        sint64 SquaredNorm{0};
+
+        for(uint64 i_Dimension{0U}; i_Dimension < m_NumberOfDimensions; i_Dimension++)
+        {
+            const float64 Value{std::clamp(std::round(ProjectedDescriptors(static_cast<sint64>(i_Descriptor), static_cast<sint64>(i_Dimension))), -127.0, 127.0)};
+            const sint64  QuantizedValue{static_cast<sint64>(Value)};
+
+            CompressedDescriptor[i_Dimension] = static_cast<sint8>(QuantizedValue);
+            SquaredNorm += QuantizedValue * QuantizedValue;
+        }
+
+        SquaredNorms[i_Descriptor] = SquaredNorm;
+    }
+}
+
+void DescriptorCompressor::Compress(const cv::Mat&         Descriptors,
+                                    CompressedDescriptors& Compressed) const
+{
+    Compress(Descriptors, Compressed.Descriptors, Compressed.SquaredNorms);
+}
+
+void DescriptorCompressor::FindTwoBestMatches(const cv::Mat&                        QueryDescriptors,
+                                              const cv::Mat&                        TrainDescriptors,
+                                              std::vector<std::vector<cv::DMatch>>& Matches) const
+{
+    FindTwoBestMatches(QueryDescriptors, TrainDescriptors, m_NumberOfCandidates, Matches);
+}
+
+void DescriptorCompressor::FindTwoBestMatches(const cv::Mat&                        QueryDescriptors,
+                                              const CompressedDescriptors&          CompressedQueryDescriptors,
+                                              const cv::Mat&                        TrainDescriptors,
+                                              const CompressedDescriptors&          CompressedTrainDescriptors,
+                                              std::vector<std::vector<cv::DMatch>>& Matches) const
+{
+    // the compressed descriptors must belong to the descriptors
+    if(!IsCompressionOf(QueryDescriptors, CompressedQueryDescriptors) || !IsCompressionOf(TrainDescriptors, CompressedTrainDescriptors))
+    {
+        throw std::invalid_argument("The compressed descriptors do not match the descriptors.");
+    }
+
+    FindTwoBestMatches(QueryDescriptors, CompressedQueryDescriptors, TrainDescriptors, CompressedTrainDescriptors, m_NumberOfCandidates, Matches);
+}
+
+uint64 DescriptorCompressor::GetNumberOfDimensions() const
+{
+    return m_NumberOfDimensions;
+}
+
+uint64 DescriptorCompressor::GetNumberOfCandidates() const
+{
+    return m_NumberOfCandidates;
+}
+
+float64 DescriptorCompressor::GetRecall() const
+{
+    return m_Recall;
+}
+
+boolean DescriptorCompressor::IsCompatible(const cv::Mat& QueryDescriptors,
+                                           const cv::Mat& TrainDescriptors) const
+{
+    const sint32 NumberOfInputDimensions{static_cast<sint32>(m_Mean.cols())};
+
+    const boolean IsQueryCompatible{(QueryDescriptors.type() == CV_32F) && (QueryDescriptors.cols == NumberOfInputDimensions)};
+    const boolean IsTrainCompatible{(TrainDescriptors.type() == CV_32F) && (TrainDescriptors.cols == NumberOfInputDimensions)};
+
+    return m_IsTrained && IsQueryCompatible && IsTrainCompatible;
+}
+
+boolean DescriptorCompressor::IsTrained() const
+{
+    return m_IsTrained;
+}
+
+template<uint64 Length>
+sint32 DescriptorCompressor::ComputeDotProduct(const sint8* DescriptorA,
+                                               const sint8* DescriptorB)
+{
+    sint32 DotProduct{0};
+
+    for(uint64 i_Element{0U}; i_Element < Length; i_Element++)
+    {
+        DotProduct += static_cast<sint32>(DescriptorA[i_Element]) * static_cast<sint32>(DescriptorB[i_Element]);
+    }
+
+    return DotProduct;
+}
+
+sint32 DescriptorCompressor::ComputeDotProduct(const sint8* DescriptorA,
+                                               const sint8* DescriptorB,
+                                               const uint64 Length)
+{
+    sint32 DotProduct{0};
+
+    for(uint64 i_Element{0U}; i_Element < Length; i_Element++)
+    {
+        DotProduct += static_cast<sint32>(DescriptorA[i_Element]) * static_cast<sint32>(DescriptorB[i_Element]);
+    }
+
+    return DotProduct;
+}
+
+void DescriptorCompressor::FindTwoBestMatches(const cv::Mat&                        QueryDescriptors,
+                                              const cv::Mat&                        TrainDescriptors,
+                                              const uint64                          NumberOfCandidates,
+                                              std::vector<std::vector<cv::DMatch>>& Matches) const
+{
+    // compress query and train descriptors
+    CompressedDescriptors CompressedQueryDescriptors;
+    CompressedDescriptors CompressedTrainDescriptors;
+
+    Compress(QueryDescriptors, CompressedQueryDescriptors);
+    Compress(TrainDescriptors, CompressedTrainDescriptors);
+
+    FindTwoBestMatches(QueryDescriptors, CompressedQueryDescriptors, TrainDescriptors, CompressedTrainDescriptors, NumberOfCandidates, Matches);
+}
+
+void DescriptorCompressor::FindTwoBestMatches(const cv::Mat&                        QueryDescriptors,
+                                              const CompressedDescriptors&          CompressedQueryDescriptors,
+                                              const cv::Mat&                        TrainDescriptors,
+                                              const CompressedDescriptors&          CompressedTrainDescriptors,
+                                              const uint64                          NumberOfCandidates,
+                                              std::vector<std::vector<cv::DMatch>>& Matches) const
+{
+    // get number of descriptors
+    const uint64 NumberOfQueryDescriptors{static_cast<uint64>(QueryDescriptors.rows)};
+    const uint64 NumberOfTrainDescriptors{static_cast<uint64>(TrainDescriptors.rows)};
+
+    // clean output matches
+    Matches.clear();
+    Matches.resize(NumberOfQueryDescriptors);
+
+    if(NumberOfTrainDescriptors == 0U)
+    {
+        return;
+    }
+
+    // select the kernel for the exact re-ranking once
+    const DescriptorKernel Kernel{DescriptorDistance::SelectKernel(QueryDescriptors, TrainDescriptors, cv::NORM_L2)};
+
+    const uint64 NumberOfCandidatesUsed{std::min(NumberOfCandidates, NumberOfTrainDescriptors)};
+
+    ListSInt64  ApproximateDistances(NumberOfTrainDescriptors);
+    ListUInt64  CandidateIndices;
+    ListFloat64 CandidateDistances;
+
+    for(uint64 i_Query{0U}; i_Query < NumberOfQueryDescriptors; i_Query++)
+    {
+        const sint8* CompressedQuery{CompressedQueryDescriptors.Descriptors.ptr<sint8>(static_cast<sint32>(i_Query))};
+
+        // rank all train descriptors by their distance in the compressed domain
+        ComputeApproximateDistances(CompressedQuery, CompressedTrainDescriptors, ApproximateDistances);
+
+        CandidateIndices.resize(NumberOfTrainDescriptors);
+
+        std::iota(CandidateIndices.begin(), CandidateIndices.end(), 0U);
+        std::nth_element(CandidateIndices.begin(),
+                         CandidateIndices.begin() + static_cast<sint64>(NumberOfCandidatesUsed - 1U),
+                         CandidateIndices.end(),
+                         [&ApproximateDistances](const uint64 IndexA, const uint64 IndexB) { return ApproximateDistances[IndexA] < ApproximateDistances[IndexB]; });
+
+        CandidateIndices.resize(NumberOfCandidatesUsed);
+
+        // re-rank the best candidates by their exact distance
+        DescriptorDistance::ComputeDistances(QueryDescriptors, i_Query, TrainDescriptors, CandidateIndices, Kernel, cv::NORM_L2, CandidateDistances);
+
+        SelectTwoBestCandidates(i_Query, CandidateIndices, CandidateDistances, Matches[i_Query]);
+    }
+}
+
+template<uint64 Length>
+void DescriptorCompressor::ComputeApproximateDistances(const sint8*                 CompressedQuery,
+                                                       const CompressedDescriptors& CompressedTrainDescriptors,
+                                                       ListSInt64&                  ApproximateDistances)
+{
+    // get number of train descriptors
+    const uint64 NumberOfTrainDescriptors{ApproximateDistances.size()};
+
+    const sint8* CompressedTrain{CompressedTrainDescriptors.Descriptors.ptr<sint8>(0)};
+
+    for(uint64 i_Train{0U}; i_Train < NumberOfTrainDescriptors; i_Train++)
+    {
+        ApproximateDistances[i_Train] = CompressedTrainDescriptors.SquaredNorms[i_Train] - 2 * static_cast<sint64>(ComputeDotProduct<Length>(CompressedQuery, CompressedTrain + i_Train * Length));
+    }
+}
+
+void DescriptorCompressor::ComputeApproximateDistances(const sint8*                 CompressedQuery,
+                                                       const CompressedDescriptors& CompressedTrainDescriptors,
+                                                       ListSInt64&                  ApproximateDistances) const
+{
+    // dispatch once for all train descriptors
+    switch(m_NumberOfDimensions)
+    {
+        case 16U:
+        {
+            ComputeApproximateDistances<16U>(CompressedQuery, CompressedTrainDescriptors, ApproximateDistances);
+
+            break;
+        }
+        case 32U:
+        {
+            ComputeApproximateDistances<32U>(CompressedQuery, CompressedTrainDescriptors, ApproximateDistances);
+
+            break;
+        }
+        case 64U:
+        {
+            ComputeApproximateDistances<64U>(CompressedQuery, CompressedTrainDescriptors, ApproximateDistances);
+
+            break;
+        }
+        case 128U:
+        {
+            ComputeApproximateDistances<128U>(CompressedQuery, CompressedTrainDescriptors, ApproximateDistances);
+
+            break;
+        }
+        default:
+        {
+            const uint64 NumberOfTrainDescriptors{ApproximateDistances.size()};
+
+            const sint8* CompressedTrain{CompressedTrainDescriptors.Descriptors.ptr<sint8>(0)};
+
+            for(uint64 i_Train{0U}; i_Train < NumberOfTrainDescriptors; i_Train++)
+            {
+                ApproximateDistances[i_Train] = CompressedTrainDescriptors.SquaredNorms[i_Train] - 2 * static_cast<sint64>(ComputeDotProduct(CompressedQuery, CompressedTrain + i_Train * m_NumberOfDimensions, m_NumberOfDimensions));
+            }
+
+            break;
+        }
+    }
+}
+
+void DescriptorCompressor::FindTwoBestMatchesExact(const cv::Mat&                        QueryDescriptors,
+                                                   const cv::Mat&                        TrainDescriptors,
+                                                   std::vector<std::vector<cv::DMatch>>& Matches)
+{
+    // get number of descriptors
+    const uint64 NumberOfQueryDescriptors{static_cast<uint64>(QueryDescriptors.rows)};
+    const uint64 NumberOfTrainDescriptors{static_cast<uint64>(TrainDescriptors.rows)};
+
+    // clean output matches
+    Matches.clear();
+    Matches.resize(NumberOfQueryDescriptors);
+
+    // compare each query descriptor against all train descriptors
+    const DescriptorKernel Kernel{DescriptorDistance::SelectKernel(QueryDescriptors, TrainDescriptors, cv::NORM_L2)};
+
+    ListUInt64 TrainIndices(NumberOfTrainDescriptors);
+
+    std::iota(TrainIndices.begin(), TrainIndices.end(), 0U);
+
+    ListFloat64 Distances;
+
+    for(uint64 i_Query{0U}; i_Query < NumberOfQueryDescriptors; i_Query++)
+    {
+        DescriptorDistance::ComputeDistances(QueryDescriptors, i_Query, TrainDescriptors, Kernel, cv::NORM_L2, Distances);
+
+        SelectTwoBestCandidates(i_Query, TrainIndices, Distances, Matches[i_Query]);
+    }
+}
+
+boolean DescriptorCompressor::IsCompressionOf(const cv::Mat&               Descriptors,
+                                              const CompressedDescriptors& Compressed) const
+{
+    const boolean IsNumberOfDescriptorsEqual{(Compressed.Descriptors.rows == Descriptors.rows) && (Compressed.SquaredNorms.size() == static_cast<uint64>(Descriptors.rows))};
+    const boolean IsNumberOfDimensionsEqual{(Descriptors.rows == 0) || (Compressed.Descriptors.cols == static_cast<sint32>(m_NumberOfDimensions))};
+
+    return IsNumberOfDescriptorsEqual && IsNumberOfDimensionsEqual && (Compressed.Descriptors.empty() || Compressed.Descriptors.isContinuous());
+}
+
+boolean DescriptorCompressor::PassesRatioTest(const std::vector<cv::DMatch>& Matches,
+                                              const float64                  RatioDistance)
+{
+    return (Matches.size() >= 2U) && (static_cast<float64>(Matches[0].distance) < (RatioDistance * static_cast<float64>(Matches[1].distance)));
+}
+
+void DescriptorCompressor::SelectTwoBestCandidates(const uint64             QueryIndex,
+                                                   const ListUInt64&        CandidateIndices,
+                                                   const ListFloat64&       CandidateDistances,
+                                                   std::vector<cv::DMatch>& Matches)
+{
+    // get number of candidates
+    const uint64 NumberOfCandidates{CandidateIndices.size()};
+
+    // find the two best candidates
+    uint64  IndexBest{0U};
+    uint64  IndexSecondBest{0U};
+    float64 DistanceBest{std::numeric_limits<float64>::max()};
+    float64 DistanceSecondBest{std::numeric_limits<float64>::max()};
+
+    for(uint64 i_Candidate{0U}; i_Candidate < NumberOfCandidates; i_Candidate++)
+    {
+        const float64 Distance{CandidateDistances[i_Candidate]};
+
+        if(Distance < DistanceBest)
+        {
+            DistanceSecondBest = DistanceBest;
+            IndexSecondBest    = IndexBest;
+            DistanceBest       = Distance;
+            IndexBest          = CandidateIndices[i_Candidate];
+        }
+        else if(Distance < DistanceSecondBest)
+        {
+            DistanceSecondBest = Distance;
+            IndexSecondBest    = CandidateIndices[i_Candidate];
+        }
+    }
+
+    // store the matches
+    Matches.clear();
+
+    if(NumberOfCandidates > 0U)
+    {
+        Matches.emplace_back(static_cast<sint32>(QueryIndex), static_cast<sint32>(IndexBest), static_cast<float32>(DistanceBest));
+    }
+
+    if(NumberOfCandidates > 1U)
+    {
+        Matches.emplace_back(static_cast<sint32>(QueryIndex), static_cast<sint32>(IndexSecondBest), static_cast<float32>(DistanceSecondBest));
+    }
+}
+
+// explicit instantiations of the dot product kernels
+template sint32 DescriptorCompressor::ComputeDotProduct<16U>(const sint8*, const sint8*);
+template sint32 DescriptorCompressor::ComputeDotProduct<32U>(const sint8*, const sint8*);
+template sint32 DescriptorCompressor::ComputeDotProduct<64U>(const sint8*, const sint8*);
+template sint32 DescriptorCompressor::ComputeDotProduct<128U>(const sint8*, const sint8*);
@@ -0,0 +1,253 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  DescriptorDistance.cpp
+///
+/// \brief Source file containing the DescriptorDistance class.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#include <cmath>
+#include <cstring>
+
+#include "../include/DescriptorDistance.h"
+
+DescriptorKernel DescriptorDistance::SelectKernel(const cv::Mat& Descriptors,
+                                                  const sint32   NormType)
+{
+    // the kernels access the rows by pointers
+    if(Descriptors.empty() || !Descriptors.isContinuous())
+    {
+        return KernelGeneric;
+    }
+
+    // binary descriptors
+    if((Descriptors.type() == CV_8U) && (NormType == cv::NORM_HAMMING))
+    {
+        if(Descriptors.cols == 32)
+        {
+            return KernelBinary256;
+        }
+
+        if(Descriptors.cols == 64)
+        {
+            return KernelBinary512;
+        }
+    }
+
+    // floating point descriptors
+    if((Descriptors.type() == CV_32F) && (NormType == cv::NORM_L2))
+    {
+        if(Descriptors.cols == 64)
+        {
+            return KernelFloat64;
+        }
+
+        if(Descriptors.cols == 128)
+        {
+            return KernelFloat128;
+        }
+    }
+
+    return KernelGeneric;
+}
+
+DescriptorKernel DescriptorDistance::SelectKernel(const cv::Mat& QueryDescriptors,
+                                                  const cv::Mat& TrainDescriptors,
+                                                  const sint32   NormType)
+{
+    const DescriptorKernel KernelQuery{SelectKernel(QueryDescriptors, NormType)};
+    const DescriptorKernel KernelTrain{SelectKernel(TrainDescriptors, NormType)};
+
+    return (KernelQuery == KernelTrain) ? KernelQuery : KernelGeneric;
+}
+
+void DescriptorDistance::ComputeDistances(const cv::Mat&         QueryDescriptors,
+                                          const uint64           QueryIndex,
+                                          const cv::Mat&         TrainDescriptors,
+                                          const DescriptorKernel Kernel,
+                                          const sint32           NormType,
+                                          ListFloat64&           Distances)
+{
+    // compare against all train descriptors
+    Distances.resize(static_cast<uint64>(TrainDescriptors.rows));
+
+    const auto SelectTrainRow{[](const uint64 IndexDistance) { return IndexDistance; }};
+
+    DispatchDistances(QueryDescriptors, QueryIndex, TrainDescriptors, SelectTrainRow, Kernel, NormType, Distances);
+}
+
+void DescriptorDistance::ComputeDistances(const cv::Mat&         QueryDescriptors,
+                                          const uint64           QueryIndex,
+                                          const cv::Mat&         TrainDescriptors,
+                                          const ListUInt64&      TrainIndices,
+                                          const DescriptorKernel Kernel,
+                                          const sint32           NormType,
+                                          ListFloat64&           Distances)
+{
+    // compare against the selected train descriptors
+    Distances.resize(TrainIndices.size());
+
+    const auto SelectTrainRow{[&TrainIndices](const uint64 IndexDistance) { return TrainIndices[IndexDistance]; }};
+
+    DispatchDistances(QueryDescriptors, QueryIndex, TrainDescriptors, SelectTrainRow, Kernel, NormType, Distances);
+}
+
+template<uint64 NumberOfBytes>
+uint32 DescriptorDistance::ComputeHammingDistance(const uint8* DescriptorA,
+                                                  const uint8* DescriptorB)
+{
+    static_assert((NumberOfBytes % sizeof(uint64)) == 0U, "Binary descriptors have to consist of complete 64-bit words.");
+
+    uint32 Distance{0U};
+
+    for(uint64 i_Byte{0U}; i_Byte < NumberOfBytes; i_Byte += sizeof(uint64))
+    {
+        Distance += CountBits(LoadWord(DescriptorA + i_Byte) ^ LoadWord(DescriptorB + i_Byte));
+    }
+
+    return Distance;
+}
+
+template<uint64 NumberOfElements>
+float64 DescriptorDistance::ComputeEuclideanDistance(const float32* DescriptorA,
+                                                     const float32* DescriptorB)
+{
+    float32 SquaredDistance{0.0F};
+
+    for(uint64 i_Element{0U}; i_Element < NumberOfElements; i_Element++)
+    {
+        const float32 Difference{DescriptorA[i_Element] - DescriptorB[i_Element]};
+
+        SquaredDistance += Difference * Difference;
+    }
+
+    return std::sqrt(static_cast<float64>(SquaredDistance));
+}
+
+template<DescriptorKernel Kernel>
+float64 DescriptorDistance::ComputeDistance(const typename DescriptorKernelTraits<Kernel>::ElementType* DescriptorA,
+                                            const typename DescriptorKernelTraits<Kernel>::ElementType* DescriptorB)
+{
+    using Traits = DescriptorKernelTraits<Kernel>;
+
+    if constexpr(Traits::IsBinary)
+    {
+        return static_cast<float64>(ComputeHammingDistance<Traits::NumberOfElements>(DescriptorA, DescriptorB));
+    }
+    else
+    {
+        return ComputeEuclideanDistance<Traits::NumberOfElements>(DescriptorA, DescriptorB);
+    }
+}
+
+template<DescriptorKernel Kernel, typename TrainRowSelector>
+void DescriptorDistance::ComputeDistances(const cv::Mat&          QueryDescriptors,
+                                          const uint64            QueryIndex,
+                                          const cv::Mat&          TrainDescriptors,
+                                          const TrainRowSelector& SelectTrainRow,
+                                          ListFloat64&            Distances)
+{
+    using Traits      = DescriptorKernelTraits<Kernel>;
+    using ElementType = typename Traits::ElementType;
+
+    const uint64 NumberOfDistances{Distances.size()};
+
+    const ElementType* Query{QueryDescriptors.ptr<ElementType>(static_cast<sint32>(QueryIndex))};
+    const ElementType* Train{TrainDescriptors.ptr<ElementType>(0)};
+
+    for(uint64 i_Distance{0U}; i_Distance < NumberOfDistances; i_Distance++)
+    {
+        Distances[i_Distance] = ComputeDistance<Kernel>(Query, Train + SelectTrainRow(i_Distance) * Traits::NumberOfElements);
+    }
+}
+
+template<typename TrainRowSelector>
+void DescriptorDistance::DispatchDistances(const cv::Mat&          QueryDescriptors,
+                                           const uint64            QueryIndex,
+                                           const cv::Mat&          TrainDescriptors,
+                                           const TrainRowSelector& SelectTrainRow,
+                                           const DescriptorKernel  Kernel,
+                                           const sint32            NormType,
+                                           ListFloat64&            Distances)
+{
+    // dispatch once for all selected train descriptors
+    switch(Kernel)
+    {
+        case KernelBinary256:
+        {
+            ComputeDistances<KernelBinary256>(QueryDescriptors, QueryIndex, TrainDescriptors, SelectTrainRow, Distances);
+
+            break;
+        }
+        case KernelBinary512:
+        {
+            ComputeDistances<KernelBinary512>(QueryDescriptors, QueryIndex, TrainDescriptors, SelectTrainRow, Distances);
+
+            break;
+        }
+        case KernelFloat64:
+        {
+            ComputeDistances<KernelFloat64>(QueryDescriptors, QueryIndex, TrainDescriptors, SelectTrainRow, Distances);
+
+            break;
+        }
+        case KernelFloat128:
+        {
+            ComputeDistances<KernelFloat128>(QueryDescriptors, QueryIndex, TrainDescriptors, SelectTrainRow, Distances);
+
+            break;
+        }
+        default:
+        {
+            const cv::Mat Query{QueryDescriptors.row(static_cast<sint32>(QueryIndex))};
+
+            const uint64 NumberOfDistances{Distances.size()};
+
+            for(uint64 i_Distance{0U}; i_Distance < NumberOfDistances; i_Distance++)
+            {
+                Distances[i_Distance] = cv::norm(Query, TrainDescriptors.row(static_cast<sint32>(SelectTrainRow(i_Distance))), NormType);
+            }
+
+            break;
+        }
+    }
+}
+
+uint32 DescriptorDistance::CountBits(const uint64 Word)
+{
+    return static_cast<uint32>(__builtin_popcountll(Word));
+}
+
+uint64 DescriptorDistance::LoadWord(const uint8* Address)
+{
+    uint64 Word{0U};
+
+    std::memcpy(&Word, Address, sizeof(Word));
+
+    return Word;
+}
+
+// explicit instantiations of the kernels
+template uint32 DescriptorDistance::ComputeHammingDistance<DescriptorKernelTraits<KernelBinary256>::NumberOfElements>(const uint8*, const uint8*);
+template uint32 DescriptorDistance::ComputeHammingDistance<DescriptorKernelTraits<KernelBinary512>::NumberOfElements>(const uint8*, const uint8*);
+template float64 DescriptorDistance::ComputeEuclideanDistance<DescriptorKernelTraits<KernelFloat64>::NumberOfElements>(const float32*, const float32*);
+template float64 DescriptorDistance::ComputeEuclideanDistance<DescriptorKernelTraits<KernelFloat128>::NumberOfElements>(const float32*, const float32*);
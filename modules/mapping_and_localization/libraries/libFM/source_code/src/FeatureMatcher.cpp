@@ -25,135 +25,534 @@ You should have received a copy of the GNU General Public License along with
 the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
 */
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+#include <opencv2/imgproc/imgproc.hpp>
+
+#include "../../../libFB/source_code/include/FeatureBucketerByOrder.h"
 #include "../include/FeatureMatcher.h"
 
 FeatureMatcher::FeatureMatcher(const float64 RatioDistance) :
-    m_DescriptorMatcher{new cv::BFMatcher},
+    m_FeatureDetectorFactory{[]() { return cv::Ptr<cv::Feature2D>(cv::ORB::create()); }},
+    m_FeatureDetector{m_FeatureDetectorFactory()},
+    m_DescriptorMatcher{cv::BFMatcher::create(cv::NORM_HAMMING)},
+    m_NormType{DetermineNormType(m_DescriptorMatcher, m_FeatureDetector)},
     m_RatioDistance{RatioDistance},
-    m_ParametersSetInternally{true}
+    m_UseDescriptorKernels{true},
+    m_DescriptorCompressor{nullptr}
 {
-    // set internal attributes
-    m_FeatureDetector = cv::ORB::create();
 }
 
-FeatureMatcher::FeatureMatcher(const cv::Ptr<cv::Feature2D>& FeatureDetector,
-                               cv::DescriptorMatcher*        DescriptorMatcher,
-                               const float64                 RatioDistance) :
+FeatureMatcher::FeatureMatcher(const cv::Ptr<cv::Feature2D>&         FeatureDetector,
+                               const cv::Ptr<cv::DescriptorMatcher>& DescriptorMatcher,
+                               const float64                         RatioDistance,
+                               const DescriptorCompressor*           Compressor,
+                               const boolean                         UseDescriptorKernels) :
     m_FeatureDetector{FeatureDetector},
     m_DescriptorMatcher{DescriptorMatcher},
+    m_NormType{DetermineNormType(m_DescriptorMatcher, m_FeatureDetector)},
+    m_RatioDistance{RatioDistance},
+    m_UseDescriptorKernels{UseDescriptorKernels},
+    m_DescriptorCompressor{Compressor}
+{
+    CheckDescriptorKernels();
+}
+
+FeatureMatcher::FeatureMatcher(const FeatureDetectorFactory&         DetectorFactory,
+                               const cv::Ptr<cv::DescriptorMatcher>& DescriptorMatcher,
+                               const float64                         RatioDistance,
+                               const DescriptorCompressor*           Compressor,
+                               const boolean                         UseDescriptorKernels) :
+    m_FeatureDetectorFactory{DetectorFactory},
+    m_FeatureDetector{m_FeatureDetectorFactory()},
+    m_DescriptorMatcher{DescriptorMatcher},
+    m_NormType{DetermineNormType(m_DescriptorMatcher, m_FeatureDetector)},
     m_RatioDistance{RatioDistance},
-    m_ParametersSetInternally{false}
+    m_UseDescriptorKernels{UseDescriptorKernels},
+    m_DescriptorCompressor{Compressor}
 {
+    CheckDescriptorKernels();
 }
 
 FeatureMatcher::~FeatureMatcher()
 {
-    if(m_ParametersSetInternally)
+}
+
+FeatureBucketerByOrder FeatureMatcher::CreateGridIndex(const std::vector<cv::KeyPoint>& ExtractedFeaturesTarget,
+                                                       const uint64                     NumberOfPixelsHorizontal,
+                                                       const uint64                     NumberOfPixelsVertical,
+                                                       const float64                    CellSize)
+{
+    // check cell size
+    if(std::isnan(CellSize) || (CellSize <= 0.0))
+    {
+        throw std::invalid_argument("The cell size of the grid index must be positive.");
+    }
+
+    // get number of cells (cells are at least as large as the cell size)
+    const float64 MaximumNumberOfCells{static_cast<float64>(std::numeric_limits<uint8>::max())};
+
+    const uint8 NumberOfCellsHorizontal{static_cast<uint8>(std::clamp(std::floor(static_cast<float64>(NumberOfPixelsHorizontal) / CellSize), 1.0, MaximumNumberOfCells))};
+    const uint8 NumberOfCellsVertical{static_cast<uint8>(std::clamp(std::floor(static_cast<float64>(NumberOfPixelsVertical) / CellSize), 1.0, MaximumNumberOfCells))};
+
+    // index all target features (the selection of the bucketer is not used)
+    FeatureBucketerByOrder GridIndex(NumberOfPixelsHorizontal, NumberOfPixelsVertical, NumberOfCellsHorizontal, NumberOfCellsVertical, std::numeric_limits<uint8>::max());
+
+    const uint64 NumberOfFeaturesTarget{ExtractedFeaturesTarget.size()};
+
+    ListColumnVectorFloat64_2d ImagePointsTarget(NumberOfFeaturesTarget);
+
+    for(uint64 i_Feature{0U}; i_Feature < NumberOfFeaturesTarget; i_Feature++)
     {
-        delete m_DescriptorMatcher;
+        ImagePointsTarget[i_Feature] << ExtractedFeaturesTarget[i_Feature].pt.x, ExtractedFeaturesTarget[i_Feature].pt.y;
     }
+
+    GridIndex.BucketFeatures(ImagePointsTarget);
+
+    return GridIndex;
+}
+
+void FeatureMatcher::ExtractFeatures(const cv::Mat&             Image,
+                                     std::vector<cv::KeyPoint>& ExtractedFeatures,
+                                     cv::Mat&                   FeatureDescriptors) const
+{
+    const ResourceLease Lease(*this);
+
+    ExtractFeatures(Image, Lease.GetResources(), ExtractedFeatures, FeatureDescriptors);
+}
+
+void FeatureMatcher::ExtractFeatures(const cv::Mat&             Image,
+                                     const FeatureBucketerBase& Bucketer,
+                                     BucketedDetectionState&    State,
+                                     std::vector<cv::KeyPoint>& ExtractedFeatures,
+                                     cv::Mat&                   FeatureDescriptors,
+                                     const uint8                InitialThreshold,
+                                     const uint8                MinimumThreshold) const
+{
+    const ResourceLease Lease(*this);
+
+    ExtractFeatures(Image, Bucketer, State, InitialThreshold, MinimumThreshold, Lease.GetResources(), ExtractedFeatures, FeatureDescriptors);
 }
 
 uint64 FeatureMatcher::FindCorrespondences(const std::vector<cv::Mat>&              Images,
-                                           std::vector<ListColumnVectorFloat64_2d>& FeatureCorrespondences)
+                                           std::vector<ListColumnVectorFloat64_2d>& FeatureCorrespondences,
+                                           Statistics*                              CallStatistics) const
 {
-    // get number of images
-    const uint64 NumberOfImages{Images.size()};
+    const ResourceLease Lease(*this);
+    MatchingResources&  Resources{Lease.GetResources()};
 
-    // clean input correspondences
-    for(uint64 i_Image{0U}; i_Image < NumberOfImages; i_Image++)
-    {
-        FeatureCorrespondences[i_Image].clear();
-    }
+    const uint64 NumberOfChains{ExtractAndChainFeatures(Images, nullptr, nullptr, 0U, 0U, Resources, CallStatistics)};
 
-    // extract features and calculate descriptors for all images
-    std::vector<std::vector<cv::KeyPoint>> ExtractedFeatures;
-    std::vector<cv::Mat>                   FeatureDescriptors;
+    CollectFeatureCorrespondences(Resources.ExtractedFeatures, Resources.FeatureChains, NumberOfChains, FeatureCorrespondences);
 
-    // pre-allocate memory
-    ExtractedFeatures.resize(NumberOfImages);
-    FeatureDescriptors.resize(NumberOfImages);
+    return NumberOfChains;
+}
 
-    for(uint64 i_Image{0U}; i_Image < NumberOfImages; i_Image++)
-    {
-        // extract features
-        m_FeatureDetector->detect(Images[i_Image], ExtractedFeatures[i_Image]);
+uint64 FeatureMatcher::FindCorrespondences(const std::vector<cv::Mat>&              Images,
+                                           const FeatureBucketerBase&               Bucketer,
+                                           std::vector<BucketedDetectionState>&     States,
+                                           std::vector<ListColumnVectorFloat64_2d>& FeatureCorrespondences,
+                                           const uint8                              InitialThreshold,
+                                           const uint8                              MinimumThreshold,
+                                           Statistics*                              CallStatistics) const
+{
+    const ResourceLease Lease(*this);
+    MatchingResources&  Resources{Lease.GetResources()};
 
-        // calculate descriptors
-        m_FeatureDetector->compute(Images[i_Image], ExtractedFeatures[i_Image], FeatureDescriptors[i_Image]);
-    }
+    const uint64 NumberOfChains{ExtractAndChainFeatures(Images, &Bucketer, &States, InitialThreshold, MinimumThreshold, Resources, CallStatistics)};
 
-    // get number of extracted features in first image
-    const uint64 NumberOfExtractedFeatures{ExtractedFeatures[0].size()};
+    CollectFeatureCorrespondences(Resources.ExtractedFeatures, Resources.FeatureChains, NumberOfChains, FeatureCorrespondences);
 
-    // find feature correspondences
-    uint64 NumberOfCorrespondencesFound{0U};
+    return NumberOfChains;
+}
 
-    std::vector<std::vector<std::vector<cv::DMatch>>> FeatureCorrespondencesInternal;
+uint64 FeatureMatcher::FindCorrespondences(const std::vector<cv::Mat>& Images,
+                                           ListMatrixFloat32_2xX&      FeatureCorrespondences,
+                                           MatrixUInt64&               FeatureIndices,
+                                           Statistics*                 CallStatistics) const
+{
+    const ResourceLease Lease(*this);
+    MatchingResources&  Resources{Lease.GetResources()};
 
-    FeatureCorrespondencesInternal.resize(NumberOfImages);
+    const uint64 NumberOfChains{ExtractAndChainFeatures(Images, nullptr, nullptr, 0U, 0U, Resources, CallStatistics)};
 
-    for(uint64 i_Image{0U}; i_Image < NumberOfImages; i_Image++)
+    CollectFeatureCorrespondences(Resources.ExtractedFeatures, Resources.FeatureChains, NumberOfChains, FeatureCorrespondences, FeatureIndices);
+
+    return NumberOfChains;
+}
+
+uint64 FeatureMatcher::FindCorrespondences(const std::vector<cv::Mat>& Images,
+                                           ListMatrixFloat64_2xX&      FeatureCorrespondences,
+                                           MatrixUInt64&               FeatureIndices,
+                                           Statistics*                 CallStatistics) const
+{
+    const ResourceLease Lease(*this);
+    MatchingResources&  Resources{Lease.GetResources()};
+
+    const uint64 NumberOfChains{ExtractAndChainFeatures(Images, nullptr, nullptr, 0U, 0U, Resources, CallStatistics)};
+
+    CollectFeatureCorrespondences(Resources.ExtractedFeatures, Resources.FeatureChains, NumberOfChains, FeatureCorrespondences, FeatureIndices);
+
+    return NumberOfChains;
+}
+
+uint64 FeatureMatcher::FindCorrespondencesInWindow(const cv::Mat&                    FeatureDescriptorsQuery,
+                                                   const ListColumnVectorFloat64_2d& PredictedImagePoints,
+                                                   const std::vector<cv::KeyPoint>&  ExtractedFeaturesTarget,
+                                                   const cv::Mat&                    FeatureDescriptorsTarget,
+                                                   const uint64                      NumberOfPixelsHorizontal,
+                                                   const uint64                      NumberOfPixelsVertical,
+                                                   const float64                     SearchRadius,
+                                                   std::vector<cv::DMatch>&          Matches,
+                                                   const boolean                     AcceptSingleCandidates) const
+{
+    // index the target features by a uniform grid (cells are at least as large as the search radius)
+    const FeatureBucketerByOrder GridIndex{CreateGridIndex(ExtractedFeaturesTarget, NumberOfPixelsHorizontal, NumberOfPixelsVertical, SearchRadius)};
+
+    return FindCorrespondencesInWindow(FeatureDescriptorsQuery, PredictedImagePoints, ExtractedFeaturesTarget, FeatureDescriptorsTarget, GridIndex, SearchRadius, Matches, AcceptSingleCandidates);
+}
+
+uint64 FeatureMatcher::FindCorrespondencesInWindow(const cv::Mat&                    FeatureDescriptorsQuery,
+                                                   const ListColumnVectorFloat64_2d& PredictedImagePoints,
+                                                   const std::vector<cv::KeyPoint>&  ExtractedFeaturesTarget,
+                                                   const cv::Mat&                    FeatureDescriptorsTarget,
+                                                   const FeatureBucketerBase&        GridIndex,
+                                                   const float64                     SearchRadius,
+                                                   std::vector<cv::DMatch>&          Matches,
+                                                   const boolean                     AcceptSingleCandidates) const
+{
+    // check search radius
+    if(std::isnan(SearchRadius) || (SearchRadius <= 0.0))
     {
-        const uint64 FirstIndex{i_Image % NumberOfImages};
-        const uint64 SecondIndex{(i_Image + 1U) % NumberOfImages};
+        throw std::invalid_argument("The search radius must be positive.");
+    }
 
-        m_DescriptorMatcher->knnMatch(FeatureDescriptors[FirstIndex], FeatureDescriptors[SecondIndex], FeatureCorrespondencesInternal[i_Image], 2);
+    // check number of query and target features
+    if(static_cast<uint64>(FeatureDescriptorsQuery.rows) != PredictedImagePoints.size())
+    {
+        throw std::invalid_argument("The number of query descriptors must match the number of predicted image points.");
     }
 
-    for(uint64 i_Feature{0U}; i_Feature < NumberOfExtractedFeatures; i_Feature++)
+    if(static_cast<uint64>(FeatureDescriptorsTarget.rows) != ExtractedFeaturesTarget.size())
     {
-        uint64  FeatureIndex{0U};
-        boolean IsGoodMatch{true};
+        throw std::invalid_argument("The number of target descriptors must match the number of target features.");
+    }
 
-        std::vector<uint64> IndexList;
-        IndexList.resize(NumberOfImages);
+    // get number of features
+    const uint64 NumberOfFeaturesQuery{PredictedImagePoints.size()};
+    const uint64 NumberOfFeaturesTarget{ExtractedFeaturesTarget.size()};
 
-        for(uint64 i_Image{0U}; i_Image < NumberOfImages; i_Image++)
+    // get layout of the grid index
+    const uint16 NumberOfBucketsHorizontal{GridIndex.GetNumberOfBucketsHorizontal()};
+    const uint16 NumberOfBuckets{static_cast<uint16>(NumberOfBucketsHorizontal * GridIndex.GetNumberOfBucketsVertical())};
+
+    // check whether the grid index refers to the target features or not
+    for(uint16 i_Bucket{0U}; i_Bucket < NumberOfBuckets; i_Bucket++)
+    {
+        for(const uint64 FeatureIndex : GridIndex.GetFeatureIndicesInBucket(i_Bucket))
         {
-            if(i_Image == 0U)
+            if(FeatureIndex >= NumberOfFeaturesTarget)
             {
-                FeatureIndex = i_Feature;
+                throw std::invalid_argument("The grid index must only contain indices of target features.");
             }
-            else
+        }
+    }
+
+    // clean output matches
+    Matches.clear();
+
+    // find best matches of the query features (invalid matches are marked by the number of target features, the buffers are reused)
+    const ResourceLease Lease(*this);
+    MatchingResources&  Resources{Lease.GetResources()};
+
+    ListUInt64&  BestMatchQuery{Resources.BestMatchesQuery};
+    ListFloat64& BestDistanceQuery{Resources.BestDistancesQuery};
+    ListUInt64&  BestMatchTarget{Resources.BestMatchesTarget};
+    ListFloat64& BestDistanceTarget{Resources.BestDistancesTarget};
+
+    BestMatchQuery.assign(NumberOfFeaturesQuery, NumberOfFeaturesTarget);
+    BestDistanceQuery.assign(NumberOfFeaturesQuery, std::numeric_limits<float64>::max());
+    BestMatchTarget.assign(NumberOfFeaturesTarget, NumberOfFeaturesQuery);
+    BestDistanceTarget.assign(NumberOfFeaturesTarget, std::numeric_limits<float64>::max());
+
+    const sint32           NormType{m_NormType};
+    const DescriptorKernel Kernel{DescriptorDistance::SelectKernel(FeatureDescriptorsQuery, FeatureDescriptorsTarget, NormType)};
+    const float64          SearchRadiusSquared{SearchRadius * SearchRadius};
+    const float64          MaximumCoordinateHorizontal{static_cast<float64>(GridIndex.GetNumberOfPixelsHorizontal()) - 1.0};
+    const float64          MaximumCoordinateVertical{static_cast<float64>(GridIndex.GetNumberOfPixelsVertical()) - 1.0};
+
+    ListUInt64&  CandidateIndices{Resources.CandidateIndices};
+    ListFloat64& CandidateDistances{Resources.CandidateDistances};
+
+    for(uint64 i_FeatureQuery{0U}; i_FeatureQuery < NumberOfFeaturesQuery; i_FeatureQuery++)
+    {
+        const ColumnVectorFloat64_2d& PredictedImagePoint{PredictedImagePoints[i_FeatureQuery]};
+
+        if(!PredictedImagePoint.allFinite())
+        {
+            continue; // no valid prediction for the current feature
+        }
+
+        // get corners of the search window (clipped at the image borders)
+        const float64 WindowLeft{std::max(PredictedImagePoint(0) - SearchRadius, 0.0)};
+        const float64 WindowRight{std::min(PredictedImagePoint(0) + SearchRadius, MaximumCoordinateHorizontal)};
+        const float64 WindowTop{std::max(PredictedImagePoint(1) - SearchRadius, 0.0)};
+        const float64 WindowBottom{std::min(PredictedImagePoint(1) + SearchRadius, MaximumCoordinateVertical)};
+
+        // get buckets covered by the search window
+        uint16 BucketIDTopLeft{0U};
+        uint16 BucketIDBottomRight{0U};
+
+        const boolean BucketIDTopLeftIsValid{GridIndex.ComputeBucketID(WindowLeft, WindowTop, BucketIDTopLeft)};
+        const boolean BucketIDBottomRightIsValid{GridIndex.ComputeBucketID(WindowRight, WindowBottom, BucketIDBottomRight)};
+
+        if(!BucketIDTopLeftIsValid || !BucketIDBottomRightIsValid || (WindowLeft > WindowRight) || (WindowTop > WindowBottom))
+        {
+            continue; // search window is outside the image
+        }
+
+        const uint16 BucketColumnFirst{static_cast<uint16>(BucketIDTopLeft % NumberOfBucketsHorizontal)};
+        const uint16 BucketColumnLast{static_cast<uint16>(BucketIDBottomRight % NumberOfBucketsHorizontal)};
+        const uint16 BucketRowFirst{static_cast<uint16>(BucketIDTopLeft / NumberOfBucketsHorizontal)};
+        const uint16 BucketRowLast{static_cast<uint16>(BucketIDBottomRight / NumberOfBucketsHorizontal)};
+
+        // collect all candidates inside the search window
+        CandidateIndices.clear();
+
+        for(uint16 i_BucketRow{BucketRowFirst}; i_BucketRow <= BucketRowLast; i_BucketRow++)
+        {
+            for(uint16 i_BucketColumn{BucketColumnFirst}; i_BucketColumn <= BucketColumnLast; i_BucketColumn++)
             {
-                FeatureIndex = IndexList[i_Image - 1U];
+                const uint16 BucketID{static_cast<uint16>(i_BucketRow * NumberOfBucketsHorizontal + i_BucketColumn)};
+
+                for(const uint64 CandidateIndex : GridIndex.GetFeatureIndicesInBucket(BucketID))
+                {
+                    const cv::Point2f& ImagePointTarget{ExtractedFeaturesTarget[CandidateIndex].pt};
+
+                    const float64 DifferenceHorizontal{static_cast<float64>(ImagePointTarget.x) - PredictedImagePoint(0)};
+                    const float64 DifferenceVertical{static_cast<float64>(ImagePointTarget.y) - PredictedImagePoint(1)};
+                    const float64 DistanceSquared{DifferenceHorizontal * DifferenceHorizontal + DifferenceVertical * DifferenceVertical};
+
+                    if(DistanceSquared <= SearchRadiusSquared)
+                    {
+                        CandidateIndices.push_back(CandidateIndex);
+                    }
+                }
             }
+        }
+
+        // compare the current feature against all candidates
+        ComputeCandidateDistances(FeatureDescriptorsQuery, i_FeatureQuery, FeatureDescriptorsTarget, CandidateIndices, Kernel, NormType, CandidateDistances);
 
-            IndexList[i_Image] = FeatureCorrespondencesInternal[i_Image][FeatureIndex][0].trainIdx;
+        const uint64 NumberOfCandidates{CandidateIndices.size()};
 
-            const float64 DistanceBest{FeatureCorrespondencesInternal[i_Image][FeatureIndex][0].distance};
-            const float64 DistanceSecondBest{FeatureCorrespondencesInternal[i_Image][FeatureIndex][1].distance};
+        uint64  IndexBest{NumberOfFeaturesTarget};
+        float64 DistanceBest{std::numeric_limits<float64>::max()};
+        float64 DistanceSecondBest{std::numeric_limits<float64>::max()};
+
+        for(uint64 i_Candidate{0U}; i_Candidate < NumberOfCandidates; i_Candidate++)
+        {
+            const float64 Distance{CandidateDistances[i_Candidate]};
 
-            if(DistanceBest < (m_RatioDistance * DistanceSecondBest))
+            if(Distance < DistanceBest)
             {
-                IsGoodMatch = IsGoodMatch && true; // NOLINT(readability-simplify-boolean-expr)
+                DistanceSecondBest = DistanceBest;
+                DistanceBest       = Distance;
+                IndexBest          = CandidateIndices[i_Candidate];
             }
-            else
+            else if(Distance < DistanceSecondBest)
             {
-                IsGoodMatch = IsGoodMatch && false; // NOLINT(readability-simplify-boolean-expr)
+                DistanceSecondBest = Distance;
             }
         }
 
-        // check if current feature correspondence is a good correspondence (i.e. "loop" over all images is closed)
-        if((i_Feature == IndexList[NumberOfImages - 1U]) && IsGoodMatch)
+        // check whether the best match is a good match or not (a single candidate cannot be checked by the ratio test)
+        const boolean IsGoodMatch{(NumberOfCandidates > 1U) ? (DistanceBest < (m_RatioDistance * DistanceSecondBest)) : AcceptSingleCandidates};
+
+        if((IndexBest < NumberOfFeaturesTarget) && IsGoodMatch)
         {
-            for(uint64 i_Image{0U}; i_Image < NumberOfImages; i_Image++)
+            BestMatchQuery[i_FeatureQuery]    = IndexBest;
+            BestDistanceQuery[i_FeatureQuery] = DistanceBest;
+
+            // update best match of the target feature
+            if(DistanceBest < BestDistanceTarget[IndexBest])
             {
-                if(i_Image == 0U)
-                {
-                    FeatureIndex = i_Feature;
-                }
-                else
-                {
-                    FeatureIndex = IndexList[i_Image - 1U];
-                }
+                BestDistanceTarget[IndexBest] = DistanceBest;
+                BestMatchTarget[IndexBest]    = i_FeatureQuery;
+            }
+        }
+    }
+
+    // collect matches which are not claimed by a better query feature
+    for(uint64 i_FeatureQuery{0U}; i_FeatureQuery < NumberOfFeaturesQuery; i_FeatureQuery++)
+    {
+        const uint64 IndexTarget{BestMatchQuery[i_FeatureQuery]};
+
+        if((IndexTarget < NumberOfFeaturesTarget) && (BestMatchTarget[IndexTarget] == i_FeatureQuery))
+        {
+            Matches.emplace_back(static_cast<sint32>(i_FeatureQuery), static_cast<sint32>(IndexTarget), static_cast<float32>(BestDistanceQuery[i_FeatureQuery]));
+        }
+    }
+
+    return Matches.size();
+}
+
+uint64 FeatureMatcher::FindCorrespondencesStereo(const cv::Mat&              ImageStereoLeft,
+                                                 const cv::Mat&              ImageStereoRight,
+                                                 ListColumnVectorFloat64_2d& FeatureCorrespondencesStereoLeft,
+                                                 ListColumnVectorFloat64_2d& FeatureCorrespondencesStereoRight,
+                                                 const float64               MaximumRowDistance,
+                                                 const float64               MaximumDisparity,
+                                                 const boolean               AcceptSingleCandidates) const
+{
+    // check search range
+    if(std::isnan(MaximumRowDistance) || (MaximumRowDistance < 0.0))
+    {
+        throw std::invalid_argument("The maximum row distance must not be negative.");
+    }
+
+    if(std::isnan(MaximumDisparity) || (MaximumDisparity < 0.0))
+    {
+        throw std::invalid_argument("The maximum disparity must not be negative.");
+    }
+
+    // clean input correspondences
+    FeatureCorrespondencesStereoLeft.clear();
+    FeatureCorrespondencesStereoRight.clear();
+
+    // extract features and calculate descriptors for both images (into the buffers of the resources)
+    const ResourceLease Lease(*this);
+    MatchingResources&  Resources{Lease.GetResources()};
+
+    Resources.ExtractedFeatures.resize(2U);
+    Resources.FeatureDescriptors.resize(2U);
 
-                ColumnVectorFloat64_2d ImagePoint;
-                ImagePoint << ExtractedFeatures[i_Image][FeatureIndex].pt.x, ExtractedFeatures[i_Image][FeatureIndex].pt.y;
+    std::vector<cv::KeyPoint>& ExtractedFeaturesStereoLeft{Resources.ExtractedFeatures[0]};
+    std::vector<cv::KeyPoint>& ExtractedFeaturesStereoRight{Resources.ExtractedFeatures[1]};
+    cv::Mat&                   FeatureDescriptorsStereoLeft{Resources.FeatureDescriptors[0]};
+    cv::Mat&                   FeatureDescriptorsStereoRight{Resources.FeatureDescriptors[1]};
 
-                FeatureCorrespondences[i_Image].push_back(ImagePoint);
+    ExtractFeatures(ImageStereoLeft, Resources, ExtractedFeaturesStereoLeft, FeatureDescriptorsStereoLeft);
+    ExtractFeatures(ImageStereoRight, Resources, ExtractedFeaturesStereoRight, FeatureDescriptorsStereoRight);
+
+    // get number of extracted features in both images
+    const uint64 NumberOfExtractedFeaturesStereoLeft{ExtractedFeaturesStereoLeft.size()};
+    const uint64 NumberOfExtractedFeaturesStereoRight{ExtractedFeaturesStereoRight.size()};
+
+    // index the features of the right image by their rows
+    const uint64 NumberOfRows{static_cast<uint64>(ImageStereoRight.rows)};
+
+    std::vector<ListUInt64>& RowIndex{Resources.RowIndex};
+
+    CreateRowIndex(ExtractedFeaturesStereoRight, NumberOfRows, MaximumRowDistance, RowIndex);
+
+    // find best matches in both directions (invalid matches are marked by the number of features in the other image, the buffers are reused)
+    ListUInt64&  BestMatchStereoLeft{Resources.BestMatchesQuery};
+    ListUInt64&  BestMatchStereoRight{Resources.BestMatchesTarget};
+    ListFloat64& BestDistanceStereoRight{Resources.BestDistancesTarget};
+
+    BestMatchStereoLeft.assign(NumberOfExtractedFeaturesStereoLeft, NumberOfExtractedFeaturesStereoRight);
+    BestMatchStereoRight.assign(NumberOfExtractedFeaturesStereoRight, NumberOfExtractedFeaturesStereoLeft);
+    BestDistanceStereoRight.assign(NumberOfExtractedFeaturesStereoRight, std::numeric_limits<float64>::max());
+
+    const sint32           NormType{m_NormType};
+    const DescriptorKernel Kernel{DescriptorDistance::SelectKernel(FeatureDescriptorsStereoLeft, FeatureDescriptorsStereoRight, NormType)};
+
+    ListUInt64&  CandidateIndices{Resources.CandidateIndices};
+    ListFloat64& CandidateDistances{Resources.CandidateDistances};
+
+    for(uint64 i_FeatureStereoLeft{0U}; i_FeatureStereoLeft < NumberOfExtractedFeaturesStereoLeft; i_FeatureStereoLeft++)
+    {
+        const cv::Point2f& ImagePointStereoLeft{ExtractedFeaturesStereoLeft[i_FeatureStereoLeft].pt};
+
+        // get row of the current feature
+        const uint64 Row{static_cast<uint64>(std::lround(ImagePointStereoLeft.y))};
+
+        if(Row >= NumberOfRows)
+        {
+            continue;
+        }
+
+        // collect all candidates inside the row band and the valid disparity range
+        CandidateIndices.clear();
+
+        for(const uint64 CandidateIndex : RowIndex[Row])
+        {
+            const cv::Point2f& ImagePointStereoRight{ExtractedFeaturesStereoRight[CandidateIndex].pt};
+
+            const float64 RowDistance{std::abs(static_cast<float64>(ImagePointStereoLeft.y - ImagePointStereoRight.y))};
+            const float64 Disparity{static_cast<float64>(ImagePointStereoLeft.x - ImagePointStereoRight.x)};
+
+            if((RowDistance <= MaximumRowDistance) && (Disparity >= 0.0) && (Disparity <= MaximumDisparity))
+            {
+                CandidateIndices.push_back(CandidateIndex);
+            }
+        }
+
+        // compare the current feature against all candidates
+        ComputeCandidateDistances(FeatureDescriptorsStereoLeft, i_FeatureStereoLeft, FeatureDescriptorsStereoRight, CandidateIndices, Kernel, NormType, CandidateDistances);
+
+        const uint64 NumberOfCandidates{CandidateIndices.size()};
+
+        uint64  IndexBest{NumberOfExtractedFeaturesStereoRight};
+        float64 DistanceBest{std::numeric_limits<float64>::max()};
+        float64 DistanceSecondBest{std::numeric_limits<float64>::max()};
+
+        for(uint64 i_Candidate{0U}; i_Candidate < NumberOfCandidates; i_Candidate++)
+        {
+            const uint64  CandidateIndex{CandidateIndices[i_Candidate]};
+            const float64 Distance{CandidateDistances[i_Candidate]};
+
+            if(Distance < DistanceBest)
+            {
+                DistanceSecondBest = DistanceBest;
+                DistanceBest       = Distance;
+                IndexBest          = CandidateIndex;
+            }
+            else if(Distance < DistanceSecondBest)
+            {
+                DistanceSecondBest = Distance;
+            }
+
+            // update best match of the candidate
+            if(Distance < BestDistanceStereoRight[CandidateIndex])
+            {
+                BestDistanceStereoRight[CandidateIndex] = Distance;
+                BestMatchStereoRight[CandidateIndex]    = i_FeatureStereoLeft;
             }
+        }
+
+        // check whether the best match is a good match or not (a single candidate cannot be checked by the ratio test)
+        const boolean IsGoodMatch{(NumberOfCandidates > 1U) ? (DistanceBest < (m_RatioDistance * DistanceSecondBest)) : AcceptSingleCandidates};
+
+        if((IndexBest < NumberOfExtractedFeaturesStereoRight) && IsGoodMatch)
+        {
+            BestMatchStereoLeft[i_FeatureStereoLeft] = IndexBest;
+        }
+    }
+
+    // collect feature correspondences which are consistent in both directions
+    uint64 NumberOfCorrespondencesFound{0U};
+
+    for(uint64 i_FeatureStereoLeft{0U}; i_FeatureStereoLeft < NumberOfExtractedFeaturesStereoLeft; i_FeatureStereoLeft++)
+    {
+        const uint64 IndexStereoRight{BestMatchStereoLeft[i_FeatureStereoLeft]};
+
+        if((IndexStereoRight < NumberOfExtractedFeaturesStereoRight) && (BestMatchStereoRight[IndexStereoRight] == i_FeatureStereoLeft))
+        {
+            ColumnVectorFloat64_2d ImagePointStereoLeft;
+            ColumnVectorFloat64_2d ImagePointStereoRight;
+
+            ImagePointStereoLeft << ExtractedFeaturesStereoLeft[i_FeatureStereoLeft].pt.x, ExtractedFeaturesStereoLeft[i_FeatureStereoLeft].pt.y;
+            ImagePointStereoRight << ExtractedFeaturesStereoRight[IndexStereoRight].pt.x, ExtractedFeaturesStereoRight[IndexStereoRight].pt.y;
+
+            FeatureCorrespondencesStereoLeft.push_back(ImagePointStereoLeft);
+            FeatureCorrespondencesStereoRight.push_back(ImagePointStereoRight);
 
             NumberOfCorrespondencesFound++;
         }
@@ -161,3 +560,992 @@ uint64 FeatureMatcher::FindCorrespondences(const std::vector<cv::Mat>&
 
     return NumberOfCorrespondencesFound;
 }
+
+uint64 FeatureMatcher::MatchFeatures(const std::vector<std::vector<cv::KeyPoint>>& ExtractedFeatures,
+                                     const std::vector<cv::Mat>&                   FeatureDescriptors,
+                                     std::vector<ListColumnVectorFloat64_2d>&      FeatureCorrespondences) const
+{
+    const ResourceLease Lease(*this);
+
+    return MatchFeatures(ExtractedFeatures, FeatureDescriptors, Lease.GetResources(), FeatureCorrespondences);
+}
+
+cv::Feature2D& FeatureMatcher::AccessFeatureDetector(MatchingResources&            Resources,
+                                                    std::unique_lock<std::mutex>& Lock) const
+{
+    // use the own detector of the resources (if available)
+    if(Resources.FeatureDetector)
+    {
+        return *Resources.FeatureDetector;
+    }
+
+    // lock and use the shared detector
+    Lock = std::unique_lock<std::mutex>(m_FeatureDetectorMutex);
+
+    return *m_FeatureDetector;
+}
+
+std::unique_ptr<FeatureMatcher::MatchingResources> FeatureMatcher::AcquireResources() const
+{
+    // take resources from the pool (if available)
+    {
+        const std::lock_guard<std::mutex> Lock(m_ResourcePoolMutex);
+
+        if(!m_ResourcePool.empty())
+        {
+            std::unique_ptr<MatchingResources> Resources{std::move(m_ResourcePool.back())};
+
+            m_ResourcePool.pop_back();
+
+            return Resources;
+        }
+    }
+
+    // create new resources (outside of the lock)
+    std::unique_ptr<MatchingResources> Resources{new MatchingResources};
+
+    Resources->DescriptorMatcher = m_DescriptorMatcher->clone(true);
+
+    if(m_FeatureDetectorFactory)
+    {
+        Resources->FeatureDetector = m_FeatureDetectorFactory();
+    }
+
+    return Resources;
+}
+
+void FeatureMatcher::AttachStatistics(const uint64       NumberOfImages,
+                                      MatchingResources& Resources,
+                                      Statistics*        CallStatistics)
+{
+    Resources.CallStatistics = CallStatistics;
+
+    if(CallStatistics == nullptr)
+    {
+        return;
+    }
+
+    // clear statistics of previous calls
+    CallStatistics->DetectionTimes.clear();
+    CallStatistics->DescriptionTimes.clear();
+    CallStatistics->NumberOfFeatures.clear();
+    CallStatistics->MatchingTimes.clear();
+    CallStatistics->NumberOfCandidates.clear();
+    CallStatistics->NumberOfGoodMatches.clear();
+    CallStatistics->NumberOfClosedChains = 0U;
+
+    // pre-allocate memory (one entry per image and per image pair)
+    CallStatistics->DetectionTimes.reserve(NumberOfImages);
+    CallStatistics->DescriptionTimes.reserve(NumberOfImages);
+    CallStatistics->NumberOfFeatures.reserve(NumberOfImages);
+    CallStatistics->MatchingTimes.reserve(NumberOfImages);
+    CallStatistics->NumberOfCandidates.reserve(NumberOfImages);
+    CallStatistics->NumberOfGoodMatches.reserve(NumberOfImages);
+}
+
+uint64 FeatureMatcher::ChainFeatures(const std::vector<cv::Mat>& FeatureDescriptors,
+                                     MatchingResources&          Resources,
+                                     std::vector<ListUInt64>&    FeatureChains) const
+{
+    // get number of images
+    const uint64 NumberOfImages{FeatureDescriptors.size()};
+
+    // get number of extracted features in first image
+    const uint64 NumberOfExtractedFeatures{static_cast<uint64>(FeatureDescriptors[0].rows)};
+
+    // initialize one feature chain for each feature of the first image (FeatureChains[i_Image][i_Chain] is the feature index of the chain in the image)
+    FeatureChains.resize(NumberOfImages);
+    FeatureChains[0].resize(NumberOfExtractedFeatures);
+
+    std::iota(FeatureChains[0].begin(), FeatureChains[0].end(), 0U);
+
+    // compress the descriptors of each image once (each image is matched as train and as query image)
+    std::vector<DescriptorCompressor::CompressedDescriptors>& CompressedFeatureDescriptors{Resources.CompressedFeatureDescriptors};
+
+    if(m_DescriptorCompressor != nullptr)
+    {
+        CompressedFeatureDescriptors.resize(NumberOfImages);
+
+        for(uint64 i_Image{0U}; i_Image < NumberOfImages; i_Image++)
+        {
+            if(m_DescriptorCompressor->IsCompatible(FeatureDescriptors[i_Image], FeatureDescriptors[i_Image]))
+            {
+                m_DescriptorCompressor->Compress(FeatureDescriptors[i_Image], CompressedFeatureDescriptors[i_Image]);
+            }
+        }
+    }
+
+    // extend the feature chains image by image (only the chains which survived the ratio tests so far are matched)
+    uint64 NumberOfChains{NumberOfExtractedFeatures};
+
+    for(uint64 i_Image{0U}; i_Image < NumberOfImages; i_Image++)
+    {
+        const uint64  FirstIndex{i_Image % NumberOfImages};
+        const uint64  SecondIndex{(i_Image + 1U) % NumberOfImages};
+        const boolean IsClosingPair{SecondIndex == 0U};
+
+        // stop if no feature chain survived
+        if((NumberOfChains == 0U) || FeatureDescriptors[SecondIndex].empty())
+        {
+            NumberOfChains = 0U;
+            break;
+        }
+
+        // check whether the image pair is matched by the compressor or not
+        const boolean IsCompressedPair{(m_DescriptorCompressor != nullptr) && m_DescriptorCompressor->IsCompatible(FeatureDescriptors[FirstIndex], FeatureDescriptors[SecondIndex])};
+
+        const DescriptorCompressor::CompressedDescriptors* CompressedQueryDescriptors{nullptr};
+        const DescriptorCompressor::CompressedDescriptors* CompressedTrainDescriptors{IsCompressedPair ? &CompressedFeatureDescriptors[SecondIndex] : nullptr};
+
+        // collect the descriptors of the current chain ends as queries (the buffers are only reallocated if they are too small)
+        cv::Mat QueryDescriptors;
+
+        if(FirstIndex == 0U)
+        {
+            QueryDescriptors           = FeatureDescriptors[FirstIndex];
+            CompressedQueryDescriptors = IsCompressedPair ? &CompressedFeatureDescriptors[FirstIndex] : nullptr;
+        }
+        else
+        {
+            cv::Mat& QueryDescriptorsBuffer{Resources.QueryDescriptors};
+
+            if((static_cast<uint64>(QueryDescriptorsBuffer.rows) < NumberOfChains) || (QueryDescriptorsBuffer.cols != FeatureDescriptors[FirstIndex].cols) || (QueryDescriptorsBuffer.type() != FeatureDescriptors[FirstIndex].type()))
+            {
+                QueryDescriptorsBuffer.create(static_cast<sint32>(NumberOfExtractedFeatures), FeatureDescriptors[FirstIndex].cols, FeatureDescriptors[FirstIndex].type());
+            }
+
+            QueryDescriptors = QueryDescriptorsBuffer.rowRange(0, static_cast<sint32>(NumberOfChains));
+
+            for(uint64 i_Chain{0U}; i_Chain < NumberOfChains; i_Chain++)
+            {
+                FeatureDescriptors[FirstIndex].row(static_cast<sint32>(FeatureChains[FirstIndex][i_Chain])).copyTo(QueryDescriptors.row(static_cast<sint32>(i_Chain)));
+            }
+
+            // collect the compressed descriptors of the chain ends as well (instead of compressing the chain ends again)
+            if(IsCompressedPair)
+            {
+                const DescriptorCompressor::CompressedDescriptors& CompressedFirst{CompressedFeatureDescriptors[FirstIndex]};
+                DescriptorCompressor::CompressedDescriptors&       CompressedQuery{Resources.CompressedQueryDescriptors};
+                cv::Mat&                                           CompressedQueryBuffer{Resources.CompressedQueryBuffer};
+
+                if((static_cast<uint64>(CompressedQueryBuffer.rows) < NumberOfChains) || (CompressedQueryBuffer.cols != CompressedFirst.Descriptors.cols) || (CompressedQueryBuffer.type() != CompressedFirst.Descriptors.type()))
+                {
+                    CompressedQueryBuffer.create(static_cast<sint32>(NumberOfExtractedFeatures), CompressedFirst.Descriptors.cols, CompressedFirst.Descriptors.type());
+                }
+
+                CompressedQuery.Descriptors = CompressedQueryBuffer.rowRange(0, static_cast<sint32>(NumberOfChains));
+                CompressedQuery.SquaredNorms.resize(NumberOfChains);
+
+                for(uint64 i_Chain{0U}; i_Chain < NumberOfChains; i_Chain++)
+                {
+                    const uint64 FeatureIndex{FeatureChains[FirstIndex][i_Chain]};
+
+                    CompressedFirst.Descriptors.row(static_cast<sint32>(FeatureIndex)).copyTo(CompressedQuery.Descriptors.row(static_cast<sint32>(i_Chain)));
+                    CompressedQuery.SquaredNorms[i_Chain] = CompressedFirst.SquaredNorms[FeatureIndex];
+                }
+
+                CompressedQueryDescriptors = &CompressedQuery;
+            }
+        }
+
+        // match the chain ends against all features of the next image
+        std::vector<cv::DMatch>& TwoBestMatches{Resources.TwoBestMatches};
+
+#ifdef FM_COLLECT_STATISTICS
+        const std::chrono::steady_clock::time_point MatchingStartTime{std::chrono::steady_clock::now()};
+#endif
+
+        FindTwoBestMatches(QueryDescriptors, CompressedQueryDescriptors, FeatureDescriptors[SecondIndex], CompressedTrainDescriptors, Resources, TwoBestMatches);
+
+#ifdef FM_COLLECT_STATISTICS
+        const float64 MatchingTime{ComputeElapsedTime(MatchingStartTime)};
+        uint64        NumberOfGoodMatches{0U};
+#endif
+
+        // keep the chains which pass the ratio test (and which close the loop in case of the last image pair)
+        if(!IsClosingPair)
+        {
+            FeatureChains[SecondIndex].resize(NumberOfChains);
+        }
+
+        uint64 NumberOfSurvivingChains{0U};
+
+        for(uint64 i_Chain{0U}; i_Chain < NumberOfChains; i_Chain++)
+        {
+            const cv::DMatch& MatchBest{TwoBestMatches[2U * i_Chain]};
+            const cv::DMatch& MatchSecondBest{TwoBestMatches[2U * i_Chain + 1U]};
+
+            if(MatchSecondBest.trainIdx < 0)
+            {
+                continue;
+            }
+
+            const uint64  MatchedFeatureIndex{static_cast<uint64>(MatchBest.trainIdx)};
+            const float64 DistanceBest{MatchBest.distance};
+            const float64 DistanceSecondBest{MatchSecondBest.distance};
+
+            const boolean IsGoodMatch{DistanceBest < (m_RatioDistance * DistanceSecondBest)};
+            const boolean IsLoopClosed{!IsClosingPair || (MatchedFeatureIndex == FeatureChains[0][i_Chain])};
+
+#ifdef FM_COLLECT_STATISTICS
+            NumberOfGoodMatches += IsGoodMatch ? 1U : 0U;
+#endif
+
+            if(IsGoodMatch && IsLoopClosed)
+            {
+                // move surviving chain to the front (all images up to the current one)
+                for(uint64 i_ImageChain{0U}; i_ImageChain <= FirstIndex; i_ImageChain++)
+                {
+                    FeatureChains[i_ImageChain][NumberOfSurvivingChains] = FeatureChains[i_ImageChain][i_Chain];
+                }
+
+                if(!IsClosingPair)
+                {
+                    FeatureChains[SecondIndex][NumberOfSurvivingChains] = MatchedFeatureIndex;
+                }
+
+                NumberOfSurvivingChains++;
+            }
+        }
+
+#ifdef FM_COLLECT_STATISTICS
+        if(Resources.CallStatistics != nullptr)
+        {
+            Resources.CallStatistics->MatchingTimes.push_back(MatchingTime);
+            Resources.CallStatistics->NumberOfCandidates.push_back(NumberOfChains);
+            Resources.CallStatistics->NumberOfGoodMatches.push_back(NumberOfGoodMatches);
+        }
+#endif
+
+        NumberOfChains = NumberOfSurvivingChains;
+    }
+
+#ifdef FM_COLLECT_STATISTICS
+    if(Resources.CallStatistics != nullptr)
+    {
+        Resources.CallStatistics->NumberOfClosedChains = NumberOfChains;
+    }
+#endif
+
+    return NumberOfChains;
+}
+
+void FeatureMatcher::CheckDescriptorKernels() const
+{
+    // the kernels compute the same distances as a brute force matcher only
+    if(m_UseDescriptorKernels && (dynamic_cast<const cv::BFMatcher*>(m_DescriptorMatcher.get()) == nullptr))
+    {
+        throw std::invalid_argument("The distance kernels can only replace a brute force matcher.");
+    }
+}
+
+sint32 FeatureMatcher::DetermineNormType(const cv::Ptr<cv::DescriptorMatcher>& DescriptorMatcher,
+                                         const cv::Ptr<cv::Feature2D>&         FeatureDetector)
+{
+    // OpenCV does not provide a getter for the norm of a brute force matcher
+    struct BFMatcherAccess : public cv::BFMatcher
+    {
+        static sint32 GetNormType(const cv::BFMatcher& Matcher)
+        {
+            return Matcher.*(&BFMatcherAccess::normType);
+        }
+    };
+
+    const cv::BFMatcher* BruteForceMatcher{dynamic_cast<const cv::BFMatcher*>(DescriptorMatcher.get())};
+
+    if(BruteForceMatcher != nullptr)
+    {
+        return BFMatcherAccess::GetNormType(*BruteForceMatcher);
+    }
+
+    return FeatureDetector->defaultNorm();
+}
+
+void FeatureMatcher::CollectFeatureCorrespondences(const std::vector<std::vector<cv::KeyPoint>>& ExtractedFeatures,
+                                                   const std::vector<ListUInt64>&                FeatureChains,
+                                                   const uint64                                  NumberOfChains,
+                                                   std::vector<ListColumnVectorFloat64_2d>&      FeatureCorrespondences)
+{
+    // get number of images
+    const uint64 NumberOfImages{ExtractedFeatures.size()};
+
+    // allocate the output once
+    FeatureCorrespondences.resize(NumberOfImages);
+
+    for(ListColumnVectorFloat64_2d& FeatureCorrespondencesImage : FeatureCorrespondences)
+    {
+        FeatureCorrespondencesImage.resize(NumberOfChains);
+    }
+
+    // collect the image coordinates of all closed feature chains
+    WalkFeatureChains(ExtractedFeatures, FeatureChains, NumberOfChains, [&FeatureCorrespondences](const uint64 ImageIndex, const uint64 ChainIndex, const uint64, const cv::Point2f& ImagePoint)
+                      {
+                          FeatureCorrespondences[ImageIndex][ChainIndex] << static_cast<float64>(ImagePoint.x), static_cast<float64>(ImagePoint.y);
+                      });
+}
+
+template<typename ListMatrix2xX>
+void FeatureMatcher::CollectFeatureCorrespondences(const std::vector<std::vector<cv::KeyPoint>>& ExtractedFeatures,
+                                                   const std::vector<ListUInt64>&                FeatureChains,
+                                                   const uint64                                  NumberOfChains,
+                                                   ListMatrix2xX&                                FeatureCorrespondences,
+                                                   MatrixUInt64&                                 FeatureIndices)
+{
+    using Scalar = typename ListMatrix2xX::value_type::Scalar;
+
+    // get number of images
+    const uint64 NumberOfImages{ExtractedFeatures.size()};
+
+    // allocate the output once
+    FeatureCorrespondences.resize(NumberOfImages);
+
+    for(uint64 i_Image{0U}; i_Image < NumberOfImages; i_Image++)
+    {
+        FeatureCorrespondences[i_Image].resize(2, static_cast<sint64>(NumberOfChains));
+    }
+
+    FeatureIndices.resize(static_cast<sint64>(NumberOfImages), static_cast<sint64>(NumberOfChains));
+
+    // collect the image coordinates and feature indices of all closed feature chains
+    WalkFeatureChains(ExtractedFeatures, FeatureChains, NumberOfChains, [&FeatureCorrespondences, &FeatureIndices](const uint64 ImageIndex, const uint64 ChainIndex, const uint64 FeatureIndex, const cv::Point2f& ImagePoint)
+                      {
+                          const sint64 Column{static_cast<sint64>(ChainIndex)};
+
+                          FeatureCorrespondences[ImageIndex](0, Column)           = static_cast<Scalar>(ImagePoint.x);
+                          FeatureCorrespondences[ImageIndex](1, Column)           = static_cast<Scalar>(ImagePoint.y);
+                          FeatureIndices(static_cast<sint64>(ImageIndex), Column) = FeatureIndex;
+                      });
+}
+
+void FeatureMatcher::ComputeCandidateDistances(const cv::Mat&         QueryDescriptors,
+                                               const uint64           QueryIndex,
+                                               const cv::Mat&         TrainDescriptors,
+                                               const ListUInt64&      CandidateIndices,
+                                               const DescriptorKernel Kernel,
+                                               const sint32           NormType,
+                                               ListFloat64&           CandidateDistances) const
+{
+    // use the fixed-width distance kernel (if enabled and supported), cv::norm otherwise
+    const DescriptorKernel KernelCandidates{UsesDescriptorKernel(Kernel) ? Kernel : KernelGeneric};
+
+    DescriptorDistance::ComputeDistances(QueryDescriptors, QueryIndex, TrainDescriptors, CandidateIndices, KernelCandidates, NormType, CandidateDistances);
+}
+
+sint32 FeatureMatcher::ComputeDescriptorBorder(const cv::Feature2D& FeatureDetector)
+{
+    // ORB discards features closer to the image border than its edge threshold
+    const cv::ORB* const DetectorORB{dynamic_cast<const cv::ORB*>(&FeatureDetector)};
+
+    if(DetectorORB != nullptr)
+    {
+        return DetectorORB->getEdgeThreshold();
+    }
+
+    return 0;
+}
+
+sint32 FeatureMatcher::ComputeOrientationRadius(const cv::Feature2D& FeatureDetector)
+{
+    // ORB computes the orientations inside a circular patch of half its patch size
+    const cv::ORB* const DetectorORB{dynamic_cast<const cv::ORB*>(&FeatureDetector)};
+
+    if(DetectorORB != nullptr)
+    {
+        return DetectorORB->getPatchSize() / 2;
+    }
+
+    return 0;
+}
+
+void FeatureMatcher::ComputeOrientations(const cv::Mat&             Image,
+                                         const sint32               Radius,
+                                         std::vector<cv::KeyPoint>& Features)
+{
+    const sint32 RadiusSquared{Radius * Radius};
+
+    for(cv::KeyPoint& Feature : Features)
+    {
+        const sint32 CenterHorizontal{cvRound(Feature.pt.x)};
+        const sint32 CenterVertical{cvRound(Feature.pt.y)};
+
+        // compute the first order moments of the circular patch (pixels outside the image are skipped)
+        sint64 MomentHorizontal{0};
+        sint64 MomentVertical{0};
+
+        for(sint32 i_OffsetVertical{-Radius}; i_OffsetVertical <= Radius; i_OffsetVertical++)
+        {
+            const sint32 Row{CenterVertical + i_OffsetVertical};
+
+            if((Row < 0) || (Row >= Image.rows))
+            {
+                continue;
+            }
+
+            const uint8* const ImageRow{Image.ptr<uint8>(Row)};
+
+            for(sint32 i_OffsetHorizontal{-Radius}; i_OffsetHorizontal <= Radius; i_OffsetHorizontal++)
+            {
+                const sint32 Column{CenterHorizontal + i_OffsetHorizontal};
+
+                if((Column < 0) || (Column >= Image.cols) || ((i_OffsetHorizontal * i_OffsetHorizontal + i_OffsetVertical * i_OffsetVertical) > RadiusSquared))
+                {
+                    continue;
+                }
+
+                const sint64 Intensity{static_cast<sint64>(ImageRow[Column])};
+
+                MomentHorizontal += i_OffsetHorizontal * Intensity;
+                MomentVertical += i_OffsetVertical * Intensity;
+            }
+        }
+
+        // the orientation points from the feature to the intensity centroid (in degrees)
+        Feature.angle = cv::fastAtan2(static_cast<float32>(MomentVertical), static_cast<float32>(MomentHorizontal));
+    }
+}
+
+float64 FeatureMatcher::ComputeElapsedTime(const std::chrono::steady_clock::time_point& StartTime)
+{
+    return std::chrono::duration<float64, std::milli>(std::chrono::steady_clock::now() - StartTime).count();
+}
+
+cv::Ptr<cv::Feature2D> FeatureMatcher::CreateBucketDetector(const cv::Feature2D& FeatureDetector,
+                                                           const uint8          Threshold)
+{
+    const sint32 ThresholdDetector{static_cast<sint32>(Threshold)};
+
+    const cv::FastFeatureDetector* const DetectorFAST{dynamic_cast<const cv::FastFeatureDetector*>(&FeatureDetector)};
+
+    if(DetectorFAST != nullptr)
+    {
+        return cv::FastFeatureDetector::create(ThresholdDetector, DetectorFAST->getNonmaxSuppression(), DetectorFAST->getType());
+    }
+
+    const cv::AgastFeatureDetector* const DetectorAGAST{dynamic_cast<const cv::AgastFeatureDetector*>(&FeatureDetector)};
+
+    if(DetectorAGAST != nullptr)
+    {
+        return cv::AgastFeatureDetector::create(ThresholdDetector, DetectorAGAST->getNonmaxSuppression(), DetectorAGAST->getType());
+    }
+
+    // ORB detects its features by FAST (the buckets are only searched at full resolution, not on the pyramid levels)
+    const cv::ORB* const DetectorORB{dynamic_cast<const cv::ORB*>(&FeatureDetector)};
+
+    if(DetectorORB != nullptr)
+    {
+        return cv::FastFeatureDetector::create(ThresholdDetector, true, cv::FastFeatureDetector::TYPE_9_16);
+    }
+
+    throw std::invalid_argument("The bucketed feature extraction requires a FAST, AGAST or ORB detector.");
+}
+
+void FeatureMatcher::CreateRowIndex(const std::vector<cv::KeyPoint>& ExtractedFeatures,
+                                    const uint64                     NumberOfRows,
+                                    const float64                    MaximumRowDistance,
+                                    std::vector<ListUInt64>&         RowIndex)
+{
+    // get number of features
+    const uint64 NumberOfFeatures{ExtractedFeatures.size()};
+
+    // clear the rows (their memory is kept) and pre-allocate memory
+    RowIndex.resize(NumberOfRows);
+
+    for(ListUInt64& FeatureIndicesInRow : RowIndex)
+    {
+        FeatureIndicesInRow.clear();
+    }
+
+    // assign each feature to all rows inside its row band
+    for(uint64 i_Feature{0U}; i_Feature < NumberOfFeatures; i_Feature++)
+    {
+        const float64 CoordinateVertical{static_cast<float64>(ExtractedFeatures[i_Feature].pt.y)};
+
+        const sint64 RowFirst{std::max(static_cast<sint64>(std::floor(CoordinateVertical - MaximumRowDistance)), static_cast<sint64>(0))};
+        const sint64 RowLast{std::min(static_cast<sint64>(std::ceil(CoordinateVertical + MaximumRowDistance)), static_cast<sint64>(NumberOfRows) - 1)};
+
+        for(sint64 i_Row{RowFirst}; i_Row <= RowLast; i_Row++)
+        {
+            RowIndex[i_Row].push_back(i_Feature);
+        }
+    }
+}
+
+void FeatureMatcher::DetectFeaturesInBucket(const cv::Mat&             Image,
+                                            const cv::Rect&            BucketRegion,
+                                            cv::Feature2D&             FeatureDetector,
+                                            const uint8                Threshold,
+                                            std::vector<cv::KeyPoint>& FeaturesInBucket)
+{
+    // extend the region by the radius of the FAST and AGAST circles
+    const sint32 Border{3};
+
+    const sint32 RegionStartHorizontal{std::max(BucketRegion.x - Border, 0)};
+    const sint32 RegionStartVertical{std::max(BucketRegion.y - Border, 0)};
+    const sint32 RegionEndHorizontal{std::min(BucketRegion.x + BucketRegion.width + Border, Image.cols)};
+    const sint32 RegionEndVertical{std::min(BucketRegion.y + BucketRegion.height + Border, Image.rows)};
+
+    const cv::Mat ImageRegion{Image(cv::Rect(RegionStartHorizontal, RegionStartVertical, RegionEndHorizontal - RegionStartHorizontal, RegionEndVertical - RegionStartVertical))};
+
+    // detect features using the threshold of the bucket
+    SetDetectorThreshold(FeatureDetector, Threshold);
+
+    FeatureDetector.detect(ImageRegion, FeaturesInBucket);
+
+    // transform features into image coordinates and keep the ones inside the bucket
+    const float32 BucketStartHorizontal{static_cast<float32>(BucketRegion.x)};
+    const float32 BucketStartVertical{static_cast<float32>(BucketRegion.y)};
+    const float32 BucketEndHorizontal{static_cast<float32>(BucketRegion.x + BucketRegion.width)};
+    const float32 BucketEndVertical{static_cast<float32>(BucketRegion.y + BucketRegion.height)};
+
+    uint64 NumberOfFeaturesInBucket{0U};
+
+    for(cv::KeyPoint& Feature : FeaturesInBucket)
+    {
+        Feature.pt.x += static_cast<float32>(RegionStartHorizontal);
+        Feature.pt.y += static_cast<float32>(RegionStartVertical);
+
+        if((Feature.pt.x >= BucketStartHorizontal) && (Feature.pt.x < BucketEndHorizontal) && (Feature.pt.y >= BucketStartVertical) && (Feature.pt.y < BucketEndVertical))
+        {
+            FeaturesInBucket[NumberOfFeaturesInBucket] = Feature;
+            NumberOfFeaturesInBucket++;
+        }
+    }
+
+    FeaturesInBucket.resize(NumberOfFeaturesInBucket);
+}
+
+uint64 FeatureMatcher::ExtractAndChainFeatures(const std::vector<cv::Mat>&          Images,
+                                               const FeatureBucketerBase*           Bucketer,
+                                               std::vector<BucketedDetectionState>* States,
+                                               const uint8                          InitialThreshold,
+                                               const uint8                          MinimumThreshold,
+                                               MatchingResources&                   Resources,
+                                               Statistics*                          CallStatistics) const
+{
+    // get number of images
+    const uint64 NumberOfImages{Images.size()};
+
+    AttachStatistics(NumberOfImages, Resources, CallStatistics);
+
+    // one state of the bucketed extraction per image stream
+    if(States != nullptr)
+    {
+        States->resize(NumberOfImages);
+    }
+
+    // extract features and calculate descriptors for all images (into the buffers of the resources)
+    std::vector<std::vector<cv::KeyPoint>>& ExtractedFeatures{Resources.ExtractedFeatures};
+    std::vector<cv::Mat>&                   FeatureDescriptors{Resources.FeatureDescriptors};
+
+    // pre-allocate memory
+    ExtractedFeatures.resize(NumberOfImages);
+    FeatureDescriptors.resize(NumberOfImages);
+
+    for(uint64 i_Image{0U}; i_Image < NumberOfImages; i_Image++)
+    {
+        if(Bucketer != nullptr)
+        {
+            ExtractFeatures(Images[i_Image], *Bucketer, (*States)[i_Image], InitialThreshold, MinimumThreshold, Resources, ExtractedFeatures[i_Image], FeatureDescriptors[i_Image]);
+        }
+        else
+        {
+            ExtractFeatures(Images[i_Image], Resources, ExtractedFeatures[i_Image], FeatureDescriptors[i_Image]);
+        }
+    }
+
+    // chain features of all images
+    return ChainFeatures(FeatureDescriptors, Resources, Resources.FeatureChains);
+}
+
+void FeatureMatcher::ExtractFeatures(const cv::Mat&             Image,
+                                     MatchingResources&         Resources,
+                                     std::vector<cv::KeyPoint>& ExtractedFeatures,
+                                     cv::Mat&                   FeatureDescriptors) const
+{
+    std::unique_lock<std::mutex> Lock;
+
+    cv::Feature2D& FeatureDetector{AccessFeatureDetector(Resources, Lock)};
+
+#ifdef FM_COLLECT_STATISTICS
+    const std::chrono::steady_clock::time_point DetectionStartTime{std::chrono::steady_clock::now()};
+#endif
+
+    // extract features
+    FeatureDetector.detect(Image, ExtractedFeatures);
+
+#ifdef FM_COLLECT_STATISTICS
+    const float64                               DetectionTime{ComputeElapsedTime(DetectionStartTime)};
+    const std::chrono::steady_clock::time_point DescriptionStartTime{std::chrono::steady_clock::now()};
+#endif
+
+    // calculate descriptors
+    FeatureDetector.compute(Image, ExtractedFeatures, FeatureDescriptors);
+
+#ifdef FM_COLLECT_STATISTICS
+    if(Resources.CallStatistics != nullptr)
+    {
+        Resources.CallStatistics->DetectionTimes.push_back(DetectionTime);
+        Resources.CallStatistics->DescriptionTimes.push_back(ComputeElapsedTime(DescriptionStartTime));
+        Resources.CallStatistics->NumberOfFeatures.push_back(ExtractedFeatures.size());
+    }
+#endif
+}
+
+void FeatureMatcher::ExtractFeatures(const cv::Mat&             Image,
+                                     const FeatureBucketerBase& Bucketer,
+                                     BucketedDetectionState&    State,
+                                     const uint8                InitialThreshold,
+                                     const uint8                MinimumThreshold,
+                                     MatchingResources&         Resources,
+                                     std::vector<cv::KeyPoint>& ExtractedFeatures,
+                                     cv::Mat&                   FeatureDescriptors) const
+{
+    // check thresholds
+    if(MinimumThreshold > InitialThreshold)
+    {
+        throw std::invalid_argument("The minimum threshold must not be larger than the initial threshold.");
+    }
+
+    // get bucket layout
+    const MatrixUInt8& FeatureMask{Bucketer.GetFeatureMask()};
+
+    const uint64  NumberOfBucketsHorizontal{static_cast<uint64>(FeatureMask.cols())};
+    const uint64  NumberOfBucketsVertical{static_cast<uint64>(FeatureMask.rows())};
+    const uint64  NumberOfBuckets{NumberOfBucketsHorizontal * NumberOfBucketsVertical};
+    const float64 BucketSizeHorizontal{Bucketer.GetBucketSizeHorizontal()};
+    const float64 BucketSizeVertical{Bucketer.GetBucketSizeVertical()};
+
+    // initialize thresholds (only for the first image of the stream or if the bucket layout or the initial threshold changed)
+    if((State.BucketThresholds.size() != NumberOfBuckets) || (State.InitialThreshold != InitialThreshold))
+    {
+        State.BucketThresholds.assign(NumberOfBuckets, InitialThreshold);
+        State.InitialThreshold = InitialThreshold;
+    }
+
+    Resources.FeaturesInBuckets.resize(NumberOfBuckets);
+
+    // create the detector of the buckets (the shared detector is only locked while it is inspected)
+    cv::Ptr<cv::Feature2D> BucketDetector;
+    sint32                 DescriptorBorder{0};
+    sint32                 OrientationRadius{0};
+
+    {
+        std::unique_lock<std::mutex> Lock;
+
+        const cv::Feature2D& FeatureDetector{AccessFeatureDetector(Resources, Lock)};
+
+        BucketDetector   = CreateBucketDetector(FeatureDetector, InitialThreshold);
+        DescriptorBorder  = ComputeDescriptorBorder(FeatureDetector);
+        OrientationRadius = ComputeOrientationRadius(FeatureDetector);
+    }
+
+    // the orientations are computed on the gray scale image (like ORB does)
+    cv::Mat ImageGray{Image};
+
+    if((OrientationRadius > 0) && (Image.type() != CV_8UC1))
+    {
+        cv::cvtColor(Image, ImageGray, cv::COLOR_BGR2GRAY);
+    }
+
+    // features closer to the image border do not get a descriptor, hence the buckets are clipped
+    const cv::Rect DescriptorRegion(DescriptorBorder, DescriptorBorder, Image.cols - 2 * DescriptorBorder, Image.rows - 2 * DescriptorBorder);
+
+#ifdef FM_COLLECT_STATISTICS
+    const std::chrono::steady_clock::time_point DetectionStartTime{std::chrono::steady_clock::now()};
+#endif
+
+    // detect features in all buckets in parallel (each bucket only accesses its own threshold and features, each
+    // range of buckets uses its own copy of the detector)
+    cv::parallel_for_(cv::Range(0, static_cast<sint32>(NumberOfBuckets)),
+                      [&](const cv::Range& BucketRange)
+                      {
+                          const cv::Ptr<cv::Feature2D> RangeDetector{CreateBucketDetector(*BucketDetector, InitialThreshold)};
+
+                          for(sint32 i_Bucket{BucketRange.start}; i_Bucket < BucketRange.end; i_Bucket++)
+                          {
+                              const uint64 BucketID{static_cast<uint64>(i_Bucket)};
+                              const uint64 BucketIDHorizontal{BucketID % NumberOfBucketsHorizontal};
+                              const uint64 BucketIDVertical{BucketID / NumberOfBucketsHorizontal};
+
+                              const uint64 MaximumNumberOfFeatures{static_cast<uint64>(FeatureMask(static_cast<sint64>(BucketIDVertical), static_cast<sint64>(BucketIDHorizontal)))};
+
+                              std::vector<cv::KeyPoint>& FeaturesInBucket{Resources.FeaturesInBuckets[BucketID]};
+                              uint8&                     Threshold{State.BucketThresholds[BucketID]};
+
+                              FeaturesInBucket.clear();
+
+                              // compute region of the bucket in the image
+                              const sint32 BucketStartHorizontal{static_cast<sint32>(std::floor(static_cast<float64>(BucketIDHorizontal) * BucketSizeHorizontal))};
+                              const sint32 BucketStartVertical{static_cast<sint32>(std::floor(static_cast<float64>(BucketIDVertical) * BucketSizeVertical))};
+                              const sint32 BucketEndHorizontal{std::min(static_cast<sint32>(std::floor(static_cast<float64>(BucketIDHorizontal + 1U) * BucketSizeHorizontal)), Image.cols)};
+                              const sint32 BucketEndVertical{std::min(static_cast<sint32>(std::floor(static_cast<float64>(BucketIDVertical + 1U) * BucketSizeVertical)), Image.rows)};
+
+                              if((MaximumNumberOfFeatures == 0U) || (BucketEndHorizontal <= BucketStartHorizontal) || (BucketEndVertical <= BucketStartVertical))
+                              {
+                                  continue;
+                              }
+
+                              const cv::Rect BucketRegion{cv::Rect(BucketStartHorizontal, BucketStartVertical, BucketEndHorizontal - BucketStartHorizontal, BucketEndVertical - BucketStartVertical) & DescriptorRegion};
+
+                              if(BucketRegion.empty())
+                              {
+                                  continue;
+                              }
+
+                              // detect features with the threshold of the bucket
+                              DetectFeaturesInBucket(Image, BucketRegion, *RangeDetector, Threshold, FeaturesInBucket);
+
+                              // retry weak buckets with the minimum threshold
+                              if((FeaturesInBucket.size() < MaximumNumberOfFeatures) && (Threshold > MinimumThreshold))
+                              {
+                                  DetectFeaturesInBucket(Image, BucketRegion, *RangeDetector, MinimumThreshold, FeaturesInBucket);
+                              }
+
+                              const uint64 NumberOfDetectedFeatures{FeaturesInBucket.size()};
+
+                              // adapt the threshold for the next image (by a quarter of its value)
+                              const uint8 ThresholdStep{static_cast<uint8>(std::max(Threshold / 4, 1))};
+
+                              if(NumberOfDetectedFeatures < MaximumNumberOfFeatures)
+                              {
+                                  Threshold = static_cast<uint8>(std::max(Threshold - ThresholdStep, static_cast<sint32>(MinimumThreshold)));
+                              }
+                              else if(NumberOfDetectedFeatures > 2U * MaximumNumberOfFeatures)
+                              {
+                                  Threshold = static_cast<uint8>(std::min(Threshold + ThresholdStep, 255));
+                              }
+
+                              // keep the strongest features only
+                              cv::KeyPointsFilter::retainBest(FeaturesInBucket, static_cast<sint32>(MaximumNumberOfFeatures));
+
+                              if(FeaturesInBucket.size() > MaximumNumberOfFeatures)
+                              {
+                                  FeaturesInBucket.resize(MaximumNumberOfFeatures);
+                              }
+
+                              // orient the features (the FAST stage of ORB does not compute the orientations)
+                              if(OrientationRadius > 0)
+                              {
+                                  ComputeOrientations(ImageGray, OrientationRadius, FeaturesInBucket);
+                              }
+                          }
+                      },
+                      static_cast<float64>(cv::getNumThreads()));
+
+    // collect the features of all buckets
+    ExtractedFeatures.clear();
+
+    for(const std::vector<cv::KeyPoint>& FeaturesInBucket : Resources.FeaturesInBuckets)
+    {
+        ExtractedFeatures.insert(ExtractedFeatures.end(), FeaturesInBucket.begin(), FeaturesInBucket.end());
+    }
+
+#ifdef FM_COLLECT_STATISTICS
+    const float64                               DetectionTime{ComputeElapsedTime(DetectionStartTime)};
+    const std::chrono::steady_clock::time_point DescriptionStartTime{std::chrono::steady_clock::now()};
+#endif
+
+    // calculate descriptors (for the selected features only)
+    std::unique_lock<std::mutex> Lock;
+
+    AccessFeatureDetector(Resources, Lock).compute(Image, ExtractedFeatures, FeatureDescriptors);
+
+#ifdef FM_COLLECT_STATISTICS
+    if(Resources.CallStatistics != nullptr)
+    {
+        Resources.CallStatistics->DetectionTimes.push_back(DetectionTime);
+        Resources.CallStatistics->DescriptionTimes.push_back(ComputeElapsedTime(DescriptionStartTime));
+        Resources.CallStatistics->NumberOfFeatures.push_back(ExtractedFeatures.size());
+    }
+#endif
+}
+
+void FeatureMatcher::FindTwoBestMatches(const cv::Mat&                                     QueryDescriptors,
+                                        const DescriptorCompressor::CompressedDescriptors* CompressedQueryDescriptors,
+                                        const cv::Mat&                                     TrainDescriptors,
+                                        const DescriptorCompressor::CompressedDescriptors* CompressedTrainDescriptors,
+                                        MatchingResources&                                 Resources,
+                                        std::vector<cv::DMatch>&                           Matches) const
+{
+    // match floating point descriptors in the compressed domain (if compressed)
+    if((CompressedQueryDescriptors != nullptr) && (CompressedTrainDescriptors != nullptr))
+    {
+        m_DescriptorCompressor->FindTwoBestMatches(QueryDescriptors, *CompressedQueryDescriptors, TrainDescriptors, *CompressedTrainDescriptors, Resources.KnnMatches);
+        FlattenMatches(Resources.KnnMatches, Matches);
+        return;
+    }
+
+    // select the kernel once for all descriptors
+    const sint32           NormType{m_NormType};
+    const DescriptorKernel Kernel{DescriptorDistance::SelectKernel(QueryDescriptors, TrainDescriptors, NormType)};
+
+    // use the descriptor matcher (generic fallback)
+    if(!UsesDescriptorKernel(Kernel))
+    {
+        Resources.DescriptorMatcher->knnMatch(QueryDescriptors, TrainDescriptors, Resources.KnnMatches, 2);
+        FlattenMatches(Resources.KnnMatches, Matches);
+        return;
+    }
+
+    // get number of descriptors
+    const uint64 NumberOfQueryDescriptors{static_cast<uint64>(QueryDescriptors.rows)};
+    const uint64 NumberOfTrainDescriptors{static_cast<uint64>(TrainDescriptors.rows)};
+
+    Matches.resize(2U * NumberOfQueryDescriptors);
+
+    // find the two best matches of all query descriptors
+    ListFloat64& Distances{Resources.Distances};
+
+    for(uint64 i_Query{0U}; i_Query < NumberOfQueryDescriptors; i_Query++)
+    {
+        DescriptorDistance::ComputeDistances(QueryDescriptors, i_Query, TrainDescriptors, Kernel, NormType, Distances);
+
+        uint64  IndexBest{0U};
+        uint64  IndexSecondBest{0U};
+        float64 DistanceBest{std::numeric_limits<float64>::max()};
+        float64 DistanceSecondBest{std::numeric_limits<float64>::max()};
+
+        for(uint64 i_Train{0U}; i_Train < NumberOfTrainDescriptors; i_Train++)
+        {
+            const float64 Distance{Distances[i_Train]};
+
+            if(Distance < DistanceBest)
+            {
+                DistanceSecondBest = DistanceBest;
+                IndexSecondBest    = IndexBest;
+                DistanceBest       = Distance;
+                IndexBest          = i_Train;
+            }
+            else if(Distance < DistanceSecondBest)
+            {
+                DistanceSecondBest = Distance;
+                IndexSecondBest    = i_Train;
+            }
+        }
+
+        // mark missing matches by a negative train index
+        const sint32 QueryIndex{static_cast<sint32>(i_Query)};
+        const sint32 TrainIndexBest{(NumberOfTrainDescriptors > 0U) ? static_cast<sint32>(IndexBest) : -1};
+        const sint32 TrainIndexSecondBest{(NumberOfTrainDescriptors > 1U) ? static_cast<sint32>(IndexSecondBest) : -1};
+
+        Matches[2U * i_Query]      = cv::DMatch(QueryIndex, TrainIndexBest, static_cast<float32>(DistanceBest));
+        Matches[2U * i_Query + 1U] = cv::DMatch(QueryIndex, TrainIndexSecondBest, static_cast<float32>(DistanceSecondBest));
+    }
+}
+
+void FeatureMatcher::FlattenMatches(const std::vector<std::vector<cv::DMatch>>& KnnMatches,
+                                    std::vector<cv::DMatch>&                    Matches)
+{
+    // get number of query descriptors
+    const uint64 NumberOfQueryDescriptors{KnnMatches.size()};
+
+    Matches.resize(2U * NumberOfQueryDescriptors);
+
+    for(uint64 i_Query{0U}; i_Query < NumberOfQueryDescriptors; i_Query++)
+    {
+        const std::vector<cv::DMatch>& CurrentMatches{KnnMatches[i_Query]};
+
+        const sint32 QueryIndex{static_cast<sint32>(i_Query)};
+
+        Matches[2U * i_Query]      = (CurrentMatches.size() > 0U) ? CurrentMatches[0] : cv::DMatch(QueryIndex, -1, std::numeric_limits<float32>::max());
+        Matches[2U * i_Query + 1U] = (CurrentMatches.size() > 1U) ? CurrentMatches[1] : cv::DMatch(QueryIndex, -1, std::numeric_limits<float32>::max());
+    }
+}
+
+uint64 FeatureMatcher::MatchFeatures(const std::vector<std::vector<cv::KeyPoint>>& ExtractedFeatures,
+                                     const std::vector<cv::Mat>&                   FeatureDescriptors,
+                                     MatchingResources&                            Resources,
+                                     std::vector<ListColumnVectorFloat64_2d>&      FeatureCorrespondences) const
+{
+    // chain features of all images
+    std::vector<ListUInt64>& FeatureChains{Resources.FeatureChains};
+
+    const uint64 NumberOfChains{ChainFeatures(FeatureDescriptors, Resources, FeatureChains)};
+
+    CollectFeatureCorrespondences(ExtractedFeatures, FeatureChains, NumberOfChains, FeatureCorrespondences);
+
+    return NumberOfChains;
+}
+
+void FeatureMatcher::ReleaseResources(std::unique_ptr<MatchingResources> Resources) const
+{
+    // detach the statistics of the call
+    Resources->CallStatistics = nullptr;
+
+    const std::lock_guard<std::mutex> Lock(m_ResourcePoolMutex);
+
+    m_ResourcePool.push_back(std::move(Resources));
+}
+
+void FeatureMatcher::SetDetectorThreshold(cv::Feature2D& FeatureDetector,
+                                          const uint8    Threshold)
+{
+    const sint32 ThresholdDetector{static_cast<sint32>(Threshold)};
+
+    cv::FastFeatureDetector* const DetectorFAST{dynamic_cast<cv::FastFeatureDetector*>(&FeatureDetector)};
+
+    if(DetectorFAST != nullptr)
+    {
+        DetectorFAST->setThreshold(ThresholdDetector);
+        return;
+    }
+
+    cv::AgastFeatureDetector* const DetectorAGAST{dynamic_cast<cv::AgastFeatureDetector*>(&FeatureDetector)};
+
+    if(DetectorAGAST != nullptr)
+    {
+        DetectorAGAST->setThreshold(ThresholdDetector);
+        return;
+    }
+
+    cv::ORB* const DetectorORB{dynamic_cast<cv::ORB*>(&FeatureDetector)};
+
+    if(DetectorORB != nullptr)
+    {
+        DetectorORB->setFastThreshold(ThresholdDetector);
+        return;
+    }
+
+    throw std::invalid_argument("The bucketed feature extraction requires a FAST, AGAST or ORB detector.");
+}
+
+boolean FeatureMatcher::UsesDescriptorKernel(const DescriptorKernel Kernel) const
+{
+    return m_UseDescriptorKernels && (Kernel != KernelGeneric);
+}
+
+template<typename CorrespondenceWriter>
+void FeatureMatcher::WalkFeatureChains(const std::vector<std::vector<cv::KeyPoint>>& ExtractedFeatures,
+                                       const std::vector<ListUInt64>&                FeatureChains,
+                                       const uint64                                  NumberOfChains,
+                                       const CorrespondenceWriter&                   WriteCorrespondence)
+{
+    // get number of images
+    const uint64 NumberOfImages{ExtractedFeatures.size()};
+
+    for(uint64 i_Chain{0U}; i_Chain < NumberOfChains; i_Chain++)
+    {
+        for(uint64 i_Image{0U}; i_Image < NumberOfImages; i_Image++)
+        {
+            const uint64 FeatureIndex{FeatureChains[i_Image][i_Chain]};
+
+            WriteCorrespondence(i_Image, i_Chain, FeatureIndex, ExtractedFeatures[i_Image][FeatureIndex].pt);
+        }
+    }
+}
+
+FeatureMatcher::ResourceLease::ResourceLease(const FeatureMatcher& Matcher) :
+    m_FeatureMatcher{Matcher},
+    m_Resources{Matcher.AcquireResources()}
+{
+}
+
+FeatureMatcher::ResourceLease::~ResourceLease()
+{
+    m_FeatureMatcher.ReleaseResources(std::move(m_Resources));
+}
+
+FeatureMatcher::MatchingResources& FeatureMatcher::ResourceLease::GetResources() const
+{
+    return *m_Resources;
+}
@@ -0,0 +1,204 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  FeatureMatcherPipeline.cpp
+///
+/// \brief Source file containing the FeatureMatcherPipeline class.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+#include "../include/FeatureMatcherPipeline.h"
+
+FeatureMatcherPipeline::FeatureMatcherPipeline(const FeatureMatcher&      Matcher,
+                                               const uint64               QueueCapacity,
+                                               const FeatureBucketerBase* Bucketer) :
+    m_FeatureMatcher{Matcher},
+    m_FeatureBucketer{Bucketer},
+    m_QueueCapacity{std::max(QueueCapacity, static_cast<uint64>(1U))},
+    m_StopRequested{false},
+    m_ExtractionFinished{false}
+{
+    // start the stages
+    m_ExtractionThread = std::thread(&FeatureMatcherPipeline::RunExtraction, this);
+    m_MatchingThread   = std::thread(&FeatureMatcherPipeline::RunMatching, this);
+}
+
+FeatureMatcherPipeline::~FeatureMatcherPipeline()
+{
+    // request the stages to stop after all pending jobs are finished
+    {
+        const std::lock_guard<std::mutex> Lock(m_Mutex);
+
+        m_StopRequested = true;
+    }
+
+    m_ExtractionCondition.notify_all();
+    m_MatchingCondition.notify_all();
+
+    m_ExtractionThread.join();
+    m_MatchingThread.join();
+}
+
+std::future<FeatureCorrespondenceResult> FeatureMatcherPipeline::FindCorrespondencesAsync(const std::vector<cv::Mat>& Images)
+{
+    // check number of images (the features are chained starting at the first image)
+    if(Images.empty())
+    {
+        throw std::invalid_argument("At least one image is required to find feature correspondences.");
+    }
+
+    ExtractionJob Job;
+
+    Job.Images = Images;
+
+    std::future<FeatureCorrespondenceResult> Result{Job.Result.get_future()};
+
+    // wait for space in the extraction queue (backpressure) and enqueue the job
+    {
+        std::unique_lock<std::mutex> Lock(m_Mutex);
+
+        m_ExtractionCondition.wait(Lock, [this]() { return m_ExtractionQueue.size() < m_QueueCapacity; });
+
+        m_ExtractionQueue.push_back(std::move(Job));
+    }
+
+    m_ExtractionCondition.notify_all();
+
+    return Result;
+}
+
+void FeatureMatcherPipeline::RunExtraction()
+{
+    while(true)
+    {
+        ExtractionJob Job;
+
+        // wait for the next job
+        {
+            std::unique_lock<std::mutex> Lock(m_Mutex);
+
+            m_ExtractionCondition.wait(Lock, [this]() { return m_StopRequested || !m_ExtractionQueue.empty(); });
+
+            if(m_ExtractionQueue.empty())
+            {
+                m_ExtractionFinished = true;
+                break;
+            }
+
+            Job = std::move(m_ExtractionQueue.front());
+            m_ExtractionQueue.pop_front();
+        }
+
+        m_ExtractionCondition.notify_all();
+
+        // extract features and calculate descriptors for all images
+        const uint64 NumberOfImages{Job.Images.size()};
+
+        MatchingJob NextJob;
+
+        NextJob.ExtractedFeatures.resize(NumberOfImages);
+        NextJob.FeatureDescriptors.resize(NumberOfImages);
+        NextJob.Result = std::move(Job.Result);
+
+        try
+        {
+            if(m_BucketedDetectionStates.size() < NumberOfImages)
+            {
+                m_BucketedDetectionStates.resize(NumberOfImages);
+            }
+
+            for(uint64 i_Image{0U}; i_Image < NumberOfImages; i_Image++)
+            {
+                if(m_FeatureBucketer != nullptr)
+                {
+                    m_FeatureMatcher.ExtractFeatures(Job.Images[i_Image], *m_FeatureBucketer, m_BucketedDetectionStates[i_Image], NextJob.ExtractedFeatures[i_Image], NextJob.FeatureDescriptors[i_Image]);
+                }
+                else
+                {
+                    m_FeatureMatcher.ExtractFeatures(Job.Images[i_Image], NextJob.ExtractedFeatures[i_Image], NextJob.FeatureDescriptors[i_Image]);
+                }
+            }
+        }
+        catch(...)
+        {
+            NextJob.Result.set_exception(std::current_exception());
+            continue;
+        }
+
+        // wait for space in the matching queue (backpressure) and enqueue the job
+        {
+            std::unique_lock<std::mutex> Lock(m_Mutex);
+
+            m_MatchingCondition.wait(Lock, [this]() { return m_MatchingQueue.size() < m_QueueCapacity; });
+
+            m_MatchingQueue.push_back(std::move(NextJob));
+        }
+
+        m_MatchingCondition.notify_all();
+    }
+
+    m_MatchingCondition.notify_all();
+}
+
+void FeatureMatcherPipeline::RunMatching()
+{
+    while(true)
+    {
+        MatchingJob Job;
+
+        // wait for the next job
+        {
+            std::unique_lock<std::mutex> Lock(m_Mutex);
+
+            m_MatchingCondition.wait(Lock, [this]() { return m_ExtractionFinished || !m_MatchingQueue.empty(); });
+
+            if(m_MatchingQueue.empty())
+            {
+                break;
+            }
+
+            Job = std::move(m_MatchingQueue.front());
+            m_MatchingQueue.pop_front();
+        }
+
+        m_MatchingCondition.notify_all();
+
+        // match the features of all images
+        try
+        {
+            FeatureCorrespondenceResult Result;
+
+            Result.FeatureCorrespondences.resize(Job.ExtractedFeatures.size());
+            Result.NumberOfCorrespondences = m_FeatureMatcher.MatchFeatures(Job.ExtractedFeatures, Job.FeatureDescriptors, Result.FeatureCorrespondences);
+
+            Job.Result.set_value(std::move(Result));
+        }
+        catch(...)
+        {
+            Job.Result.set_exception(std::current_exception());
+        }
+    }
+}
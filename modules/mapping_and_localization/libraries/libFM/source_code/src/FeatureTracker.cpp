@@ -0,0 +1,216 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  FeatureTracker.cpp
+///
+/// \brief Source file containing the FeatureTracker class.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#include "../include/FeatureTracker.h"
+
+FeatureTracker::FeatureTracker(const FeatureMatcher& Matcher,
+                               const uint64          MaximumNumberOfTracks,
+                               const float64         SearchRadius,
+                               const boolean         AcceptSingleCandidates) :
+    m_FeatureMatcher{Matcher},
+    m_MaximumNumberOfTracks{MaximumNumberOfTracks},
+    m_SearchRadius{SearchRadius},
+    m_AcceptSingleCandidates{AcceptSingleCandidates},
+    m_NumberOfTracks{0U},
+    m_NextTrackID{0U}
+{
+    // pre-allocate memory of the track pool
+    m_TrackIDs.reserve(m_MaximumNumberOfTracks);
+    m_TrackAges.reserve(m_MaximumNumberOfTracks);
+    m_TrackImagePoints.reserve(m_MaximumNumberOfTracks);
+    m_TrackVelocities.reserve(m_MaximumNumberOfTracks);
+    m_PredictedImagePoints.reserve(m_MaximumNumberOfTracks);
+    m_TrackIsExtended.reserve(m_MaximumNumberOfTracks);
+}
+
+FeatureTracker::~FeatureTracker()
+{
+}
+
+uint64 FeatureTracker::GetNumberOfTracks() const
+{
+    return m_NumberOfTracks;
+}
+
+const ListUInt64& FeatureTracker::GetTrackAges() const
+{
+    return m_TrackAges;
+}
+
+cv::Mat FeatureTracker::GetTrackDescriptors() const
+{
+    // return header of the rows belonging to the active tracks
+    return m_TrackDescriptors.rowRange(0, static_cast<sint32>(m_NumberOfTracks));
+}
+
+const ListUInt64& FeatureTracker::GetTrackIDs() const
+{
+    return m_TrackIDs;
+}
+
+const ListColumnVectorFloat64_2d& FeatureTracker::GetTrackImagePoints() const
+{
+    return m_TrackImagePoints;
+}
+
+uint64 FeatureTracker::ProcessImage(const cv::Mat& Image)
+{
+    // extract features and calculate descriptors in the new image
+    m_FeatureMatcher.ExtractFeatures(Image, m_ExtractedFeatures, m_FeatureDescriptors);
+
+    // allocate memory for the descriptors of the tracks (done once, as soon as the descriptor size is known)
+    if(m_TrackDescriptors.empty() && !m_FeatureDescriptors.empty())
+    {
+        m_TrackDescriptors.create(static_cast<sint32>(m_MaximumNumberOfTracks), m_FeatureDescriptors.cols, m_FeatureDescriptors.type());
+    }
+
+    // clear variables
+    m_FeatureIsAssigned.assign(m_ExtractedFeatures.size(), false);
+    m_TrackIsExtended.assign(m_NumberOfTracks, false);
+    m_Matches.clear();
+
+    // predict positions of the active tracks (constant velocity model) and match them against the extracted features
+    if((m_NumberOfTracks > 0U) && !m_ExtractedFeatures.empty())
+    {
+        m_PredictedImagePoints.resize(m_NumberOfTracks);
+
+        for(uint64 i_Track{0U}; i_Track < m_NumberOfTracks; i_Track++)
+        {
+            m_PredictedImagePoints[i_Track] = m_TrackImagePoints[i_Track] + m_TrackVelocities[i_Track];
+        }
+
+        m_FeatureMatcher.FindCorrespondencesInWindow(GetTrackDescriptors(),
+                                                     m_PredictedImagePoints,
+                                                     m_ExtractedFeatures,
+                                                     m_FeatureDescriptors,
+                                                     static_cast<uint64>(Image.cols),
+                                                     static_cast<uint64>(Image.rows),
+                                                     m_SearchRadius,
+                                                     m_Matches,
+                                                     m_AcceptSingleCandidates);
+    }
+
+    // update the track pool
+    ExtendTracks();
+    TerminateTracks();
+    StartTracks();
+
+    return m_NumberOfTracks;
+}
+
+void FeatureTracker::Reset()
+{
+    // terminate all tracks (the allocated memory is kept)
+    m_TrackIDs.clear();
+    m_TrackAges.clear();
+    m_TrackImagePoints.clear();
+    m_TrackVelocities.clear();
+
+    m_NumberOfTracks = 0U;
+}
+
+void FeatureTracker::ExtendTracks()
+{
+    // extend all tracks which have been matched
+    for(const cv::DMatch& Match : m_Matches)
+    {
+        const uint64 TrackIndex{static_cast<uint64>(Match.queryIdx)};
+        const uint64 FeatureIndex{static_cast<uint64>(Match.trainIdx)};
+
+        const ColumnVectorFloat64_2d ImagePoint(m_ExtractedFeatures[FeatureIndex].pt.x, m_ExtractedFeatures[FeatureIndex].pt.y);
+
+        m_TrackVelocities[TrackIndex]  = ImagePoint - m_TrackImagePoints[TrackIndex];
+        m_TrackImagePoints[TrackIndex] = ImagePoint;
+        m_TrackAges[TrackIndex]++;
+
+        m_FeatureDescriptors.row(static_cast<sint32>(FeatureIndex)).copyTo(m_TrackDescriptors.row(static_cast<sint32>(TrackIndex)));
+
+        m_TrackIsExtended[TrackIndex]     = true;
+        m_FeatureIsAssigned[FeatureIndex] = true;
+    }
+}
+
+void FeatureTracker::StartTracks()
+{
+    // get number of extracted features
+    const uint64 NumberOfExtractedFeatures{m_ExtractedFeatures.size()};
+
+    // start new tracks as long as the pool is not full
+    for(uint64 i_Feature{0U}; (i_Feature < NumberOfExtractedFeatures) && (m_NumberOfTracks < m_MaximumNumberOfTracks); i_Feature++)
+    {
+        if(m_FeatureIsAssigned[i_Feature])
+        {
+            continue;
+        }
+
+        const ColumnVectorFloat64_2d ImagePoint(m_ExtractedFeatures[i_Feature].pt.x, m_ExtractedFeatures[i_Feature].pt.y);
+
+        m_TrackIDs.push_back(m_NextTrackID);
+        m_TrackAges.push_back(1U);
+        m_TrackImagePoints.push_back(ImagePoint);
+        m_TrackVelocities.push_back(ColumnVectorFloat64_2d::Zero());
+
+        m_FeatureDescriptors.row(static_cast<sint32>(i_Feature)).copyTo(m_TrackDescriptors.row(static_cast<sint32>(m_NumberOfTracks)));
+
+        m_NextTrackID++;
+        m_NumberOfTracks++;
+    }
+}
+
+void FeatureTracker::TerminateTracks()
+{
+    // iterate backwards, so the last active track has always been checked already when it is moved
+    for(uint64 i_Track{m_NumberOfTracks}; i_Track > 0U; i_Track--)
+    {
+        const uint64 TrackIndex{i_Track - 1U};
+
+        if(m_TrackIsExtended[TrackIndex])
+        {
+            continue;
+        }
+
+        // replace the terminated track by the last active track
+        const uint64 LastTrackIndex{m_NumberOfTracks - 1U};
+
+        if(TrackIndex != LastTrackIndex)
+        {
+            m_TrackIDs[TrackIndex]         = m_TrackIDs[LastTrackIndex];
+            m_TrackAges[TrackIndex]        = m_TrackAges[LastTrackIndex];
+            m_TrackImagePoints[TrackIndex] = m_TrackImagePoints[LastTrackIndex];
+            m_TrackVelocities[TrackIndex]  = m_TrackVelocities[LastTrackIndex];
+
+            m_TrackDescriptors.row(static_cast<sint32>(LastTrackIndex)).copyTo(m_TrackDescriptors.row(static_cast<sint32>(TrackIndex)));
+        }
+
+        m_TrackIDs.pop_back();
+        m_TrackAges.pop_back();
+        m_TrackImagePoints.pop_back();
+        m_TrackVelocities.pop_back();
+
+        m_NumberOfTracks--;
+    }
+}
@@ -0,0 +1,444 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  GeometricVerifier.cpp
+///
+/// \brief Source file containing the GeometricVerifier class.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+#include <Eigen/SVD>
+
+#include "../include/GeometricVerifier.h"
+
+GeometricVerifier::GeometricVerifier(const uint64  NumberOfHypotheses,
+                                     const uint64  BlockSize,
+                                     const float64 InlierThreshold,
+                                     const uint64  SeedValue) :
+    m_NumberOfHypotheses{std::max(NumberOfHypotheses, static_cast<uint64>(1U))},
+    m_BlockSize{std::max(BlockSize, static_cast<uint64>(1U))},
+    m_InlierThreshold{InlierThreshold},
+    m_SeedValue{SeedValue}
+{
+}
+
+GeometricVerifier::~GeometricVerifier()
+{
+}
+
+uint64 GeometricVerifier::VerifyFundamental(const MatrixFloat64_2xX& ImagePointsFirst,
+                                            const MatrixFloat64_2xX& ImagePointsSecond,
+                                            MatrixFloat64_3d&        FundamentalMatrix,
+                                            ListBoolean&             InlierMask) const
+{
+    // check number of feature correspondences
+    if(ImagePointsFirst.cols() != ImagePointsSecond.cols())
+    {
+        throw std::invalid_argument("The number of image points in the first image must match the number of image points in the second image.");
+    }
+
+    // get number of feature correspondences
+    const uint64 NumberOfCorrespondences{static_cast<uint64>(ImagePointsFirst.cols())};
+    const uint64 SampleSize{8U};
+
+    // clean output
+    FundamentalMatrix.setZero();
+    InlierMask.assign(NumberOfCorrespondences, false);
+
+    if(NumberOfCorrespondences < SampleSize)
+    {
+        return 0U;
+    }
+
+    // generate hypotheses from progressively growing sets of feature correspondences
+    std::mt19937 RandomNumberEngine(static_cast<std::mt19937::result_type>(m_SeedValue));
+
+    MatrixFloat64 Hypotheses(static_cast<sint64>(3U * m_NumberOfHypotheses), 3);
+    uint64        NumberOfHypotheses{0U};
+    ListUInt64    Sample(SampleSize);
+
+    for(uint64 i_Hypothesis{0U}; i_Hypothesis < m_NumberOfHypotheses; i_Hypothesis++)
+    {
+        const uint64 SamplingSetSize{SampleSize + ((NumberOfCorrespondences - SampleSize) * (i_Hypothesis + 1U)) / m_NumberOfHypotheses};
+
+        std::uniform_int_distribution<uint64> UniformDistribution(0U, SamplingSetSize - 1U);
+
+        uint64 SampleCounter{0U};
+
+        while(SampleCounter < SampleSize)
+        {
+            const uint64 ChosenIndex{UniformDistribution(RandomNumberEngine)};
+
+            if(std::find(Sample.begin(), Sample.begin() + static_cast<sint64>(SampleCounter), ChosenIndex) == (Sample.begin() + static_cast<sint64>(SampleCounter)))
+            {
+                Sample[SampleCounter] = ChosenIndex;
+                SampleCounter++;
+            }
+        }
+
+        MatrixFloat64_3d Hypothesis;
+
+        if(ComputeFundamentalMatrix(ImagePointsFirst, ImagePointsSecond, Sample, Hypothesis))
+        {
+            Hypotheses.block<3, 3>(static_cast<sint64>(3U * NumberOfHypotheses), 0) = Hypothesis;
+            NumberOfHypotheses++;
+        }
+    }
+
+    if(NumberOfHypotheses == 0U)
+    {
+        return 0U;
+    }
+
+    // score the hypotheses block by block in random order (the worse half of the hypotheses is discarded after each block)
+    ListUInt64 CorrespondenceOrder(NumberOfCorrespondences);
+
+    std::iota(CorrespondenceOrder.begin(), CorrespondenceOrder.end(), 0U);
+    std::shuffle(CorrespondenceOrder.begin(), CorrespondenceOrder.end(), RandomNumberEngine);
+
+    ListUInt64 HypothesisIndices(NumberOfHypotheses);
+    ListUInt64 Scores(NumberOfHypotheses, 0U);
+
+    std::iota(HypothesisIndices.begin(), HypothesisIndices.end(), 0U);
+
+    MatrixFloat64 PointsFirst;
+    MatrixFloat64 PointsSecond;
+
+    for(uint64 BlockStart{0U}; (BlockStart < NumberOfCorrespondences) && (HypothesisIndices.size() > 1U); BlockStart += m_BlockSize)
+    {
+        const uint64 BlockEnd{std::min(BlockStart + m_BlockSize, NumberOfCorrespondences)};
+        const sint64 NumberOfPointsInBlock{static_cast<sint64>(BlockEnd - BlockStart)};
+
+        // collect homogeneous image coordinates of the block
+        PointsFirst.resize(3, NumberOfPointsInBlock);
+        PointsSecond.resize(3, NumberOfPointsInBlock);
+
+        for(sint64 i_Point{0}; i_Point < NumberOfPointsInBlock; i_Point++)
+        {
+            const sint64 CorrespondenceIndex{static_cast<sint64>(CorrespondenceOrder[BlockStart + static_cast<uint64>(i_Point)])};
+
+            PointsFirst.col(i_Point) << ImagePointsFirst.col(CorrespondenceIndex), 1.0;
+            PointsSecond.col(i_Point) << ImagePointsSecond.col(CorrespondenceIndex), 1.0;
+        }
+
+        ScoreHypotheses(Hypotheses, HypothesisIndices, PointsFirst, PointsSecond, Scores);
+
+        // keep the better half of the hypotheses
+        const uint64 NumberOfSurvivingHypotheses{std::max(HypothesisIndices.size() / 2U, static_cast<uint64>(1U))};
+
+        std::stable_sort(HypothesisIndices.begin(), HypothesisIndices.end(), [&Scores](const uint64 IndexA, const uint64 IndexB) { return Scores[IndexA] > Scores[IndexB]; });
+
+        HypothesisIndices.resize(NumberOfSurvivingHypotheses);
+    }
+
+    // select the best hypothesis (the remaining hypotheses have been scored on the same blocks)
+    const uint64 IndexBest{*std::max_element(HypothesisIndices.begin(), HypothesisIndices.end(), [&Scores](const uint64 IndexA, const uint64 IndexB) { return Scores[IndexA] < Scores[IndexB]; })};
+
+    FundamentalMatrix = Hypotheses.block<3, 3>(static_cast<sint64>(3U * IndexBest), 0);
+
+    uint64 NumberOfInliers{ComputeInliers(ImagePointsFirst, ImagePointsSecond, FundamentalMatrix, InlierMask)};
+
+    // refine the fundamental matrix by all inliers
+    if(NumberOfInliers >= SampleSize)
+    {
+        ListUInt64 InlierIndices;
+
+        InlierIndices.reserve(NumberOfInliers);
+
+        for(uint64 i_Correspondence{0U}; i_Correspondence < NumberOfCorrespondences; i_Correspondence++)
+        {
+            if(InlierMask[i_Correspondence])
+            {
+                InlierIndices.push_back(i_Correspondence);
+            }
+        }
+
+        MatrixFloat64_3d FundamentalMatrixRefined;
+        ListBoolean      InlierMaskRefined;
+
+        if(ComputeFundamentalMatrix(ImagePointsFirst, ImagePointsSecond, InlierIndices, FundamentalMatrixRefined))
+        {
+            const uint64 NumberOfInliersRefined{ComputeInliers(ImagePointsFirst, ImagePointsSecond, FundamentalMatrixRefined, InlierMaskRefined)};
+
+            if(NumberOfInliersRefined >= NumberOfInliers)
+            {
+                FundamentalMatrix = FundamentalMatrixRefined;
+                InlierMask        = InlierMaskRefined;
+                NumberOfInliers   = NumberOfInliersRefined;
+            }
+        }
+    }
+
+    return NumberOfInliers;
+}
+
+uint64 GeometricVerifier::VerifyStereo(const MatrixFloat64_2xX& ImagePointsStereoLeft,
+                                       const MatrixFloat64_2xX& ImagePointsStereoRight,
+                                       const float64            MaximumRowDistance,
+                                       const float64            MaximumDisparity,
+                                       ListBoolean&             InlierMask)
+{
+    // check number of feature correspondences
+    if(ImagePointsStereoLeft.cols() != ImagePointsStereoRight.cols())
+    {
+        throw std::invalid_argument("The number of image points in the left image must match the number of image points in the right image.");
+    }
+
+    // get number of feature correspondences
+    const sint64 NumberOfCorrespondences{ImagePointsStereoLeft.cols()};
+
+    // check row distance and disparity of all feature correspondences at once
+    const Eigen::Array<float64, 1, Eigen::Dynamic> RowDistances{(ImagePointsStereoLeft.row(1) - ImagePointsStereoRight.row(1)).array().abs()};
+    const Eigen::Array<float64, 1, Eigen::Dynamic> Disparities{(ImagePointsStereoLeft.row(0) - ImagePointsStereoRight.row(0)).array()};
+
+    const Eigen::Array<boolean, 1, Eigen::Dynamic> IsInlier{(RowDistances <= MaximumRowDistance) && (Disparities >= 0.0) && (Disparities <= MaximumDisparity)};
+
+    // store inlier mask
+    InlierMask.resize(static_cast<uint64>(NumberOfCorrespondences));
+
+    uint64 NumberOfInliers{0U};
+
+    for(sint64 i_Correspondence{0}; i_Correspondence < NumberOfCorrespondences; i_Correspondence++)
+    {
+        InlierMask[static_cast<uint64>(i_Correspondence)] = IsInlier(i_Correspondence);
+
+        if(IsInlier(i_Correspondence))
+        {
+            NumberOfInliers++;
+        }
+    }
+
+    return NumberOfInliers;
+}
+
+boolean GeometricVerifier::ComputeFundamentalMatrix(const MatrixFloat64_2xX& ImagePointsFirst,
+                                                    const MatrixFloat64_2xX& ImagePointsSecond,
+                                                    const ListUInt64&        Indices,
+                                                    MatrixFloat64_3d&        FundamentalMatrix)
+{
+    // get number of feature correspondences
+    const uint64 NumberOfCorrespondences{Indices.size()};
+
+    if(NumberOfCorrespondences < 8U)
+    {
+        return false;
+    }
+
+    // normalize the image coordinates
+    MatrixFloat64_3d TransformationFirst;
+    MatrixFloat64_3d TransformationSecond;
+
+    if(!ComputeNormalization(ImagePointsFirst, Indices, TransformationFirst) || !ComputeNormalization(ImagePointsSecond, Indices, TransformationSecond))
+    {
+        return false;
+    }
+
+    // set up the linear system (one epipolar constraint per feature correspondence)
+    MatrixFloat64 DesignMatrix(static_cast<sint64>(NumberOfCorrespondences), 9);
+
+    for(uint64 i_Correspondence{0U}; i_Correspondence < NumberOfCorrespondences; i_Correspondence++)
+    {
+        const sint64 Index{static_cast<sint64>(Indices[i_Correspondence])};
+
+        ColumnVectorFloat64_3d PointFirst;
+        ColumnVectorFloat64_3d PointSecond;
+
+        PointFirst << ImagePointsFirst.col(Index), 1.0;
+        PointSecond << ImagePointsSecond.col(Index), 1.0;
+
+        PointFirst  = TransformationFirst * PointFirst;
+        PointSecond = TransformationSecond * PointSecond;
+
+        DesignMatrix.row(static_cast<sint64>(i_Correspondence)) << PointSecond(0) * PointFirst(0), PointSecond(0) * PointFirst(1), PointSecond(0),
+            PointSecond(1) * PointFirst(0), PointSecond(1) * PointFirst(1), PointSecond(1),
+            PointFirst(0), PointFirst(1), 1.0;
+    }
+
+    // solve the linear system (right singular vector of the smallest singular value, the design matrix is decomposed directly since the normal matrix squares its condition number)
+    const Eigen::JacobiSVD<MatrixFloat64> DesignMatrixSVD(DesignMatrix, Eigen::ComputeFullV);
+
+    const ColumnVectorFloat64 Solution{DesignMatrixSVD.matrixV().col(8)};
+
+    MatrixFloat64_3d FundamentalMatrixNormalized;
+
+    FundamentalMatrixNormalized << Solution(0), Solution(1), Solution(2),
+        Solution(3), Solution(4), Solution(5),
+        Solution(6), Solution(7), Solution(8);
+
+    // enforce rank 2
+    const Eigen::JacobiSVD<MatrixFloat64_3d> FundamentalMatrixSVD(FundamentalMatrixNormalized, Eigen::ComputeFullU | Eigen::ComputeFullV);
+
+    ColumnVectorFloat64_3d SingularValues{FundamentalMatrixSVD.singularValues()};
+
+    SingularValues(2) = 0.0;
+
+    FundamentalMatrixNormalized = FundamentalMatrixSVD.matrixU() * SingularValues.asDiagonal() * FundamentalMatrixSVD.matrixV().transpose();
+
+    // undo the normalization
+    FundamentalMatrix = TransformationSecond.transpose() * FundamentalMatrixNormalized * TransformationFirst;
+
+    const float64 Norm{FundamentalMatrix.norm()};
+
+    if(!(Norm > 0.0))
+    {
+        return false;
+    }
+
+    FundamentalMatrix /= Norm;
+
+    return true;
+}
+
+boolean GeometricVerifier::ComputeNormalization(const MatrixFloat64_2xX& ImagePoints,
+                                                const ListUInt64&        Indices,
+                                                MatrixFloat64_3d&        Transformation)
+{
+    // get number of image points
+    const uint64 NumberOfImagePoints{Indices.size()};
+
+    // compute centroid
+    ColumnVectorFloat64_2d Centroid{ColumnVectorFloat64_2d::Zero()};
+
+    for(const uint64 Index : Indices)
+    {
+        Centroid += ImagePoints.col(static_cast<sint64>(Index));
+    }
+
+    Centroid /= static_cast<float64>(NumberOfImagePoints);
+
+    // compute average distance from the centroid
+    float64 AverageDistance{0.0};
+
+    for(const uint64 Index : Indices)
+    {
+        AverageDistance += (ImagePoints.col(static_cast<sint64>(Index)) - Centroid).norm();
+    }
+
+    AverageDistance /= static_cast<float64>(NumberOfImagePoints);
+
+    if(!(AverageDistance > 0.0))
+    {
+        return false;
+    }
+
+    // compose transformation
+    const float64 Scale{std::sqrt(2.0) / AverageDistance};
+
+    Transformation << Scale, 0.0, -Scale * Centroid(0),
+        0.0, Scale, -Scale * Centroid(1),
+        0.0, 0.0, 1.0;
+
+    return true;
+}
+
+uint64 GeometricVerifier::ComputeInliers(const MatrixFloat64_2xX& ImagePointsFirst,
+                                         const MatrixFloat64_2xX& ImagePointsSecond,
+                                         const MatrixFloat64_3d&  FundamentalMatrix,
+                                         ListBoolean&             InlierMask) const
+{
+    // check number of feature correspondences
+    if(ImagePointsFirst.cols() != ImagePointsSecond.cols())
+    {
+        throw std::invalid_argument("The number of image points in the first image must match the number of image points in the second image.");
+    }
+
+    // get number of feature correspondences
+    const sint64 NumberOfCorrespondences{ImagePointsFirst.cols()};
+
+    // compute epipolar lines of all feature correspondences at once
+    const MatrixFloat64 LinesSecond{(FundamentalMatrix.leftCols<2>() * ImagePointsFirst).colwise() + FundamentalMatrix.col(2)};
+    const MatrixFloat64 LinesFirst{(FundamentalMatrix.transpose().leftCols<2>() * ImagePointsSecond).colwise() + FundamentalMatrix.row(2).transpose()};
+
+    // compute squared Sampson distances
+    const Eigen::Array<float64, 1, Eigen::Dynamic> Residuals{(ImagePointsSecond.array() * LinesSecond.topRows<2>().array()).colwise().sum() + LinesSecond.row(2).array()};
+    const Eigen::Array<float64, 1, Eigen::Dynamic> Denominators{LinesSecond.topRows<2>().array().square().colwise().sum() + LinesFirst.topRows<2>().array().square().colwise().sum()};
+
+    const Eigen::Array<float64, 1, Eigen::Dynamic> SquaredSampsonDistances{Residuals.square() / Denominators.max(std::numeric_limits<float64>::min())};
+
+    // store inlier mask
+    const float64 SquaredInlierThreshold{m_InlierThreshold * m_InlierThreshold};
+
+    InlierMask.resize(static_cast<uint64>(NumberOfCorrespondences));
+
+    uint64 NumberOfInliers{0U};
+
+    for(sint64 i_Correspondence{0}; i_Correspondence < NumberOfCorrespondences; i_Correspondence++)
+    {
+        const boolean IsInlier{SquaredSampsonDistances(i_Correspondence) <= SquaredInlierThreshold};
+
+        InlierMask[static_cast<uint64>(i_Correspondence)] = IsInlier;
+
+        if(IsInlier)
+        {
+            NumberOfInliers++;
+        }
+    }
+
+    return NumberOfInliers;
+}
+
+void GeometricVerifier::ScoreHypotheses(const MatrixFloat64& Hypotheses,
+                                        const ListUInt64&    HypothesisIndices,
+                                        const MatrixFloat64& PointsFirst,
+                                        const MatrixFloat64& PointsSecond,
+                                        ListUInt64&          Scores) const
+{
+    // get number of hypotheses
+    const uint64 NumberOfHypotheses{HypothesisIndices.size()};
+
+    // stack the hypotheses and their transposes
+    MatrixFloat64 StackedHypotheses(static_cast<sint64>(3U * NumberOfHypotheses), 3);
+    MatrixFloat64 StackedHypothesesTransposed(static_cast<sint64>(3U * NumberOfHypotheses), 3);
+
+    for(uint64 i_Hypothesis{0U}; i_Hypothesis < NumberOfHypotheses; i_Hypothesis++)
+    {
+        const MatrixFloat64_3d Hypothesis{Hypotheses.block<3, 3>(static_cast<sint64>(3U * HypothesisIndices[i_Hypothesis]), 0)};
+
+        StackedHypotheses.block<3, 3>(static_cast<sint64>(3U * i_Hypothesis), 0)           = Hypothesis;
+        StackedHypothesesTransposed.block<3, 3>(static_cast<sint64>(3U * i_Hypothesis), 0) = Hypothesis.transpose();
+    }
+
+    // compute the epipolar lines of the block for all hypotheses at once
+    const MatrixFloat64 LinesSecond{StackedHypotheses * PointsFirst};
+    const MatrixFloat64 LinesFirst{StackedHypothesesTransposed * PointsSecond};
+
+    // count the feature correspondences whose Sampson distance is below the threshold
+    const float64 SquaredInlierThreshold{m_InlierThreshold * m_InlierThreshold};
+
+    for(uint64 i_Hypothesis{0U}; i_Hypothesis < NumberOfHypotheses; i_Hypothesis++)
+    {
+        const sint64 Row{static_cast<sint64>(3U * i_Hypothesis)};
+
+        const Eigen::Array<float64, 1, Eigen::Dynamic> Residuals{(PointsSecond.array() * LinesSecond.middleRows<3>(Row).array()).colwise().sum()};
+        const Eigen::Array<float64, 1, Eigen::Dynamic> Denominators{LinesSecond.middleRows<2>(Row).array().square().colwise().sum() + LinesFirst.middleRows<2>(Row).array().square().colwise().sum()};
+
+        const uint64 NumberOfInliers{static_cast<uint64>((Residuals.square() <= (SquaredInlierThreshold * Denominators)).count())};
+
+        Scores[HypothesisIndices[i_Hypothesis]] += NumberOfInliers;
+    }
+}
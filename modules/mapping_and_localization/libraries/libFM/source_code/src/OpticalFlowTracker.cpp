@@ -0,0 +1,392 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  OpticalFlowTracker.cpp
+///
+/// \brief Source file containing the OpticalFlowTracker class.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <opencv2/imgproc/imgproc.hpp>
+#include <opencv2/video/tracking.hpp>
+
+#include "../include/OpticalFlowTracker.h"
+
+OpticalFlowTracker::OpticalFlowTracker(const FeatureBucketerBase& Bucketer,
+                                       const uint64               NumberOfStreams,
+                                       const uint8                NumberOfPyramidLevels,
+                                       const uint16               WindowSize,
+                                       const boolean              UseForwardBackwardCheck,
+                                       const float64              MaximumForwardBackwardError,
+                                       const float64              MinimumDistance,
+                                       const float64              QualityLevel) :
+    m_FeatureBucketer{Bucketer},
+    m_NumberOfStreams{NumberOfStreams},
+    m_NumberOfPyramidLevels{static_cast<sint32>(NumberOfPyramidLevels)},
+    m_WindowSize{static_cast<sint32>(WindowSize), static_cast<sint32>(WindowSize)},
+    m_UseForwardBackwardCheck{UseForwardBackwardCheck},
+    m_MaximumForwardBackwardError{MaximumForwardBackwardError},
+    m_MinimumDistance{MinimumDistance},
+    m_QualityLevel{QualityLevel}
+{
+    // create the states of the image streams
+    m_TrackingStreams.resize(m_NumberOfStreams);
+}
+
+OpticalFlowTracker::~OpticalFlowTracker()
+{
+}
+
+uint64 OpticalFlowTracker::GetNumberOfTracks(const uint64 StreamIndex) const
+{
+    CheckStreamIndex(StreamIndex);
+
+    return m_TrackingStreams[StreamIndex].TrackIDs.size();
+}
+
+const ListUInt64& OpticalFlowTracker::GetTrackAges(const uint64 StreamIndex) const
+{
+    CheckStreamIndex(StreamIndex);
+
+    return m_TrackingStreams[StreamIndex].TrackAges;
+}
+
+const ListUInt64& OpticalFlowTracker::GetTrackIDs(const uint64 StreamIndex) const
+{
+    CheckStreamIndex(StreamIndex);
+
+    return m_TrackingStreams[StreamIndex].TrackIDs;
+}
+
+const ListColumnVectorFloat64_2d& OpticalFlowTracker::GetTrackImagePoints(const uint64 StreamIndex) const
+{
+    CheckStreamIndex(StreamIndex);
+
+    return m_TrackingStreams[StreamIndex].TrackImagePoints;
+}
+
+void OpticalFlowTracker::ProcessImages(const std::vector<cv::Mat>& Images)
+{
+    // check whether there is exactly one image for each image stream
+    if(Images.size() != m_NumberOfStreams)
+    {
+        throw std::invalid_argument("Number of images (" + std::to_string(Images.size()) + ") does not match the number of image streams (" + std::to_string(m_NumberOfStreams) + ").");
+    }
+
+    // check whether the images match the size of the feature bucketer (before any stream is changed)
+    const cv::Size ImageSizeBucketer(static_cast<sint32>(m_FeatureBucketer.GetNumberOfPixelsHorizontal()), static_cast<sint32>(m_FeatureBucketer.GetNumberOfPixelsVertical()));
+
+    for(const cv::Mat& Image : Images)
+    {
+        if(Image.size() != ImageSizeBucketer)
+        {
+            throw std::invalid_argument("Size of the image (" + std::to_string(Image.cols) + "x" + std::to_string(Image.rows) + ") does not match the size of the feature bucketer (" + std::to_string(ImageSizeBucketer.width) + "x" + std::to_string(ImageSizeBucketer.height) + ").");
+        }
+    }
+
+    // track the image streams in parallel (the streams do not share any state)
+    cv::parallel_for_(cv::Range(0, static_cast<sint32>(m_NumberOfStreams)),
+                      [this, &Images](const cv::Range& StreamRange)
+                      {
+                          for(sint32 i_Stream{StreamRange.start}; i_Stream < StreamRange.end; i_Stream++)
+                          {
+                              TrackStream(Images[static_cast<uint64>(i_Stream)], m_TrackingStreams[static_cast<uint64>(i_Stream)]);
+                          }
+                      });
+}
+
+void OpticalFlowTracker::Reset()
+{
+    // terminate all tracks and forget the previous images
+    for(TrackingStream& Stream : m_TrackingStreams)
+    {
+        Stream.PyramidPrevious.clear();
+        Stream.ImagePointsPrevious.clear();
+        Stream.TrackIDs.clear();
+        Stream.TrackAges.clear();
+        Stream.TrackImagePoints.clear();
+    }
+}
+
+void OpticalFlowTracker::CheckStreamIndex(const uint64 StreamIndex) const
+{
+    if(StreamIndex >= m_NumberOfStreams)
+    {
+        throw std::out_of_range("StreamIndex " + std::to_string(StreamIndex) + " is out of range.");
+    }
+}
+
+boolean OpticalFlowTracker::IsCloseToTrack(const cv::Point2f&    ImagePoint,
+                                           const TrackingStream& Stream) const
+{
+    // get bucket layout
+    const sint64  NumberOfBucketsHorizontal{static_cast<sint64>(m_FeatureBucketer.GetNumberOfBucketsHorizontal())};
+    const sint64  NumberOfBucketsVertical{static_cast<sint64>(m_FeatureBucketer.GetNumberOfBucketsVertical())};
+    const float64 BucketSizeHorizontal{m_FeatureBucketer.GetBucketSizeHorizontal()};
+    const float64 BucketSizeVertical{m_FeatureBucketer.GetBucketSizeVertical()};
+
+    // get all buckets which overlap with the minimum distance around the image point
+    const float64 CoordinateHorizontal{static_cast<float64>(ImagePoint.x)};
+    const float64 CoordinateVertical{static_cast<float64>(ImagePoint.y)};
+
+    const sint64 BucketColumnFirst{std::max(static_cast<sint64>(std::floor((CoordinateHorizontal - m_MinimumDistance) / BucketSizeHorizontal)), static_cast<sint64>(0))};
+    const sint64 BucketColumnLast{std::min(static_cast<sint64>(std::floor((CoordinateHorizontal + m_MinimumDistance) / BucketSizeHorizontal)), NumberOfBucketsHorizontal - 1)};
+    const sint64 BucketRowFirst{std::max(static_cast<sint64>(std::floor((CoordinateVertical - m_MinimumDistance) / BucketSizeVertical)), static_cast<sint64>(0))};
+    const sint64 BucketRowLast{std::min(static_cast<sint64>(std::floor((CoordinateVertical + m_MinimumDistance) / BucketSizeVertical)), NumberOfBucketsVertical - 1)};
+
+    const float64 MinimumDistanceSquared{m_MinimumDistance * m_MinimumDistance};
+
+    for(sint64 i_BucketRow{BucketRowFirst}; i_BucketRow <= BucketRowLast; i_BucketRow++)
+    {
+        for(sint64 i_BucketColumn{BucketColumnFirst}; i_BucketColumn <= BucketColumnLast; i_BucketColumn++)
+        {
+            const uint64 BucketID{static_cast<uint64>(i_BucketRow * NumberOfBucketsHorizontal + i_BucketColumn)};
+
+            for(const uint64 TrackIndex : Stream.TrackIndicesInBuckets[BucketID])
+            {
+                const float64 DistanceHorizontal{static_cast<float64>(ImagePoint.x - Stream.ImagePointsCurrent[TrackIndex].x)};
+                const float64 DistanceVertical{static_cast<float64>(ImagePoint.y - Stream.ImagePointsCurrent[TrackIndex].y)};
+
+                if((DistanceHorizontal * DistanceHorizontal + DistanceVertical * DistanceVertical) < MinimumDistanceSquared)
+                {
+                    return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+void OpticalFlowTracker::ReplenishTracks(const cv::Mat&  Image,
+                                         TrackingStream& Stream) const
+{
+    // get bucket layout
+    const MatrixUInt8& FeatureMask{m_FeatureBucketer.GetFeatureMask()};
+
+    const uint64  NumberOfBucketsHorizontal{static_cast<uint64>(FeatureMask.cols())};
+    const uint64  NumberOfBucketsVertical{static_cast<uint64>(FeatureMask.rows())};
+    const float64 BucketSizeHorizontal{m_FeatureBucketer.GetBucketSizeHorizontal()};
+    const float64 BucketSizeVertical{m_FeatureBucketer.GetBucketSizeVertical()};
+
+    // distribute the tracks into the buckets
+    Stream.TrackIndicesInBuckets.resize(NumberOfBucketsHorizontal * NumberOfBucketsVertical);
+
+    for(ListUInt64& TrackIndicesInBucket : Stream.TrackIndicesInBuckets)
+    {
+        TrackIndicesInBucket.clear();
+    }
+
+    const uint64 NumberOfTrackedFeatures{Stream.ImagePointsCurrent.size()};
+
+    for(uint64 i_Track{0U}; i_Track < NumberOfTrackedFeatures; i_Track++)
+    {
+        uint16 BucketID{0U};
+
+        if(m_FeatureBucketer.ComputeBucketID(Stream.ImagePointsCurrent[i_Track].x, Stream.ImagePointsCurrent[i_Track].y, BucketID))
+        {
+            Stream.TrackIndicesInBuckets[BucketID].push_back(i_Track);
+        }
+    }
+
+    // detect new features in all buckets which are not filled up
+    for(uint64 i_BucketVertical{0U}; i_BucketVertical < NumberOfBucketsVertical; i_BucketVertical++)
+    {
+        for(uint64 i_BucketHorizontal{0U}; i_BucketHorizontal < NumberOfBucketsHorizontal; i_BucketHorizontal++)
+        {
+            const uint64 BucketID{i_BucketVertical * NumberOfBucketsHorizontal + i_BucketHorizontal};
+            const uint64 NumberOfTracksInBucket{Stream.TrackIndicesInBuckets[BucketID].size()};
+
+            const uint64 MaximumNumberOfFeatures{static_cast<uint64>(FeatureMask(static_cast<sint64>(i_BucketVertical), static_cast<sint64>(i_BucketHorizontal)))};
+
+            if(NumberOfTracksInBucket >= MaximumNumberOfFeatures)
+            {
+                continue;
+            }
+
+            const uint64 NumberOfMissingFeatures{MaximumNumberOfFeatures - NumberOfTracksInBucket};
+
+            // compute region of the bucket in the image
+            const sint32 BucketStartHorizontal{static_cast<sint32>(std::floor(static_cast<float64>(i_BucketHorizontal) * BucketSizeHorizontal))};
+            const sint32 BucketStartVertical{static_cast<sint32>(std::floor(static_cast<float64>(i_BucketVertical) * BucketSizeVertical))};
+            const sint32 BucketEndHorizontal{std::min(static_cast<sint32>(std::floor(static_cast<float64>(i_BucketHorizontal + 1U) * BucketSizeHorizontal)), Image.cols)};
+            const sint32 BucketEndVertical{std::min(static_cast<sint32>(std::floor(static_cast<float64>(i_BucketVertical + 1U) * BucketSizeVertical)), Image.rows)};
+
+            if((BucketEndHorizontal <= BucketStartHorizontal) || (BucketEndVertical <= BucketStartVertical))
+            {
+                continue;
+            }
+
+            const cv::Rect BucketRegion(BucketStartHorizontal, BucketStartVertical, BucketEndHorizontal - BucketStartHorizontal, BucketEndVertical - BucketStartVertical);
+
+            // count the tracks which can discard detections in the bucket (inside the bucket or closer to it than the
+            // minimum distance)
+            const uint64 NeighborColumnFirst{static_cast<uint64>(std::max(std::floor((static_cast<float64>(BucketStartHorizontal) - m_MinimumDistance) / BucketSizeHorizontal), 0.0))};
+            const uint64 NeighborColumnLast{std::min(static_cast<uint64>(std::floor((static_cast<float64>(BucketEndHorizontal) + m_MinimumDistance) / BucketSizeHorizontal)), NumberOfBucketsHorizontal - 1U)};
+            const uint64 NeighborRowFirst{static_cast<uint64>(std::max(std::floor((static_cast<float64>(BucketStartVertical) - m_MinimumDistance) / BucketSizeVertical), 0.0))};
+            const uint64 NeighborRowLast{std::min(static_cast<uint64>(std::floor((static_cast<float64>(BucketEndVertical) + m_MinimumDistance) / BucketSizeVertical)), NumberOfBucketsVertical - 1U)};
+
+            uint64 NumberOfNearbyTracks{0U};
+
+            for(uint64 i_NeighborRow{NeighborRowFirst}; i_NeighborRow <= NeighborRowLast; i_NeighborRow++)
+            {
+                for(uint64 i_NeighborColumn{NeighborColumnFirst}; i_NeighborColumn <= NeighborColumnLast; i_NeighborColumn++)
+                {
+                    NumberOfNearbyTracks += Stream.TrackIndicesInBuckets[i_NeighborRow * NumberOfBucketsHorizontal + i_NeighborColumn].size();
+                }
+            }
+
+            // detect features (request additional ones, since detections close to tracked features are discarded)
+            cv::goodFeaturesToTrack(Image(BucketRegion),
+                                    Stream.ImagePointsDetected,
+                                    static_cast<sint32>(NumberOfMissingFeatures + NumberOfNearbyTracks),
+                                    m_QualityLevel,
+                                    m_MinimumDistance);
+
+            // start new tracks for the strongest features which are not close to a tracked feature (of any bucket, the
+            // new tracks are added to the bucket, so the detections of the next buckets keep their distance as well)
+            uint64 NumberOfNewFeatures{0U};
+
+            for(const cv::Point2f& ImagePointDetected : Stream.ImagePointsDetected)
+            {
+                if(NumberOfNewFeatures == NumberOfMissingFeatures)
+                {
+                    break;
+                }
+
+                const cv::Point2f ImagePoint(ImagePointDetected.x + static_cast<float32>(BucketStartHorizontal), ImagePointDetected.y + static_cast<float32>(BucketStartVertical));
+
+                if(IsCloseToTrack(ImagePoint, Stream))
+                {
+                    continue;
+                }
+
+                Stream.TrackIndicesInBuckets[BucketID].push_back(Stream.ImagePointsCurrent.size());
+                Stream.ImagePointsCurrent.push_back(ImagePoint);
+                Stream.TrackIDs.push_back(Stream.NextTrackID);
+                Stream.TrackAges.push_back(1U);
+
+                Stream.NextTrackID++;
+                NumberOfNewFeatures++;
+            }
+        }
+    }
+}
+
+void OpticalFlowTracker::TrackStream(const cv::Mat&  Image,
+                                     TrackingStream& Stream) const
+{
+    // build image pyramid of the current image (reused as previous pyramid for the next image)
+    cv::buildOpticalFlowPyramid(Image, Stream.PyramidCurrent, m_WindowSize, m_NumberOfPyramidLevels);
+
+    const uint64 NumberOfTracks{Stream.ImagePointsPrevious.size()};
+
+    if((NumberOfTracks > 0U) && !Stream.PyramidPrevious.empty())
+    {
+        // track features from the previous into the current image
+        cv::calcOpticalFlowPyrLK(Stream.PyramidPrevious,
+                                 Stream.PyramidCurrent,
+                                 Stream.ImagePointsPrevious,
+                                 Stream.ImagePointsCurrent,
+                                 Stream.StatusForward,
+                                 Stream.TrackingErrors,
+                                 m_WindowSize,
+                                 m_NumberOfPyramidLevels);
+
+        // track features back from the current into the previous image (started at the tracked positions, an
+        // initialization with the original positions would bias the backward tracking towards passing the check)
+        if(m_UseForwardBackwardCheck)
+        {
+            cv::calcOpticalFlowPyrLK(Stream.PyramidCurrent,
+                                     Stream.PyramidPrevious,
+                                     Stream.ImagePointsCurrent,
+                                     Stream.ImagePointsBackward,
+                                     Stream.StatusBackward,
+                                     Stream.TrackingErrors,
+                                     m_WindowSize,
+                                     m_NumberOfPyramidLevels);
+        }
+
+        // keep valid tracks only (in place, the order of the tracks is preserved)
+        const float64 MaximumForwardBackwardErrorSquared{m_MaximumForwardBackwardError * m_MaximumForwardBackwardError};
+        const float32 ImageWidth{static_cast<float32>(Image.cols)};
+        const float32 ImageHeight{static_cast<float32>(Image.rows)};
+
+        uint64 NumberOfValidTracks{0U};
+
+        for(uint64 i_Track{0U}; i_Track < NumberOfTracks; i_Track++)
+        {
+            const cv::Point2f& ImagePoint{Stream.ImagePointsCurrent[i_Track]};
+
+            boolean TrackIsValid{(Stream.StatusForward[i_Track] != 0U) && (ImagePoint.x >= 0.0F) && (ImagePoint.x < ImageWidth) && (ImagePoint.y >= 0.0F) && (ImagePoint.y < ImageHeight)};
+
+            if(TrackIsValid && m_UseForwardBackwardCheck)
+            {
+                const float64 ErrorHorizontal{static_cast<float64>(Stream.ImagePointsBackward[i_Track].x - Stream.ImagePointsPrevious[i_Track].x)};
+                const float64 ErrorVertical{static_cast<float64>(Stream.ImagePointsBackward[i_Track].y - Stream.ImagePointsPrevious[i_Track].y)};
+
+                TrackIsValid = (Stream.StatusBackward[i_Track] != 0U) && ((ErrorHorizontal * ErrorHorizontal + ErrorVertical * ErrorVertical) <= MaximumForwardBackwardErrorSquared);
+            }
+
+            if(TrackIsValid)
+            {
+                Stream.ImagePointsCurrent[NumberOfValidTracks] = ImagePoint;
+                Stream.TrackIDs[NumberOfValidTracks]           = Stream.TrackIDs[i_Track];
+                Stream.TrackAges[NumberOfValidTracks]          = Stream.TrackAges[i_Track] + 1U;
+
+                NumberOfValidTracks++;
+            }
+        }
+
+        Stream.ImagePointsCurrent.resize(NumberOfValidTracks);
+        Stream.TrackIDs.resize(NumberOfValidTracks);
+        Stream.TrackAges.resize(NumberOfValidTracks);
+    }
+    else
+    {
+        Stream.ImagePointsCurrent.clear();
+        Stream.TrackIDs.clear();
+        Stream.TrackAges.clear();
+    }
+
+    // detect new features in buckets which do not contain enough tracks
+    ReplenishTracks(Image, Stream);
+
+    // convert image coordinates of the tracks
+    const uint64 NumberOfTracksCurrent{Stream.ImagePointsCurrent.size()};
+
+    Stream.TrackImagePoints.resize(NumberOfTracksCurrent);
+
+    for(uint64 i_Track{0U}; i_Track < NumberOfTracksCurrent; i_Track++)
+    {
+        Stream.TrackImagePoints[i_Track] << static_cast<float64>(Stream.ImagePointsCurrent[i_Track].x), static_cast<float64>(Stream.ImagePointsCurrent[i_Track].y);
+    }
+
+    // current image becomes the previous image
+    std::swap(Stream.PyramidPrevious, Stream.PyramidCurrent);
+    std::swap(Stream.ImagePointsPrevious, Stream.ImagePointsCurrent);
+}
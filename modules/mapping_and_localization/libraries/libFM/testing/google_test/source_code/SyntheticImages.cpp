@@ -0,0 +1,56 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  SyntheticImages.cpp
+///
+/// \brief Source file containing the synthetic images for the unit tests.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#include <random>
+
+#include <opencv2/imgproc/imgproc.hpp>
+
+#include "SyntheticImages.h"
+
+cv::Mat CreateRectangleImage(const sint32 NumberOfPixelsHorizontal,
+                             const sint32 NumberOfPixelsVertical,
+                             const uint32 Seed)
+{
+    std::mt19937 RandomNumberEngine(Seed);
+
+    std::uniform_int_distribution<sint32> DistributionColumn(0, NumberOfPixelsHorizontal - 1);
+    std::uniform_int_distribution<sint32> DistributionRow(0, NumberOfPixelsVertical - 1);
+    std::uniform_int_distribution<sint32> DistributionSize(8, 40);
+    std::uniform_int_distribution<sint32> DistributionIntensity(0, 255);
+
+    cv::Mat Image(NumberOfPixelsVertical, NumberOfPixelsHorizontal, CV_8UC1, cv::Scalar(128));
+
+    const uint64 NumberOfRectangles{(static_cast<uint64>(NumberOfPixelsHorizontal) * static_cast<uint64>(NumberOfPixelsVertical)) / 800U};
+
+    for(uint64 i_Rectangle{0U}; i_Rectangle < NumberOfRectangles; i_Rectangle++)
+    {
+        const cv::Rect Rectangle(DistributionColumn(RandomNumberEngine), DistributionRow(RandomNumberEngine), DistributionSize(RandomNumberEngine), DistributionSize(RandomNumberEngine));
+
+        cv::rectangle(Image, Rectangle, cv::Scalar(DistributionIntensity(RandomNumberEngine)), cv::FILLED);
+    }
+
+    return Image;
+}
@@ -0,0 +1,49 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  SyntheticImages.h
+///
+/// \brief Header file containing the synthetic images for the unit tests.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#ifndef SYNTHETICIMAGES_H
+#define SYNTHETICIMAGES_H
+
+#include <opencv2/core/core.hpp>
+
+#include <GlobalTypesDerived.h>
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief     Creates an image with random rectangles.
+///
+/// The corners of the overlapping rectangles yield well-distributed features.
+///
+/// \param[in] NumberOfPixelsHorizontal Number of pixels in horizontal direction.
+/// \param[in] NumberOfPixelsVertical   Number of pixels in vertical direction.
+/// \param[in] Seed                     Seed value of the random number engine.
+///
+/// \return    Image with random rectangles.
+///////////////////////////////////////////////////////////////////////////////
+cv::Mat CreateRectangleImage(const sint32 NumberOfPixelsHorizontal,
+                             const sint32 NumberOfPixelsVertical,
+                             const uint32 Seed);
+
+#endif // SYNTHETICIMAGES_H
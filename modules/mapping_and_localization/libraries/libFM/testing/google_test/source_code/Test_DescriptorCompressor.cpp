@@ -0,0 +1,338 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  Test_DescriptorCompressor.cpp
+///
+/// \brief Source file containing the unit tests for DescriptorCompressor.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../../../source_code/include/DescriptorCompressor.h"
+
+// definition of macros for the unit tests
+#define TEST_RECALL_SYNTHETICDESCRIPTORS_ISWITHINTOLERANCE TEST ///< Define to get a unique test name.
+#define TEST_MATCHES_ALLCANDIDATES_ISMATCHINGEXACT         TEST ///< Define to get a unique test name.
+#define TEST_TRAIN_TOOFEWDESCRIPTORS_ISTHROWING            TEST ///< Define to get a unique test name.
+#define TEST_COMPRESS_INVALIDDESCRIPTORS_ISTHROWING        TEST ///< Define to get a unique test name.
+#define TEST_MATCHES_PRECOMPRESSED_ISMATCHINGCOMPRESSED    TEST ///< Define to get a unique test name.
+#define TEST_DOTPRODUCT_FIXEDLENGTH_ISMATCHINGANYLENGTH    TEST ///< Define to get a unique test name.
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class DescriptorCompressorExposed
+///
+/// \brief Class exposing the matching with a given number of candidates and
+///        the exact matching of the DescriptorCompressor.
+///////////////////////////////////////////////////////////////////////////////
+class DescriptorCompressorExposed : public DescriptorCompressor
+{
+public:
+    using DescriptorCompressor::DescriptorCompressor;
+    using DescriptorCompressor::FindTwoBestMatches;
+    using DescriptorCompressor::FindTwoBestMatchesExact;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief     Creates pairs of synthetic 128-dimensional descriptors.
+///
+/// The descriptors are generated from a 16-dimensional latent space and
+/// disturbed by noise. The second half of the descriptors are noisy copies of
+/// the first half, i.e. each descriptor of the first half has a distinctive
+/// match in the second half.
+///
+/// \param[in] NumberOfPairs Number of descriptor pairs.
+/// \param[in] Seed          Seed value of the random number engine.
+///
+/// \return    Descriptors (one descriptor per row, 2 * NumberOfPairs rows).
+///////////////////////////////////////////////////////////////////////////////
+cv::Mat CreateDescriptorPairs(const sint32 NumberOfPairs,
+                              const uint32 Seed)
+{
+    std::mt19937 RandomNumberEngine(Seed);
+
+    std::normal_distribution<float32> DistributionLatent(0.0F, 1.0F);
+    std::normal_distribution<float32> DistributionMixing(0.0F, 20.0F);
+    std::normal_distribution<float32> DistributionNoise(0.0F, 2.0F);
+
+    // random mixing of the latent space
+    cv::Mat Mixing(16, 128, CV_32F);
+
+    for(sint32 i_Latent{0}; i_Latent < 16; i_Latent++)
+    {
+        for(sint32 i_Element{0}; i_Element < 128; i_Element++)
+        {
+            Mixing.at<float32>(i_Latent, i_Element) = DistributionMixing(RandomNumberEngine);
+        }
+    }
+
+    cv::Mat Descriptors(2 * NumberOfPairs, 128, CV_32F);
+
+    for(sint32 i_Pair{0}; i_Pair < NumberOfPairs; i_Pair++)
+    {
+        float32 Latent[16];
+
+        for(sint32 i_Latent{0}; i_Latent < 16; i_Latent++)
+        {
+            Latent[i_Latent] = DistributionLatent(RandomNumberEngine);
+        }
+
+        for(sint32 i_Element{0}; i_Element < 128; i_Element++)
+        {
+            float32 Value{100.0F + DistributionNoise(RandomNumberEngine)};
+
+            for(sint32 i_Latent{0}; i_Latent < 16; i_Latent++)
+            {
+                Value += Latent[i_Latent] * Mixing.at<float32>(i_Latent, i_Element);
+            }
+
+            Descriptors.at<float32>(i_Pair, i_Element)                 = Value;
+            Descriptors.at<float32>(NumberOfPairs + i_Pair, i_Element) = Value + DistributionNoise(RandomNumberEngine);
+        }
+    }
+
+    return Descriptors;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the recall of the ratio test after the training.
+///
+/// Tests whether the number of re-ranked candidates is tuned such that the
+/// recall of the ratio test stays within the tolerance or not. The maximum
+/// number of candidates is the number of train descriptors used during the
+/// training, i.e. the tolerance can always be met. The expectation is to get
+/// a recall of at least one minus the maximum loss of recall.
+///////////////////////////////////////////////////////////////////////////////
+TEST_RECALL_SYNTHETICDESCRIPTORS_ISWITHINTOLERANCE(DescriptorCompressor, Test_Recall_SyntheticDescriptors_IsWithinTolerance)
+{
+    const sint32  NumberOfPairs{300};
+    const float64 MaximumRecallLoss{0.02};
+
+    const cv::Mat Descriptors{CreateDescriptorPairs(NumberOfPairs, 1U)};
+
+    DescriptorCompressor Compressor(32U, MaximumRecallLoss, static_cast<uint64>(NumberOfPairs));
+
+    ASSERT_FALSE(Compressor.IsTrained());
+
+    Compressor.Train(Descriptors);
+
+    ASSERT_TRUE(Compressor.IsTrained());
+    ASSERT_TRUE(Compressor.IsCompatible(Descriptors, Descriptors));
+    ASSERT_EQ(Compressor.GetNumberOfDimensions(), 32U);
+    ASSERT_GE(Compressor.GetNumberOfCandidates(), 2U);
+    ASSERT_LE(Compressor.GetNumberOfCandidates(), static_cast<uint64>(NumberOfPairs));
+    ASSERT_GE(Compressor.GetRecall(), 1.0 - MaximumRecallLoss);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the matches if all train descriptors are re-ranked.
+///
+/// Tests whether the matches in the compressed domain are equal to the exact
+/// matches if the number of re-ranked candidates is at least the number of
+/// train descriptors or not. The expectation is to get identical matches.
+///////////////////////////////////////////////////////////////////////////////
+TEST_MATCHES_ALLCANDIDATES_ISMATCHINGEXACT(DescriptorCompressor, Test_Matches_AllCandidates_IsMatchingExact)
+{
+    const sint32 NumberOfPairs{200};
+
+    const cv::Mat Descriptors{CreateDescriptorPairs(NumberOfPairs, 2U)};
+    const cv::Mat QueryDescriptors{Descriptors.rowRange(0, NumberOfPairs)};
+    const cv::Mat TrainDescriptors{Descriptors.rowRange(NumberOfPairs, 2 * NumberOfPairs)};
+
+    DescriptorCompressorExposed Compressor(16U);
+
+    Compressor.Train(Descriptors);
+
+    std::vector<std::vector<cv::DMatch>> MatchesExact;
+
+    DescriptorCompressorExposed::FindTwoBestMatchesExact(QueryDescriptors, TrainDescriptors, MatchesExact);
+
+    ASSERT_EQ(MatchesExact.size(), static_cast<uint64>(NumberOfPairs));
+
+    for(const uint64 NumberOfCandidates : {static_cast<uint64>(NumberOfPairs), static_cast<uint64>(2 * NumberOfPairs)})
+    {
+        std::vector<std::vector<cv::DMatch>> Matches;
+
+        Compressor.FindTwoBestMatches(QueryDescriptors, TrainDescriptors, NumberOfCandidates, Matches);
+
+        ASSERT_EQ(Matches.size(), MatchesExact.size());
+
+        for(uint64 i_Query{0U}; i_Query < Matches.size(); i_Query++)
+        {
+            ASSERT_EQ(Matches[i_Query].size(), 2U);
+            ASSERT_EQ(MatchesExact[i_Query].size(), 2U);
+
+            for(uint64 i_Match{0U}; i_Match < 2U; i_Match++)
+            {
+                ASSERT_EQ(Matches[i_Query][i_Match].queryIdx, MatchesExact[i_Query][i_Match].queryIdx);
+                ASSERT_EQ(Matches[i_Query][i_Match].trainIdx, MatchesExact[i_Query][i_Match].trainIdx);
+                ASSERT_FLOAT_EQ(Matches[i_Query][i_Match].distance, MatchesExact[i_Query][i_Match].distance);
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the training with too few descriptors.
+///
+/// Tests whether the training with less than four descriptors or with less
+/// dimensions than the compressed descriptors throws an exception or not. The
+/// expectation is to get an exception and an untrained compressor.
+///////////////////////////////////////////////////////////////////////////////
+TEST_TRAIN_TOOFEWDESCRIPTORS_ISTHROWING(DescriptorCompressor, Test_Train_TooFewDescriptors_IsThrowing)
+{
+    const cv::Mat Descriptors{CreateDescriptorPairs(10, 3U)};
+
+    DescriptorCompressor Compressor(64U);
+    DescriptorCompressor CompressorTooManyDimensions(256U);
+
+    ASSERT_THROW(Compressor.Train(Descriptors.rowRange(0, 3)), std::invalid_argument);
+    ASSERT_THROW(CompressorTooManyDimensions.Train(Descriptors), std::invalid_argument);
+    ASSERT_FALSE(Compressor.IsTrained());
+    ASSERT_FALSE(CompressorTooManyDimensions.IsTrained());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the compression of invalid descriptors.
+///
+/// Tests whether the compression by an untrained compressor, of descriptors
+/// which are no floating point descriptors and of descriptors with another
+/// number of dimensions than the training descriptors throws an exception or
+/// not. The expectation is to get an exception in all cases, and that valid
+/// and empty descriptors are compressed by the trained compressor.
+///////////////////////////////////////////////////////////////////////////////
+TEST_COMPRESS_INVALIDDESCRIPTORS_ISTHROWING(DescriptorCompressor, Test_Compress_InvalidDescriptors_IsThrowing)
+{
+    const cv::Mat Descriptors{CreateDescriptorPairs(10, 3U)};
+
+    DescriptorCompressor Compressor(64U);
+
+    cv::Mat    CompressedDescriptors;
+    ListSInt64 SquaredNorms;
+
+    ASSERT_THROW(Compressor.Compress(Descriptors, CompressedDescriptors, SquaredNorms), std::invalid_argument);
+
+    Compressor.Train(Descriptors);
+
+    const cv::Mat DescriptorsBinary(Descriptors.rows, Descriptors.cols, CV_8U, cv::Scalar(0));
+    const cv::Mat DescriptorsTooFewDimensions{Descriptors.colRange(0, Descriptors.cols - 1)};
+
+    ASSERT_THROW(Compressor.Compress(DescriptorsBinary, CompressedDescriptors, SquaredNorms), std::invalid_argument);
+    ASSERT_THROW(Compressor.Compress(DescriptorsTooFewDimensions, CompressedDescriptors, SquaredNorms), std::invalid_argument);
+
+    ASSERT_NO_THROW(Compressor.Compress(Descriptors, CompressedDescriptors, SquaredNorms));
+    ASSERT_EQ(CompressedDescriptors.rows, Descriptors.rows);
+    ASSERT_EQ(SquaredNorms.size(), static_cast<uint64>(Descriptors.rows));
+
+    ASSERT_NO_THROW(Compressor.Compress(cv::Mat(), CompressedDescriptors, SquaredNorms));
+    ASSERT_TRUE(SquaredNorms.empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the matching of descriptors which are already compressed.
+///
+/// Tests whether the matches of descriptors which are compressed once by the
+/// caller are equal to the matches of the descriptors which are compressed
+/// by the matching or not. The numbers of dimensions use the fixed-length
+/// kernels (64) and the kernel for any length (24). The expectation is to get
+/// identical matches, and an exception if the compressed descriptors do not
+/// belong to the descriptors.
+///////////////////////////////////////////////////////////////////////////////
+TEST_MATCHES_PRECOMPRESSED_ISMATCHINGCOMPRESSED(DescriptorCompressor, Test_Matches_PreCompressed_IsMatchingCompressed)
+{
+    const sint32 NumberOfPairs{100};
+
+    const cv::Mat Descriptors{CreateDescriptorPairs(NumberOfPairs, 5U)};
+    const cv::Mat QueryDescriptors{Descriptors.rowRange(0, NumberOfPairs)};
+    const cv::Mat TrainDescriptors{Descriptors.rowRange(NumberOfPairs, 2 * NumberOfPairs)};
+
+    for(const uint64 NumberOfDimensions : {64U, 24U})
+    {
+        DescriptorCompressor Compressor(NumberOfDimensions);
+
+        Compressor.Train(Descriptors);
+
+        DescriptorCompressor::CompressedDescriptors CompressedQueryDescriptors;
+        DescriptorCompressor::CompressedDescriptors CompressedTrainDescriptors;
+
+        Compressor.Compress(QueryDescriptors, CompressedQueryDescriptors);
+        Compressor.Compress(TrainDescriptors, CompressedTrainDescriptors);
+
+        std::vector<std::vector<cv::DMatch>> MatchesExpected;
+        std::vector<std::vector<cv::DMatch>> Matches;
+
+        Compressor.FindTwoBestMatches(QueryDescriptors, TrainDescriptors, MatchesExpected);
+        Compressor.FindTwoBestMatches(QueryDescriptors, CompressedQueryDescriptors, TrainDescriptors, CompressedTrainDescriptors, Matches);
+
+        ASSERT_EQ(Matches.size(), MatchesExpected.size());
+
+        for(uint64 i_Query{0U}; i_Query < Matches.size(); i_Query++)
+        {
+            ASSERT_EQ(Matches[i_Query].size(), MatchesExpected[i_Query].size());
+
+            for(uint64 i_Match{0U}; i_Match < Matches[i_Query].size(); i_Match++)
+            {
+                ASSERT_EQ(Matches[i_Query][i_Match].trainIdx, MatchesExpected[i_Query][i_Match].trainIdx);
+                ASSERT_FLOAT_EQ(Matches[i_Query][i_Match].distance, MatchesExpected[i_Query][i_Match].distance);
+            }
+        }
+
+        // compressed descriptors of other descriptors
+        ASSERT_THROW(Compressor.FindTwoBestMatches(QueryDescriptors, CompressedTrainDescriptors, TrainDescriptors.rowRange(0, 10), CompressedTrainDescriptors, Matches), std::invalid_argument);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the dot product kernels of fixed length.
+///
+/// Tests whether the dot products of the fixed-length kernels are equal to the
+/// dot products of the kernel for any length or not. The descriptors contain
+/// the extreme values of 8-bit signed integers. The expectation is to get
+/// identical dot products.
+///////////////////////////////////////////////////////////////////////////////
+TEST_DOTPRODUCT_FIXEDLENGTH_ISMATCHINGANYLENGTH(DescriptorCompressor, Test_DotProduct_FixedLength_IsMatchingAnyLength)
+{
+    std::mt19937 RandomNumberEngine(6U);
+
+    std::uniform_int_distribution<sint32> DistributionElements(-127, 127);
+
+    std::vector<sint8> DescriptorA(128U);
+    std::vector<sint8> DescriptorB(128U);
+
+    for(uint64 i_Element{0U}; i_Element < 128U; i_Element++)
+    {
+        DescriptorA[i_Element] = static_cast<sint8>(DistributionElements(RandomNumberEngine));
+        DescriptorB[i_Element] = static_cast<sint8>(DistributionElements(RandomNumberEngine));
+    }
+
+    DescriptorA[0] = -127;
+    DescriptorB[0] = -127;
+    DescriptorA[1] = 127;
+    DescriptorB[1] = -127;
+
+    ASSERT_EQ(DescriptorCompressor::ComputeDotProduct<16U>(DescriptorA.data(), DescriptorB.data()), DescriptorCompressor::ComputeDotProduct(DescriptorA.data(), DescriptorB.data(), 16U));
+    ASSERT_EQ(DescriptorCompressor::ComputeDotProduct<32U>(DescriptorA.data(), DescriptorB.data()), DescriptorCompressor::ComputeDotProduct(DescriptorA.data(), DescriptorB.data(), 32U));
+    ASSERT_EQ(DescriptorCompressor::ComputeDotProduct<64U>(DescriptorA.data(), DescriptorB.data()), DescriptorCompressor::ComputeDotProduct(DescriptorA.data(), DescriptorB.data(), 64U));
+    ASSERT_EQ(DescriptorCompressor::ComputeDotProduct<128U>(DescriptorA.data(), DescriptorB.data()), DescriptorCompressor::ComputeDotProduct(DescriptorA.data(), DescriptorB.data(), 128U));
+}
@@ -0,0 +1,287 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  Test_DescriptorDistance.cpp
+///
+/// \brief Source file containing the unit tests for DescriptorDistance.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#include <algorithm>
+#include <cstring>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "../../../source_code/include/DescriptorDistance.h"
+
+// definition of macros for the unit tests
+#define TEST_KERNELS_RANDOMDESCRIPTORS_ISMATCHINGNORM    TEST ///< Define to get a unique test name.
+#define TEST_GENERIC_UNSUPPORTEDLAYOUT_ISMATCHINGNORM    TEST ///< Define to get a unique test name.
+#define TEST_GENERIC_NONCONTINUOUSDESCRIPTORS_ISSELECTED TEST ///< Define to get a unique test name.
+#define TEST_HAMMING_UNALIGNEDADDRESS_ISMATCHINGNORM     TEST ///< Define to get a unique test name.
+#define TEST_EUCLIDEAN_LARGEMAGNITUDE_ISACCURATE         TEST ///< Define to get a unique test name.
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief     Creates random descriptors.
+///
+/// Binary descriptors are uniformly distributed bytes, floating point
+/// descriptors are uniformly distributed in the value range of SIFT.
+///
+/// \param[in] NumberOfDescriptors Number of descriptors.
+/// \param[in] NumberOfElements    Number of elements of each descriptor.
+/// \param[in] Type                Type of the descriptors (CV_8U or CV_32F).
+/// \param[in] Seed                Seed value of the random number engine.
+///
+/// \return    Descriptors (one descriptor per row).
+///////////////////////////////////////////////////////////////////////////////
+cv::Mat CreateRandomDescriptors(const sint32 NumberOfDescriptors,
+                                const sint32 NumberOfElements,
+                                const sint32 Type,
+                                const uint32 Seed)
+{
+    std::mt19937 RandomNumberEngine(Seed);
+
+    std::uniform_int_distribution<sint32>   DistributionByte(0, 255);
+    std::uniform_real_distribution<float32> DistributionValue(0.0F, 512.0F);
+
+    cv::Mat Descriptors(NumberOfDescriptors, NumberOfElements, Type);
+
+    for(sint32 i_Descriptor{0}; i_Descriptor < NumberOfDescriptors; i_Descriptor++)
+    {
+        for(sint32 i_Element{0}; i_Element < NumberOfElements; i_Element++)
+        {
+            if(Type == CV_8U)
+            {
+                Descriptors.at<uint8>(i_Descriptor, i_Element) = static_cast<uint8>(DistributionByte(RandomNumberEngine));
+            }
+            else
+            {
+                Descriptors.at<float32>(i_Descriptor, i_Element) = DistributionValue(RandomNumberEngine);
+            }
+        }
+    }
+
+    return Descriptors;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief     Checks the distances of all query descriptors against cv::norm().
+///
+/// Both the distances to all train descriptors and to a subset of the train
+/// descriptors are checked. Floating point distances are accumulated in
+/// single precision by the kernels, hence a relative tolerance is used.
+///
+/// \param[in] QueryDescriptors Query descriptors (one descriptor per row).
+/// \param[in] TrainDescriptors Train descriptors (one descriptor per row).
+/// \param[in] Kernel           Kernel used to compute the distances.
+/// \param[in] NormType         Norm used to compare the descriptors.
+///////////////////////////////////////////////////////////////////////////////
+void CheckDistances(const cv::Mat&         QueryDescriptors,
+                    const cv::Mat&         TrainDescriptors,
+                    const DescriptorKernel Kernel,
+                    const sint32           NormType)
+{
+    const uint64 NumberOfQueryDescriptors{static_cast<uint64>(QueryDescriptors.rows)};
+    const uint64 NumberOfTrainDescriptors{static_cast<uint64>(TrainDescriptors.rows)};
+
+    // every third train descriptor in reverse order
+    ListUInt64 TrainIndices;
+
+    for(uint64 i_Train{NumberOfTrainDescriptors}; i_Train > 0U; i_Train -= std::min(i_Train, static_cast<uint64>(3U)))
+    {
+        TrainIndices.push_back(i_Train - 1U);
+    }
+
+    ListFloat64 Distances;
+    ListFloat64 DistancesSubset;
+
+    for(uint64 i_Query{0U}; i_Query < NumberOfQueryDescriptors; i_Query++)
+    {
+        const cv::Mat Query{QueryDescriptors.row(static_cast<sint32>(i_Query))};
+
+        DescriptorDistance::ComputeDistances(QueryDescriptors, i_Query, TrainDescriptors, Kernel, NormType, Distances);
+        DescriptorDistance::ComputeDistances(QueryDescriptors, i_Query, TrainDescriptors, TrainIndices, Kernel, NormType, DistancesSubset);
+
+        ASSERT_EQ(Distances.size(), NumberOfTrainDescriptors);
+        ASSERT_EQ(DistancesSubset.size(), TrainIndices.size());
+
+        for(uint64 i_Train{0U}; i_Train < NumberOfTrainDescriptors; i_Train++)
+        {
+            const float64 DistanceExpected{cv::norm(Query, TrainDescriptors.row(static_cast<sint32>(i_Train)), NormType)};
+
+            ASSERT_NEAR(Distances[i_Train], DistanceExpected, 1e-5 * DistanceExpected);
+        }
+
+        for(uint64 i_Train{0U}; i_Train < TrainIndices.size(); i_Train++)
+        {
+            ASSERT_DOUBLE_EQ(DistancesSubset[i_Train], Distances[TrainIndices[i_Train]]);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the distances of all fixed-width kernels.
+///
+/// Tests whether the kernels are selected for their descriptor layouts and
+/// whether their distances match cv::norm() or not. The expectation is to get
+/// the kernel of each layout and matching distances for random descriptors.
+///////////////////////////////////////////////////////////////////////////////
+TEST_KERNELS_RANDOMDESCRIPTORS_ISMATCHINGNORM(DescriptorDistance, Test_Kernels_RandomDescriptors_IsMatchingNorm)
+{
+    const sint32 NumberOfElements[4]{32, 64, 64, 128};
+    const sint32 Types[4]{CV_8U, CV_8U, CV_32F, CV_32F};
+    const sint32 NormTypes[4]{cv::NORM_HAMMING, cv::NORM_HAMMING, cv::NORM_L2, cv::NORM_L2};
+
+    const DescriptorKernel KernelsExpected[4]{KernelBinary256, KernelBinary512, KernelFloat64, KernelFloat128};
+
+    for(uint64 i_Layout{0U}; i_Layout < 4U; i_Layout++)
+    {
+        const cv::Mat QueryDescriptors{CreateRandomDescriptors(7, NumberOfElements[i_Layout], Types[i_Layout], 1U)};
+        const cv::Mat TrainDescriptors{CreateRandomDescriptors(50, NumberOfElements[i_Layout], Types[i_Layout], 2U)};
+
+        const DescriptorKernel Kernel{DescriptorDistance::SelectKernel(QueryDescriptors, TrainDescriptors, NormTypes[i_Layout])};
+
+        ASSERT_EQ(Kernel, KernelsExpected[i_Layout]);
+
+        CheckDistances(QueryDescriptors, TrainDescriptors, Kernel, NormTypes[i_Layout]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the distances of unsupported descriptor layouts.
+///
+/// Tests whether the generic kernel is selected for descriptor layouts which
+/// are not supported by a fixed-width kernel and whether its distances match
+/// cv::norm() or not. The expectation is to get the generic kernel and
+/// matching distances.
+///////////////////////////////////////////////////////////////////////////////
+TEST_GENERIC_UNSUPPORTEDLAYOUT_ISMATCHINGNORM(DescriptorDistance, Test_Generic_UnsupportedLayout_IsMatchingNorm)
+{
+    // 384-bit binary descriptors, floating point descriptors with another norm and layouts which differ between query and train
+    const cv::Mat QueryBinary384{CreateRandomDescriptors(5, 48, CV_8U, 3U)};
+    const cv::Mat TrainBinary384{CreateRandomDescriptors(20, 48, CV_8U, 4U)};
+    const cv::Mat QueryFloat128{CreateRandomDescriptors(5, 128, CV_32F, 5U)};
+    const cv::Mat TrainFloat128{CreateRandomDescriptors(20, 128, CV_32F, 6U)};
+    const cv::Mat TrainBinary256{CreateRandomDescriptors(20, 32, CV_8U, 7U)};
+
+    ASSERT_EQ(DescriptorDistance::SelectKernel(QueryBinary384, TrainBinary384, cv::NORM_HAMMING), KernelGeneric);
+    ASSERT_EQ(DescriptorDistance::SelectKernel(QueryFloat128, TrainFloat128, cv::NORM_L1), KernelGeneric);
+    ASSERT_EQ(DescriptorDistance::SelectKernel(QueryBinary384, TrainBinary256, cv::NORM_HAMMING), KernelGeneric);
+
+    CheckDistances(QueryBinary384, TrainBinary384, KernelGeneric, cv::NORM_HAMMING);
+    CheckDistances(QueryFloat128, TrainFloat128, KernelGeneric, cv::NORM_L1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the kernel of non-continuous descriptors.
+///
+/// Tests whether the generic kernel is selected for descriptors which are a
+/// region of interest of a larger matrix (i.e. the rows are not continuous)
+/// or not. The expectation is to get the generic kernel and distances which
+/// match cv::norm().
+///////////////////////////////////////////////////////////////////////////////
+TEST_GENERIC_NONCONTINUOUSDESCRIPTORS_ISSELECTED(DescriptorDistance, Test_Generic_NonContinuousDescriptors_IsSelected)
+{
+    const cv::Mat QueryDescriptorsPadded{CreateRandomDescriptors(5, 40, CV_8U, 8U)};
+    const cv::Mat TrainDescriptorsPadded{CreateRandomDescriptors(30, 40, CV_8U, 9U)};
+
+    // 256-bit descriptors starting at an odd column (i.e. unaligned rows)
+    const cv::Mat QueryDescriptors{QueryDescriptorsPadded.colRange(3, 35)};
+    const cv::Mat TrainDescriptors{TrainDescriptorsPadded.colRange(3, 35)};
+
+    ASSERT_FALSE(TrainDescriptors.isContinuous());
+    ASSERT_EQ(DescriptorDistance::SelectKernel(QueryDescriptors, TrainDescriptors, cv::NORM_HAMMING), KernelGeneric);
+    ASSERT_EQ(DescriptorDistance::SelectKernel(QueryDescriptors.clone(), TrainDescriptors.clone(), cv::NORM_HAMMING), KernelBinary256);
+
+    CheckDistances(QueryDescriptors, TrainDescriptors, KernelGeneric, cv::NORM_HAMMING);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the Hamming distances at unaligned addresses.
+///
+/// Tests whether the Hamming distances are correct if the descriptors start
+/// at addresses which are not aligned to 64-bit words or not. The expectation
+/// is to get the distances of cv::norm() for all offsets.
+///////////////////////////////////////////////////////////////////////////////
+TEST_HAMMING_UNALIGNEDADDRESS_ISMATCHINGNORM(DescriptorDistance, Test_Hamming_UnalignedAddress_IsMatchingNorm)
+{
+    const cv::Mat Descriptors{CreateRandomDescriptors(2, 64, CV_8U, 10U)};
+
+    const uint32 DistanceExpected256{static_cast<uint32>(cv::norm(Descriptors.row(0).colRange(0, 32), Descriptors.row(1).colRange(0, 32), cv::NORM_HAMMING))};
+    const uint32 DistanceExpected512{static_cast<uint32>(cv::norm(Descriptors.row(0), Descriptors.row(1), cv::NORM_HAMMING))};
+
+    uint8 Buffer[2U * 64U + 8U];
+
+    for(uint64 i_Offset{0U}; i_Offset < 8U; i_Offset++)
+    {
+        uint8* const DescriptorA{Buffer + i_Offset};
+        uint8* const DescriptorB{Buffer + i_Offset + 64U};
+
+        std::memcpy(DescriptorA, Descriptors.ptr<uint8>(0), 64U);
+        std::memcpy(DescriptorB, Descriptors.ptr<uint8>(1), 64U);
+
+        ASSERT_EQ(DescriptorDistance::ComputeHammingDistance<32U>(DescriptorA, DescriptorB), DistanceExpected256);
+        ASSERT_EQ(DescriptorDistance::ComputeHammingDistance<64U>(DescriptorA, DescriptorB), DistanceExpected512);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the accuracy of the Euclidean distances.
+///
+/// Tests whether the accumulation of the squared differences in single
+/// precision is accurate enough for descriptors with a large magnitude and
+/// for nearly identical descriptors or not. The expectation is to get the
+/// distances of cv::norm() (accumulated in double precision) up to a small
+/// relative error.
+///////////////////////////////////////////////////////////////////////////////
+TEST_EUCLIDEAN_LARGEMAGNITUDE_ISACCURATE(DescriptorDistance, Test_Euclidean_LargeMagnitude_IsAccurate)
+{
+    std::mt19937 RandomNumberEngine(11U);
+
+    std::uniform_real_distribution<float32> DistributionValue(1000.0F, 100000.0F);
+    std::uniform_real_distribution<float32> DistributionNoise(-0.5F, 0.5F);
+
+    // large descriptors and nearly identical copies of them
+    cv::Mat DescriptorsLarge(1, 128, CV_32F);
+    cv::Mat DescriptorsSimilar(1, 128, CV_32F);
+
+    for(sint32 i_Element{0}; i_Element < 128; i_Element++)
+    {
+        DescriptorsLarge.at<float32>(0, i_Element)   = DistributionValue(RandomNumberEngine);
+        DescriptorsSimilar.at<float32>(0, i_Element) = DescriptorsLarge.at<float32>(0, i_Element) + DistributionNoise(RandomNumberEngine);
+    }
+
+    const cv::Mat DescriptorsZero{cv::Mat::zeros(1, 128, CV_32F)};
+
+    const float64 DistanceExpectedLarge128{cv::norm(DescriptorsLarge, DescriptorsZero, cv::NORM_L2)};
+    const float64 DistanceExpectedSimilar128{cv::norm(DescriptorsLarge, DescriptorsSimilar, cv::NORM_L2)};
+    const float64 DistanceExpectedLarge64{cv::norm(DescriptorsLarge.colRange(0, 64), DescriptorsZero.colRange(0, 64), cv::NORM_L2)};
+    const float64 DistanceExpectedSimilar64{cv::norm(DescriptorsLarge.colRange(0, 64), DescriptorsSimilar.colRange(0, 64), cv::NORM_L2)};
+
+    const float32* Large{DescriptorsLarge.ptr<float32>(0)};
+    const float32* Similar{DescriptorsSimilar.ptr<float32>(0)};
+    const float32* Zero{DescriptorsZero.ptr<float32>(0)};
+
+    ASSERT_NEAR(DescriptorDistance::ComputeEuclideanDistance<128U>(Large, Zero), DistanceExpectedLarge128, 1e-5 * DistanceExpectedLarge128);
+    ASSERT_NEAR(DescriptorDistance::ComputeEuclideanDistance<128U>(Large, Similar), DistanceExpectedSimilar128, 1e-5 * DistanceExpectedSimilar128);
+    ASSERT_NEAR(DescriptorDistance::ComputeEuclideanDistance<64U>(Large, Zero), DistanceExpectedLarge64, 1e-5 * DistanceExpectedLarge64);
+    ASSERT_NEAR(DescriptorDistance::ComputeEuclideanDistance<64U>(Large, Similar), DistanceExpectedSimilar64, 1e-5 * DistanceExpectedSimilar64);
+}
@@ -0,0 +1,890 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  Test_FeatureMatcher.cpp
+///
+/// \brief Source file containing the unit tests for FeatureMatcher.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#include <algorithm>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../../../source_code/include/FeatureMatcher.h"
+#include "SyntheticImages.h"
+
+// definition of macros for the unit tests
+#define TEST_FINDCORRESPONDENCESINWINDOW_SINGLECANDIDATE_ISREJECTED TEST ///< Define to get a unique test name.
+#define TEST_FINDCORRESPONDENCESINWINDOW_INVALIDINPUT_ISREJECTED    TEST ///< Define to get a unique test name.
+#define TEST_FINDCORRESPONDENCESSTEREO_SHIFTEDIMAGE_ISMATCHINGSHIFT   TEST ///< Define to get a unique test name.
+#define TEST_FINDCORRESPONDENCESSTEREO_INVALIDSEARCHRANGE_ISTHROWING  TEST ///< Define to get a unique test name.
+#define TEST_EXTRACTFEATURES_FEATURELESSBUCKET_ISLOWERINGTHRESHOLD    TEST ///< Define to get a unique test name.
+#define TEST_EXTRACTFEATURES_FEATUREMASK_ISLIMITINGBUCKETS            TEST ///< Define to get a unique test name.
+#define TEST_EXTRACTFEATURES_ORBDETECTOR_ISORIENTED                   TEST ///< Define to get a unique test name.
+#define TEST_EXTRACTFEATURES_SEPARATESTATES_ISINDEPENDENT             TEST ///< Define to get a unique test name.
+#define TEST_EXTRACTFEATURES_INVALIDTHRESHOLDS_ISTHROWING             TEST ///< Define to get a unique test name.
+#define TEST_FINDCORRESPONDENCES_CONCURRENTCALLS_ISMATCHINGSEQUENTIAL TEST ///< Define to get a unique test name.
+#define TEST_FINDCORRESPONDENCES_ALLOVERLOADS_ISEQUIVALENT            TEST ///< Define to get a unique test name.
+#define TEST_MATCHFEATURES_SIFTDESCRIPTORS_ISUSINGKERNEL              TEST ///< Define to get a unique test name.
+#define TEST_CONSTRUCTOR_KERNELSWITHOUTBRUTEFORCE_ISTHROWING          TEST ///< Define to get a unique test name.
+#define TEST_FINDCORRESPONDENCESINWINDOW_MATCHERNORM_ISUSED           TEST ///< Define to get a unique test name.
+#define TEST_FINDCORRESPONDENCES_STATISTICS_ISCONSISTENT              TEST ///< Define to get a unique test name.
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class CountingBFMatcher
+///
+/// \brief Brute force matcher counting the calls of the matching (shared by
+///        all clones).
+///////////////////////////////////////////////////////////////////////////////
+class CountingBFMatcher : public cv::BFMatcher
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor.
+    ///
+    /// \param[in] NumberOfCalls Counter for the calls of the matching.
+    ///////////////////////////////////////////////////////////////////////////////
+    CountingBFMatcher(const std::shared_ptr<std::atomic<uint64>>& NumberOfCalls) :
+        cv::BFMatcher(cv::NORM_L2),
+        m_NumberOfCalls{NumberOfCalls}
+    {
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Clones the matcher (without the train descriptors).
+    ///
+    /// \return Clone sharing the counter of the matcher.
+    ///////////////////////////////////////////////////////////////////////////////
+    cv::Ptr<cv::DescriptorMatcher> clone(bool) const override
+    {
+        return cv::makePtr<CountingBFMatcher>(m_NumberOfCalls);
+    }
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Counts the call and finds the k best matches.
+    ///
+    /// \param[in]  QueryDescriptors Query descriptors (one descriptor per row).
+    /// \param[out] Matches          Best matches of all query descriptors.
+    /// \param[in]  K                Number of best matches.
+    /// \param[in]  Masks            Masks of the permissible matches.
+    /// \param[in]  CompactResult    Flag whether query descriptors without matches are skipped or not.
+    ///////////////////////////////////////////////////////////////////////////////
+    void knnMatchImpl(cv::InputArray                        QueryDescriptors,
+                      std::vector<std::vector<cv::DMatch>>& Matches,
+                      int                                   K,
+                      cv::InputArrayOfArrays                Masks,
+                      bool                                  CompactResult) override
+    {
+        (*m_NumberOfCalls)++;
+
+        cv::BFMatcher::knnMatchImpl(QueryDescriptors, Matches, K, Masks, CompactResult);
+    }
+
+private:
+    std::shared_ptr<std::atomic<uint64>> m_NumberOfCalls; ///< Counter for the calls of the matching.
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for query features with a single candidate in the window.
+///
+/// Tests whether the match of a query feature with a single candidate is
+/// rejected by the windowed matching or not. The first two query features
+/// have a single candidate each (a similar and a dissimilar one), the third
+/// query feature has two candidates which pass the ratio test. The
+/// expectation is that only the third match is accepted by default and that
+/// all matches are accepted if single candidates are accepted explicitly.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FINDCORRESPONDENCESINWINDOW_SINGLECANDIDATE_ISREJECTED(FeatureMatcher, Test_FindCorrespondencesInWindow_SingleCandidate_IsRejected)
+{
+    // binary descriptors of the query features (all bits cleared, all bits set, all bits cleared)
+    cv::Mat FeatureDescriptorsQuery(3, 32, CV_8U, cv::Scalar(0));
+
+    FeatureDescriptorsQuery.row(1).setTo(cv::Scalar(255));
+
+    // binary descriptors of the target features (one bit set, half of the bits set, all bits cleared, half of the bits set)
+    cv::Mat FeatureDescriptorsTarget(4, 32, CV_8U, cv::Scalar(15));
+
+    FeatureDescriptorsTarget.row(0).setTo(cv::Scalar(0));
+    FeatureDescriptorsTarget.at<uint8>(0, 0) = 1U;
+    FeatureDescriptorsTarget.row(2).setTo(cv::Scalar(0));
+
+    const std::vector<cv::KeyPoint> ExtractedFeaturesTarget{cv::KeyPoint(50.0F, 50.0F, 7.0F), cv::KeyPoint(150.0F, 50.0F, 7.0F), cv::KeyPoint(250.0F, 48.0F, 7.0F), cv::KeyPoint(250.0F, 52.0F, 7.0F)};
+
+    ListColumnVectorFloat64_2d PredictedImagePoints(3U);
+
+    PredictedImagePoints[0] << 51.0, 49.0;
+    PredictedImagePoints[1] << 149.0, 51.0;
+    PredictedImagePoints[2] << 250.0, 50.0;
+
+    const FeatureMatcher Matcher;
+
+    std::vector<cv::DMatch> Matches;
+
+    // single candidates are rejected by default
+    ASSERT_EQ(Matcher.FindCorrespondencesInWindow(FeatureDescriptorsQuery, PredictedImagePoints, ExtractedFeaturesTarget, FeatureDescriptorsTarget, 320U, 100U, 10.0, Matches), 1U);
+    ASSERT_EQ(Matches[0].queryIdx, 2);
+    ASSERT_EQ(Matches[0].trainIdx, 2);
+
+    // single candidates are accepted on request
+    ASSERT_EQ(Matcher.FindCorrespondencesInWindow(FeatureDescriptorsQuery, PredictedImagePoints, ExtractedFeaturesTarget, FeatureDescriptorsTarget, 320U, 100U, 10.0, Matches, true), 3U);
+
+    for(sint32 i_Match{0}; i_Match < 3; i_Match++)
+    {
+        ASSERT_EQ(Matches[static_cast<uint64>(i_Match)].queryIdx, i_Match);
+        ASSERT_EQ(Matches[static_cast<uint64>(i_Match)].trainIdx, i_Match);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for invalid inputs of the windowed matching.
+///
+/// Tests whether the windowed matching rejects a mismatch between the number
+/// of descriptors and the number of predicted image points or target features
+/// or a grid index of other target features and whether it skips query
+/// features without a finite prediction or not. The expectation is to get an
+/// exception for a mismatch, and that only the query feature with a finite
+/// prediction is matched.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FINDCORRESPONDENCESINWINDOW_INVALIDINPUT_ISREJECTED(FeatureMatcher, Test_FindCorrespondencesInWindow_InvalidInput_IsRejected)
+{
+    // binary descriptors of the query and target features (all bits cleared)
+    const cv::Mat FeatureDescriptorsQuery(3, 32, CV_8U, cv::Scalar(0));
+    const cv::Mat FeatureDescriptorsTarget(3, 32, CV_8U, cv::Scalar(0));
+
+    const std::vector<cv::KeyPoint> ExtractedFeaturesTarget{cv::KeyPoint(50.0F, 50.0F, 7.0F), cv::KeyPoint(150.0F, 50.0F, 7.0F), cv::KeyPoint(250.0F, 50.0F, 7.0F)};
+
+    ListColumnVectorFloat64_2d PredictedImagePoints(3U);
+
+    PredictedImagePoints[0] << std::numeric_limits<float64>::quiet_NaN(), 50.0;
+    PredictedImagePoints[1] << 150.0, std::numeric_limits<float64>::infinity();
+    PredictedImagePoints[2] << 250.0, 50.0;
+
+    const FeatureMatcher Matcher;
+
+    std::vector<cv::DMatch> Matches;
+
+    // mismatch between the descriptors and the predicted image points or the target features
+    const ListColumnVectorFloat64_2d PredictedImagePointsShort(PredictedImagePoints.begin(), PredictedImagePoints.begin() + 2);
+    const std::vector<cv::KeyPoint>  ExtractedFeaturesTargetShort(ExtractedFeaturesTarget.begin(), ExtractedFeaturesTarget.begin() + 2);
+
+    ASSERT_THROW(Matcher.FindCorrespondencesInWindow(FeatureDescriptorsQuery, PredictedImagePointsShort, ExtractedFeaturesTarget, FeatureDescriptorsTarget, 320U, 100U, 10.0, Matches, true), std::invalid_argument);
+    ASSERT_THROW(Matcher.FindCorrespondencesInWindow(FeatureDescriptorsQuery, PredictedImagePoints, ExtractedFeaturesTargetShort, FeatureDescriptorsTarget, 320U, 100U, 10.0, Matches, true), std::invalid_argument);
+
+    // grid index containing more target features than passed
+    const cv::Mat                FeatureDescriptorsTargetShort{FeatureDescriptorsTarget.rowRange(0, 2)};
+    const FeatureBucketerByOrder GridIndex{FeatureMatcher::CreateGridIndex(ExtractedFeaturesTarget, 320U, 100U, 10.0)};
+
+    ASSERT_THROW(Matcher.FindCorrespondencesInWindow(FeatureDescriptorsQuery, PredictedImagePoints, ExtractedFeaturesTargetShort, FeatureDescriptorsTargetShort, GridIndex, 10.0, Matches, true), std::invalid_argument);
+
+    // query features without a finite prediction are skipped
+    ASSERT_EQ(Matcher.FindCorrespondencesInWindow(FeatureDescriptorsQuery, PredictedImagePoints, ExtractedFeaturesTarget, FeatureDescriptorsTarget, 320U, 100U, 10.0, Matches, true), 1U);
+    ASSERT_EQ(Matches[0].queryIdx, 2);
+    ASSERT_EQ(Matches[0].trainIdx, 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief     Counts the stereo correspondences with the expected disparity.
+///
+/// Checks that all stereo correspondences are inside the row band and inside
+/// the disparity range.
+///
+/// \param[in] FeatureCorrespondencesStereoLeft  Image coordinates of the feature correspondences in the left image.
+/// \param[in] FeatureCorrespondencesStereoRight Image coordinates of the feature correspondences in the right image.
+/// \param[in] MaximumRowDistance                Maximum distance between the rows of corresponding features (in pixels).
+/// \param[in] MaximumDisparity                  Maximum disparity of corresponding features (in pixels).
+/// \param[in] DisparityExpected                 Expected disparity of the correspondences (in pixels).
+///
+/// \return    Number of correspondences with the expected disparity.
+///////////////////////////////////////////////////////////////////////////////
+uint64 CountStereoCorrespondences(const ListColumnVectorFloat64_2d& FeatureCorrespondencesStereoLeft,
+                                  const ListColumnVectorFloat64_2d& FeatureCorrespondencesStereoRight,
+                                  const float64                     MaximumRowDistance,
+                                  const float64                     MaximumDisparity,
+                                  const float64                     DisparityExpected)
+{
+    uint64 NumberOfCorrespondencesExpected{0U};
+
+    for(uint64 i_Correspondence{0U}; i_Correspondence < FeatureCorrespondencesStereoLeft.size(); i_Correspondence++)
+    {
+        const ColumnVectorFloat64_2d& ImagePointStereoLeft{FeatureCorrespondencesStereoLeft[i_Correspondence]};
+        const ColumnVectorFloat64_2d& ImagePointStereoRight{FeatureCorrespondencesStereoRight[i_Correspondence]};
+
+        const float64 Disparity{ImagePointStereoLeft(0) - ImagePointStereoRight(0)};
+
+        EXPECT_LE(std::abs(ImagePointStereoLeft(1) - ImagePointStereoRight(1)), MaximumRowDistance);
+        EXPECT_GE(Disparity, 0.0);
+        EXPECT_LE(Disparity, MaximumDisparity);
+
+        if(std::abs(Disparity - DisparityExpected) < 0.5)
+        {
+            NumberOfCorrespondencesExpected++;
+        }
+    }
+
+    return NumberOfCorrespondencesExpected;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the stereo matching of a horizontally shifted image.
+///
+/// Tests whether the stereo matching of a rectified image pair recovers the
+/// shift between the images or not. The right image is shifted by 12 pixels
+/// w.r.t. the left image and a single-level ORB detector is used, so correct
+/// correspondences have a disparity of exactly 12 pixels. The expectation is
+/// that almost all correspondences have this disparity and that no
+/// correspondence is outside the search range, also if the true disparity is
+/// outside the disparity range.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FINDCORRESPONDENCESSTEREO_SHIFTEDIMAGE_ISMATCHINGSHIFT(FeatureMatcher, Test_FindCorrespondencesStereo_ShiftedImage_IsMatchingShift)
+{
+    const cv::Mat Canvas{CreateRectangleImage(400, 300, 7U)};
+    const cv::Mat ImageStereoLeft{Canvas(cv::Rect(52, 20, 320, 240)).clone()};
+    const cv::Mat ImageStereoRight{Canvas(cv::Rect(64, 20, 320, 240)).clone()};
+
+    const FeatureMatcher Matcher(cv::ORB::create(500, 1.2F, 1), cv::BFMatcher::create(cv::NORM_HAMMING));
+
+    ListColumnVectorFloat64_2d FeatureCorrespondencesStereoLeft;
+    ListColumnVectorFloat64_2d FeatureCorrespondencesStereoRight;
+
+    // true disparity inside the disparity range
+    const uint64 NumberOfCorrespondences{Matcher.FindCorrespondencesStereo(ImageStereoLeft, ImageStereoRight, FeatureCorrespondencesStereoLeft, FeatureCorrespondencesStereoRight, 2.0, 64.0)};
+
+    ASSERT_GT(NumberOfCorrespondences, 20U);
+    ASSERT_EQ(FeatureCorrespondencesStereoLeft.size(), NumberOfCorrespondences);
+    ASSERT_EQ(FeatureCorrespondencesStereoRight.size(), NumberOfCorrespondences);
+
+    const uint64 NumberOfCorrespondencesExpected{CountStereoCorrespondences(FeatureCorrespondencesStereoLeft, FeatureCorrespondencesStereoRight, 2.0, 64.0, 12.0)};
+
+    ASSERT_GE(10U * NumberOfCorrespondencesExpected, 9U * NumberOfCorrespondences);
+
+    // true disparity outside the disparity range
+    Matcher.FindCorrespondencesStereo(ImageStereoLeft, ImageStereoRight, FeatureCorrespondencesStereoLeft, FeatureCorrespondencesStereoRight, 2.0, 8.0);
+
+    ASSERT_EQ(CountStereoCorrespondences(FeatureCorrespondencesStereoLeft, FeatureCorrespondencesStereoRight, 2.0, 8.0, 12.0), 0U);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for an invalid search range of the stereo matching.
+///
+/// Tests whether the stereo matching throws an exception if the maximum row
+/// distance or the maximum disparity is negative or not a number or not. The
+/// expectation is to get an exception for invalid values and no exception for
+/// a search range of zero.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FINDCORRESPONDENCESSTEREO_INVALIDSEARCHRANGE_ISTHROWING(FeatureMatcher, Test_FindCorrespondencesStereo_InvalidSearchRange_IsThrowing)
+{
+    const cv::Mat Image{CreateRectangleImage(320, 240, 3U)};
+
+    const FeatureMatcher Matcher;
+
+    ListColumnVectorFloat64_2d FeatureCorrespondencesStereoLeft;
+    ListColumnVectorFloat64_2d FeatureCorrespondencesStereoRight;
+
+    const float64 NotANumber{std::numeric_limits<float64>::quiet_NaN()};
+
+    ASSERT_THROW(Matcher.FindCorrespondencesStereo(Image, Image, FeatureCorrespondencesStereoLeft, FeatureCorrespondencesStereoRight, -1.0, 64.0), std::invalid_argument);
+    ASSERT_THROW(Matcher.FindCorrespondencesStereo(Image, Image, FeatureCorrespondencesStereoLeft, FeatureCorrespondencesStereoRight, NotANumber, 64.0), std::invalid_argument);
+    ASSERT_THROW(Matcher.FindCorrespondencesStereo(Image, Image, FeatureCorrespondencesStereoLeft, FeatureCorrespondencesStereoRight, 2.0, -1.0), std::invalid_argument);
+    ASSERT_THROW(Matcher.FindCorrespondencesStereo(Image, Image, FeatureCorrespondencesStereoLeft, FeatureCorrespondencesStereoRight, 2.0, NotANumber), std::invalid_argument);
+    ASSERT_NO_THROW(Matcher.FindCorrespondencesStereo(Image, Image, FeatureCorrespondencesStereoLeft, FeatureCorrespondencesStereoRight, 0.0, 0.0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the adaptation of the threshold of a featureless bucket.
+///
+/// Tests whether the FAST threshold of a bucket without any features is
+/// lowered from image to image or not. The left bucket of the image is
+/// featureless, the right bucket contains many features. The expectation is
+/// that the threshold of the left bucket is lowered by a quarter of its value
+/// until the minimum threshold is reached and that the threshold of the right
+/// bucket is not lowered.
+///////////////////////////////////////////////////////////////////////////////
+TEST_EXTRACTFEATURES_FEATURELESSBUCKET_ISLOWERINGTHRESHOLD(FeatureMatcher, Test_ExtractFeatures_FeaturelessBucket_IsLoweringThreshold)
+{
+    cv::Mat Image{CreateRectangleImage(480, 240, 5U)};
+
+    // the featureless region reaches into the second bucket, so no features are detected at its border
+    Image(cv::Rect(0, 0, 240, 240)).setTo(cv::Scalar(128));
+
+    const FeatureBucketerByOrder Bucketer(480U, 240U, 3U, 1U, 20U);
+
+    const std::vector<uint8> ThresholdsExpected{15U, 12U, 9U, 7U, 6U, 5U, 5U};
+
+    const FeatureMatcher Matcher;
+
+    FeatureMatcher::BucketedDetectionState State;
+    std::vector<cv::KeyPoint>              ExtractedFeatures;
+    cv::Mat                                FeatureDescriptors;
+
+    for(const uint8 ThresholdExpected : ThresholdsExpected)
+    {
+        Matcher.ExtractFeatures(Image, Bucketer, State, ExtractedFeatures, FeatureDescriptors, 20U, 5U);
+
+        ASSERT_EQ(State.BucketThresholds.size(), 3U);
+        ASSERT_EQ(State.BucketThresholds[0], ThresholdExpected);
+        ASSERT_GE(State.BucketThresholds[2], 20U);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the number of features in each bucket.
+///
+/// Tests whether the number of features extracted in each bucket is limited
+/// by the feature mask or not. The image contains many features in all
+/// buckets. The expectation is to get exactly the number of features defined
+/// by the feature mask in each bucket.
+///////////////////////////////////////////////////////////////////////////////
+TEST_EXTRACTFEATURES_FEATUREMASK_ISLIMITINGBUCKETS(FeatureMatcher, Test_ExtractFeatures_FeatureMask_IsLimitingBuckets)
+{
+    const cv::Mat Image{CreateRectangleImage(480, 240, 6U)};
+
+    MatrixUInt8 FeatureMask(2, 3);
+
+    FeatureMask << 5U, 0U, 10U,
+        1U, 20U, 3U;
+
+    const FeatureBucketerByOrder Bucketer(480U, 240U, FeatureMask);
+
+    const FeatureMatcher Matcher;
+
+    FeatureMatcher::BucketedDetectionState State;
+    std::vector<cv::KeyPoint>              ExtractedFeatures;
+    cv::Mat                                FeatureDescriptors;
+
+    Matcher.ExtractFeatures(Image, Bucketer, State, ExtractedFeatures, FeatureDescriptors);
+
+    ASSERT_EQ(static_cast<uint64>(FeatureDescriptors.rows), ExtractedFeatures.size());
+
+    ListUInt64 NumberOfFeaturesInBuckets(6U, 0U);
+
+    for(const cv::KeyPoint& ExtractedFeature : ExtractedFeatures)
+    {
+        uint16 BucketID{0U};
+
+        ASSERT_TRUE(Bucketer.ComputeBucketID(static_cast<float64>(ExtractedFeature.pt.x), static_cast<float64>(ExtractedFeature.pt.y), BucketID));
+
+        NumberOfFeaturesInBuckets[BucketID]++;
+    }
+
+    for(sint64 i_Bucket{0}; i_Bucket < FeatureMask.size(); i_Bucket++)
+    {
+        ASSERT_EQ(NumberOfFeaturesInBuckets[static_cast<uint64>(i_Bucket)], static_cast<uint64>(FeatureMask(i_Bucket / 3, i_Bucket % 3)));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the orientations of bucketed ORB features.
+///
+/// Tests whether the bucketed extraction with an ORB detector orients its
+/// features like ORB does or not. The features detected by ORB at full
+/// resolution serve as reference. The expectation is that all features are
+/// oriented and that the orientations of at least 90% of the features at the
+/// same position differ by less than 10 degrees.
+///////////////////////////////////////////////////////////////////////////////
+TEST_EXTRACTFEATURES_ORBDETECTOR_ISORIENTED(FeatureMatcher, Test_ExtractFeatures_ORBDetector_IsOriented)
+{
+    const cv::Mat Image{CreateRectangleImage(480, 240, 7U)};
+
+    MatrixUInt8 FeatureMask(2, 3);
+
+    FeatureMask.setConstant(20U);
+
+    const FeatureBucketerByOrder Bucketer(480U, 240U, FeatureMask);
+
+    const FeatureMatcher Matcher;
+
+    FeatureMatcher::BucketedDetectionState State;
+    std::vector<cv::KeyPoint>              ExtractedFeatures;
+    cv::Mat                                FeatureDescriptors;
+
+    Matcher.ExtractFeatures(Image, Bucketer, State, ExtractedFeatures, FeatureDescriptors);
+
+    ASSERT_FALSE(ExtractedFeatures.empty());
+
+    // reference features of ORB (full resolution only)
+    std::vector<cv::KeyPoint> ReferenceFeatures;
+
+    cv::ORB::create(5000, 1.2F, 1)->detect(Image, ReferenceFeatures);
+
+    uint64 NumberOfComparedFeatures{0U};
+    uint64 NumberOfMatchingOrientations{0U};
+
+    for(const cv::KeyPoint& ExtractedFeature : ExtractedFeatures)
+    {
+        ASSERT_GE(ExtractedFeature.angle, 0.0F);
+        ASSERT_LT(ExtractedFeature.angle, 360.0F);
+
+        for(const cv::KeyPoint& ReferenceFeature : ReferenceFeatures)
+        {
+            if(cv::norm(ExtractedFeature.pt - ReferenceFeature.pt) < 0.5)
+            {
+                const float64 AngleDifference{std::abs(static_cast<float64>(ExtractedFeature.angle - ReferenceFeature.angle))};
+
+                if(std::min(AngleDifference, 360.0 - AngleDifference) < 10.0)
+                {
+                    NumberOfMatchingOrientations++;
+                }
+
+                NumberOfComparedFeatures++;
+                break;
+            }
+        }
+    }
+
+    ASSERT_GE(2U * NumberOfComparedFeatures, ExtractedFeatures.size());
+    ASSERT_GE(10U * NumberOfMatchingOrientations, 9U * NumberOfComparedFeatures);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the states of separate image streams.
+///
+/// Tests whether the FAST thresholds of an image stream are independent of
+/// the images of other streams and whether a changed initial threshold resets
+/// the thresholds or not. The first stream only sees a featureless image, the
+/// second stream only sees an image with many features. The expectation is
+/// that only the thresholds of the first stream are lowered, and that the
+/// thresholds of the first stream restart at the new initial threshold.
+///////////////////////////////////////////////////////////////////////////////
+TEST_EXTRACTFEATURES_SEPARATESTATES_ISINDEPENDENT(FeatureMatcher, Test_ExtractFeatures_SeparateStates_IsIndependent)
+{
+    const cv::Mat ImageFeatureless(240, 480, CV_8UC1, cv::Scalar(128));
+    const cv::Mat ImageTextured{CreateRectangleImage(480, 240, 5U)};
+
+    const FeatureBucketerByOrder Bucketer(480U, 240U, 3U, 1U, 20U);
+
+    const FeatureMatcher Matcher;
+
+    FeatureMatcher::BucketedDetectionState StateFeatureless;
+    FeatureMatcher::BucketedDetectionState StateTextured;
+    std::vector<cv::KeyPoint>              ExtractedFeatures;
+    cv::Mat                                FeatureDescriptors;
+
+    // alternate between both streams
+    for(uint64 i_Image{0U}; i_Image < 3U; i_Image++)
+    {
+        Matcher.ExtractFeatures(ImageFeatureless, Bucketer, StateFeatureless, ExtractedFeatures, FeatureDescriptors, 20U, 5U);
+        Matcher.ExtractFeatures(ImageTextured, Bucketer, StateTextured, ExtractedFeatures, FeatureDescriptors, 20U, 5U);
+    }
+
+    ASSERT_EQ(StateFeatureless.BucketThresholds, std::vector<uint8>(3U, 9U));
+    ASSERT_GE(*std::min_element(StateTextured.BucketThresholds.begin(), StateTextured.BucketThresholds.end()), 20U);
+
+    // a changed initial threshold restarts the adaptation
+    Matcher.ExtractFeatures(ImageFeatureless, Bucketer, StateFeatureless, ExtractedFeatures, FeatureDescriptors, 40U, 5U);
+
+    ASSERT_EQ(StateFeatureless.InitialThreshold, 40U);
+    ASSERT_EQ(StateFeatureless.BucketThresholds, std::vector<uint8>(3U, 30U));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for invalid thresholds of the bucketed extraction.
+///
+/// Tests whether the bucketed extraction rejects a minimum threshold which is
+/// larger than the initial threshold or not. The expectation is to get an
+/// exception for such thresholds and no exception for equal thresholds.
+///////////////////////////////////////////////////////////////////////////////
+TEST_EXTRACTFEATURES_INVALIDTHRESHOLDS_ISTHROWING(FeatureMatcher, Test_ExtractFeatures_InvalidThresholds_IsThrowing)
+{
+    const cv::Mat Image{CreateRectangleImage(480, 240, 5U)};
+
+    const FeatureBucketerByOrder Bucketer(480U, 240U, 3U, 1U, 20U);
+
+    const FeatureMatcher Matcher;
+
+    FeatureMatcher::BucketedDetectionState State;
+    std::vector<cv::KeyPoint>              ExtractedFeatures;
+    cv::Mat                                FeatureDescriptors;
+
+    ASSERT_THROW(Matcher.ExtractFeatures(Image, Bucketer, State, ExtractedFeatures, FeatureDescriptors, 10U, 11U), std::invalid_argument);
+    ASSERT_NO_THROW(Matcher.ExtractFeatures(Image, Bucketer, State, ExtractedFeatures, FeatureDescriptors, 10U, 10U));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief     Checks the correspondences of concurrent calls against the
+///            correspondences of sequential calls.
+///
+/// Each thread processes all image sets (starting with a different one) using
+/// the same matcher.
+///
+/// \param[in] Matcher         Feature matcher which is shared by all threads.
+/// \param[in] ImageSets       List containing the image sets.
+/// \param[in] NumberOfThreads Number of threads calling the matcher concurrently.
+///////////////////////////////////////////////////////////////////////////////
+void CheckConcurrentCorrespondences(const FeatureMatcher&                    Matcher,
+                                    const std::vector<std::vector<cv::Mat>>& ImageSets,
+                                    const uint64                             NumberOfThreads)
+{
+    const uint64 NumberOfImageSets{ImageSets.size()};
+
+    // find correspondences sequentially
+    std::vector<std::vector<ListColumnVectorFloat64_2d>> FeatureCorrespondencesSequential(NumberOfImageSets);
+
+    for(uint64 i_ImageSet{0U}; i_ImageSet < NumberOfImageSets; i_ImageSet++)
+    {
+        ASSERT_GT(Matcher.FindCorrespondences(ImageSets[i_ImageSet], FeatureCorrespondencesSequential[i_ImageSet]), 10U);
+    }
+
+    // find correspondences concurrently
+    std::vector<std::vector<std::vector<ListColumnVectorFloat64_2d>>> FeatureCorrespondencesConcurrent(NumberOfThreads, std::vector<std::vector<ListColumnVectorFloat64_2d>>(NumberOfImageSets));
+
+    std::vector<std::thread> Threads;
+
+    for(uint64 i_Thread{0U}; i_Thread < NumberOfThreads; i_Thread++)
+    {
+        Threads.emplace_back([&, i_Thread]()
+                             {
+                                 for(uint64 i_ImageSet{0U}; i_ImageSet < NumberOfImageSets; i_ImageSet++)
+                                 {
+                                     const uint64 ImageSetIndex{(i_ImageSet + i_Thread) % NumberOfImageSets};
+
+                                     Matcher.FindCorrespondences(ImageSets[ImageSetIndex], FeatureCorrespondencesConcurrent[i_Thread][ImageSetIndex]);
+                                 }
+                             });
+    }
+
+    for(std::thread& Thread : Threads)
+    {
+        Thread.join();
+    }
+
+    for(uint64 i_Thread{0U}; i_Thread < NumberOfThreads; i_Thread++)
+    {
+        for(uint64 i_ImageSet{0U}; i_ImageSet < NumberOfImageSets; i_ImageSet++)
+        {
+            const std::vector<ListColumnVectorFloat64_2d>& FeatureCorrespondences{FeatureCorrespondencesConcurrent[i_Thread][i_ImageSet]};
+
+            ASSERT_EQ(FeatureCorrespondences.size(), FeatureCorrespondencesSequential[i_ImageSet].size());
+
+            for(uint64 i_Image{0U}; i_Image < FeatureCorrespondences.size(); i_Image++)
+            {
+                ASSERT_TRUE(FeatureCorrespondences[i_Image] == FeatureCorrespondencesSequential[i_ImageSet][i_Image]);
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for concurrent calls of a single matcher.
+///
+/// Tests whether concurrent calls of FindCorrespondences on the same matcher
+/// yield the same correspondences as sequential calls or not. The matcher
+/// either creates a detector for each set of resources or shares a single
+/// detector. The expectation is to get identical correspondences in both
+/// cases.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FINDCORRESPONDENCES_CONCURRENTCALLS_ISMATCHINGSEQUENTIAL(FeatureMatcher, Test_FindCorrespondences_ConcurrentCalls_IsMatchingSequential)
+{
+    const cv::Mat Canvas{CreateRectangleImage(480, 360, 8U)};
+
+    // image sets of three shifted images each
+    std::vector<std::vector<cv::Mat>> ImageSets(4U);
+
+    for(sint32 i_ImageSet{0}; i_ImageSet < 4; i_ImageSet++)
+    {
+        for(sint32 i_Image{0}; i_Image < 3; i_Image++)
+        {
+            ImageSets[static_cast<uint64>(i_ImageSet)].push_back(Canvas(cv::Rect(40 + 10 * i_ImageSet + 3 * i_Image, 40 + 2 * i_Image, 320, 240)).clone());
+        }
+    }
+
+    // detector created for each set of resources
+    const FeatureMatcher MatcherFactory;
+
+    CheckConcurrentCorrespondences(MatcherFactory, ImageSets, 4U);
+
+    // detector shared by all threads
+    const FeatureMatcher MatcherShared(cv::ORB::create(), cv::BFMatcher::create(cv::NORM_HAMMING));
+
+    CheckConcurrentCorrespondences(MatcherShared, ImageSets, 4U);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the equivalence of the outputs of FindCorrespondences.
+///
+/// Tests whether the overloads of FindCorrespondences with the list of image
+/// coordinates, with single precision matrices and with double precision
+/// matrices find the same feature correspondences on the same images or not.
+/// The expectation is to get identical image coordinates (up to the
+/// precision of the output) and identical feature indices, and that the
+/// feature indices refer to the features extracted in the images.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FINDCORRESPONDENCES_ALLOVERLOADS_ISEQUIVALENT(FeatureMatcher, Test_FindCorrespondences_AllOverloads_IsEquivalent)
+{
+    const cv::Mat Canvas{CreateRectangleImage(480, 360, 9U)};
+
+    const std::vector<cv::Mat> Images{Canvas(cv::Rect(40, 40, 320, 240)).clone(), Canvas(cv::Rect(44, 42, 320, 240)).clone(), Canvas(cv::Rect(48, 44, 320, 240)).clone()};
+
+    const FeatureMatcher Matcher;
+
+    std::vector<ListColumnVectorFloat64_2d> FeatureCorrespondencesList;
+    ListMatrixFloat32_2xX                   FeatureCorrespondencesFloat32;
+    ListMatrixFloat64_2xX                   FeatureCorrespondencesFloat64;
+    MatrixUInt64                            FeatureIndicesFloat32;
+    MatrixUInt64                            FeatureIndicesFloat64;
+
+    const uint64 NumberOfCorrespondences{Matcher.FindCorrespondences(Images, FeatureCorrespondencesList)};
+
+    ASSERT_GT(NumberOfCorrespondences, 20U);
+    ASSERT_EQ(Matcher.FindCorrespondences(Images, FeatureCorrespondencesFloat32, FeatureIndicesFloat32), NumberOfCorrespondences);
+    ASSERT_EQ(Matcher.FindCorrespondences(Images, FeatureCorrespondencesFloat64, FeatureIndicesFloat64), NumberOfCorrespondences);
+
+    ASSERT_EQ(FeatureCorrespondencesList.size(), Images.size());
+    ASSERT_EQ(FeatureCorrespondencesFloat32.size(), Images.size());
+    ASSERT_EQ(FeatureCorrespondencesFloat64.size(), Images.size());
+    ASSERT_EQ(static_cast<uint64>(FeatureIndicesFloat32.rows()), Images.size());
+    ASSERT_EQ(static_cast<uint64>(FeatureIndicesFloat32.cols()), NumberOfCorrespondences);
+    ASSERT_TRUE(FeatureIndicesFloat32 == FeatureIndicesFloat64);
+
+    for(uint64 i_Image{0U}; i_Image < Images.size(); i_Image++)
+    {
+        std::vector<cv::KeyPoint> ExtractedFeatures;
+        cv::Mat                   FeatureDescriptors;
+
+        Matcher.ExtractFeatures(Images[i_Image], ExtractedFeatures, FeatureDescriptors);
+
+        ASSERT_EQ(FeatureCorrespondencesList[i_Image].size(), NumberOfCorrespondences);
+        ASSERT_EQ(static_cast<uint64>(FeatureCorrespondencesFloat32[i_Image].cols()), NumberOfCorrespondences);
+        ASSERT_EQ(static_cast<uint64>(FeatureCorrespondencesFloat64[i_Image].cols()), NumberOfCorrespondences);
+
+        for(uint64 i_Correspondence{0U}; i_Correspondence < NumberOfCorrespondences; i_Correspondence++)
+        {
+            const sint64                  Column{static_cast<sint64>(i_Correspondence)};
+            const ColumnVectorFloat64_2d& ImagePoint{FeatureCorrespondencesList[i_Image][i_Correspondence]};
+
+            ASSERT_EQ(FeatureCorrespondencesFloat64[i_Image](0, Column), ImagePoint(0));
+            ASSERT_EQ(FeatureCorrespondencesFloat64[i_Image](1, Column), ImagePoint(1));
+            ASSERT_EQ(FeatureCorrespondencesFloat32[i_Image](0, Column), static_cast<float32>(ImagePoint(0)));
+            ASSERT_EQ(FeatureCorrespondencesFloat32[i_Image](1, Column), static_cast<float32>(ImagePoint(1)));
+
+            // the feature index refers to the feature at the image coordinates
+            const uint64 FeatureIndex{FeatureIndicesFloat64(static_cast<sint64>(i_Image), Column)};
+
+            ASSERT_LT(FeatureIndex, ExtractedFeatures.size());
+            ASSERT_EQ(static_cast<float64>(ExtractedFeatures[FeatureIndex].pt.x), ImagePoint(0));
+            ASSERT_EQ(static_cast<float64>(ExtractedFeatures[FeatureIndex].pt.y), ImagePoint(1));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the matching of SIFT descriptors.
+///
+/// Tests whether 128-dimensional floating point descriptors (e.g. SIFT) are
+/// matched by the distance kernel if requested or not. The descriptors of the
+/// second image are a permutation of the descriptors of the first image with
+/// small noise, the horizontal image coordinate of each feature encodes its
+/// identity. The expectation is to find all correspondences with and without
+/// the kernels, and that the brute force matcher is only called if the kernels
+/// are disabled.
+///////////////////////////////////////////////////////////////////////////////
+TEST_MATCHFEATURES_SIFTDESCRIPTORS_ISUSINGKERNEL(FeatureMatcher, Test_MatchFeatures_SIFTDescriptors_IsUsingKernel)
+{
+    const sint32 NumberOfFeatures{60};
+    const sint32 NumberOfElements{128};
+
+    std::mt19937 RandomNumberEngine(5U);
+
+    std::uniform_real_distribution<float32> DistributionValue(0.0F, 512.0F);
+    std::uniform_real_distribution<float32> DistributionNoise(-2.0F, 2.0F);
+
+    ListUInt64 Permutation(static_cast<uint64>(NumberOfFeatures));
+
+    std::iota(Permutation.begin(), Permutation.end(), 0U);
+    std::shuffle(Permutation.begin(), Permutation.end(), RandomNumberEngine);
+
+    std::vector<std::vector<cv::KeyPoint>> ExtractedFeatures(2U);
+    std::vector<cv::Mat>                   FeatureDescriptors{cv::Mat(NumberOfFeatures, NumberOfElements, CV_32F), cv::Mat(NumberOfFeatures, NumberOfElements, CV_32F)};
+
+    for(sint32 i_Feature{0}; i_Feature < NumberOfFeatures; i_Feature++)
+    {
+        for(sint32 i_Element{0}; i_Element < NumberOfElements; i_Element++)
+        {
+            FeatureDescriptors[0].at<float32>(i_Feature, i_Element) = DistributionValue(RandomNumberEngine);
+        }
+
+        ExtractedFeatures[0].emplace_back(static_cast<float32>(i_Feature), 10.0F, 7.0F);
+    }
+
+    for(sint32 i_Feature{0}; i_Feature < NumberOfFeatures; i_Feature++)
+    {
+        const sint32 FeatureIndex{static_cast<sint32>(Permutation[static_cast<uint64>(i_Feature)])};
+
+        for(sint32 i_Element{0}; i_Element < NumberOfElements; i_Element++)
+        {
+            FeatureDescriptors[1].at<float32>(i_Feature, i_Element) = FeatureDescriptors[0].at<float32>(FeatureIndex, i_Element) + DistributionNoise(RandomNumberEngine);
+        }
+
+        ExtractedFeatures[1].emplace_back(static_cast<float32>(FeatureIndex), 20.0F, 7.0F);
+    }
+
+    // match with and without the kernels
+    for(uint64 i_Configuration{0U}; i_Configuration < 2U; i_Configuration++)
+    {
+        const boolean UseKernels{i_Configuration == 0U};
+
+        const std::shared_ptr<std::atomic<uint64>> NumberOfCalls{std::make_shared<std::atomic<uint64>>(0U)};
+
+        const FeatureMatcher Matcher(cv::SIFT::create(), cv::makePtr<CountingBFMatcher>(NumberOfCalls), 0.7, nullptr, UseKernels);
+
+        std::vector<ListColumnVectorFloat64_2d> FeatureCorrespondences;
+
+        ASSERT_EQ(Matcher.MatchFeatures(ExtractedFeatures, FeatureDescriptors, FeatureCorrespondences), static_cast<uint64>(NumberOfFeatures));
+
+        for(uint64 i_Correspondence{0U}; i_Correspondence < FeatureCorrespondences[0].size(); i_Correspondence++)
+        {
+            ASSERT_EQ(FeatureCorrespondences[0][i_Correspondence](0), FeatureCorrespondences[1][i_Correspondence](0));
+        }
+
+        if(UseKernels)
+        {
+            ASSERT_EQ(NumberOfCalls->load(), 0U);
+        }
+        else
+        {
+            ASSERT_GT(NumberOfCalls->load(), 0U);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the distance kernels without a brute force matcher.
+///
+/// Tests whether the request of the distance kernels for a descriptor matcher
+/// which is not a brute force matcher is rejected or not. The expectation is
+/// that the constructors throw an exception, and that the descriptor matcher
+/// is accepted if the kernels are not requested.
+///////////////////////////////////////////////////////////////////////////////
+TEST_CONSTRUCTOR_KERNELSWITHOUTBRUTEFORCE_ISTHROWING(FeatureMatcher, Test_Constructor_KernelsWithoutBruteForce_IsThrowing)
+{
+    const FeatureMatcher::FeatureDetectorFactory DetectorFactory{[]() -> cv::Ptr<cv::Feature2D> { return cv::SIFT::create(); }};
+
+    ASSERT_THROW(FeatureMatcher(cv::SIFT::create(), cv::FlannBasedMatcher::create(), 0.7, nullptr, true), std::invalid_argument);
+    ASSERT_THROW(FeatureMatcher(DetectorFactory, cv::FlannBasedMatcher::create(), 0.7, nullptr, true), std::invalid_argument);
+
+    ASSERT_NO_THROW(FeatureMatcher(cv::SIFT::create(), cv::FlannBasedMatcher::create(), 0.7, nullptr, false));
+    ASSERT_NO_THROW(FeatureMatcher(cv::SIFT::create(), cv::BFMatcher::create(cv::NORM_L2), 0.7, nullptr, true));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the norm used by the windowed matching.
+///
+/// Tests whether the windowed matching compares the descriptors by the norm of
+/// the brute force matcher instead of the default norm of the detector or not.
+/// The query descriptor is closer to the first target descriptor with respect
+/// to the L1 norm and closer to the second one with respect to the L2 norm.
+/// The expectation is that the first target feature is matched at its L1
+/// distance, with and without the distance kernels.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FINDCORRESPONDENCESINWINDOW_MATCHERNORM_ISUSED(FeatureMatcher, Test_FindCorrespondencesInWindow_MatcherNorm_IsUsed)
+{
+    // floating point descriptors (query at the origin, first target with a single large element, second target with all elements set)
+    const cv::Mat FeatureDescriptorsQuery(1, 64, CV_32F, cv::Scalar(0.0F));
+    cv::Mat       FeatureDescriptorsTarget(2, 64, CV_32F, cv::Scalar(0.0F));
+
+    FeatureDescriptorsTarget.at<float32>(0, 0) = 10.0F;
+    FeatureDescriptorsTarget.row(1).setTo(cv::Scalar(1.0F));
+
+    const float64 DistanceExpected{cv::norm(FeatureDescriptorsQuery, FeatureDescriptorsTarget.row(0), cv::NORM_L1)};
+
+    const std::vector<cv::KeyPoint> ExtractedFeaturesTarget{cv::KeyPoint(50.0F, 48.0F, 7.0F), cv::KeyPoint(50.0F, 52.0F, 7.0F)};
+
+    ListColumnVectorFloat64_2d PredictedImagePoints(1U);
+
+    PredictedImagePoints[0] << 50.0, 50.0;
+
+    for(const boolean UseKernels : {false, true})
+    {
+        const FeatureMatcher Matcher(cv::SIFT::create(), cv::BFMatcher::create(cv::NORM_L1), 0.9, nullptr, UseKernels);
+
+        std::vector<cv::DMatch> Matches;
+
+        ASSERT_EQ(Matcher.FindCorrespondencesInWindow(FeatureDescriptorsQuery, PredictedImagePoints, ExtractedFeaturesTarget, FeatureDescriptorsTarget, 100U, 100U, 10.0, Matches), 1U);
+        ASSERT_EQ(Matches[0].trainIdx, 0);
+        ASSERT_NEAR(Matches[0].distance, DistanceExpected, 1e-5);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the statistics of FindCorrespondences.
+///
+/// Tests whether the statistics of a call are consistent with the feature
+/// chains or not. The expectation is to get one entry per image and per image
+/// pair, that each image pair matches the chains which survived the previous
+/// image pair, and that the number of closed chains is the number of feature
+/// correspondences. The statistics stay empty if FM_COLLECT_STATISTICS is not
+/// defined.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FINDCORRESPONDENCES_STATISTICS_ISCONSISTENT(FeatureMatcher, Test_FindCorrespondences_Statistics_IsConsistent)
+{
+    const cv::Mat Canvas{CreateRectangleImage(480, 360, 9U)};
+
+    const std::vector<cv::Mat> Images{Canvas(cv::Rect(40, 40, 320, 240)).clone(), Canvas(cv::Rect(44, 42, 320, 240)).clone(), Canvas(cv::Rect(48, 44, 320, 240)).clone()};
+
+    const FeatureMatcher Matcher;
+
+    std::vector<ListColumnVectorFloat64_2d> FeatureCorrespondences;
+    FeatureMatcher::Statistics              CallStatistics;
+
+    const uint64 NumberOfCorrespondences{Matcher.FindCorrespondences(Images, FeatureCorrespondences, &CallStatistics)};
+
+    ASSERT_GT(NumberOfCorrespondences, 20U);
+
+#ifdef FM_COLLECT_STATISTICS
+    const uint64 NumberOfImages{Images.size()};
+
+    ASSERT_EQ(CallStatistics.DetectionTimes.size(), NumberOfImages);
+    ASSERT_EQ(CallStatistics.DescriptionTimes.size(), NumberOfImages);
+    ASSERT_EQ(CallStatistics.NumberOfFeatures.size(), NumberOfImages);
+    ASSERT_EQ(CallStatistics.MatchingTimes.size(), NumberOfImages);
+    ASSERT_EQ(CallStatistics.NumberOfCandidates.size(), NumberOfImages);
+    ASSERT_EQ(CallStatistics.NumberOfGoodMatches.size(), NumberOfImages);
+
+    // all features of the first image start a chain
+    ASSERT_EQ(CallStatistics.NumberOfCandidates[0], CallStatistics.NumberOfFeatures[0]);
+
+    // each image pair (except the closing one) keeps the chains with a good match
+    for(uint64 i_ImagePair{0U}; (i_ImagePair + 1U) < NumberOfImages; i_ImagePair++)
+    {
+        ASSERT_EQ(CallStatistics.NumberOfCandidates[i_ImagePair + 1U], CallStatistics.NumberOfGoodMatches[i_ImagePair]);
+    }
+
+    ASSERT_EQ(CallStatistics.NumberOfClosedChains, NumberOfCorrespondences);
+#else
+    ASSERT_TRUE(CallStatistics.DetectionTimes.empty());
+    ASSERT_TRUE(CallStatistics.DescriptionTimes.empty());
+    ASSERT_TRUE(CallStatistics.NumberOfFeatures.empty());
+    ASSERT_TRUE(CallStatistics.MatchingTimes.empty());
+    ASSERT_TRUE(CallStatistics.NumberOfCandidates.empty());
+    ASSERT_TRUE(CallStatistics.NumberOfGoodMatches.empty());
+    ASSERT_EQ(CallStatistics.NumberOfClosedChains, 0U);
+#endif
+}
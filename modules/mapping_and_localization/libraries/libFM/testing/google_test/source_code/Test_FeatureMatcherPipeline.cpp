@@ -0,0 +1,328 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  Test_FeatureMatcherPipeline.cpp
+///
+/// \brief Source file containing the unit tests for FeatureMatcherPipeline.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "../../../source_code/include/FeatureMatcherPipeline.h"
+#include "SyntheticImages.h"
+
+// definition of macros for the unit tests
+#define TEST_RESULTS_MULTIPLEJOBS_ISMATCHINGSYNCHRONOUS TEST ///< Define to get a unique test name.
+#define TEST_SUBMISSION_FULLQUEUE_ISBLOCKING            TEST ///< Define to get a unique test name.
+#define TEST_SHUTDOWN_PENDINGJOBS_ISFINISHED            TEST ///< Define to get a unique test name.
+#define TEST_SUBMISSION_NOIMAGES_ISTHROWING             TEST ///< Define to get a unique test name.
+
+///////////////////////////////////////////////////////////////////////////////
+/// \class GatedDetector
+///
+/// \brief ORB detector which blocks the detection until its gate is opened.
+///////////////////////////////////////////////////////////////////////////////
+class GatedDetector : public cv::Feature2D
+{
+protected:
+    cv::Ptr<cv::ORB>        m_Detector;  ///< Detector performing the detection and description.
+    std::mutex              m_Mutex;     ///< Mutex protecting the gate.
+    std::condition_variable m_Condition; ///< Condition variable signaling the opening of the gate.
+    boolean                 m_IsOpen;    ///< Flag defining whether the gate is open or not.
+
+public:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor.
+    ///////////////////////////////////////////////////////////////////////////////
+    GatedDetector() :
+        m_Detector{cv::ORB::create()},
+        m_IsOpen{false}
+    {
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief Opens the gate, i.e. all blocked and future detections proceed.
+    ///////////////////////////////////////////////////////////////////////////////
+    void Open()
+    {
+        {
+            const std::lock_guard<std::mutex> Lock(m_Mutex);
+
+            m_IsOpen = true;
+        }
+
+        m_Condition.notify_all();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief         Calculates the descriptors of the features.
+    ///
+    /// \param[in]     Image       Image where the features were detected.
+    /// \param[in,out] Keypoints   Features whose descriptors shall be calculated.
+    /// \param[out]    Descriptors Descriptors of the features.
+    ///////////////////////////////////////////////////////////////////////////////
+    void compute(cv::InputArray Image, std::vector<cv::KeyPoint>& Keypoints, cv::OutputArray Descriptors) override
+    {
+        m_Detector->compute(Image, Keypoints, Descriptors);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the norm of the descriptors.
+    ///
+    /// \return Norm of the descriptors.
+    ///////////////////////////////////////////////////////////////////////////////
+    sint32 defaultNorm() const override
+    {
+        return m_Detector->defaultNorm();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the size of the descriptors.
+    ///
+    /// \return Size of the descriptors (in bytes).
+    ///////////////////////////////////////////////////////////////////////////////
+    sint32 descriptorSize() const override
+    {
+        return m_Detector->descriptorSize();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief  Getter for the type of the descriptors.
+    ///
+    /// \return Type of the descriptors.
+    ///////////////////////////////////////////////////////////////////////////////
+    sint32 descriptorType() const override
+    {
+        return m_Detector->descriptorType();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// \brief      Detects the features once the gate is open.
+    ///
+    /// \param[in]  Image     Image where the features shall be detected.
+    /// \param[out] Keypoints Features detected in the image.
+    /// \param[in]  Mask      Mask defining where the features shall be detected.
+    ///////////////////////////////////////////////////////////////////////////////
+    void detect(cv::InputArray Image, std::vector<cv::KeyPoint>& Keypoints, cv::InputArray Mask) override
+    {
+        // wait until the gate is opened
+        {
+            std::unique_lock<std::mutex> Lock(m_Mutex);
+
+            m_Condition.wait(Lock, [this]() { return m_IsOpen; });
+        }
+
+        m_Detector->detect(Image, Keypoints, Mask);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief     Creates the image pairs for the jobs of the pipeline.
+///
+/// The second image of each pair is shifted by a few pixels w.r.t. the first
+/// image. The content of each pair differs.
+///
+/// \param[in] NumberOfJobs Number of jobs.
+///
+/// \return    List containing the image pairs.
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::vector<cv::Mat>> CreateImagePairs(const uint64 NumberOfJobs)
+{
+    std::vector<std::vector<cv::Mat>> ImagePairs(NumberOfJobs);
+
+    for(uint64 i_Job{0U}; i_Job < NumberOfJobs; i_Job++)
+    {
+        const cv::Mat Canvas{CreateRectangleImage(400, 300, static_cast<uint32>(100U + i_Job))};
+
+        ImagePairs[i_Job] = {Canvas(cv::Rect(20, 20, 320, 240)).clone(), Canvas(cv::Rect(23 + static_cast<sint32>(i_Job), 21, 320, 240)).clone()};
+    }
+
+    return ImagePairs;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief     Checks whether a result equals the synchronous result or not.
+///
+/// \param[in] Matcher Feature matcher used for the synchronous call.
+/// \param[in] Images  List of images where feature correspondences shall be found.
+/// \param[in] Result  Result of the pipeline.
+///////////////////////////////////////////////////////////////////////////////
+void CheckResult(const FeatureMatcher&              Matcher,
+                 const std::vector<cv::Mat>&        Images,
+                 const FeatureCorrespondenceResult& Result)
+{
+    std::vector<ListColumnVectorFloat64_2d> FeatureCorrespondences;
+
+    const uint64 NumberOfCorrespondences{Matcher.FindCorrespondences(Images, FeatureCorrespondences)};
+
+    ASSERT_GT(NumberOfCorrespondences, 0U);
+    ASSERT_EQ(Result.NumberOfCorrespondences, NumberOfCorrespondences);
+    ASSERT_EQ(Result.FeatureCorrespondences.size(), Images.size());
+
+    for(uint64 i_Image{0U}; i_Image < Images.size(); i_Image++)
+    {
+        ASSERT_EQ(Result.FeatureCorrespondences[i_Image].size(), NumberOfCorrespondences);
+
+        for(uint64 i_Correspondence{0U}; i_Correspondence < NumberOfCorrespondences; i_Correspondence++)
+        {
+            ASSERT_EQ(Result.FeatureCorrespondences[i_Image][i_Correspondence], FeatureCorrespondences[i_Image][i_Correspondence]);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the results of multiple jobs.
+///
+/// Tests whether the results of the pipeline match the results of synchronous
+/// calls or not. Several jobs with different images are submitted at once.
+/// The expectation is that each future yields the result of its own job.
+///////////////////////////////////////////////////////////////////////////////
+TEST_RESULTS_MULTIPLEJOBS_ISMATCHINGSYNCHRONOUS(FeatureMatcherPipeline, Test_Results_MultipleJobs_IsMatchingSynchronous)
+{
+    const uint64 NumberOfJobs{6U};
+
+    const std::vector<std::vector<cv::Mat>> ImagePairs{CreateImagePairs(NumberOfJobs)};
+
+    const FeatureMatcher   Matcher;
+    FeatureMatcherPipeline Pipeline(Matcher, 2U);
+
+    std::vector<std::future<FeatureCorrespondenceResult>> Results;
+
+    for(const std::vector<cv::Mat>& Images : ImagePairs)
+    {
+        Results.push_back(Pipeline.FindCorrespondencesAsync(Images));
+    }
+
+    for(uint64 i_Job{0U}; i_Job < NumberOfJobs; i_Job++)
+    {
+        CheckResult(Matcher, ImagePairs[i_Job], Results[i_Job].get());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the backpressure of a full queue.
+///
+/// Tests whether the submission of a job blocks if the extraction queue is
+/// full or not. The extraction stage is blocked by the detector, hence the
+/// first job stays in the extraction stage and the second job fills the queue.
+/// The expectation is that the third submission blocks until the detector is
+/// released and that all jobs are finished afterwards.
+///////////////////////////////////////////////////////////////////////////////
+TEST_SUBMISSION_FULLQUEUE_ISBLOCKING(FeatureMatcherPipeline, Test_Submission_FullQueue_IsBlocking)
+{
+    const uint64 NumberOfJobs{3U};
+
+    const std::vector<std::vector<cv::Mat>> ImagePairs{CreateImagePairs(NumberOfJobs)};
+
+    const cv::Ptr<GatedDetector> Detector{cv::makePtr<GatedDetector>()};
+
+    const FeatureMatcher   Matcher(Detector, cv::BFMatcher::create(cv::NORM_HAMMING));
+    FeatureMatcherPipeline Pipeline(Matcher, 1U);
+
+    std::future<FeatureCorrespondenceResult> ResultFirst{Pipeline.FindCorrespondencesAsync(ImagePairs[0])};
+    std::future<FeatureCorrespondenceResult> ResultSecond{Pipeline.FindCorrespondencesAsync(ImagePairs[1])};
+
+    std::future<std::future<FeatureCorrespondenceResult>> SubmissionThird{std::async(std::launch::async, [&]() { return Pipeline.FindCorrespondencesAsync(ImagePairs[2]); })};
+
+    // the gate is opened in any case, otherwise the pipeline could not be destroyed
+    EXPECT_EQ(SubmissionThird.wait_for(std::chrono::milliseconds(200)), std::future_status::timeout);
+    EXPECT_EQ(ResultFirst.wait_for(std::chrono::milliseconds(0)), std::future_status::timeout);
+
+    Detector->Open();
+
+    std::future<FeatureCorrespondenceResult> ResultThird{SubmissionThird.get()};
+
+    CheckResult(Matcher, ImagePairs[0], ResultFirst.get());
+    CheckResult(Matcher, ImagePairs[1], ResultSecond.get());
+    CheckResult(Matcher, ImagePairs[2], ResultThird.get());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the shutdown of the pipeline with pending jobs.
+///
+/// Tests whether pending jobs are finished if the pipeline is destroyed or
+/// not. The extraction stage is blocked by the detector while the pipeline is
+/// destroyed. The expectation is that the destruction waits for the pending
+/// jobs and that all futures hold valid results afterwards.
+///////////////////////////////////////////////////////////////////////////////
+TEST_SHUTDOWN_PENDINGJOBS_ISFINISHED(FeatureMatcherPipeline, Test_Shutdown_PendingJobs_IsFinished)
+{
+    const uint64 NumberOfJobs{3U};
+
+    const std::vector<std::vector<cv::Mat>> ImagePairs{CreateImagePairs(NumberOfJobs)};
+
+    const cv::Ptr<GatedDetector> Detector{cv::makePtr<GatedDetector>()};
+
+    const FeatureMatcher Matcher(Detector, cv::BFMatcher::create(cv::NORM_HAMMING));
+
+    std::unique_ptr<FeatureMatcherPipeline> Pipeline{new FeatureMatcherPipeline(Matcher, NumberOfJobs)};
+
+    std::vector<std::future<FeatureCorrespondenceResult>> Results;
+
+    for(const std::vector<cv::Mat>& Images : ImagePairs)
+    {
+        Results.push_back(Pipeline->FindCorrespondencesAsync(Images));
+    }
+
+    std::future<void> Shutdown{std::async(std::launch::async, [&Pipeline]() { Pipeline.reset(); })};
+
+    EXPECT_EQ(Shutdown.wait_for(std::chrono::milliseconds(200)), std::future_status::timeout);
+
+    Detector->Open();
+
+    Shutdown.get();
+
+    for(uint64 i_Job{0U}; i_Job < NumberOfJobs; i_Job++)
+    {
+        ASSERT_EQ(Results[i_Job].wait_for(std::chrono::milliseconds(0)), std::future_status::ready);
+
+        CheckResult(Matcher, ImagePairs[i_Job], Results[i_Job].get());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the submission of a job without images.
+///
+/// Tests whether a job without images is rejected before it is queued or not.
+/// The expectation is to get an exception and that the pipeline still
+/// processes subsequent jobs.
+///////////////////////////////////////////////////////////////////////////////
+TEST_SUBMISSION_NOIMAGES_ISTHROWING(FeatureMatcherPipeline, Test_Submission_NoImages_IsThrowing)
+{
+    const std::vector<std::vector<cv::Mat>> ImagePairs{CreateImagePairs(1U)};
+
+    const FeatureMatcher Matcher;
+
+    FeatureMatcherPipeline Pipeline(Matcher);
+
+    ASSERT_THROW(Pipeline.FindCorrespondencesAsync(std::vector<cv::Mat>()), std::invalid_argument);
+
+    std::future<FeatureCorrespondenceResult> Result{Pipeline.FindCorrespondencesAsync(ImagePairs[0])};
+
+    CheckResult(Matcher, ImagePairs[0], Result.get());
+}
@@ -0,0 +1,285 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  Test_FeatureTracker.cpp
+///
+/// \brief Source file containing the unit tests for FeatureTracker.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#include <algorithm>
+#include <set>
+
+#include <gtest/gtest.h>
+
+#include "../../../source_code/include/FeatureTracker.h"
+#include "SyntheticImages.h"
+
+// definition of macros for the unit tests
+#define TEST_TRACKIDS_SHIFTEDIMAGE_ISSTABLE            TEST ///< Define to get a unique test name.
+#define TEST_TRACKS_TEXTURELESSIMAGE_ISTERMINATED      TEST ///< Define to get a unique test name.
+#define TEST_NUMBEROFTRACKS_SHIFTEDIMAGE_ISREPLENISHED TEST ///< Define to get a unique test name.
+#define TEST_TRACKIDS_ISOLATEDFEATURES_ISSTABLE        TEST ///< Define to get a unique test name.
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief      Counts the tracks which have been continued by the shift of the
+///             image content.
+///
+/// \param[in]  Tracker               Feature tracker after processing the shifted image.
+/// \param[in]  TrackIDsFirst         IDs of the tracks after processing the first image.
+/// \param[in]  TrackImagePointsFirst Image coordinates of the tracks after processing the first image.
+/// \param[in]  Shift                 Shift of the image content (in pixels).
+/// \param[out] NumberOfShiftedTracks Number of continued tracks which moved by the shift.
+///
+/// \return     Number of continued tracks.
+///////////////////////////////////////////////////////////////////////////////
+uint64 CountContinuedTracks(const FeatureTracker&             Tracker,
+                            const ListUInt64&                 TrackIDsFirst,
+                            const ListColumnVectorFloat64_2d& TrackImagePointsFirst,
+                            const ColumnVectorFloat64_2d&     Shift,
+                            uint64&                           NumberOfShiftedTracks)
+{
+    uint64 NumberOfContinuedTracks{0U};
+
+    NumberOfShiftedTracks = 0U;
+
+    for(uint64 i_Track{0U}; i_Track < Tracker.GetNumberOfTracks(); i_Track++)
+    {
+        const ListUInt64::const_iterator TrackFirst{std::find(TrackIDsFirst.begin(), TrackIDsFirst.end(), Tracker.GetTrackIDs()[i_Track])};
+
+        if(TrackFirst == TrackIDsFirst.end())
+        {
+            continue;
+        }
+
+        const uint64 IndexFirst{static_cast<uint64>(TrackFirst - TrackIDsFirst.begin())};
+
+        NumberOfContinuedTracks++;
+
+        if((Tracker.GetTrackImagePoints()[i_Track] - TrackImagePointsFirst[IndexFirst] - Shift).norm() < 1.5)
+        {
+            NumberOfShiftedTracks++;
+        }
+    }
+
+    return NumberOfContinuedTracks;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the IDs of the tracks in a shifted image.
+///
+/// Tests whether the tracks keep their IDs if the image content is shifted by
+/// a few pixels or not. The expectation is that at least half of the tracks
+/// are continued, that continued tracks moved by the shift and that new tracks
+/// get new IDs.
+///////////////////////////////////////////////////////////////////////////////
+TEST_TRACKIDS_SHIFTEDIMAGE_ISSTABLE(FeatureTracker, Test_TrackIDs_ShiftedImage_IsStable)
+{
+    const cv::Mat Canvas{CreateRectangleImage(800, 600, 1U)};
+
+    const FeatureMatcher Matcher;
+    FeatureTracker       Tracker(Matcher, 300U, 20.0);
+
+    // the content of the second image is shifted by (-4, -2) pixels
+    const uint64 NumberOfTracksFirst{Tracker.ProcessImage(Canvas(cv::Rect(50, 50, 640, 480)).clone())};
+
+    const ListUInt64                 TrackIDsFirst{Tracker.GetTrackIDs()};
+    const ListColumnVectorFloat64_2d TrackImagePointsFirst{Tracker.GetTrackImagePoints()};
+
+    ASSERT_GT(NumberOfTracksFirst, 100U);
+
+    const uint64 NumberOfTracksSecond{Tracker.ProcessImage(Canvas(cv::Rect(54, 52, 640, 480)).clone())};
+
+    const ListUInt64&                 TrackIDsSecond{Tracker.GetTrackIDs()};
+    const ListUInt64&                 TrackAgesSecond{Tracker.GetTrackAges()};
+    const ListColumnVectorFloat64_2d& TrackImagePointsSecond{Tracker.GetTrackImagePoints()};
+
+    ASSERT_EQ(TrackIDsSecond.size(), NumberOfTracksSecond);
+    ASSERT_EQ(std::set<uint64>(TrackIDsSecond.begin(), TrackIDsSecond.end()).size(), NumberOfTracksSecond);
+
+    const ColumnVectorFloat64_2d Shift(-4.0, -2.0);
+
+    uint64 NumberOfContinuedTracks{0U};
+    uint64 NumberOfShiftedTracks{0U};
+
+    for(uint64 i_Track{0U}; i_Track < NumberOfTracksSecond; i_Track++)
+    {
+        const uint64 TrackID{TrackIDsSecond[i_Track]};
+
+        // new tracks get IDs which have not been used before
+        if(TrackID >= NumberOfTracksFirst)
+        {
+            ASSERT_EQ(TrackAgesSecond[i_Track], 1U);
+            continue;
+        }
+
+        ASSERT_EQ(TrackAgesSecond[i_Track], 2U);
+
+        // find the position of the track in the first image
+        const uint64 IndexFirst{static_cast<uint64>(std::find(TrackIDsFirst.begin(), TrackIDsFirst.end(), TrackID) - TrackIDsFirst.begin())};
+
+        ASSERT_LT(IndexFirst, NumberOfTracksFirst);
+
+        NumberOfContinuedTracks++;
+
+        if((TrackImagePointsSecond[i_Track] - TrackImagePointsFirst[IndexFirst] - Shift).norm() < 1.5)
+        {
+            NumberOfShiftedTracks++;
+        }
+    }
+
+    ASSERT_GE(2U * NumberOfContinuedTracks, NumberOfTracksFirst);
+    ASSERT_GE(20U * NumberOfShiftedTracks, 19U * NumberOfContinuedTracks);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the termination of the tracks in a textureless image.
+///
+/// Tests whether all tracks are terminated if no features are extracted in
+/// the new image or not. The expectation is to get no tracks and that tracks
+/// started afterwards get new IDs.
+///////////////////////////////////////////////////////////////////////////////
+TEST_TRACKS_TEXTURELESSIMAGE_ISTERMINATED(FeatureTracker, Test_Tracks_TexturelessImage_IsTerminated)
+{
+    const cv::Mat Image{CreateRectangleImage(640, 480, 2U)};
+    const cv::Mat ImageTextureless(480, 640, CV_8UC1, cv::Scalar(128));
+
+    const FeatureMatcher Matcher;
+    FeatureTracker       Tracker(Matcher, 200U, 20.0);
+
+    const uint64 NumberOfTracksFirst{Tracker.ProcessImage(Image)};
+
+    ASSERT_GT(NumberOfTracksFirst, 0U);
+    ASSERT_EQ(Tracker.ProcessImage(ImageTextureless), 0U);
+    ASSERT_TRUE(Tracker.GetTrackIDs().empty());
+    ASSERT_TRUE(Tracker.GetTrackImagePoints().empty());
+
+    const uint64 NumberOfTracksThird{Tracker.ProcessImage(Image)};
+
+    ASSERT_EQ(NumberOfTracksThird, NumberOfTracksFirst);
+
+    for(uint64 i_Track{0U}; i_Track < NumberOfTracksThird; i_Track++)
+    {
+        ASSERT_GE(Tracker.GetTrackIDs()[i_Track], NumberOfTracksFirst);
+        ASSERT_EQ(Tracker.GetTrackAges()[i_Track], 1U);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the replenishment of the tracks.
+///
+/// Tests whether terminated tracks are replaced by new tracks or not. The
+/// image contains more features than tracks. The expectation is to get the
+/// maximum number of tracks after each image, both if the image content is
+/// shifted by a few pixels and if it is replaced completely.
+///////////////////////////////////////////////////////////////////////////////
+TEST_NUMBEROFTRACKS_SHIFTEDIMAGE_ISREPLENISHED(FeatureTracker, Test_NumberOfTracks_ShiftedImage_IsReplenished)
+{
+    const cv::Mat Canvas{CreateRectangleImage(800, 600, 3U)};
+    const cv::Mat ImageOther{CreateRectangleImage(640, 480, 4U)};
+
+    const uint64 MaximumNumberOfTracks{100U};
+
+    const FeatureMatcher Matcher;
+    FeatureTracker       Tracker(Matcher, MaximumNumberOfTracks, 20.0);
+
+    ASSERT_EQ(Tracker.ProcessImage(Canvas(cv::Rect(50, 50, 640, 480)).clone()), MaximumNumberOfTracks);
+    ASSERT_EQ(Tracker.ProcessImage(Canvas(cv::Rect(53, 51, 640, 480)).clone()), MaximumNumberOfTracks);
+
+    // continued tracks keep their IDs, replenished tracks get new ones
+    uint64 NumberOfContinuedTracks{0U};
+
+    for(uint64 i_Track{0U}; i_Track < MaximumNumberOfTracks; i_Track++)
+    {
+        const boolean IsContinued{Tracker.GetTrackIDs()[i_Track] < MaximumNumberOfTracks};
+
+        ASSERT_EQ(Tracker.GetTrackAges()[i_Track], IsContinued ? 2U : 1U);
+
+        NumberOfContinuedTracks += IsContinued ? 1U : 0U;
+    }
+
+    ASSERT_GT(NumberOfContinuedTracks, 0U);
+
+    // almost all tracks are terminated in an unrelated image and replaced by new ones
+    ASSERT_EQ(Tracker.ProcessImage(ImageOther), MaximumNumberOfTracks);
+    ASSERT_EQ(Tracker.GetTrackDescriptors().rows, static_cast<sint32>(MaximumNumberOfTracks));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the IDs of isolated tracks in a shifted image.
+///
+/// Tests whether tracks with a single feature inside their search window keep
+/// their IDs if the image content is shifted by a few pixels or not. The image
+/// contains squares which are far apart compared to the search radius, i.e.
+/// the search window of each track contains only the corner of the track. The
+/// expectation is that almost all tracks are continued and moved by the shift
+/// if single candidates are accepted (default), and that fewer tracks are
+/// continued otherwise.
+///////////////////////////////////////////////////////////////////////////////
+TEST_TRACKIDS_ISOLATEDFEATURES_ISSTABLE(FeatureTracker, Test_TrackIDs_IsolatedFeatures_IsStable)
+{
+    // squares of different intensities on a regular grid
+    cv::Mat Canvas(600, 800, CV_8UC1, cv::Scalar(128));
+
+    const ListUInt64 Intensities{0U, 40U, 220U, 255U, 70U, 190U};
+
+    for(sint32 i_Row{0}; i_Row < 4; i_Row++)
+    {
+        for(sint32 i_Column{0}; i_Column < 6; i_Column++)
+        {
+            const cv::Rect Square(100 + 100 * i_Column, 100 + 100 * i_Row, 24, 24);
+
+            Canvas(Square).setTo(cv::Scalar(static_cast<float64>(Intensities[static_cast<uint64>((i_Row + i_Column) % 6)])));
+        }
+    }
+
+    // a single pyramid level avoids duplicates of the corners at other scales
+    const FeatureMatcher Matcher(cv::ORB::create(500, 1.2F, 1), cv::BFMatcher::create(cv::NORM_HAMMING));
+
+    // the content of the second image is shifted by (-3, -2) pixels
+    const cv::Mat                ImageFirst{Canvas(cv::Rect(50, 50, 640, 480)).clone()};
+    const cv::Mat                ImageSecond{Canvas(cv::Rect(53, 52, 640, 480)).clone()};
+    const ColumnVectorFloat64_2d Shift(-3.0, -2.0);
+
+    FeatureTracker TrackerSingleCandidates(Matcher, 300U, 8.0);
+    FeatureTracker TrackerNoSingleCandidates(Matcher, 300U, 8.0, false);
+
+    const uint64 NumberOfTracksFirst{TrackerSingleCandidates.ProcessImage(ImageFirst)};
+
+    ASSERT_EQ(TrackerNoSingleCandidates.ProcessImage(ImageFirst), NumberOfTracksFirst);
+    ASSERT_GE(NumberOfTracksFirst, 48U);
+
+    const ListUInt64                 TrackIDsFirst{TrackerSingleCandidates.GetTrackIDs()};
+    const ListColumnVectorFloat64_2d TrackImagePointsFirst{TrackerSingleCandidates.GetTrackImagePoints()};
+
+    TrackerSingleCandidates.ProcessImage(ImageSecond);
+    TrackerNoSingleCandidates.ProcessImage(ImageSecond);
+
+    uint64 NumberOfShiftedTracks{0U};
+    uint64 NumberOfShiftedTracksNoSingleCandidates{0U};
+
+    const uint64 NumberOfContinuedTracks{CountContinuedTracks(TrackerSingleCandidates, TrackIDsFirst, TrackImagePointsFirst, Shift, NumberOfShiftedTracks)};
+    const uint64 NumberOfContinuedTracksNoSingleCandidates{CountContinuedTracks(TrackerNoSingleCandidates, TrackIDsFirst, TrackImagePointsFirst, Shift, NumberOfShiftedTracksNoSingleCandidates)};
+
+    ASSERT_GE(10U * NumberOfContinuedTracks, 9U * NumberOfTracksFirst);
+    ASSERT_EQ(NumberOfShiftedTracks, NumberOfContinuedTracks);
+    ASSERT_LT(NumberOfContinuedTracksNoSingleCandidates, NumberOfContinuedTracks);
+}
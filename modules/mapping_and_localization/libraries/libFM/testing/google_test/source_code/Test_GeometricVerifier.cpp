@@ -0,0 +1,331 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  Test_GeometricVerifier.cpp
+///
+/// \brief Source file containing the unit tests for GeometricVerifier.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <opencv2/calib3d.hpp>
+
+#include "../../../source_code/include/GeometricVerifier.h"
+
+// definition of macros for the unit tests
+#define TEST_FUNDAMENTAL_30PERCENTOUTLIERS_ISMATCHING   TEST ///< Define to get a unique test name.
+#define TEST_FUNDAMENTAL_SAMESEED_ISDETERMINISTIC       TEST ///< Define to get a unique test name.
+#define TEST_FUNDAMENTAL_TOOFEWCORRESPONDENCES_ISEMPTY  TEST ///< Define to get a unique test name.
+#define TEST_STEREO_ROWANDDISPARITYOUTLIERS_ISMATCHING  TEST ///< Define to get a unique test name.
+#define TEST_FUNDAMENTAL_NOISYCORRESPONDENCES_ISOPENCV  TEST ///< Define to get a unique test name.
+#define TEST_VERIFY_MISMATCHINGPOINTS_ISTHROWING        TEST ///< Define to get a unique test name.
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief      Creates feature correspondences of a moving camera.
+///
+/// The 3D points are projected into two views of a pinhole camera. Every
+/// third feature correspondence is replaced by a random image point in the
+/// second view (outlier).
+///
+/// \param[in]  NumberOfCorrespondences Number of feature correspondences.
+/// \param[out] ImagePointsFirst        Image coordinates of the feature correspondences in the first image.
+/// \param[out] ImagePointsSecond       Image coordinates of the feature correspondences in the second image.
+/// \param[out] IsOutlier               Flag for each feature correspondence whether it is an outlier or not.
+///////////////////////////////////////////////////////////////////////////////
+void CreateCorrespondences(const uint64       NumberOfCorrespondences,
+                           MatrixFloat64_2xX& ImagePointsFirst,
+                           MatrixFloat64_2xX& ImagePointsSecond,
+                           ListBoolean&       IsOutlier)
+{
+    std::mt19937 RandomNumberEngine(42U);
+
+    std::uniform_real_distribution<float64> DistributionHorizontal(-4.0, 4.0);
+    std::uniform_real_distribution<float64> DistributionVertical(-3.0, 3.0);
+    std::uniform_real_distribution<float64> DistributionDepth(5.0, 15.0);
+    std::uniform_real_distribution<float64> DistributionColumn(0.0, 640.0);
+    std::uniform_real_distribution<float64> DistributionRow(0.0, 480.0);
+
+    // camera intrinsics and motion between both views
+    MatrixFloat64_3d CameraMatrix;
+
+    CameraMatrix << 500.0, 0.0, 320.0,
+        0.0, 500.0, 240.0,
+        0.0, 0.0, 1.0;
+
+    const MatrixFloat64_3d       Rotation{Eigen::AngleAxisd(0.1, ColumnVectorFloat64_3d::UnitY()).toRotationMatrix()};
+    const ColumnVectorFloat64_3d Translation(1.0, 0.1, 0.05);
+
+    ImagePointsFirst.resize(2, static_cast<sint64>(NumberOfCorrespondences));
+    ImagePointsSecond.resize(2, static_cast<sint64>(NumberOfCorrespondences));
+    IsOutlier.resize(NumberOfCorrespondences);
+
+    for(uint64 i_Correspondence{0U}; i_Correspondence < NumberOfCorrespondences; i_Correspondence++)
+    {
+        const sint64 Column{static_cast<sint64>(i_Correspondence)};
+
+        const ColumnVectorFloat64_3d PointFirst(DistributionHorizontal(RandomNumberEngine), DistributionVertical(RandomNumberEngine), DistributionDepth(RandomNumberEngine));
+        const ColumnVectorFloat64_3d PointSecond{Rotation * PointFirst + Translation};
+
+        ImagePointsFirst.col(Column)  = (CameraMatrix * PointFirst).hnormalized();
+        ImagePointsSecond.col(Column) = (CameraMatrix * PointSecond).hnormalized();
+
+        IsOutlier[i_Correspondence] = ((i_Correspondence % 3U) == 0U);
+
+        if(IsOutlier[i_Correspondence])
+        {
+            ImagePointsSecond(0, Column) = DistributionColumn(RandomNumberEngine);
+            ImagePointsSecond(1, Column) = DistributionRow(RandomNumberEngine);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the inliers of the fundamental matrix verification.
+///
+/// Tests whether the inliers of the fundamental matrix verification do match
+/// the expected inliers or not. A third of the feature correspondences are
+/// outliers. The expectation is to keep all inliers and to reject at least
+/// 95% of the outliers.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FUNDAMENTAL_30PERCENTOUTLIERS_ISMATCHING(GeometricVerifier, Test_Fundamental_30PercentOutliers_IsMatching)
+{
+    const uint64 NumberOfCorrespondences{600U};
+
+    MatrixFloat64_2xX ImagePointsFirst;
+    MatrixFloat64_2xX ImagePointsSecond;
+    ListBoolean       IsOutlier;
+
+    CreateCorrespondences(NumberOfCorrespondences, ImagePointsFirst, ImagePointsSecond, IsOutlier);
+
+    const GeometricVerifier Verifier;
+
+    MatrixFloat64_3d FundamentalMatrix;
+    ListBoolean      InlierMask;
+
+    Verifier.VerifyFundamental(ImagePointsFirst, ImagePointsSecond, FundamentalMatrix, InlierMask);
+
+    ASSERT_EQ(InlierMask.size(), NumberOfCorrespondences);
+
+    uint64 NumberOfRejectedInliers{0U};
+    uint64 NumberOfAcceptedOutliers{0U};
+    uint64 NumberOfOutliers{0U};
+
+    for(uint64 i_Correspondence{0U}; i_Correspondence < NumberOfCorrespondences; i_Correspondence++)
+    {
+        if(IsOutlier[i_Correspondence])
+        {
+            NumberOfOutliers++;
+
+            if(InlierMask[i_Correspondence])
+            {
+                NumberOfAcceptedOutliers++;
+            }
+        }
+        else if(!InlierMask[i_Correspondence])
+        {
+            NumberOfRejectedInliers++;
+        }
+    }
+
+    ASSERT_EQ(NumberOfRejectedInliers, 0U);
+    ASSERT_LE(20U * NumberOfAcceptedOutliers, NumberOfOutliers);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the determinism of the fundamental matrix verification.
+///
+/// Tests whether two verifiers with the same seed value yield the same result
+/// or not. The expectation is to get identical inlier masks and fundamental
+/// matrices.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FUNDAMENTAL_SAMESEED_ISDETERMINISTIC(GeometricVerifier, Test_Fundamental_SameSeed_IsDeterministic)
+{
+    const uint64 NumberOfCorrespondences{300U};
+
+    MatrixFloat64_2xX ImagePointsFirst;
+    MatrixFloat64_2xX ImagePointsSecond;
+    ListBoolean       IsOutlier;
+
+    CreateCorrespondences(NumberOfCorrespondences, ImagePointsFirst, ImagePointsSecond, IsOutlier);
+
+    const GeometricVerifier VerifierFirst(64U, 50U, 1.0, 7U);
+    const GeometricVerifier VerifierSecond(64U, 50U, 1.0, 7U);
+
+    MatrixFloat64_3d FundamentalMatrixFirst;
+    MatrixFloat64_3d FundamentalMatrixSecond;
+    ListBoolean      InlierMaskFirst;
+    ListBoolean      InlierMaskSecond;
+
+    const uint64 NumberOfInliersFirst{VerifierFirst.VerifyFundamental(ImagePointsFirst, ImagePointsSecond, FundamentalMatrixFirst, InlierMaskFirst)};
+    const uint64 NumberOfInliersSecond{VerifierSecond.VerifyFundamental(ImagePointsFirst, ImagePointsSecond, FundamentalMatrixSecond, InlierMaskSecond)};
+
+    ASSERT_EQ(NumberOfInliersFirst, NumberOfInliersSecond);
+    ASSERT_EQ(InlierMaskFirst, InlierMaskSecond);
+    ASSERT_TRUE(FundamentalMatrixFirst.isApprox(FundamentalMatrixSecond));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the fundamental matrix verification with too few feature
+///        correspondences.
+///
+/// Tests whether the verification of less than eight feature correspondences
+/// fails or not. The expectation is to get no inliers and a zero fundamental
+/// matrix.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FUNDAMENTAL_TOOFEWCORRESPONDENCES_ISEMPTY(GeometricVerifier, Test_Fundamental_TooFewCorrespondences_IsEmpty)
+{
+    const uint64 NumberOfCorrespondences{7U};
+
+    MatrixFloat64_2xX ImagePointsFirst;
+    MatrixFloat64_2xX ImagePointsSecond;
+    ListBoolean       IsOutlier;
+
+    CreateCorrespondences(NumberOfCorrespondences, ImagePointsFirst, ImagePointsSecond, IsOutlier);
+
+    const GeometricVerifier Verifier;
+
+    MatrixFloat64_3d FundamentalMatrix;
+    ListBoolean      InlierMask;
+
+    const uint64 NumberOfInliers{Verifier.VerifyFundamental(ImagePointsFirst, ImagePointsSecond, FundamentalMatrix, InlierMask)};
+
+    ASSERT_EQ(NumberOfInliers, 0U);
+    ASSERT_EQ(InlierMask, ListBoolean(NumberOfCorrespondences, false));
+    ASSERT_TRUE(FundamentalMatrix.isZero());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for a mismatch between the number of image points of both
+///        images.
+///
+/// Tests whether the fundamental matrix verification and the stereo
+/// verification reject image points which do not form pairs or not. The
+/// expectation is to get an exception from both verifications.
+///////////////////////////////////////////////////////////////////////////////
+TEST_VERIFY_MISMATCHINGPOINTS_ISTHROWING(GeometricVerifier, Test_Verify_MismatchingPoints_IsThrowing)
+{
+    const uint64 NumberOfCorrespondences{20U};
+
+    MatrixFloat64_2xX ImagePointsFirst;
+    MatrixFloat64_2xX ImagePointsSecond;
+    ListBoolean       IsOutlier;
+
+    CreateCorrespondences(NumberOfCorrespondences, ImagePointsFirst, ImagePointsSecond, IsOutlier);
+
+    const MatrixFloat64_2xX ImagePointsSecondShort{ImagePointsSecond.leftCols(NumberOfCorrespondences - 1U)};
+
+    const GeometricVerifier Verifier;
+
+    MatrixFloat64_3d FundamentalMatrix;
+    ListBoolean      InlierMask;
+
+    ASSERT_THROW(Verifier.VerifyFundamental(ImagePointsFirst, ImagePointsSecondShort, FundamentalMatrix, InlierMask), std::invalid_argument);
+    ASSERT_THROW(Verifier.VerifyFundamental(ImagePointsSecondShort, ImagePointsFirst, FundamentalMatrix, InlierMask), std::invalid_argument);
+    ASSERT_THROW(GeometricVerifier::VerifyStereo(ImagePointsFirst, ImagePointsSecondShort, 1.0, 100.0, InlierMask), std::invalid_argument);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the inliers of the stereo verification.
+///
+/// Tests whether the inliers of the stereo verification do match the expected
+/// inliers or not. The expectation is to reject the feature correspondences
+/// with a large row distance, a negative disparity and a too large disparity.
+///////////////////////////////////////////////////////////////////////////////
+TEST_STEREO_ROWANDDISPARITYOUTLIERS_ISMATCHING(GeometricVerifier, Test_Stereo_RowAndDisparityOutliers_IsMatching)
+{
+    MatrixFloat64_2xX ImagePointsStereoLeft(2, 5);
+    MatrixFloat64_2xX ImagePointsStereoRight(2, 5);
+
+    ImagePointsStereoLeft << 100.0, 200.0, 300.0, 400.0, 500.0,
+        50.0, 60.0, 70.0, 80.0, 90.0;
+    ImagePointsStereoRight << 90.0, 150.0, 310.0, 200.0, 499.0,
+        50.5, 65.0, 70.0, 80.0, 91.0;
+
+    const ListBoolean InlierMaskExpected{true, false, false, false, true};
+
+    ListBoolean InlierMask;
+
+    const uint64 NumberOfInliers{GeometricVerifier::VerifyStereo(ImagePointsStereoLeft, ImagePointsStereoRight, 2.0, 128.0, InlierMask)};
+
+    ASSERT_EQ(NumberOfInliers, 2U);
+    ASSERT_EQ(InlierMask, InlierMaskExpected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the fundamental matrix verification of noisy feature
+///        correspondences.
+///
+/// Tests whether the fundamental matrix verification finds as many inliers as
+/// the RANSAC of OpenCV with the same inlier threshold or not. The image
+/// coordinates of the second image are disturbed by Gaussian noise. The
+/// expectation is that the numbers of inliers differ by at most 5%.
+///////////////////////////////////////////////////////////////////////////////
+TEST_FUNDAMENTAL_NOISYCORRESPONDENCES_ISOPENCV(GeometricVerifier, Test_Fundamental_NoisyCorrespondences_IsOpenCV)
+{
+    const uint64 NumberOfCorrespondences{600U};
+
+    MatrixFloat64_2xX ImagePointsFirst;
+    MatrixFloat64_2xX ImagePointsSecond;
+    ListBoolean       IsOutlier;
+
+    CreateCorrespondences(NumberOfCorrespondences, ImagePointsFirst, ImagePointsSecond, IsOutlier);
+
+    std::mt19937 RandomNumberEngine(3U);
+
+    std::normal_distribution<float64> DistributionNoise(0.0, 0.3);
+
+    std::vector<cv::Point2d> PointsFirst;
+    std::vector<cv::Point2d> PointsSecond;
+
+    for(uint64 i_Correspondence{0U}; i_Correspondence < NumberOfCorrespondences; i_Correspondence++)
+    {
+        const sint64 Column{static_cast<sint64>(i_Correspondence)};
+
+        ImagePointsSecond(0, Column) += DistributionNoise(RandomNumberEngine);
+        ImagePointsSecond(1, Column) += DistributionNoise(RandomNumberEngine);
+
+        PointsFirst.emplace_back(ImagePointsFirst(0, Column), ImagePointsFirst(1, Column));
+        PointsSecond.emplace_back(ImagePointsSecond(0, Column), ImagePointsSecond(1, Column));
+    }
+
+    const GeometricVerifier Verifier;
+
+    MatrixFloat64_3d FundamentalMatrix;
+    ListBoolean      InlierMask;
+
+    const uint64 NumberOfInliers{Verifier.VerifyFundamental(ImagePointsFirst, ImagePointsSecond, FundamentalMatrix, InlierMask)};
+
+    cv::Mat InlierMaskOpenCV;
+
+    cv::findFundamentalMat(PointsFirst, PointsSecond, cv::FM_RANSAC, 1.0, 0.999, InlierMaskOpenCV);
+
+    const uint64 NumberOfInliersOpenCV{static_cast<uint64>(cv::countNonZero(InlierMaskOpenCV))};
+
+    ASSERT_GT(NumberOfInliersOpenCV, 0U);
+    ASSERT_LE(20U * NumberOfInliers, 21U * NumberOfInliersOpenCV);
+    ASSERT_GE(20U * NumberOfInliers, 19U * NumberOfInliersOpenCV);
+}
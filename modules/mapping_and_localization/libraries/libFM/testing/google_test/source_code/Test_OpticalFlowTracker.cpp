@@ -0,0 +1,453 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file  Test_OpticalFlowTracker.cpp
+///
+/// \brief Source file containing the unit tests for OpticalFlowTracker.
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+This file is part of the Robotics Toolbox.
+
+Copyright (C) 2026
+
+Authors: Bernd Kitt (b.kitt@berndkitt.de)
+
+The Robotics Toolbox is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License,
+or any later version.
+
+The Robotics Toolbox is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+the Robotics Toolbox. If not, see https://www.gnu.org/licenses/.
+*/
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <opencv2/imgproc/imgproc.hpp>
+
+#include "../../../../libFB/source_code/include/FeatureBucketerByOrder.h"
+#include "../../../source_code/include/OpticalFlowTracker.h"
+#include "SyntheticImages.h"
+
+// definition of macros for the unit tests
+#define TEST_TRACKS_KNOWNTRANSLATION_ISMATCHING    TEST ///< Define to get a unique test name.
+#define TEST_TRACKS_TEXTURELESSREGION_ISPRUNED     TEST ///< Define to get a unique test name.
+#define TEST_TRACKS_DEPLETEDBUCKET_ISREPLENISHED   TEST ///< Define to get a unique test name.
+#define TEST_TRACKS_OCCLUDEDREGION_ISREJECTED      TEST ///< Define to get a unique test name.
+#define TEST_TRACKS_SMALLBUCKETS_ISKEEPINGDISTANCE TEST ///< Define to get a unique test name.
+#define TEST_TRACKS_WRONGIMAGESIZE_ISTHROWING      TEST ///< Define to get a unique test name.
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief     Creates a blurred image with random rectangles.
+///
+/// The image is blurred to get smooth gradients for the optical flow.
+///
+/// \param[in] NumberOfPixelsHorizontal Number of pixels in horizontal direction.
+/// \param[in] NumberOfPixelsVertical   Number of pixels in vertical direction.
+/// \param[in] Seed                     Seed value of the random number engine.
+///
+/// \return    Blurred image with random rectangles.
+///////////////////////////////////////////////////////////////////////////////
+cv::Mat CreateBlurredRectangleImage(const sint32 NumberOfPixelsHorizontal,
+                                    const sint32 NumberOfPixelsVertical,
+                                    const uint32 Seed)
+{
+    cv::Mat ImageBlurred;
+
+    cv::GaussianBlur(CreateRectangleImage(NumberOfPixelsHorizontal, NumberOfPixelsVertical, Seed), ImageBlurred, cv::Size(5, 5), 1.5);
+
+    return ImageBlurred;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief     Counts the tracks in each bucket.
+///
+/// \param[in] Bucketer    Feature bucketer defining the buckets.
+/// \param[in] ImagePoints List containing the image coordinates of the tracks.
+///
+/// \return    List containing the number of tracks for all buckets.
+///////////////////////////////////////////////////////////////////////////////
+ListUInt64 CountTracksInBuckets(const FeatureBucketerBase&        Bucketer,
+                                const ListColumnVectorFloat64_2d& ImagePoints)
+{
+    ListUInt64 NumberOfTracksInBuckets(static_cast<uint64>(Bucketer.GetFeatureMask().size()), 0U);
+
+    for(const ColumnVectorFloat64_2d& ImagePoint : ImagePoints)
+    {
+        uint16 BucketID{0U};
+
+        if(Bucketer.ComputeBucketID(ImagePoint(0), ImagePoint(1), BucketID))
+        {
+            NumberOfTracksInBuckets[BucketID]++;
+        }
+    }
+
+    return NumberOfTracksInBuckets;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the tracking of a known translation.
+///
+/// Tests whether the tracks follow a translation of the image content or not.
+/// The expectation is that almost all tracks are continued and moved by the
+/// translation with sub-pixel accuracy.
+///////////////////////////////////////////////////////////////////////////////
+TEST_TRACKS_KNOWNTRANSLATION_ISMATCHING(OpticalFlowTracker, Test_Tracks_KnownTranslation_IsMatching)
+{
+    const cv::Mat Canvas{CreateBlurredRectangleImage(800, 600, 11U)};
+
+    const FeatureBucketerByOrder Bucketer(640U, 480U, 4U, 3U, 10U);
+
+    OpticalFlowTracker Tracker(Bucketer);
+
+    // the content of the second image is shifted by (-3, -1) pixels
+    Tracker.ProcessImages({Canvas(cv::Rect(50, 50, 640, 480)).clone()});
+
+    const ListUInt64                 TrackIDsFirst{Tracker.GetTrackIDs(0U)};
+    const ListColumnVectorFloat64_2d TrackImagePointsFirst{Tracker.GetTrackImagePoints(0U)};
+
+    ASSERT_GT(TrackIDsFirst.size(), 100U);
+
+    Tracker.ProcessImages({Canvas(cv::Rect(53, 51, 640, 480)).clone()});
+
+    const ColumnVectorFloat64_2d Shift(-3.0, -1.0);
+
+    uint64 NumberOfContinuedTracks{0U};
+    uint64 NumberOfAccurateTracks{0U};
+
+    for(uint64 i_Track{0U}; i_Track < Tracker.GetNumberOfTracks(0U); i_Track++)
+    {
+        const ListUInt64::const_iterator TrackIDFirst{std::find(TrackIDsFirst.begin(), TrackIDsFirst.end(), Tracker.GetTrackIDs(0U)[i_Track])};
+
+        if(TrackIDFirst == TrackIDsFirst.end())
+        {
+            ASSERT_EQ(Tracker.GetTrackAges(0U)[i_Track], 1U);
+            continue;
+        }
+
+        ASSERT_EQ(Tracker.GetTrackAges(0U)[i_Track], 2U);
+
+        NumberOfContinuedTracks++;
+
+        const uint64 IndexFirst{static_cast<uint64>(TrackIDFirst - TrackIDsFirst.begin())};
+
+        if((Tracker.GetTrackImagePoints(0U)[i_Track] - TrackImagePointsFirst[IndexFirst] - Shift).norm() < 0.2)
+        {
+            NumberOfAccurateTracks++;
+        }
+    }
+
+    ASSERT_GE(10U * NumberOfContinuedTracks, 9U * TrackIDsFirst.size());
+    ASSERT_GE(20U * NumberOfAccurateTracks, 19U * NumberOfContinuedTracks);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the pruning of tracks in a textureless region.
+///
+/// Tests whether tracks whose status is invalid are terminated or not. The
+/// right half of the second image is textureless, hence the backward tracking
+/// fails for the tracks in this half. The expectation is that the tracks in
+/// the right half are terminated while the tracks in the left half are kept.
+///////////////////////////////////////////////////////////////////////////////
+TEST_TRACKS_TEXTURELESSREGION_ISPRUNED(OpticalFlowTracker, Test_Tracks_TexturelessRegion_IsPruned)
+{
+    const cv::Mat ImageFirst{CreateBlurredRectangleImage(640, 480, 12U)};
+
+    cv::Mat ImageSecond{ImageFirst.clone()};
+
+    ImageSecond(cv::Rect(320, 0, 320, 480)).setTo(cv::Scalar(128));
+
+    const FeatureBucketerByOrder Bucketer(640U, 480U, 4U, 3U, 10U);
+
+    OpticalFlowTracker Tracker(Bucketer);
+
+    Tracker.ProcessImages({ImageFirst});
+
+    const ListUInt64                 TrackIDsFirst{Tracker.GetTrackIDs(0U)};
+    const ListColumnVectorFloat64_2d TrackImagePointsFirst{Tracker.GetTrackImagePoints(0U)};
+
+    Tracker.ProcessImages({ImageSecond});
+
+    const ListUInt64& TrackIDsSecond{Tracker.GetTrackIDs(0U)};
+
+    uint64 NumberOfTracksLeft{0U};
+    uint64 NumberOfContinuedTracksLeft{0U};
+
+    for(uint64 i_Track{0U}; i_Track < TrackIDsFirst.size(); i_Track++)
+    {
+        const boolean IsContinued{std::find(TrackIDsSecond.begin(), TrackIDsSecond.end(), TrackIDsFirst[i_Track]) != TrackIDsSecond.end()};
+
+        // the search window of these tracks lies completely in the textureless region
+        if(TrackImagePointsFirst[i_Track](0) > 340.0)
+        {
+            ASSERT_FALSE(IsContinued);
+        }
+        else if(TrackImagePointsFirst[i_Track](0) < 250.0)
+        {
+            NumberOfTracksLeft++;
+            NumberOfContinuedTracksLeft += IsContinued ? 1U : 0U;
+        }
+    }
+
+    ASSERT_GT(NumberOfTracksLeft, 0U);
+    ASSERT_GE(10U * NumberOfContinuedTracksLeft, 9U * NumberOfTracksLeft);
+
+    // no new tracks are started in the textureless region
+    for(const ColumnVectorFloat64_2d& TrackImagePoint : Tracker.GetTrackImagePoints(0U))
+    {
+        ASSERT_LT(TrackImagePoint(0), 340.0);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the replenishment of a depleted bucket.
+///
+/// Tests whether new tracks are only started in buckets which contain less
+/// tracks than defined by the feature mask or not. The tracks of a single
+/// bucket are lost in the second image, which is restored in the third image.
+/// The expectation is that each bucket contains the number of tracks defined
+/// by the feature mask and that the tracks of distant buckets are continued
+/// without starting new tracks there.
+///////////////////////////////////////////////////////////////////////////////
+TEST_TRACKS_DEPLETEDBUCKET_ISREPLENISHED(OpticalFlowTracker, Test_Tracks_DepletedBucket_IsReplenished)
+{
+    const cv::Mat ImageFirst{CreateBlurredRectangleImage(640, 480, 13U)};
+
+    cv::Mat ImageSecond{ImageFirst.clone()};
+
+    ImageSecond(cv::Rect(480, 320, 160, 160)).setTo(cv::Scalar(128));
+
+    // buckets of 160x160 pixels, no tracks in the second bucket of the second row
+    MatrixUInt8 FeatureMask(3, 4);
+
+    FeatureMask << 2U, 5U, 5U, 5U,
+        5U, 0U, 5U, 5U,
+        5U, 5U, 5U, 5U;
+
+    const FeatureBucketerByOrder Bucketer(640U, 480U, FeatureMask);
+
+    const uint16 BucketIDDepleted{11U};
+
+    OpticalFlowTracker Tracker(Bucketer);
+
+    Tracker.ProcessImages({ImageFirst});
+
+    const ListUInt64 NumberOfTracksInBucketsFirst{CountTracksInBuckets(Bucketer, Tracker.GetTrackImagePoints(0U))};
+
+    for(sint64 i_Bucket{0}; i_Bucket < FeatureMask.size(); i_Bucket++)
+    {
+        ASSERT_EQ(NumberOfTracksInBucketsFirst[static_cast<uint64>(i_Bucket)], static_cast<uint64>(FeatureMask(i_Bucket / 4, i_Bucket % 4)));
+    }
+
+    const uint64 NumberOfTracksFirst{Tracker.GetNumberOfTracks(0U)};
+
+    Tracker.ProcessImages({ImageSecond});
+
+    ASSERT_LT(CountTracksInBuckets(Bucketer, Tracker.GetTrackImagePoints(0U))[BucketIDDepleted], 5U);
+
+    Tracker.ProcessImages({ImageFirst});
+
+    const ListUInt64 NumberOfTracksInBucketsThird{CountTracksInBuckets(Bucketer, Tracker.GetTrackImagePoints(0U))};
+
+    ASSERT_EQ(NumberOfTracksInBucketsThird[BucketIDDepleted], 5U);
+    ASSERT_EQ(NumberOfTracksInBucketsThird[5U], 0U);
+
+    // the tracks of buckets far away from the depleted bucket are continued, no new tracks are started there
+    for(uint64 i_Track{0U}; i_Track < Tracker.GetNumberOfTracks(0U); i_Track++)
+    {
+        const ColumnVectorFloat64_2d& TrackImagePoint{Tracker.GetTrackImagePoints(0U)[i_Track]};
+
+        if((TrackImagePoint(0) < 320.0) || (TrackImagePoint(1) < 160.0))
+        {
+            ASSERT_LT(Tracker.GetTrackIDs(0U)[i_Track], NumberOfTracksFirst);
+            ASSERT_EQ(Tracker.GetTrackAges(0U)[i_Track], 3U);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief      Counts the tracks of the first image which are continued in the
+///             second image.
+///
+/// Only the tracks whose column in the first image lies inside the given
+/// range are considered.
+///
+/// \param[in]  TrackIDsFirst         List containing the IDs of the tracks in the first image.
+/// \param[in]  TrackImagePointsFirst List containing the image coordinates of the tracks in the first image.
+/// \param[in]  TrackIDsSecond        List containing the IDs of the tracks in the second image.
+/// \param[in]  MinimumColumn         Minimum column of the considered tracks in the first image.
+/// \param[in]  MaximumColumn         Maximum column of the considered tracks in the first image.
+/// \param[out] NumberOfTracks        Number of considered tracks.
+///
+/// \return     Number of considered tracks which are continued in the second image.
+///////////////////////////////////////////////////////////////////////////////
+uint64 CountContinuedTracks(const ListUInt64&                 TrackIDsFirst,
+                            const ListColumnVectorFloat64_2d& TrackImagePointsFirst,
+                            const ListUInt64&                 TrackIDsSecond,
+                            const float64                     MinimumColumn,
+                            const float64                     MaximumColumn,
+                            uint64&                           NumberOfTracks)
+{
+    uint64 NumberOfContinuedTracks{0U};
+
+    NumberOfTracks = 0U;
+
+    for(uint64 i_Track{0U}; i_Track < TrackIDsFirst.size(); i_Track++)
+    {
+        if((TrackImagePointsFirst[i_Track](0) < MinimumColumn) || (TrackImagePointsFirst[i_Track](0) > MaximumColumn))
+        {
+            continue;
+        }
+
+        NumberOfTracks++;
+
+        if(std::find(TrackIDsSecond.begin(), TrackIDsSecond.end(), TrackIDsFirst[i_Track]) != TrackIDsSecond.end())
+        {
+            NumberOfContinuedTracks++;
+        }
+    }
+
+    return NumberOfContinuedTracks;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the rejection of tracks in an occluded region.
+///
+/// Tests whether wrong forward tracks are rejected by the forward-backward
+/// check or not. The right half of the second image is occluded by a
+/// different texture, hence the forward tracking converges to wrong positions
+/// for the tracks in this half. The expectation is that these tracks are kept
+/// without the forward-backward check and that they are terminated by the
+/// forward-backward check, while the tracks in the left half are kept in both
+/// cases.
+///////////////////////////////////////////////////////////////////////////////
+TEST_TRACKS_OCCLUDEDREGION_ISREJECTED(OpticalFlowTracker, Test_Tracks_OccludedRegion_IsRejected)
+{
+    const cv::Mat ImageFirst{CreateBlurredRectangleImage(640, 480, 14U)};
+    const cv::Mat ImageOccluder{CreateBlurredRectangleImage(640, 480, 15U)};
+
+    cv::Mat ImageSecond{ImageFirst.clone()};
+
+    ImageOccluder(cv::Rect(320, 0, 320, 480)).copyTo(ImageSecond(cv::Rect(320, 0, 320, 480)));
+
+    const FeatureBucketerByOrder Bucketer(640U, 480U, 4U, 3U, 10U);
+
+    for(const boolean UseForwardBackwardCheck : {false, true})
+    {
+        OpticalFlowTracker Tracker(Bucketer, 1U, 3U, 21U, UseForwardBackwardCheck);
+
+        Tracker.ProcessImages({ImageFirst});
+
+        const ListUInt64                 TrackIDsFirst{Tracker.GetTrackIDs(0U)};
+        const ListColumnVectorFloat64_2d TrackImagePointsFirst{Tracker.GetTrackImagePoints(0U)};
+
+        Tracker.ProcessImages({ImageSecond});
+
+        // tracks in the left half (the search window does not reach the occluded region)
+        uint64       NumberOfTracksLeft{0U};
+        const uint64 NumberOfContinuedTracksLeft{CountContinuedTracks(TrackIDsFirst, TrackImagePointsFirst, Tracker.GetTrackIDs(0U), 0.0, 250.0, NumberOfTracksLeft)};
+
+        ASSERT_GT(NumberOfTracksLeft, 0U);
+        ASSERT_GE(10U * NumberOfContinuedTracksLeft, 9U * NumberOfTracksLeft);
+
+        // tracks in the right half (the search window lies completely in the occluded region)
+        uint64       NumberOfTracksRight{0U};
+        const uint64 NumberOfContinuedTracksRight{CountContinuedTracks(TrackIDsFirst, TrackImagePointsFirst, Tracker.GetTrackIDs(0U), 340.0, 640.0, NumberOfTracksRight)};
+
+        ASSERT_GT(NumberOfTracksRight, 0U);
+
+        // the wrong tracks are only terminated by the forward-backward check
+        if(UseForwardBackwardCheck)
+        {
+            ASSERT_LE(10U * NumberOfContinuedTracksRight, NumberOfTracksRight);
+        }
+        else
+        {
+            ASSERT_GE(2U * NumberOfContinuedTracksRight, NumberOfTracksRight);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for the distance between tracks of neighboring buckets.
+///
+/// Tests whether the minimum distance between the tracks is kept across the
+/// borders of the buckets or not. The buckets are only a few times larger
+/// than the minimum distance. The expectation is that no two tracks are
+/// closer to each other than the minimum distance, neither after the
+/// detection nor after the replenishment.
+///////////////////////////////////////////////////////////////////////////////
+TEST_TRACKS_SMALLBUCKETS_ISKEEPINGDISTANCE(OpticalFlowTracker, Test_Tracks_SmallBuckets_IsKeepingDistance)
+{
+    const cv::Mat Canvas{CreateBlurredRectangleImage(800, 600, 16U)};
+
+    const float64 MinimumDistance{10.0};
+
+    // buckets of 40x40 pixels
+    const FeatureBucketerByOrder Bucketer(640U, 480U, 16U, 12U, 10U);
+
+    OpticalFlowTracker Tracker(Bucketer, 1U, 3U, 21U, true, 1.0, MinimumDistance);
+
+    for(sint32 i_Image{0}; i_Image < 3; i_Image++)
+    {
+        Tracker.ProcessImages({Canvas(cv::Rect(80 + 3 * i_Image, 60 + 2 * i_Image, 640, 480)).clone()});
+
+        const ListColumnVectorFloat64_2d& TrackImagePoints{Tracker.GetTrackImagePoints(0U)};
+
+        ASSERT_GT(TrackImagePoints.size(), 0U);
+
+        // tracks which are continued may move closer to each other, only new tracks need to keep the distance
+        const ListUInt64& TrackAges{Tracker.GetTrackAges(0U)};
+
+        for(uint64 i_TrackFirst{0U}; i_TrackFirst < TrackImagePoints.size(); i_TrackFirst++)
+        {
+            for(uint64 i_TrackSecond{i_TrackFirst + 1U}; i_TrackSecond < TrackImagePoints.size(); i_TrackSecond++)
+            {
+                if((TrackAges[i_TrackFirst] > 1U) && (TrackAges[i_TrackSecond] > 1U))
+                {
+                    continue;
+                }
+
+                ASSERT_GE((TrackImagePoints[i_TrackFirst] - TrackImagePoints[i_TrackSecond]).norm(), MinimumDistance);
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Test for images which do not match the feature bucketer.
+///
+/// Tests whether images whose size differs from the size of the feature
+/// bucketer are rejected or not. The expectation is to get an exception and
+/// that the tracks of all image streams are kept.
+///////////////////////////////////////////////////////////////////////////////
+TEST_TRACKS_WRONGIMAGESIZE_ISTHROWING(OpticalFlowTracker, Test_Tracks_WrongImageSize_IsThrowing)
+{
+    const cv::Mat Image{CreateBlurredRectangleImage(640, 480, 17U)};
+
+    const FeatureBucketerByOrder Bucketer(640U, 480U, 4U, 3U, 10U);
+
+    OpticalFlowTracker Tracker(Bucketer, 2U);
+
+    Tracker.ProcessImages({Image, Image});
+
+    const ListUInt64 TrackIDs{Tracker.GetTrackIDs(0U)};
+
+    ASSERT_GT(TrackIDs.size(), 0U);
+
+    const std::vector<cv::Mat> ImagesCropped{Image, Image(cv::Rect(0, 0, 320, 240)).clone()};
+    const std::vector<cv::Mat> ImagesTransposed{Image.t(), Image};
+
+    ASSERT_THROW(Tracker.ProcessImages(ImagesCropped), std::invalid_argument);
+    ASSERT_THROW(Tracker.ProcessImages(ImagesTransposed), std::invalid_argument);
+
+    ASSERT_EQ(Tracker.GetTrackIDs(0U), TrackIDs);
+    ASSERT_EQ(Tracker.GetTrackIDs(1U), TrackIDs);
+}